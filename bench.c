@@ -0,0 +1,718 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include "xurl.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <x86intrin.h>
+#define HAVE_CYCLES 1
+#else
+#define HAVE_CYCLES 0
+#endif
+
+// Number of times each benchmark is repeated. The
+// median and 99th percentile are taken over these.
+#define RUNS 101
+
+// Minimum number of URLs parsed by a single run, so
+// that runs on small inputs are long enough to time.
+#define MIN_URLS_PER_RUN 20000
+
+typedef struct {
+    const char **srcs;
+    size_t      *lens;
+    size_t       count;
+    size_t       bytes;
+    xurl_t      *outs; // Scratch space for the batch parser
+    bool        *oks;
+    xurl_columns *columns; // Output of the columnar parser
+    xurl_hostset *hostset; // Rules for the host matcher
+    xurl_cidr_set *cidr;   // Rules for the address matcher
+    uint32_t *ipv4s;       // Parsed addresses, for the formatters
+    uint16_t (*ipv6s)[8];
+    struct in_addr  *in4s; // The same in network byte order, for inet_ntop
+    struct in6_addr *in6s;
+} input_t;
+
+typedef size_t (*pass_fn)(const input_t *input);
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Time stamp counter, which on modern x86 CPUs ticks
+// at the nominal frequency and not the current one.
+static unsigned long long cycles(void)
+{
+#if HAVE_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double*) a;
+    double y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+static void print_header(void)
+{
+    fprintf(stdout, "%-28s %9s %9s %10s %12s %7s\n",
+            "benchmark", "median", "p99", "bytes/cyc", "URLs/sec", "ok");
+    fprintf(stdout, "%-28s %9s %9s %10s %12s %7s\n",
+            "", "ns/URL", "ns/URL", "", "", "");
+}
+
+/* Symbol: run
+ *   Call [pass] on [input] RUNS times (more per run
+ *   if the input is small) and report the median and
+ *   99th percentile of the time per URL.
+ */
+static void run(const char *name, pass_fn pass, const input_t *input)
+{
+    if (input->count == 0) {
+        fprintf(stdout, "%-28s (no input)\n", name);
+        return;
+    }
+
+    size_t reps = (MIN_URLS_PER_RUN + input->count - 1) / input->count;
+    double ns_per_url[RUNS];
+    double bytes_per_cycle[RUNS];
+    size_t ok = pass(input); // Warm-up
+
+    for (size_t r = 0; r < RUNS; r++) {
+        double start = now();
+        unsigned long long start_cycles = cycles();
+        for (size_t i = 0; i < reps; i++)
+            ok = pass(input);
+        unsigned long long elapsed_cycles = cycles() - start_cycles;
+        double elapsed = now() - start;
+
+        ns_per_url[r] = elapsed * 1e9 / (reps * input->count);
+        bytes_per_cycle[r] = elapsed_cycles ? (double) reps * input->bytes / elapsed_cycles : 0;
+    }
+
+    qsort(ns_per_url, RUNS, sizeof(double), compare_doubles);
+    qsort(bytes_per_cycle, RUNS, sizeof(double), compare_doubles);
+
+    double median = ns_per_url[RUNS / 2];
+    double p99 = ns_per_url[RUNS * 99 / 100];
+    if (HAVE_CYCLES)
+        fprintf(stdout, "%-28s %9.2f %9.2f %10.3f %12.0f %7zu\n",
+                name, median, p99, bytes_per_cycle[RUNS / 2], 1e9 / median, ok);
+    else
+        fprintf(stdout, "%-28s %9.2f %9.2f %10s %12.0f %7zu\n",
+                name, median, p99, "-", 1e9 / median, ok);
+}
+
+static size_t pass_parse(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        xurl_t url;
+        ok += xurl_parse(input->srcs[i], input->lens[i], &url);
+    }
+    return ok;
+}
+
+static size_t pass_parse_compact(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        xurl_compact_t url;
+        ok += xurl_parse_compact(input->srcs[i], input->lens[i], &url);
+    }
+    return ok;
+}
+
+static size_t pass_parse_into(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++)
+        ok += xurl_parse(input->srcs[i], input->lens[i], &input->outs[i]);
+    return ok;
+}
+
+static size_t pass_parse_batch(const input_t *input)
+{
+    return xurl_parse_batch(input->srcs, input->lens, input->count, input->outs, input->oks);
+}
+
+static size_t pass_parse_columns(const input_t *input)
+{
+    return xurl_parse_columns(input->srcs, input->lens, input->count, input->columns);
+}
+
+static size_t pass_registrable_domain(const input_t *input)
+{
+    // Hosts of the URLs already parsed by the batch parser
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        const char *domain;
+        size_t domain_len;
+        ok += input->oks[i] && xurl_registrable_domain(&input->outs[i].host, &domain, &domain_len);
+    }
+    return ok;
+}
+
+static size_t pass_hostset_match(const input_t *input)
+{
+    // Hosts of the URLs already parsed by the batch parser
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        uint32_t id;
+        ok += input->oks[i] && xurl_hostset_match(input->hostset, &input->outs[i].host, &id);
+    }
+    return ok;
+}
+
+static size_t pass_host_to_ascii(const input_t *input)
+{
+    // Hosts of the URLs already parsed by the batch parser
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        char buffer[256];
+        const char *out;
+        size_t out_len;
+        ok += input->oks[i] && xurl_host_to_ascii(&input->outs[i].host, buffer, sizeof(buffer), &out, &out_len);
+    }
+    return ok;
+}
+
+/* Build a host set with [count] rules. About half
+ * of the distinct host names of [input] are added
+ * as exact rules, and the rest are made up (half of
+ * them as suffix rules).
+ */
+static void *build_hostset(const input_t *input, size_t count, xurl_hostset *set)
+{
+    const char **rules = malloc(count * sizeof(char*));
+    size_t *lens = malloc(count * sizeof(size_t));
+    char *text = malloc(count * 32);
+    if (!rules || !lens || !text)
+        return NULL;
+
+    size_t n = 0;
+    size_t used = 0;
+    for (size_t i = 0; i < input->count && n < count / 2; i++) {
+        const xurl_host *host = &input->outs[i].host;
+        if (!input->oks[i] || host->mode != XURL_HOSTMODE_NAME || host->name == NULL || host->name_len > 32)
+            continue;
+        unsigned sum = 0;
+        for (size_t k = 0; k < host->name_len; k++)
+            sum += (unsigned char) host->name[k];
+        if (sum & 1)
+            continue;
+        rules[n] = host->name;
+        lens[n] = host->name_len;
+        n++;
+    }
+    for (uint32_t state = 1; n < count; n++) {
+        state = state * 1103515245 + 12345;
+        int len = snprintf(text + used, 32, "%s%x.blocked%zu.example",
+                           (state >> 8) & 1 ? "*." : "", state, n % 1000);
+        rules[n] = text + used;
+        lens[n] = len;
+        used += len;
+    }
+
+    size_t size = xurl_hostset_size(rules, lens, n);
+    void *image = malloc(size);
+    if (image == NULL || !xurl_hostset_build(rules, lens, NULL, n, image, size)
+        || !xurl_hostset_load(image, size, set)) {
+        free(image);
+        image = NULL;
+    }
+    free(rules);
+    free(lens);
+    free(text);
+    return image;
+}
+
+static size_t pass_parse_ipv4(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        uint32_t ipv4;
+        ok += xurl_parse_ipv4(input->srcs[i], input->lens[i], &ipv4);
+    }
+    return ok;
+}
+
+static size_t pass_inet_pton4(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        struct in_addr ipv4;
+        ok += (inet_pton(AF_INET, input->srcs[i], &ipv4) == 1);
+    }
+    return ok;
+}
+
+static size_t pass_parse_ipv6(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        uint16_t ipv6[8];
+        ok += xurl_parse_ipv6(input->srcs[i], input->lens[i], ipv6);
+    }
+    return ok;
+}
+
+static size_t pass_inet_pton6(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        struct in6_addr ipv6;
+        ok += (inet_pton(AF_INET6, input->srcs[i], &ipv6) == 1);
+    }
+    return ok;
+}
+
+static size_t pass_cidr_match4(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        xurl_host host = {.mode = XURL_HOSTMODE_IPV4};
+        uint32_t id;
+        ok += xurl_parse_ipv4(input->srcs[i], input->lens[i], &host.ipv4)
+           && xurl_cidr_match(input->cidr, &host, &id);
+    }
+    return ok;
+}
+
+static size_t pass_classify_ip4(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        xurl_host host = {.mode = XURL_HOSTMODE_IPV4};
+        ok += xurl_parse_ipv4(input->srcs[i], input->lens[i], &host.ipv4)
+           && xurl_classify_ip(&host) == XURL_IP_GLOBAL;
+    }
+    return ok;
+}
+
+static size_t pass_cidr_match6(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        xurl_host host = {.mode = XURL_HOSTMODE_IPV6};
+        uint32_t id;
+        ok += xurl_parse_ipv6(input->srcs[i], input->lens[i], host.ipv6)
+           && xurl_cidr_match(input->cidr, &host, &id);
+    }
+    return ok;
+}
+
+static size_t pass_format_ipv4(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        char buffer[INET_ADDRSTRLEN];
+        ok += xurl_format_ipv4(input->ipv4s[i], buffer, sizeof(buffer)) > 0;
+    }
+    return ok;
+}
+
+static size_t pass_inet_ntop4(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        char buffer[INET_ADDRSTRLEN];
+        ok += inet_ntop(AF_INET, &input->in4s[i], buffer, sizeof(buffer)) != NULL;
+    }
+    return ok;
+}
+
+static size_t pass_format_ipv6(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        char buffer[INET6_ADDRSTRLEN];
+        ok += xurl_format_ipv6(input->ipv6s[i], buffer, sizeof(buffer)) > 0;
+    }
+    return ok;
+}
+
+static size_t pass_inet_ntop6(const input_t *input)
+{
+    size_t ok = 0;
+    for (size_t i = 0; i < input->count; i++) {
+        char buffer[INET6_ADDRSTRLEN];
+        ok += inet_ntop(AF_INET6, &input->in6s[i], buffer, sizeof(buffer)) != NULL;
+    }
+    return ok;
+}
+
+/* Parse the hosts of [ipv4] and [ipv6] into the
+ * binary forms used by the formatters.
+ */
+static bool parse_addresses(input_t *ipv4, input_t *ipv6)
+{
+    ipv4->ipv4s = calloc(ipv4->count + 1, sizeof(uint32_t));
+    ipv4->in4s = calloc(ipv4->count + 1, sizeof(struct in_addr));
+    ipv6->ipv6s = calloc(ipv6->count + 1, sizeof(uint16_t[8]));
+    ipv6->in6s = calloc(ipv6->count + 1, sizeof(struct in6_addr));
+    if (!ipv4->ipv4s || !ipv4->in4s || !ipv6->ipv6s || !ipv6->in6s)
+        return false;
+
+    for (size_t i = 0; i < ipv4->count; i++) {
+        xurl_parse_ipv4(ipv4->srcs[i], ipv4->lens[i], &ipv4->ipv4s[i]);
+        ipv4->in4s[i].s_addr = htonl(ipv4->ipv4s[i]);
+    }
+    for (size_t i = 0; i < ipv6->count; i++) {
+        xurl_parse_ipv6(ipv6->srcs[i], ipv6->lens[i], ipv6->ipv6s[i]);
+        for (int p = 0; p < 8; p++) {
+            ipv6->in6s[i].s6_addr[2*p+0] = ipv6->ipv6s[i][p] >> 8;
+            ipv6->in6s[i].s6_addr[2*p+1] = ipv6->ipv6s[i][p] & 0xFF;
+        }
+    }
+    return true;
+}
+
+/* Build a CIDR set with [count] random prefixes,
+ * half IPv4 and half IPv6, plus the special-purpose
+ * ranges of the classifier.
+ */
+static xurl_cidr_node *build_cidr(size_t count, xurl_cidr_set *set)
+{
+    static const char *special[] = {
+        "0.0.0.0/8", "10.0.0.0/8", "100.64.0.0/10", "127.0.0.0/8",
+        "169.254.0.0/16", "172.16.0.0/12", "192.168.0.0/16",
+        "::1", "fc00::/7", "fe80::/10",
+    };
+    size_t num_special = sizeof(special)/sizeof(special[0]);
+    size_t max_nodes = 2 * (count + num_special) + 1;
+    xurl_cidr_node *nodes = malloc(max_nodes * sizeof(xurl_cidr_node));
+    if (nodes == NULL || !xurl_cidr_init(set, nodes, max_nodes))
+        return NULL;
+
+    for (size_t i = 0; i < num_special; i++)
+        xurl_cidr_add(set, special[i], strlen(special[i]), i);
+
+    srand(4);
+    for (size_t i = 0; i < count; i++) {
+        char buf[64];
+        int len;
+        if (i & 1) {
+            int bits = 8 + rand() % 25;
+            uint32_t addr = ((uint32_t) rand() << 16 ^ (uint32_t) rand()) & (~0u << (32 - bits));
+            len = snprintf(buf, sizeof(buf), "%u.%u.%u.%u/%d", addr >> 24,
+                           (addr >> 16) & 255, (addr >> 8) & 255, addr & 255, bits);
+        } else
+            len = snprintf(buf, sizeof(buf), "2%03x:%x::/32", rand() & 0xFFF, rand() & 0xFFFF);
+        xurl_cidr_add(set, buf, len, num_special + i);
+    }
+    return nodes;
+}
+
+/* Symbol: load_corpus
+ *   Read the URLs of [path], one per line, into
+ *   a single buffer.
+ */
+static bool load_corpus(const char *path, char **data, input_t *input)
+{
+    FILE *stream = fopen(path, "rb");
+    if (stream == NULL)
+        return false;
+
+    fseek(stream, 0, SEEK_END);
+    long size = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+
+    *data = malloc(size + 1);
+    if (*data == NULL || fread(*data, 1, size, stream) != (size_t) size) {
+        fclose(stream);
+        return false;
+    }
+    fclose(stream);
+    (*data)[size] = '\n';
+
+    size_t lines = 0;
+    for (long k = 0; k < size; k++)
+        lines += ((*data)[k] == '\n');
+    lines++;
+
+    input->srcs = malloc(lines * sizeof(char*));
+    input->lens = malloc(lines * sizeof(size_t));
+    if (input->srcs == NULL || input->lens == NULL)
+        return false;
+
+    input->count = 0;
+    input->bytes = 0;
+    char *line = *data;
+    char *end = *data + size;
+    while (line < end) {
+        char *newline = memchr(line, '\n', end - line + 1);
+        size_t len = newline - line;
+        if (len > 0 && line[len-1] == '\r')
+            len--;
+        if (len > 0) {
+            input->srcs[input->count] = line;
+            input->lens[input->count] = len;
+            input->count++;
+            input->bytes += len;
+        }
+        line = newline + 1;
+    }
+    return true;
+}
+
+/* Symbol: extract_hosts
+ *   Collect the text of the IP addresses used as
+ *   host by the URLs of [corpus], without brackets.
+ *   They are copied into [arena] and zero-terminated,
+ *   so that they can be passed to inet_pton.
+ */
+static bool extract_hosts(const input_t *corpus, input_t *ipv4, input_t *ipv6, char **arena)
+{
+    size_t arena_used = 0;
+    *arena = malloc(corpus->bytes + corpus->count);
+    if (*arena == NULL)
+        return false;
+
+    ipv4->srcs = malloc(corpus->count * sizeof(char*));
+    ipv4->lens = malloc(corpus->count * sizeof(size_t));
+    ipv6->srcs = malloc(corpus->count * sizeof(char*));
+    ipv6->lens = malloc(corpus->count * sizeof(size_t));
+    if (!ipv4->srcs || !ipv4->lens || !ipv6->srcs || !ipv6->lens)
+        return false;
+
+    for (size_t i = 0; i < corpus->count; i++) {
+
+        const char *src = corpus->srcs[i];
+        size_t len = corpus->lens[i];
+
+        xurl_t url;
+        if (!xurl_parse(src, len, &url) || url.host.mode == XURL_HOSTMODE_NAME)
+            continue;
+
+        // Skip the schema and userinfo. URLs with an
+        // IP host always have an authority.
+        const char *start = src;
+        const char *end = src + len;
+        while (start[0] != '/' || start[1] != '/')
+            start++;
+        start += 2;
+        const char *at = memchr(start, '@', end - start);
+        const char *slash = memchr(start, '/', end - start);
+        if (at && (!slash || at < slash))
+            start = at + 1;
+
+        input_t *list;
+        if (url.host.mode == XURL_HOSTMODE_IPV6) {
+            start++;
+            end = memchr(start, ']', end - start);
+            list = ipv6;
+        } else {
+            const char *k = start;
+            while (k < end && *k != ':' && *k != '/' && *k != '?' && *k != '#')
+                k++;
+            end = k;
+            list = ipv4;
+        }
+
+        char *copy = *arena + arena_used;
+        memcpy(copy, start, end - start);
+        copy[end - start] = '\0';
+        arena_used += end - start + 1;
+
+        list->srcs[list->count] = copy;
+        list->lens[list->count] = end - start;
+        list->count++;
+        list->bytes += end - start;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "bench_corpus.txt";
+
+    char *data;
+    input_t corpus = {0};
+    if (!load_corpus(path, &data, &corpus)) {
+        fprintf(stderr, "Couldn't load corpus %s\n", path);
+        return -1;
+    }
+
+    input_t ipv4 = {0};
+    input_t ipv6 = {0};
+    char *hosts_arena;
+    if (!extract_hosts(&corpus, &ipv4, &ipv6, &hosts_arena)) {
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+
+    if (!parse_addresses(&ipv4, &ipv6)) {
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+
+    fprintf(stdout, "%s: %zu URLs (%zu bytes), %zu IPv4 and %zu IPv6 hosts, %d runs\n\n",
+            path, corpus.count, corpus.bytes, ipv4.count, ipv6.count, RUNS);
+    print_header();
+
+    static const char *levels[] = {
+        [XURL_SIMD_NONE] = "scalar",
+        [XURL_SIMD_SSE2] = "sse2",
+        [XURL_SIMD_AVX2] = "avx2",
+    };
+
+    xurl_simd best = xurl_get_simd();
+    for (xurl_simd level = XURL_SIMD_NONE; level <= best; level++) {
+        char name[64];
+        snprintf(name, sizeof(name), "xurl_parse (%s)", levels[level]);
+        xurl_set_simd(level);
+        run(name, pass_parse, &corpus);
+    }
+    xurl_set_simd(best);
+
+    run("xurl_parse_compact", pass_parse_compact, &corpus);
+
+    fprintf(stdout, "\n");
+    for (xurl_simd level = XURL_SIMD_NONE; level <= best; level++) {
+        char name[64];
+        snprintf(name, sizeof(name), "xurl_parse_ipv4 (%s)", levels[level]);
+        xurl_set_simd(level);
+        run(name, pass_parse_ipv4, &ipv4);
+    }
+    xurl_set_simd(best);
+    run("inet_pton (AF_INET)", pass_inet_pton4, &ipv4);
+
+    fprintf(stdout, "\n");
+    run("xurl_parse_ipv6", pass_parse_ipv6, &ipv6);
+    run("inet_pton (AF_INET6)", pass_inet_pton6, &ipv6);
+
+    fprintf(stdout, "\n");
+    run("xurl_format_ipv4", pass_format_ipv4, &ipv4);
+    run("inet_ntop (AF_INET)", pass_inet_ntop4, &ipv4);
+    run("xurl_format_ipv6", pass_format_ipv6, &ipv6);
+    run("inet_ntop (AF_INET6)", pass_inet_ntop6, &ipv6);
+
+    xurl_cidr_set cidr;
+    xurl_cidr_node *cidr_nodes = build_cidr(10000, &cidr);
+    if (cidr_nodes == NULL) {
+        fprintf(stderr, "Couldn't build the CIDR set\n");
+        return -1;
+    }
+    ipv4.cidr = &cidr;
+    ipv6.cidr = &cidr;
+    // The address matchers include the time
+    // to parse the address.
+    fprintf(stdout, "\n");
+    run("xurl_cidr_match (IPv4)", pass_cidr_match4, &ipv4);
+    run("xurl_classify_ip (IPv4)", pass_classify_ip4, &ipv4);
+    run("xurl_cidr_match (IPv6)", pass_cidr_match6, &ipv6);
+
+    // Compare a loop of [xurl_parse] with [xurl_parse_batch]
+    // on a large set of URLs copied into a single arena,
+    // which is too big to stay in cache.
+    input_t large;
+    large.count = 1 << 16;
+    large.bytes = 0;
+    large.srcs = malloc(large.count * sizeof(char*));
+    large.lens = malloc(large.count * sizeof(size_t));
+    large.outs = malloc(large.count * sizeof(xurl_t));
+    large.oks  = malloc(large.count * sizeof(bool));
+    size_t arena_size = 0;
+    for (size_t i = 0; i < large.count; i++)
+        arena_size += corpus.lens[(i * 7919) % corpus.count];
+    char *arena = malloc(arena_size);
+    if (!large.srcs || !large.lens || !large.outs || !large.oks || !arena) {
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+    size_t arena_used = 0;
+    for (size_t i = 0; i < large.count; i++) {
+        size_t k = (i * 7919) % corpus.count;
+        size_t len = corpus.lens[k];
+        memcpy(arena + arena_used, corpus.srcs[k], len);
+        large.srcs[i] = arena + arena_used;
+        large.lens[i] = len;
+        large.bytes += len;
+        arena_used += len;
+    }
+
+    // Columnar output, with all the columns. After the
+    // first run, all hosts are already interned.
+    xurl_schema_dict schemas;
+    xurl_intern hosts;
+    xurl_columns columns = {0};
+    xurl_intern_entry *entries = malloc(large.count * sizeof(xurl_intern_entry));
+    uint32_t *slots = malloc(2 * large.count * sizeof(uint32_t));
+    uint32_t *column_data = malloc(2 * XURL_COMPONENT_COUNT * large.count * sizeof(uint32_t));
+    uint32_t *host_ids = malloc(large.count * sizeof(uint32_t));
+    uint16_t *ports = malloc(large.count * sizeof(uint16_t));
+    uint8_t  *present = malloc(large.count);
+    uint8_t  *schema_ids = malloc(large.count);
+    if (!entries || !slots || !column_data || !host_ids || !ports || !present || !schema_ids) {
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+    xurl_schema_dict_init(&schemas);
+    xurl_intern_init(&hosts, entries, large.count, slots, 2 * large.count);
+    for (int c = 0; c < XURL_COMPONENT_COUNT; c++) {
+        columns.offset[c] = column_data + (2 * c + 0) * large.count;
+        columns.length[c] = column_data + (2 * c + 1) * large.count;
+    }
+    columns.present = present;
+    columns.port = ports;
+    columns.schema_id = schema_ids;
+    columns.host_id = host_ids;
+    columns.schemas = &schemas;
+    columns.hosts = &hosts;
+    large.columns = &columns;
+
+    fprintf(stdout, "\n");
+    run("xurl_parse loop (64K)", pass_parse_into, &large);
+    run("xurl_parse_batch (64K)", pass_parse_batch, &large);
+    run("xurl_parse_columns (64K)", pass_parse_columns, &large);
+    run("xurl_registrable_domain (64K)", pass_registrable_domain, &large);
+    run("xurl_host_to_ascii (64K)", pass_host_to_ascii, &large);
+
+    xurl_hostset hostset;
+    void *hostset_image = build_hostset(&large, 500000, &hostset);
+    if (hostset_image == NULL) {
+        fprintf(stderr, "Couldn't build the host set\n");
+        return -1;
+    }
+    large.hostset = &hostset;
+    run("xurl_hostset_match (64K)", pass_hostset_match, &large);
+
+    free(data);
+    free(corpus.srcs);
+    free(corpus.lens);
+    free(hosts_arena);
+    free(ipv4.srcs);
+    free(ipv4.lens);
+    free(ipv6.srcs);
+    free(ipv6.lens);
+    free(ipv4.ipv4s);
+    free(ipv4.in4s);
+    free(ipv6.ipv6s);
+    free(ipv6.in6s);
+    free(large.srcs);
+    free(large.lens);
+    free(large.outs);
+    free(large.oks);
+    free(arena);
+    free(entries);
+    free(slots);
+    free(column_data);
+    free(host_ids);
+    free(ports);
+    free(present);
+    free(schema_ids);
+    free(hostset_image);
+    free(cidr_nodes);
+    return 0;
+}
@@ -1,4 +1,3 @@
-#include <arpa/inet.h>
 #include <string.h>
 #include <stdio.h>
 #include "xurl.h"
@@ -15,7 +14,7 @@ int main(int argc, char **argv)
         printf("USERNAME\t%s\n", result.userinfo.username != NULL ? result.userinfo.username : "---");
         printf("PASSWORD\t%s\n", result.userinfo.password != NULL ? result.userinfo.password : "---");
 
-        char buffer[32];
+        char buffer[XURL_IPV6_TEXT_MAX + 1];
         switch (result.host.mode) {
             
             case XURL_HOSTMODE_NAME: 
@@ -23,13 +22,16 @@ int main(int argc, char **argv)
             break;
             
             case XURL_HOSTMODE_IPV4: 
-            inet_ntop(AF_INET, &result.host.ipv4, buffer, sizeof(buffer));
+            xurl_format_ipv4(result.host.ipv4, buffer, sizeof(buffer));
             printf("HOST (IPV4)\t%s\n", buffer); 
             break;
             
             case XURL_HOSTMODE_IPV6: 
-            inet_ntop(AF_INET6, &result.host.ipv6, buffer, sizeof(buffer));
-            printf("HOST (IPV6)\t%s\n", buffer); 
+            xurl_format_ipv6(result.host.ipv6, buffer, sizeof(buffer));
+            if (result.host.zone != NULL)
+                printf("HOST (IPV6)\t%s%%%s\n", buffer, result.host.zone);
+            else
+                printf("HOST (IPV6)\t%s\n", buffer); 
             break;
         }
         if (result.host.no_port) 
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# Compiles the Public Suffix List (https://publicsuffix.org/list/)
+# into the reversed-label trie used by xurl_registrable_domain.
+#
+#   python3 gen_suffixes.py public_suffix_list.dat > xurl_suffixes.h
+#
+# Each node of the trie is a label. The children of a node are
+# stored next to each other and sorted, so they can be binary
+# searched, and the trie is laid out breadth-first so that the
+# top-level domains, which are visited by every lookup, are at
+# the start of the table. Labels are stored once in a string
+# pool, and their first 4 bytes are also packed big-endian in
+# the node, so that most comparisons of the binary search don't
+# touch the pool. Internationalized labels are converted to
+# Punycode, since that's the form they have in URLs.
+
+import sys
+
+SUFFIX_RULE      = 1 # The labels up to this node are a public suffix
+SUFFIX_WILDCARD  = 2 # Any child of this node is a public suffix
+SUFFIX_EXCEPTION = 4 # The labels up to this node are not a public suffix
+
+def to_ascii(label):
+    if label.isascii():
+        return label.lower()
+    return 'xn--' + label.encode('punycode').decode('ascii')
+
+def load_rules(path):
+    rules = []
+    version = None
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith('// VERSION:'):
+                version = line[len('// VERSION:'):].strip()
+            if not line or line.startswith('//'):
+                continue
+            rules.append(line.split()[0])
+    return rules, version
+
+class Node:
+    def __init__(self, label):
+        self.label = label
+        self.flags = 0
+        self.children = {}
+
+def build_trie(rules):
+    root = Node('')
+    for rule in rules:
+        flag = SUFFIX_RULE
+        if rule.startswith('!'):
+            flag = SUFFIX_EXCEPTION
+            rule = rule[1:]
+        labels = [to_ascii(l) for l in rule.split('.')][::-1]
+        if labels[-1] == '*':
+            # Wildcards only appear as the leftmost label
+            labels.pop()
+            flag = SUFFIX_WILDCARD
+        node = root
+        for label in labels:
+            node = node.children.setdefault(label, Node(label))
+        node.flags |= flag
+    return root
+
+def build_pool(labels):
+    # Longer labels go first so that shorter ones can
+    # often be found inside them.
+    pool = ''
+    offsets = {}
+    for label in sorted(labels, key=lambda l: (-len(l), l)):
+        k = pool.find(label)
+        if k < 0:
+            k = len(pool)
+            pool += label
+        offsets[label] = k
+    return pool, offsets
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write('Usage: %s <public_suffix_list.dat>\n' % sys.argv[0])
+        sys.exit(1)
+
+    rules, version = load_rules(sys.argv[1])
+    root = build_trie(rules)
+
+    # Breadth-first layout
+    order = [root]
+    first_child = {}
+    k = 0
+    while k < len(order):
+        node = order[k]
+        first_child[id(node)] = len(order)
+        order.extend(node.children[l] for l in sorted(node.children))
+        k += 1
+
+    pool, offsets = build_pool(set(n.label for n in order[1:]))
+    assert len(order) < 65536 and len(pool) < 65536
+
+    out = sys.stdout
+    out.write('// Generated by gen_suffixes.py from the Public Suffix List\n')
+    if version:
+        out.write('// (version %s). Don\'t edit by hand.\n' % version)
+    else:
+        out.write('// Don\'t edit by hand.\n')
+    out.write('\n')
+
+    out.write('static const char suffix_labels[] =\n')
+    for i in range(0, len(pool), 64):
+        out.write('    "%s"\n' % pool[i:i+64])
+    out.write('    ;\n\n')
+
+    out.write('static const suffix_node suffix_nodes[] = {\n')
+    for node in order:
+        key = int.from_bytes(node.label[:4].encode('ascii').ljust(4, b'\0'), 'big')
+        out.write('    {0x%08x, %d, %d, %d, %d, %d},\n' % (key,
+            offsets.get(node.label, 0), len(node.label), node.flags,
+            first_child[id(node)], len(node.children)))
+    out.write('};\n')
+
+if __name__ == '__main__':
+    main()
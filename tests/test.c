@@ -7,6 +7,23 @@ int main(void) {
     test_ipv4(&total, &passed);
     test_ipv6(&total, &passed);
     test_url(&total, &passed);
+    test_simd(&total, &passed);
+    test_stream(&total, &passed);
+    test_decode(&total, &passed);
+    test_query(&total, &passed);
+    test_path(&total, &passed);
+    test_canonical(&total, &passed);
+    test_resolve(&total, &passed);
+    test_format(&total, &passed);
+    test_hash(&total, &passed);
+    test_compact(&total, &passed);
+    test_columns(&total, &passed);
+    test_target(&total, &passed);
+    test_parts(&total, &passed);
+    test_suffix(&total, &passed);
+    test_hostset(&total, &passed);
+    test_cidr(&total, &passed);
+    test_idna(&total, &passed);
     fprintf(stdout, "Passed %ld out of %ld tests\n", passed, total);
     return 0;
 }
\ No newline at end of file
@@ -11,3 +11,20 @@
 int test_ipv4(size_t*, size_t*);
 int test_ipv6(size_t*, size_t*);
 int test_url(size_t*, size_t*);
+int test_simd(size_t*, size_t*);
+int test_stream(size_t*, size_t*);
+int test_decode(size_t*, size_t*);
+int test_query(size_t*, size_t*);
+int test_path(size_t*, size_t*);
+int test_canonical(size_t*, size_t*);
+int test_resolve(size_t*, size_t*);
+int test_format(size_t*, size_t*);
+int test_hash(size_t*, size_t*);
+int test_compact(size_t*, size_t*);
+int test_columns(size_t*, size_t*);
+int test_target(size_t*, size_t*);
+int test_parts(size_t*, size_t*);
+int test_suffix(size_t*, size_t*);
+int test_hostset(size_t*, size_t*);
+int test_cidr(size_t*, size_t*);
+int test_idna(size_t*, size_t*);
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+static const char *rules[] = {
+    "10.0.0.0/8",
+    "10.1.0.0/16",
+    "10.1.2.3",
+    "192.168.0.0/16",
+    "0.0.0.0/0",
+    "fe80::/10",
+    "2001:db8::/32",
+    "2001:db8:1::/48",
+    "::1/128",
+    "10.0.0.0/8", // Duplicate, the first id is kept
+};
+
+static void check_match(size_t *total, size_t *passed, const xurl_cidr_set *set,
+                        const char *url, int expected)
+{
+    xurl_t parsed;
+    uint32_t id;
+    bool res = xurl_parse(url, strlen(url), &parsed)
+            && xurl_cidr_match(set, &parsed.host, &id);
+    if (expected < 0 ? !res : (res && id == (uint32_t) expected)) {
+        fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " cidr %s\n", url);
+        (*passed)++;
+    } else if (res)
+        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " cidr %s\n"
+                "  Matched rule %u, expected %d\n", url, id, expected);
+    else
+        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " cidr %s\n"
+                "  No match, expected rule %d\n", url, expected);
+    (*total)++;
+}
+
+static void check_class(size_t *total, size_t *passed, const char *url,
+                        xurl_ip_class expected)
+{
+    xurl_t parsed;
+    if (!xurl_parse(url, strlen(url), &parsed))
+        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " classify %s\n"
+                "  Parsing failed\n", url);
+    else {
+        xurl_ip_class class = xurl_classify_ip(&parsed.host);
+        if (class != expected)
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " classify %s\n"
+                    "  Got class %d, expected %d\n", url, class, expected);
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " classify %s\n", url);
+            (*passed)++;
+        }
+    }
+    (*total)++;
+}
+
+int test_cidr(size_t *total, size_t *passed)
+{
+    xurl_cidr_node nodes[32];
+    xurl_cidr_set set;
+    bool built = xurl_cidr_init(&set, nodes, sizeof(nodes)/sizeof(nodes[0]));
+    for (size_t i = 0; built && i < sizeof(rules)/sizeof(rules[0]); i++)
+        built = xurl_cidr_add(&set, rules[i], strlen(rules[i]), 100 + i);
+    if (!built) {
+        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " cidr\n"
+                "  Couldn't build the set\n");
+        (*total)++;
+        return 0;
+    }
+
+    static const struct {
+        const char *url;
+        int rule; // -1 if none matches
+    } list[] = {
+        {"http://10.9.9.9/", 100},
+        {"http://10.1.9.9/", 101},
+        {"http://10.1.2.3/", 102},
+        {"http://10.1.2.4/", 101},
+        {"http://192.168.1.1:8080/", 103},
+        {"http://8.8.8.8/", 104},
+        {"http://[::ffff:10.1.2.3]/", 102},
+        {"http://[::ffff:8.8.8.8]/", 104},
+        {"http://[fe80::1%25eth0]/", 105},
+        {"http://[febf:ffff::]/", 105},
+        {"http://[fec0::]/", -1},
+        {"http://[2001:db8::1]/", 106},
+        {"http://[2001:db8:1:2::]/", 107},
+        {"http://[2001:db9::]/", -1},
+        {"http://[::1]/", 108},
+        {"http://[::2]/", -1},
+        {"http://[::]/", -1},
+        {"http://localhost/", -1},
+        {"/path", -1},
+    };
+
+    for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++)
+        check_match(total, passed, &set, list[i].url, list[i].rule);
+
+    {
+        // Invalid prefixes and full sets are rejected
+        static const char *bad[] = {
+            "", "/8", "10.0.0.0/", "10.0.0.0/33", "10.0.0.0/0008", "10.0.0.0/x",
+            "10.0.0.1/8", "fe80::1/10", "::/129", "example.com/8", "10.0.0.0/8/8",
+        };
+        bool rejected = true;
+        for (size_t i = 0; i < sizeof(bad)/sizeof(bad[0]); i++)
+            rejected = rejected && !xurl_cidr_add(&set, bad[i], strlen(bad[i]), 0);
+
+        xurl_cidr_node small[3];
+        xurl_cidr_set full;
+        rejected = rejected && xurl_cidr_init(&full, small, 3)
+                            && xurl_cidr_add(&full, "10.0.0.0/8", 10, 0)
+                            && !xurl_cidr_add(&full, "11.0.0.0/8", 10, 1);
+        if (rejected) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " cidr (bad prefixes)\n");
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " cidr (bad prefixes)\n"
+                    "  Bad prefix added succesfully\n");
+        (*total)++;
+    }
+
+    static const struct {
+        const char *url;
+        xurl_ip_class class;
+    } classes[] = {
+        {"http://example.com/", XURL_IP_NONE},
+        {"http://8.8.8.8/", XURL_IP_GLOBAL},
+        {"http://0.0.0.0/", XURL_IP_UNSPECIFIED},
+        {"http://127.0.0.1/", XURL_IP_LOOPBACK},
+        {"http://10.0.0.1/", XURL_IP_PRIVATE},
+        {"http://172.16.0.1/", XURL_IP_PRIVATE},
+        {"http://172.31.255.255/", XURL_IP_PRIVATE},
+        {"http://172.32.0.0/", XURL_IP_GLOBAL},
+        {"http://192.168.1.1/", XURL_IP_PRIVATE},
+        {"http://100.64.0.1/", XURL_IP_SHARED},
+        {"http://100.128.0.1/", XURL_IP_GLOBAL},
+        {"http://169.254.169.254/", XURL_IP_LINK_LOCAL},
+        {"http://192.0.0.8/", XURL_IP_RESERVED},
+        {"http://192.0.2.1/", XURL_IP_DOCUMENTATION},
+        {"http://198.51.100.1/", XURL_IP_DOCUMENTATION},
+        {"http://203.0.113.1/", XURL_IP_DOCUMENTATION},
+        {"http://198.19.255.255/", XURL_IP_BENCHMARKING},
+        {"http://224.0.0.1/", XURL_IP_MULTICAST},
+        {"http://240.0.0.1/", XURL_IP_RESERVED},
+        {"http://255.255.255.255/", XURL_IP_BROADCAST},
+        {"http://[2606:4700::1111]/", XURL_IP_GLOBAL},
+        {"http://[::]/", XURL_IP_UNSPECIFIED},
+        {"http://[::1]/", XURL_IP_LOOPBACK},
+        {"http://[::ffff:127.0.0.1]/", XURL_IP_LOOPBACK},
+        {"http://[::ffff:8.8.8.8]/", XURL_IP_GLOBAL},
+        {"http://[64:ff9b::a9fe:a9fe]/", XURL_IP_LINK_LOCAL},
+        {"http://[fd00::1]/", XURL_IP_PRIVATE},
+        {"http://[fe80::1]/", XURL_IP_LINK_LOCAL},
+        {"http://[2001:db8::1]/", XURL_IP_DOCUMENTATION},
+        {"http://[3fff::1]/", XURL_IP_DOCUMENTATION},
+        {"http://[2001:2::1]/", XURL_IP_BENCHMARKING},
+        {"http://[2001::1]/", XURL_IP_RESERVED},
+        {"http://[100::1]/", XURL_IP_RESERVED},
+        {"http://[ff02::1]/", XURL_IP_MULTICAST},
+    };
+
+    for (size_t i = 0; i < sizeof(classes)/sizeof(classes[0]); i++)
+        check_class(total, passed, classes[i].url, classes[i].class);
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+int test_decode(size_t *total, size_t *passed)
+{
+    static const struct {
+        bool query;
+        bool success;
+        const char *input;
+        const char *expected;
+    } list[] = {
+        {false, true,  "", ""},
+        {false, true,  "/data/index.html", "/data/index.html"},
+        {false, true,  "/a%20b", "/a b"},
+        {false, true,  "%41%42%43", "ABC"},
+        {false, true,  "/a%2Fb%2fc", "/a/b/c"},
+        {false, true,  "/a+b", "/a+b"},
+        {false, true,  "/caf%C3%A9/menu", "/caf\xC3\xA9/menu"},
+        {false, true,  "/a/very/long/path/that/is/longer/than/a/vector/%7Euser", "/a/very/long/path/that/is/longer/than/a/vector/~user"},
+        {true,  true,  "name=francesco&date=today", "name=francesco&date=today"},
+        {true,  true,  "running+shoes", "running shoes"},
+        {true,  true,  "a%2Bb+c", "a+b c"},
+        {true,  true,  "%E2%82%AC", "\xE2\x82\xAC"},
+        {false, false, "/a%2", NULL},  // Source ends inside percent-encoded byte
+        {false, false, "/a%zz", NULL}, // Non-hex digits
+        {true,  false, "%", NULL},
+    };
+
+    for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++) {
+
+        const char *input = list[i].input;
+        size_t len = strlen(input);
+
+        char buffer[128];
+        const char *out;
+        size_t out_len;
+        bool res;
+        if (list[i].query)
+            res = xurl_decode_query(input, len, buffer, sizeof(buffer), &out, &out_len);
+        else
+            res = xurl_decode_path(input, len, buffer, sizeof(buffer), &out, &out_len);
+
+        if (!list[i].success) {
+            if (res)
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " decode %s\n"
+                        "  Bad input decoded succesfully\n", input);
+            else {
+                fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " decode %s\n", input);
+                (*passed)++;
+            }
+        } else {
+            const char *expected = list[i].expected;
+            size_t expected_len = strlen(expected);
+            if (!res)
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " decode %s\n"
+                        "  Decoding failed\n", input);
+            else if (out_len != expected_len || memcmp(out, expected, out_len))
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " decode %s\n"
+                        "  Got \"%.*s\", expected \"%s\"\n", input, (int) out_len, out, expected);
+            else if (!strcmp(input, expected) && out != input)
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " decode %s\n"
+                        "  Nothing to decode, but the input was copied\n", input);
+            else {
+                fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " decode %s\n", input);
+                (*passed)++;
+            }
+        }
+        (*total)++;
+    }
+
+    {
+        // Destination buffer too small
+        const char *input = "/a%20b";
+        char buffer[3];
+        const char *out;
+        size_t out_len;
+        if (xurl_decode_path(input, strlen(input), buffer, sizeof(buffer), &out, &out_len))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " decode %s (small buffer)\n"
+                    "  Decoding succeded unexpectedly\n", input);
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " decode %s (small buffer)\n", input);
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    return 0;
+}
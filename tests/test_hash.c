@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+int test_hash(size_t *total, size_t *passed)
+{
+    static const struct {
+        const char *a;
+        const char *b;
+        unsigned mask;
+        bool equal;
+    } list[] = {
+        {"http://example.com/a", "http://example.com/a", XURL_HASH_ALL, true},
+        {"HTTP://Example.COM/a", "http://example.com/a", XURL_HASH_ALL, true},              // Schema and host case
+        {"http://example.com/A", "http://example.com/a", XURL_HASH_ALL, false},             // Path case
+        {"http://example.com/a#x", "http://example.com/a#y", XURL_HASH_ALL, false},
+        {"http://example.com/a#x", "http://example.com/a#y", XURL_HASH_ALL & ~XURL_HASH_FRAGMENT, true},
+        {"http://u:p@example.com/", "http://example.com/", XURL_HASH_ALL & ~XURL_HASH_USERINFO, true},
+        {"http://u:p@example.com/", "http://example.com/", XURL_HASH_ALL, false},
+        {"http://example.com:80/", "http://example.com/", XURL_HASH_ALL, false},
+        {"http://example.com:80/", "http://example.com/", XURL_HASH_ALL & ~XURL_HASH_PORT, true},
+        {"http://example.com:80/", "http://example.com:81/", XURL_HASH_ALL, false},
+        {"http://example.com/", "https://example.com/", XURL_HASH_ALL, false},
+        {"http://example.com/", "https://example.com/", XURL_HASH_HOST | XURL_HASH_PATH, true},
+        {"http://example.com/?", "http://example.com/", XURL_HASH_ALL, false},              // Empty and absent query
+        {"http://example.com/?a", "http://example.com/#a", XURL_HASH_ALL, false},           // Same bytes in different components
+        {"http://[0:0:0:0:0:0:0:1]/", "http://[::1]/", XURL_HASH_ALL, true},                 // IPv6 by value
+        {"http://127.0.0.1/", "http://127.0.0.2/", XURL_HASH_ALL, false},
+        {"http://a.b/", "http://a.c/", XURL_HASH_HOST, false},
+        {"http://example.com/x", "http://example.com/y", XURL_HASH_HOST, true},
+    };
+
+    for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++) {
+
+        char a[128], b[128];
+        strcpy(a, list[i].a);
+        strcpy(b, list[i].b);
+
+        xurl_t url_a, url_b;
+        if (!xurl_parse(a, strlen(a), &url_a) || !xurl_parse(b, strlen(b), &url_b))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hash %s %s\n"
+                    "  Parsing failed\n", list[i].a, list[i].b);
+        else if ((xurl_hash(&url_a, list[i].mask, 0) == xurl_hash(&url_b, list[i].mask, 0)) != list[i].equal)
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hash %s %s\n"
+                    "  Hashes expected to be %s\n", list[i].a, list[i].b, list[i].equal ? "equal" : "different");
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " hash %s %s\n", list[i].a, list[i].b);
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    {
+        // Seeds give different hashes
+        char input[] = "http://example.com/";
+        xurl_t url;
+        if (xurl_parse(input, strlen(input), &url) && xurl_hash(&url, XURL_HASH_ALL, 1) != xurl_hash(&url, XURL_HASH_ALL, 2)) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " hash %s (seeds)\n", input);
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hash %s (seeds)\n"
+                    "  Hashes expected to be different\n", input);
+        (*total)++;
+    }
+
+    {
+        // Long paths are hashed equally at all SIMD levels,
+        // and changing any of their bytes changes the hash.
+        char input[512] = "http://example.com/";
+        size_t prefix = strlen(input);
+        for (size_t k = prefix; k < sizeof(input) - 1; k++)
+            input[k] = 'a' + k % 26;
+        input[sizeof(input) - 1] = '\0';
+
+        xurl_simd saved = xurl_get_simd();
+        bool ok = true;
+        for (size_t len = prefix; len < sizeof(input); len += 7) {
+
+            xurl_t url;
+            if (!xurl_parse(input, len, &url)) {
+                ok = false;
+                break;
+            }
+
+            xurl_set_simd(XURL_SIMD_NONE);
+            uint64_t expected = xurl_hash(&url, XURL_HASH_ALL, 42);
+            for (xurl_simd level = XURL_SIMD_SSE2; level <= XURL_SIMD_AVX2; level++)
+                if (xurl_set_simd(level) && xurl_hash(&url, XURL_HASH_ALL, 42) != expected)
+                    ok = false;
+
+            if (len > prefix) {
+                char saved_byte = input[len-1];
+                input[len-1] = '_';
+                if (xurl_hash(&url, XURL_HASH_ALL, 42) == expected)
+                    ok = false;
+                input[len-1] = saved_byte;
+            }
+        }
+        xurl_set_simd(saved);
+
+        if (ok) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " hash (long paths)\n");
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hash (long paths)\n"
+                    "  Hashes depend on the SIMD level or ignore some bytes\n");
+        (*total)++;
+    }
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+static const char *rules[] = {
+    "example.com",
+    "*.ads.example",
+    "tracker.ads.example",
+    "*.Cdn.Example.NET",
+    "cdn.example.net",
+    "*.co",
+    "example.com",   // Duplicate, the first id is kept
+    "*.ads.example", // Duplicate
+};
+
+static bool build(void *mem, size_t cap, size_t *size)
+{
+    size_t count = sizeof(rules)/sizeof(rules[0]);
+    size_t lens[sizeof(rules)/sizeof(rules[0])];
+    uint32_t ids[sizeof(rules)/sizeof(rules[0])];
+    for (size_t i = 0; i < count; i++) {
+        lens[i] = strlen(rules[i]);
+        ids[i] = 100 + i;
+    }
+    if (xurl_hostset_size(rules, lens, count) > cap)
+        return false;
+    *size = xurl_hostset_build(rules, lens, ids, count, mem, cap);
+    return *size > 0;
+}
+
+static void check(size_t *total, size_t *passed, const xurl_hostset *set,
+                  const char *url, int expected)
+{
+    xurl_t parsed;
+    uint32_t id;
+    bool res = xurl_parse(url, strlen(url), &parsed)
+            && xurl_hostset_match(set, &parsed.host, &id);
+    if (expected < 0 ? !res : (res && id == (uint32_t) expected)) {
+        fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " hostset %s\n", url);
+        (*passed)++;
+    } else if (res)
+        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hostset %s\n"
+                "  Matched rule %u, expected %d\n", url, id, expected);
+    else
+        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hostset %s\n"
+                "  No match, expected rule %d\n", url, expected);
+    (*total)++;
+}
+
+int test_hostset(size_t *total, size_t *passed)
+{
+    uint64_t mem[128];
+    size_t size;
+    xurl_hostset set;
+    if (!build(mem, sizeof(mem), &size) || !xurl_hostset_load(mem, size, &set)) {
+        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hostset\n"
+                "  Couldn't build the set\n");
+        (*total)++;
+        return 0;
+    }
+
+    static const struct {
+        const char *url;
+        int rule; // -1 if none matches
+    } list[] = {
+        {"http://example.com/", 100},
+        {"http://EXAMPLE.com:8080/x", 100},
+        {"http://example.com./", 100},
+        {"http://www.example.com/", -1},
+        {"http://example.org/", -1},
+        {"http://ads.example/", -1},
+        {"http://x.ads.example/", 101},
+        {"http://a.b.ADS.example/", 101},
+        {"http://tracker.ads.example/", 102},
+        {"http://x.tracker.ads.example/", 101},
+        {"http://cdn.example.net/", 104},
+        {"http://img.cdn.example.net/", 103},
+        {"http://co/", -1},
+        {"http://example.co/", 105},
+        {"http://xexample.com/", -1},
+        {"http://127.0.0.1/", -1},
+        {"http://[::1]/", -1},
+        {"/path", -1},
+    };
+
+    for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++)
+        check(total, passed, &set, list[i].url, list[i].rule);
+
+    {
+        // The image can be saved to a file and loaded back
+        // at a different address.
+        FILE *fp = tmpfile();
+        uint64_t copy[128];
+        xurl_hostset loaded;
+        bool ok = fp != NULL
+               && fwrite(mem, 1, size, fp) == size
+               && fseek(fp, 0, SEEK_SET) == 0
+               && fread(copy, 1, size, fp) == size;
+        if (fp != NULL)
+            fclose(fp);
+        memset(mem, 0, sizeof(mem));
+        if (ok && xurl_hostset_load(copy, size, &loaded)) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " hostset (saved image)\n");
+            (*passed)++;
+            check(total, passed, &loaded, "http://x.tracker.ads.example/", 101);
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hostset (saved image)\n"
+                    "  Couldn't load the image\n");
+        (*total)++;
+
+        // Truncated and corrupted images are rejected
+        uint32_t magic = ((uint32_t*) copy)[0];
+        bool rejected = !xurl_hostset_load(copy, size - 1, &loaded)
+                     && !xurl_hostset_load(copy, 8, &loaded)
+                     && !xurl_hostset_load((char*) copy + 1, size - 1, &loaded);
+        ((uint32_t*) copy)[0] = magic ^ 1;
+        rejected = rejected && !xurl_hostset_load(copy, size, &loaded);
+        ((uint32_t*) copy)[0] = magic;
+
+        // The domains of the slots don't fit in a text
+        // of size zero
+        ((uint32_t*) copy)[2] = 0;
+        rejected = rejected && !xurl_hostset_load(copy, size, &loaded);
+        if (rejected) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " hostset (bad images)\n");
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hostset (bad images)\n"
+                    "  Bad image loaded succesfully\n");
+        (*total)++;
+    }
+
+    {
+        // Invalid rules and small buffers make the build fail
+        static const char *bad[] = {"", "*.", "*", "a..b", ".a", "a.", "a b", "*.*.a", "a/b"};
+        bool rejected = true;
+        for (size_t i = 0; i < sizeof(bad)/sizeof(bad[0]); i++) {
+            size_t len = strlen(bad[i]);
+            rejected = rejected && !xurl_hostset_build(&bad[i], &len, NULL, 1, mem, sizeof(mem));
+        }
+        const char *good = "example.com";
+        size_t good_len = strlen(good);
+        size_t need = xurl_hostset_size(&good, &good_len, 1);
+        rejected = rejected && !xurl_hostset_build(&good, &good_len, NULL, 1, mem, need - 1)
+                            &&  xurl_hostset_build(&good, &good_len, NULL, 1, mem, need) == need;
+        if (rejected) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " hostset (bad rules)\n");
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " hostset (bad rules)\n"
+                    "  Bad rule set built succesfully\n");
+        (*total)++;
+    }
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+typedef bool (*convert_fn)(const xurl_host*, char*, size_t, const char**, size_t*);
+
+static void check(size_t *total, size_t *passed, const char *what, convert_fn convert,
+                  const char *name, const char *expected)
+{
+    xurl_host host = {
+        .mode = XURL_HOSTMODE_NAME,
+        .name = (char*) name,
+        .name_len = strlen(name),
+        .no_port = true,
+    };
+
+    char buffer[256];
+    const char *out;
+    size_t out_len;
+    bool res = convert(&host, buffer, sizeof(buffer), &out, &out_len);
+
+    bool ok;
+    if (expected == NULL)
+        ok = !res;
+    else
+        ok = res && out_len == strlen(expected) && !memcmp(out, expected, out_len);
+
+    if (ok) {
+        fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " %s %s\n", what, name);
+        (*passed)++;
+    } else if (res)
+        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " %s %s\n"
+                "  Got \"%.*s\", expected %s\n", what, name, (int) out_len, out, expected ? expected : "failure");
+    else
+        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " %s %s\n"
+                "  Conversion failed, expected \"%s\"\n", what, name, expected);
+    (*total)++;
+}
+
+int test_idna(size_t *total, size_t *passed)
+{
+    static const struct {
+        const char *name;
+        const char *ascii; // NULL if the conversion fails
+    } to_ascii[] = {
+        {"example.com", "example.com"},
+        {"b\xC3\xBC" "cher.example", "xn--bcher-kva.example"},         // bücher.example
+        {"B\xC3\xBC" "cher.example", "xn--Bcher-kva.example"},         // Case is kept
+        {"%C3%BC" "ber.de", "xn--ber-goa.de"},                         // über.de, percent-encoded
+        {"m%c3%bcnchen.de.", "xn--mnchen-3ya.de."},
+        {"\xE4\xBE\x8B\xE3\x81\x88.\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88", "xn--r8jz45g.xn--zckzah"}, // 例え.テスト
+        {"xn--bcher-kva.example", "xn--bcher-kva.example"},
+        {"a%2Db.com", "a-b.com"},
+        {"\xC3", NULL},                 // Truncated sequence
+        {"%C3.com", NULL},
+        {"%ZZ.com", NULL},
+        {"a%2Eb.com", NULL},            // Encoded '.'
+        {"\xC0\xAF.com", NULL},         // Overlong '/'
+        {"\xED\xA0\x80.com", NULL},     // Surrogate
+        {"\xF4\x90\x80\x80.com", NULL}, // Past U+10FFFF
+        {"\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC"
+         "\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC"
+         "\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC"
+         "\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC"
+         "\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC"
+         "\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC\xC3\xBC", NULL}, // Encoded label over 63 bytes
+    };
+
+    for (size_t i = 0; i < sizeof(to_ascii)/sizeof(to_ascii[0]); i++)
+        check(total, passed, "to_ascii", xurl_host_to_ascii, to_ascii[i].name, to_ascii[i].ascii);
+
+    static const struct {
+        const char *name;
+        const char *unicode; // NULL if the conversion fails
+    } to_unicode[] = {
+        {"example.com", "example.com"},
+        {"xn--bcher-kva.example", "b\xC3\xBC" "cher.example"},
+        {"XN--BCHER-KVA.example", "B\xC3\xBC" "CHER.example"},       // Case is kept
+        {"www.xn--85x722f.com.cn", "www.\xE9\xA3\x9F\xE7\x8B\xAE.com.cn"}, // www.食狮.com.cn
+        {"xn--r8jz45g.xn--zckzah", "\xE4\xBE\x8B\xE3\x81\x88.\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88"},
+        {"%C3%BC" "ber.de", "\xC3\xBC" "ber.de"},
+        {"a--b.com", "a--b.com"},
+        {"xn--", NULL},
+        {"xn--abc-", NULL},       // Only ASCII
+        {"xn--99999999999", NULL}, // Overflow
+        {"xn--a%41", NULL},
+    };
+
+    for (size_t i = 0; i < sizeof(to_unicode)/sizeof(to_unicode[0]); i++)
+        check(total, passed, "to_unicode", xurl_host_to_unicode, to_unicode[i].name, to_unicode[i].unicode);
+
+    static const struct {
+        const char *url;
+        bool ascii;   // Unchanged by xurl_host_to_ascii
+        bool unicode; // Unchanged by xurl_host_to_unicode
+    } unchanged[] = {
+        {"http://www.example.com/", true, true},
+        {"http://a--b.com/", true, true},
+        {"http://my--site.example/", true, true},
+        {"http://a-rather-long--host-name.example.com/", true, true},
+        {"http://ab--c.some-long-domain-name.example/", true, true},
+        {"http://XN--BCHER-KVA.example/", true, false},
+        {"http://www.xn--bcher-kva.a-rather-long-domain-name.example/", true, false},
+    };
+
+    for (size_t i = 0; i < sizeof(unchanged)/sizeof(unchanged[0]); i++) {
+
+        // Hosts that don't change are returned as they
+        // are, without using the buffer.
+        const char *input = unchanged[i].url;
+        xurl_t url;
+        const char *ascii, *unicode;
+        size_t ascii_len, unicode_len;
+        if (xurl_parse(input, strlen(input), &url)
+            && (!unchanged[i].ascii || (xurl_host_to_ascii(&url.host, NULL, 0, &ascii, &ascii_len)
+                && ascii == url.host.name && ascii_len == url.host.name_len))
+            && (!unchanged[i].unicode || (xurl_host_to_unicode(&url.host, NULL, 0, &unicode, &unicode_len)
+                && unicode == url.host.name && unicode_len == url.host.name_len))) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " idna (unchanged host %s)\n", input);
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " idna (unchanged host %s)\n"
+                    "  The original name wasn't returned\n", input);
+        (*total)++;
+    }
+
+    {
+        // IP addresses and small buffers make the conversion fail
+        char input[] = "http://[::1]/";
+        xurl_t url;
+        char small[8];
+        const char *out;
+        size_t out_len;
+        xurl_host host = {
+            .mode = XURL_HOSTMODE_NAME,
+            .name = "b\xC3\xBC" "cher.example",
+            .name_len = strlen("b\xC3\xBC" "cher.example"),
+        };
+        if (xurl_parse(input, strlen(input), &url)
+            && !xurl_host_to_ascii(&url.host, small, sizeof(small), &out, &out_len)
+            && !xurl_host_to_unicode(&url.host, small, sizeof(small), &out, &out_len)
+            && !xurl_host_to_ascii(&host, small, sizeof(small), &out, &out_len)) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " idna (bad hosts)\n");
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " idna (bad hosts)\n"
+                    "  Conversion succeded unexpectedly\n");
+        (*total)++;
+    }
+
+    return 0;
+}
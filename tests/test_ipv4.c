@@ -13,6 +13,29 @@ int test_ipv4(size_t *total, size_t *passed)
         "0.1.0.0",
         "1.0.0.0",
         "255.255.255.255",
+        "192.168.0.1",
+        "10.0.0.10",
+        "100.200.250.199",
+        "256.0.0.0",
+        "0.0.0.256",
+        "1.2.3.1000",
+        "1234.1.1.1",
+        "01.2.3.4",     // Leading zeros
+        "1.02.3.4",
+        "1.2.3.04",
+        "1.2.3.00",
+        "00.0.0.0",
+        "1.2.3",
+        "1.2.3.",
+        "1..2.3",
+        ".1.2.3.4",
+        "1.2.3.4.",
+        "1.2.3.4.5",
+        "1.2.3.4x",
+        "x1.2.3.4",
+        "1.2.3.-4",
+        "",
+        "255.255.255.255.255.255",
     };
 
     for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++) {
@@ -50,5 +73,52 @@ int test_ipv4(size_t *total, size_t *passed)
         }
         (*total)++;
     }
+
+    {
+        // Random strings of digits and dots give the same
+        // results of inet_pton at every SIMD level.
+        uint32_t state = 2463534242;
+        xurl_simd saved = xurl_get_simd();
+        bool ok = true;
+        for (int n = 0; n < 100000 && ok; n++) {
+
+            char input[32];
+            size_t len = 0;
+            for (int u = 0; u < 4; u++) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                len += snprintf(input + len, sizeof(input) - len, u ? ".%u" : "%u", state % 300);
+            }
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            if (state % 4 == 0)
+                input[state / 4 % len] = "0.1x"[state / 64 % 4];
+
+            uint32_t expected;
+            bool expected_ok = (1 == inet_pton(AF_INET, input, &expected));
+            expected = ntohl(expected);
+
+            for (xurl_simd level = XURL_SIMD_NONE; level <= XURL_SIMD_AVX2; level++) {
+                uint32_t output;
+                if (!xurl_set_simd(level))
+                    continue;
+                bool output_ok = xurl_parse_ipv4(input, len, &output);
+                if (output_ok != expected_ok || (output_ok && output != expected)) {
+                    fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " %s (level %d)\n"
+                            "  Result doesn't match inet_pton\n", input, level);
+                    ok = false;
+                }
+            }
+        }
+        xurl_set_simd(saved);
+
+        if (ok) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " random IPv4 addresses\n");
+            (*passed)++;
+        }
+        (*total)++;
+    }
     return 0;
 }
\ No newline at end of file
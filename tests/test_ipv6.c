@@ -26,6 +26,31 @@ int test_ipv6(size_t *total, size_t *passed)
         "e::",
         "f::",
         "0:1:2:3::5:6:7",
+        "::ffff:10.0.0.1",  // IPv4-mapped
+        "::1.2.3.4",
+        "1:2:3:4:5:6:1.2.3.4",
+        "1:2:3:4:5:6:7:1.2.3.4",
+        "1:2:3:4:5:1.2.3.4",
+        "::ffff:01.0.0.1",
+        "::ffff:1.2.3",
+        "::ffff:256.0.0.1",
+        "1.2.3.4",
+        "12345::",         // Too many digits
+        "00000::",
+        "1:2:3:4:5:6:7:8:9",
+        "1:2:3:4:5:6:7",
+        "1::2::3",
+        "::1:",
+        ":1::",
+        ":::",
+        "1:2:3:4:5:6:7::",
+        "::2:3:4:5:6:7:8",
+        "1::2:3:4:5:6:7:8",
+        "ffff:FFFF:ffff:FFFF:ffff:FFFF:ffff:FFFF",
+        "g::",
+        "",
+        ":",
+        "fe80::1%eth0",    // Zones are only accepted in URLs
     };
 
     for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++) {
@@ -72,5 +97,109 @@ int test_ipv6(size_t *total, size_t *passed)
         }
         (*total)++;
     }
+
+    {
+        // Random addresses give the same results of inet_pton
+        uint32_t state = 88172645;
+        bool ok = true;
+        for (int n = 0; n < 100000 && ok; n++) {
+
+            char input[64];
+            size_t len = 0;
+
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            int words = state % 9;
+            int gap = (state >> 4) % 2 ? (int) ((state >> 5) % (words + 1)) : -1;
+            for (int w = 0; w < words; w++) {
+                if (w == gap)
+                    len += snprintf(input + len, sizeof(input) - len, "::");
+                else if (w > 0)
+                    input[len++] = ':';
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                for (uint32_t d = 0; d < 1 + state % 5; d++)
+                    input[len++] = "0123456789abcdefABCDEF"[(state >> (3 + d * 5)) % 22];
+            }
+            if (gap == words)
+                len += snprintf(input + len, sizeof(input) - len, "::");
+            if (state % 5 == 0)
+                len += snprintf(input + len, sizeof(input) - len, "%s%u.%u.%u.%u",
+                                words ? ":" : "::", state % 260, state / 7 % 260, state / 11 % 260, state / 13 % 260);
+            input[len] = '\0';
+
+            uint16_t output[8];
+            uint16_t expected[8];
+            bool expected_ok = (1 == inet_pton(AF_INET6, input, expected));
+            for (size_t g = 0; g < 8; g++)
+                expected[g] = ntohs(expected[g]);
+
+            bool output_ok = xurl_parse_ipv6(input, len, output);
+            if (output_ok != expected_ok || (output_ok && memcmp(output, expected, 16))) {
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " %s\n"
+                        "  Result doesn't match inet_pton\n", input);
+                ok = false;
+            }
+        }
+        if (ok) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " random IPv6 addresses\n");
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    {
+        // IPv4-mapped addresses and zone identifiers in URLs
+        static const struct {
+            const char *input;
+            const char *zone;
+            uint16_t last_words[2];
+        } urls[] = {
+            {"http://[::ffff:10.0.0.1]/", NULL, {0x0A00, 0x0001}},
+            {"http://[::ffff:10.0.0.1]:8080", NULL, {0x0A00, 0x0001}},
+            {"http://[fe80::1%25eth0]/", "eth0", {0x0000, 0x0001}},
+            {"http://[fe80::1%25en%301]:80/x", "en%301", {0x0000, 0x0001}},
+        };
+        for (size_t i = 0; i < sizeof(urls)/sizeof(urls[0]); i++) {
+            const char *input = urls[i].input;
+            const char *zone = urls[i].zone;
+            xurl_t url;
+            if (!xurl_parse(input, strlen(input), &url) || url.host.mode != XURL_HOSTMODE_IPV6)
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " %s\n"
+                        "  Parsing failed\n", input);
+            else if (url.host.ipv6[6] != urls[i].last_words[0] || url.host.ipv6[7] != urls[i].last_words[1])
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " %s\n"
+                        "  IPv6 doesn't match\n", input);
+            else if (zone == NULL ? url.host.zone != NULL
+                     : (url.host.zone == NULL || url.host.zone_len != strlen(zone) || memcmp(url.host.zone, zone, url.host.zone_len)))
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " %s\n"
+                        "  Zone doesn't match\n", input);
+            else {
+                fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " %s\n", input);
+                (*passed)++;
+            }
+            (*total)++;
+        }
+
+        static const char *invalid[] = {
+            "http://[fe80::1%eth0]/",
+            "http://[fe80::1%25]/",
+            "http://[fe80::1%25eth/0]/",
+            "http://[::ffff:10.0.0]/",
+        };
+        for (size_t i = 0; i < sizeof(invalid)/sizeof(invalid[0]); i++) {
+            xurl_t url;
+            if (xurl_parse(invalid[i], strlen(invalid[i]), &url))
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " %s\n"
+                        "  Parsing succeded unexpectedly\n", invalid[i]);
+            else {
+                fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " %s\n", invalid[i]);
+                (*passed)++;
+            }
+            (*total)++;
+        }
+    }
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+// The slice must be inside [part] and hold the same
+// bytes as the one parsed from the concatenation.
+static bool same_slice(const char *part, size_t part_len,
+                       const char *slice, size_t slice_len,
+                       const char *exp, size_t exp_len)
+{
+    if (exp == NULL)
+        return slice == NULL && slice_len == 0;
+    return slice != NULL
+        && slice >= part && slice + slice_len <= part + part_len
+        && slice_len == exp_len && !memcmp(slice, exp, exp_len);
+}
+
+// Absent parts are shown as "-"
+static const char *show(const char *part)
+{
+    return part ? part : "-";
+}
+
+int test_parts(size_t *total, size_t *passed)
+{
+    // Pseudo-headers that are also valid when
+    // concatenated as scheme "://" authority path.
+    static const struct {
+        const char *scheme;
+        const char *authority;
+        const char *path;
+    } list[] = {
+        {"https", "example.com", "/"},
+        {"https", "example.com:8443", "/index.html?lang=en"},
+        {"http", "example.com", "/a/b?"},
+        {"http", "127.0.0.1:80", "/x"},
+        {"http", "[2001:db8::1]:8080", "/y?z=1"},
+        {"http", "[fe80::1%25eth0]", "/"},
+        {"h3", "a.b.c", "/%41%42?%43"},
+    };
+
+    for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++) {
+
+        // Each part gets a buffer of its own
+        char scheme[64], authority[64], path[64], joined[256];
+        size_t scheme_len = strlen(list[i].scheme);
+        size_t authority_len = strlen(list[i].authority);
+        size_t path_len = strlen(list[i].path);
+        memcpy(scheme, list[i].scheme, scheme_len);
+        memcpy(authority, list[i].authority, authority_len);
+        memcpy(path, list[i].path, path_len);
+        int joined_len = snprintf(joined, sizeof(joined), "%s://%s%s", list[i].scheme, list[i].authority, list[i].path);
+
+        xurl_t url, exp;
+        if (!xurl_parse_parts(scheme, scheme_len, authority, authority_len, path, path_len, &url)
+            || !xurl_parse(joined, joined_len, &exp))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " parts %s\n"
+                    "  Parsing failed\n", joined);
+        else if (!same_slice(scheme, scheme_len, url.schema, url.schema_len, exp.schema, exp.schema_len)
+              || !same_slice(authority, authority_len, url.userinfo.username, url.userinfo.username_len, exp.userinfo.username, exp.userinfo.username_len)
+              || !same_slice(authority, authority_len, url.userinfo.password, url.userinfo.password_len, exp.userinfo.password, exp.userinfo.password_len)
+              || url.host.mode != exp.host.mode
+              || url.host.no_port != exp.host.no_port
+              || url.host.port != exp.host.port
+              || (exp.host.mode == XURL_HOSTMODE_NAME && !same_slice(authority, authority_len, url.host.name, url.host.name_len, exp.host.name, exp.host.name_len))
+              || (exp.host.mode == XURL_HOSTMODE_IPV4 && url.host.ipv4 != exp.host.ipv4)
+              || (exp.host.mode == XURL_HOSTMODE_IPV6 && (memcmp(url.host.ipv6, exp.host.ipv6, sizeof(exp.host.ipv6))
+                  || !same_slice(authority, authority_len, url.host.zone, url.host.zone_len, exp.host.zone, exp.host.zone_len)))
+              || !same_slice(path, path_len, url.path, url.path_len, exp.path, exp.path_len)
+              || !same_slice(path, path_len, url.query, url.query_len, exp.query, exp.query_len)
+              || url.fragment != NULL)
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " parts %s\n"
+                    "  Components don't match the ones of xurl_parse\n", joined);
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " parts %s\n", joined);
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    static const struct {
+        bool success;
+        const char *scheme;
+        const char *authority;
+        const char *path;
+    } other[] = {
+        {true,  NULL, "example.com:443", NULL}, // CONNECT
+        {true,  "https", "example.com", "*"},   // OPTIONS *
+        {true,  "https", NULL, "/"},            // No :authority
+        {true,  "https", "example.com", "/a//b"},
+        {true,  "https", "example.com", "//x"},
+        {false, "", "example.com", "/"},
+        {false, "1http", "example.com", "/"},
+        {false, "ht tp", "example.com", "/"},
+        {false, "https", "", "/"},
+        {false, "https", "example.com/", "/"},
+        {false, "https", "example.com:x", "/"},
+        {false, "https", "user@example.com", "/"},
+        {false, "https", "u:p@example.com", "/"},
+        {false, "https", "example.com", ""},
+        {false, "https", "example.com", "index.html"},
+        {false, "https", "example.com", "/a#b"},
+        {false, "https", "example.com", "/a b"},
+        {false, "https", "example.com", "**"},
+    };
+
+    for (size_t i = 0; i < sizeof(other)/sizeof(other[0]); i++) {
+
+        const char *scheme = other[i].scheme;
+        const char *authority = other[i].authority;
+        const char *path = other[i].path;
+
+        xurl_t url;
+        bool res = xurl_parse_parts(scheme, scheme ? strlen(scheme) : 0,
+                                    authority, authority ? strlen(authority) : 0,
+                                    path, path ? strlen(path) : 0, &url);
+        if (res != other[i].success)
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " parts [%s] [%s] [%s]\n"
+                    "  %s\n", show(scheme), show(authority), show(path),
+                    res ? "Bad input parsed succesfully" : "Parsing failed");
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " parts [%s] [%s] [%s]\n",
+                    show(scheme), show(authority), show(path));
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    {
+        // Empty path segments are kept
+        const char *path = "//x/?q";
+        xurl_t url;
+        if (xurl_parse_parts("https", 5, "example.com", 11, path, 6, &url)
+            && url.path == path && url.path_len == 4
+            && url.query == path + 5 && url.query_len == 1) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " parts (empty segments)\n");
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " parts (empty segments)\n"
+                    "  Wrong path or query\n");
+        (*total)++;
+    }
+
+    return 0;
+}
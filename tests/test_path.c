@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+// Write the segments of [path] in [dst] as a
+// sequence of "[segment]".
+static void dump_segments(const char *path, char *dst, size_t max)
+{
+    xurl_path_iter iter;
+    const char *segment;
+    size_t segment_len;
+    size_t used = 0;
+    dst[0] = '\0';
+
+    xurl_path_init(&iter, path, path ? strlen(path) : 0);
+    while (xurl_path_next(&iter, &segment, &segment_len) && used < max)
+        used += snprintf(dst + used, max - used, "[%.*s]", (int) segment_len, segment);
+}
+
+int test_path(size_t *total, size_t *passed)
+{
+    static const struct {
+        const char *path;
+        const char *expected;
+    } segments[] = {
+        {NULL, ""},
+        {"", ""},
+        {"/", "[]"},
+        {"/data/index.html", "[data][index.html]"},
+        {"/data/", "[data][]"},
+        {"data/index.html", "[data][index.html]"},
+        {"a", "[a]"},
+        {"/a/very/long/path/with/more/than/sixteen/bytes/per/vector", 
+         "[a][very][long][path][with][more][than][sixteen][bytes][per][vector]"},
+    };
+
+    for (size_t i = 0; i < sizeof(segments)/sizeof(segments[0]); i++) {
+
+        const char *path = segments[i].path;
+        const char *expected = segments[i].expected;
+
+        char output[512];
+        dump_segments(path, output, sizeof(output));
+
+        if (strcmp(output, expected))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " segments %s\n"
+                    "  Got \"%s\", expected \"%s\"\n", path ? path : "(null)", output, expected);
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " segments %s\n", path ? path : "(null)");
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    static const struct {
+        const char *path;
+        const char *expected;
+    } dots[] = {
+        {"", ""},
+        {"/", "/"},
+        {"/a/b/c/./../../g", "/a/g"}, // RFC 3986, section 5.2.4
+        {"mid/content=5/../6", "mid/6"},
+        {"/a/./b/../c", "/a/c"},
+        {"/a/c", "/a/c"},
+        {"/a/b/", "/a/b/"},
+        {"/a/b/.", "/a/b/"},
+        {"/a/b/..", "/a/"},
+        {"/a/b/../", "/a/"},
+        {"/..", "/"},
+        {"/../..", "/"},
+        {"/../a", "/a"},
+        {"/./a", "/a"},
+        {"../a", "a"},
+        {"./a", "a"},
+        {".", ""},
+        {"..", ""},
+        {"a/..", "/"},
+        {"/a/..b/.c/c.", "/a/..b/.c/c."},
+        {"/a/b/c/../../../../g", "/g"},
+    };
+
+    for (size_t i = 0; i < sizeof(dots)/sizeof(dots[0]); i++) {
+
+        const char *path = dots[i].path;
+        const char *expected = dots[i].expected;
+        size_t len = strlen(path);
+
+        // Once into a separate buffer and once in place
+        char output[128];
+        size_t output_len;
+        bool res = xurl_remove_dot_segments(path, len, output, sizeof(output), &output_len);
+
+        char inplace[128];
+        size_t inplace_len;
+        memcpy(inplace, path, len);
+        bool inplace_res = xurl_remove_dot_segments(inplace, len, inplace, sizeof(inplace), &inplace_len);
+
+        if (!res || !inplace_res)
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " dot segments %s\n"
+                    "  Removal failed\n", path);
+        else if (output_len != strlen(expected) || memcmp(output, expected, output_len))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " dot segments %s\n"
+                    "  Got \"%.*s\", expected \"%s\"\n", path, (int) output_len, output, expected);
+        else if (inplace_len != output_len || memcmp(inplace, output, output_len))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " dot segments %s\n"
+                    "  Got \"%.*s\" in place, expected \"%s\"\n", path, (int) inplace_len, inplace, expected);
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " dot segments %s\n", path);
+            (*passed)++;
+        }
+        (*total)++;
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+// Write the parameters of [query] in [dst] as a sequence
+// of "key=value;" or "key;" for keys without a value.
+static void dump_params(const char *query, int flags, char *dst, size_t max)
+{
+    xurl_query_iter iter;
+    xurl_query_param param;
+    size_t used = 0;
+    dst[0] = '\0';
+
+    xurl_query_init(&iter, query, query ? strlen(query) : 0, flags);
+    while (xurl_query_next(&iter, &param) && used < max) {
+        if (param.value == NULL)
+            used += snprintf(dst + used, max - used, "%.*s;",
+                             (int) param.key_len, param.key);
+        else
+            used += snprintf(dst + used, max - used, "%.*s=%.*s;",
+                             (int) param.key_len, param.key,
+                             (int) param.value_len, param.value);
+    }
+}
+
+int test_query(size_t *total, size_t *passed)
+{
+    static const struct {
+        int flags;
+        const char *query;
+        const char *expected;
+    } list[] = {
+        {0, NULL, ""},
+        {0, "", ""},
+        {0, "name=francesco&date=today", "name=francesco;date=today;"},
+        {0, "a=1", "a=1;"},
+        {0, "a=", "a=;"},                  // Empty value
+        {0, "=1", "=1;"},                  // Empty key
+        {0, "=", "=;"},                    // Empty key and value
+        {0, "a", "a;"},                    // Key without value
+        {0, "a&b=2&c", "a;b=2;c;"},
+        {0, "a=1=2", "a=1=2;"},            // '=' inside the value
+        {0, "&&a=1&&&b=2&", "a=1;b=2;"},   // Empty parameters are skipped
+        {0, "a=1;b=2", "a=1;b=2;"},        // ';' isn't a separator by default
+        {XURL_QUERY_SEMICOLON, "a=1;b=2&c=3", "a=1;b=2;c=3;"},
+        {XURL_QUERY_SEMICOLON, ";;a;=", "a;=;"},
+        {0, "utm_source=newsletter&utm_medium=email&utm_campaign=spring_sale_2024&utm_term=running+shoes",
+            "utm_source=newsletter;utm_medium=email;utm_campaign=spring_sale_2024;utm_term=running+shoes;"},
+        {0, "q=a%26b&x=%3D", "q=a%26b;x=%3D;"}, // Percent-encoded separators aren't separators
+    };
+
+    for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++) {
+
+        const char *query = list[i].query;
+        const char *expected = list[i].expected;
+
+        char output[512];
+        dump_params(query, list[i].flags, output, sizeof(output));
+
+        if (strcmp(output, expected))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " query %s\n"
+                    "  Got \"%s\", expected \"%s\"\n", query ? query : "(null)", output, expected);
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " query %s\n", query ? query : "(null)");
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    {
+        static const char *keys[] = {
+            "id", "page", "sort", "utm_source", "utm_medium", "utm_campaign", "empty", "flag",
+        };
+        static const struct {
+            const char *query;
+            const char *expected[8]; // "key=value", "key" without value or NULL
+        } lookups[] = {
+            {"id=42&page=3&sort=desc", {"id=42", "page=3", "sort=desc", NULL, NULL, NULL, NULL, NULL}},
+            {"utm_campaign=spring&x=1&utm_source=newsletter&flag&empty=", 
+                {NULL, NULL, NULL, "utm_source=newsletter", NULL, "utm_campaign=spring", "empty=", "flag"}},
+            {"id=1&id=2", {"id=1", NULL, NULL, NULL, NULL, NULL, NULL, NULL}}, // First occurrence wins
+            {"identity=1&pag=2&pages=3", {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL}},
+            {"", {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL}},
+        };
+
+        xurl_keyset set;
+        bool built = xurl_keyset_init(&set, keys, sizeof(keys)/sizeof(keys[0]));
+
+        for (size_t i = 0; i < sizeof(lookups)/sizeof(lookups[0]); i++) {
+
+            const char *query = lookups[i].query;
+
+            bool failed = !built;
+            if (built) {
+                xurl_query_param params[8];
+                xurl_query_lookup(&set, query, strlen(query), 0, params);
+
+                for (size_t p = 0; p < 8; p++) {
+                    char output[128];
+                    if (params[p].key == NULL)
+                        output[0] = '\0';
+                    else if (params[p].value == NULL)
+                        snprintf(output, sizeof(output), "%.*s", (int) params[p].key_len, params[p].key);
+                    else
+                        snprintf(output, sizeof(output), "%.*s=%.*s",
+                                 (int) params[p].key_len, params[p].key,
+                                 (int) params[p].value_len, params[p].value);
+
+                    const char *expected = lookups[i].expected[p];
+                    if (expected == NULL)
+                        expected = "";
+
+                    if (strcmp(output, expected)) {
+                        fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " lookup %s\n"
+                                "  Key \"%s\": got \"%s\", expected \"%s\"\n", 
+                                query, keys[p], output, expected);
+                        failed = true;
+                    }
+                }
+            }
+
+            if (!failed) {
+                fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " lookup %s\n", query);
+                (*passed)++;
+            }
+            (*total)++;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+static bool same_slice(const char *a, size_t a_len, const char *b, size_t b_len)
+{
+    if (a == NULL || b == NULL)
+        return a == b;
+    return a_len == b_len && !memcmp(a, b, a_len);
+}
+
+static bool same_url(const xurl_t *a, const xurl_t *b)
+{
+    if (a->host.mode != b->host.mode || a->host.no_port != b->host.no_port)
+        return false;
+    if (!a->host.no_port && a->host.port != b->host.port)
+        return false;
+    return same_slice(a->schema, a->schema_len, b->schema, b->schema_len)
+        && same_slice(a->userinfo.username, a->userinfo.username_len, b->userinfo.username, b->userinfo.username_len)
+        && same_slice(a->userinfo.password, a->userinfo.password_len, b->userinfo.password, b->userinfo.password_len)
+        && (a->host.mode != XURL_HOSTMODE_NAME || same_slice(a->host.name, a->host.name_len, b->host.name, b->host.name_len))
+        && same_slice(a->path, a->path_len, b->path, b->path_len)
+        && same_slice(a->query, a->query_len, b->query, b->query_len)
+        && same_slice(a->fragment, a->fragment_len, b->fragment, b->fragment_len);
+}
+
+int test_resolve(size_t *total, size_t *passed)
+{
+    // Examples from RFC 3986, section 5.4
+    static const char base_str[] = "http://a/b/c/d;p?q";
+    static const struct {
+        const char *ref;
+        const char *expected;
+    } list[] = {
+        // Normal examples
+        {"g:h",     "g:h"},
+        {"g",       "http://a/b/c/g"},
+        {"./g",     "http://a/b/c/g"},
+        {"g/",      "http://a/b/c/g/"},
+        {"/g",      "http://a/g"},
+        {"//g",     "http://g"},
+        {"?y",      "http://a/b/c/d;p?y"},
+        {"g?y",     "http://a/b/c/g?y"},
+        {"#s",      "http://a/b/c/d;p?q#s"},
+        {"g#s",     "http://a/b/c/g#s"},
+        {"g?y#s",   "http://a/b/c/g?y#s"},
+        {";x",      "http://a/b/c/;x"},
+        {"g;x",     "http://a/b/c/g;x"},
+        {"g;x?y#s", "http://a/b/c/g;x?y#s"},
+        {"",        "http://a/b/c/d;p?q"},
+        {".",       "http://a/b/c/"},
+        {"./",      "http://a/b/c/"},
+        {"..",      "http://a/b/"},
+        {"../",     "http://a/b/"},
+        {"../g",    "http://a/b/g"},
+        {"../..",   "http://a/"},
+        {"../../",  "http://a/"},
+        {"../../g", "http://a/g"},
+
+        // Abnormal examples
+        {"../../../g",    "http://a/g"},
+        {"../../../../g", "http://a/g"},
+        {"/./g",          "http://a/g"},
+        {"/../g",         "http://a/g"},
+        {"g.",            "http://a/b/c/g."},
+        {".g",            "http://a/b/c/.g"},
+        {"g..",           "http://a/b/c/g.."},
+        {"..g",           "http://a/b/c/..g"},
+        {"./../g",        "http://a/b/g"},
+        {"./g/.",         "http://a/b/c/g/"},
+        {"g/./h",         "http://a/b/c/g/h"},
+        {"g/../h",        "http://a/b/c/h"},
+        {"g;x=1/./y",     "http://a/b/c/g;x=1/y"},
+        {"g;x=1/../y",    "http://a/b/c/y"},
+        {"g?y/./x",       "http://a/b/c/g?y/./x"},
+        {"g?y/../x",      "http://a/b/c/g?y/../x"},
+        {"g#s/./x",       "http://a/b/c/g#s/./x"},
+        {"g#s/../x",      "http://a/b/c/g#s/../x"},
+        {"http:g",        "http:g"},
+    };
+
+    for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++) {
+
+        const char *ref_str = list[i].ref;
+        const char *expected = list[i].expected;
+
+        char base_copy[sizeof(base_str)];
+        char ref_copy[64];
+        memcpy(base_copy, base_str, sizeof(base_str));
+        strcpy(ref_copy, ref_str);
+
+        xurl_t base, ref, out, reparsed;
+        char output[256];
+        size_t output_len;
+        if (!xurl_parse(base_copy, strlen(base_copy), &base) || !xurl_parse_reference(ref_copy, strlen(ref_copy), &ref))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " resolve \"%s\"\n"
+                    "  Parsing failed\n", ref_str);
+        else if (!xurl_resolve(&base, &ref, output, sizeof(output), &output_len, &out))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " resolve \"%s\"\n"
+                    "  Resolution failed\n", ref_str);
+        else if (output_len != strlen(expected) || memcmp(output, expected, output_len))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " resolve \"%s\"\n"
+                    "  Got \"%.*s\", expected \"%s\"\n", ref_str, (int) output_len, output, expected);
+        else if (!xurl_parse(expected, strlen(expected), &reparsed) || !same_url(&out, &reparsed))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " resolve \"%s\"\n"
+                    "  Resulting components don't match the parsed result\n", ref_str);
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " resolve \"%s\"\n", ref_str);
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    {
+        // Destination buffer too small
+        const char *ref_str = "g/h/i/j";
+        xurl_t base, ref, out;
+        char output[12];
+        size_t output_len;
+        if (xurl_parse(base_str, strlen(base_str), &base)
+            && xurl_parse_reference(ref_str, strlen(ref_str), &ref)
+            && !xurl_resolve(&base, &ref, output, sizeof(output), &output_len, &out)) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " resolve \"%s\" (small buffer)\n", ref_str);
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " resolve \"%s\" (small buffer)\n"
+                    "  Resolution succeded unexpectedly\n", ref_str);
+        (*total)++;
+    }
+
+    {
+        // The base must be absolute
+        const char *base_str2 = "/a/b";
+        const char *ref_str = "c";
+        xurl_t base, ref, out;
+        char output[64];
+        size_t output_len;
+        if (xurl_parse(base_str2, strlen(base_str2), &base)
+            && xurl_parse_reference(ref_str, strlen(ref_str), &ref)
+            && !xurl_resolve(&base, &ref, output, sizeof(output), &output_len, &out)) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " resolve \"%s\" (relative base)\n", ref_str);
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " resolve \"%s\" (relative base)\n"
+                    "  Resolution succeded unexpectedly\n", ref_str);
+        (*total)++;
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+static uint32_t next_random(uint32_t *state)
+{
+    // xorshift32
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static size_t generate_input(uint32_t *state, char *dst, size_t max)
+{
+    static const char *prefixes[] = {
+        "", "/", "http:", "http://example.com", "http://example.com/", "//127.0.0.1:80/",
+        "http://", "http://user",
+    };
+
+    // Mostly characters that are valid in paths, queries
+    // and fragments, with some that terminate them.
+    static const char alphabet[] = 
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+        "-._~!$&'()*+,;=:@" "////??" "#%[] \"<>\\^`{|}\x7f\x80\xff";
+
+    const char *prefix = prefixes[next_random(state) % (sizeof(prefixes)/sizeof(prefixes[0]))];
+    size_t len = strlen(prefix);
+    memcpy(dst, prefix, len);
+
+    // Terminators are rare, so that long runs are generated
+    size_t common = 62 + 17 + 6;
+    size_t extra = len + next_random(state) % 150;
+    if (extra > max)
+        extra = max;
+    while (len < extra) {
+        uint32_t r = next_random(state);
+        if (r % 64)
+            dst[len++] = alphabet[r / 64 % common];
+        else
+            dst[len++] = alphabet[r / 64 % (sizeof(alphabet) - 1)];
+    }
+    return len;
+}
+
+static bool same_results(bool res1, size_t i1, const xurl_t *url1,
+                         bool res2, size_t i2, const xurl_t *url2)
+{
+    if (res1 != res2 || i1 != i2)
+        return false;
+
+    if (!res1)
+        return true;
+
+    return url1->userinfo.username == url2->userinfo.username
+        && url1->userinfo.password == url2->userinfo.password
+        && url1->host.mode == url2->host.mode
+        && (url1->host.mode != XURL_HOSTMODE_NAME || (url1->host.name == url2->host.name && url1->host.name_len == url2->host.name_len))
+        && url1->host.port == url2->host.port
+        && url1->path == url2->path && url1->path_len == url2->path_len
+        && url1->query == url2->query && url1->query_len == url2->query_len
+        && url1->fragment == url2->fragment && url1->fragment_len == url2->fragment_len;
+}
+
+int test_simd(size_t *total, size_t *passed)
+{
+    static const char *names[] = {
+        [XURL_SIMD_NONE] = "scalar",
+        [XURL_SIMD_SSE2] = "sse2",
+        [XURL_SIMD_AVX2] = "avx2",
+    };
+
+    xurl_simd best = xurl_get_simd();
+
+    for (xurl_simd level = XURL_SIMD_NONE + 1; level <= best; level++) {
+
+        uint32_t state = 2463534242;
+        size_t count = 20000;
+        bool failed = false;
+
+        for (size_t n = 0; n < count && !failed; n++) {
+
+            char input[256];
+            size_t len = generate_input(&state, input, sizeof(input));
+
+            // The scalar loops are the reference
+            xurl_t exp;
+            size_t exp_i = 0;
+            xurl_set_simd(XURL_SIMD_NONE);
+            bool exp_res = xurl_parse2(input, len, &exp_i, &exp);
+
+            xurl_t out;
+            size_t out_i = 0;
+            xurl_set_simd(level);
+            bool out_res = xurl_parse2(input, len, &out_i, &out);
+
+            if (!same_results(exp_res, exp_i, &exp, out_res, out_i, &out)) {
+                fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " %.*s\n"
+                        "  Results of the %s scanner don't match the scalar ones\n",
+                        (int) len, input, names[level]);
+                failed = true;
+            }
+        }
+
+        if (!failed) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " %s scanner (%zu inputs)\n",
+                    names[level], count);
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    xurl_set_simd(best);
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+int test_suffix(size_t *total, size_t *passed)
+{
+    // Mostly from the test cases of the Public Suffix
+    // List (tests/test_psl.txt in its repository).
+    static const struct {
+        const char *host;
+        const char *domain; // NULL if there is none
+    } list[] = {
+
+        // Mixed case
+        {"COM", NULL},
+        {"example.COM", "example.COM"},
+        {"WwW.example.COM", "example.COM"},
+
+        // Leading and trailing dots, empty labels
+        {".com", NULL},
+        {".example", NULL},
+        {"example.com.", "example.com."},
+        {"www.example.com.", "example.com."},
+        {"a..example.com", "example.com"},
+        {"example..com", NULL},
+
+        // Unlisted TLD
+        {"example", NULL},
+        {"example.example", "example.example"},
+        {"b.example.example", "example.example"},
+        {"a.b.example.example", "example.example"},
+
+        // TLD with only one rule
+        {"biz", NULL},
+        {"domain.biz", "domain.biz"},
+        {"b.domain.biz", "domain.biz"},
+        {"a.b.domain.biz", "domain.biz"},
+
+        // TLD with some two-level rules
+        {"com", NULL},
+        {"example.com", "example.com"},
+        {"b.example.com", "example.com"},
+        {"a.b.example.com", "example.com"},
+        {"uk.com", NULL},
+        {"example.uk.com", "example.uk.com"},
+        {"b.example.uk.com", "example.uk.com"},
+        {"a.b.example.uk.com", "example.uk.com"},
+        {"test.ac", "test.ac"},
+
+        // TLD with only one wildcard rule
+        {"mm", NULL},
+        {"c.mm", NULL},
+        {"b.c.mm", "b.c.mm"},
+        {"a.b.c.mm", "b.c.mm"},
+
+        // More complex TLD
+        {"jp", NULL},
+        {"test.jp", "test.jp"},
+        {"www.test.jp", "test.jp"},
+        {"ac.jp", NULL},
+        {"test.ac.jp", "test.ac.jp"},
+        {"www.test.ac.jp", "test.ac.jp"},
+        {"kyoto.jp", NULL},
+        {"test.kyoto.jp", "test.kyoto.jp"},
+        {"ide.kyoto.jp", NULL},
+        {"b.ide.kyoto.jp", "b.ide.kyoto.jp"},
+        {"a.b.ide.kyoto.jp", "b.ide.kyoto.jp"},
+        {"c.kobe.jp", NULL},
+        {"b.c.kobe.jp", "b.c.kobe.jp"},
+        {"a.b.c.kobe.jp", "b.c.kobe.jp"},
+        {"city.kobe.jp", "city.kobe.jp"},
+        {"www.city.kobe.jp", "city.kobe.jp"},
+
+        // TLD with a wildcard rule and exceptions
+        {"ck", NULL},
+        {"test.ck", NULL},
+        {"b.test.ck", "b.test.ck"},
+        {"a.b.test.ck", "b.test.ck"},
+        {"www.ck", "www.ck"},
+        {"www.www.ck", "www.ck"},
+
+        // US K12
+        {"us", NULL},
+        {"test.us", "test.us"},
+        {"www.test.us", "test.us"},
+        {"ak.us", NULL},
+        {"test.ak.us", "test.ak.us"},
+        {"www.test.ak.us", "test.ak.us"},
+        {"k12.ak.us", NULL},
+        {"test.k12.ak.us", "test.k12.ak.us"},
+        {"www.test.k12.ak.us", "test.k12.ak.us"},
+
+        // Punycoded IDN labels
+        {"xn--85x722f.com.cn", "xn--85x722f.com.cn"},
+        {"xn--85x722f.xn--55qx5d.cn", "xn--85x722f.xn--55qx5d.cn"},
+        {"www.xn--85x722f.xn--55qx5d.cn", "xn--85x722f.xn--55qx5d.cn"},
+        {"shishi.xn--55qx5d.cn", "shishi.xn--55qx5d.cn"},
+        {"xn--55qx5d.cn", NULL},
+        {"xn--85x722f.xn--fiqs8s", "xn--85x722f.xn--fiqs8s"},
+        {"www.xn--85x722f.xn--fiqs8s", "xn--85x722f.xn--fiqs8s"},
+        {"shishi.xn--fiqs8s", "shishi.xn--fiqs8s"},
+        {"xn--fiqs8s", NULL},
+    };
+
+    for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++) {
+
+        const char *name = list[i].host;
+        xurl_host host = {
+            .mode = XURL_HOSTMODE_NAME,
+            .name = name,
+            .name_len = strlen(name),
+            .no_port = true,
+        };
+
+        const char *domain;
+        size_t domain_len;
+        bool found = xurl_registrable_domain(&host, &domain, &domain_len);
+
+        const char *exp = list[i].domain;
+        bool ok;
+        if (exp == NULL)
+            ok = !found;
+        else
+            ok = found
+              && domain + domain_len == name + host.name_len // A slice of the name
+              && domain_len == strlen(exp)
+              && !memcmp(domain, exp, domain_len);
+
+        if (ok) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " suffix %s\n", name);
+            (*passed)++;
+        } else if (found)
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " suffix %s\n"
+                    "  Got \"%.*s\", expected %s\n", name, (int) domain_len, domain, exp ? exp : "none");
+        else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " suffix %s\n"
+                    "  Got none, expected \"%s\"\n", name, exp);
+        (*total)++;
+    }
+
+    {
+        // IP addresses have no registrable domain
+        xurl_t url;
+        const char *domain;
+        size_t domain_len;
+        if (xurl_parse("http://127.0.0.1/", 17, &url)
+            && !xurl_registrable_domain(&url.host, &domain, &domain_len)) {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " suffix (IP address)\n");
+            (*passed)++;
+        } else
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " suffix (IP address)\n"
+                    "  Got a registrable domain\n");
+        (*total)++;
+    }
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../xurl.h"
+
+// The component [slice] must be [expected], found
+// in [input], or absent if [expected] is NULL.
+static bool same_slice(const char *input, const char *slice, size_t slice_len,
+                       const char *expected)
+{
+    if (expected == NULL)
+        return slice == NULL && slice_len == 0;
+    if (expected[0] == '\0')
+        return slice != NULL && slice_len == 0;
+    const char *found = strstr(input, expected);
+    return found != NULL && slice == found && slice_len == strlen(expected);
+}
+
+int test_target(size_t *total, size_t *passed)
+{
+    static const struct {
+        xurl_method_hint method;
+        const char *input;
+        xurl_target_form form;
+        const char *schema;
+        const char *host; // Text of the host, if it's a name
+        int port;         // -1 if there's none
+        const char *path;
+        const char *query;
+    } list[] = {
+
+        // Origin-form
+        {XURL_METHOD_OTHER,   "/", XURL_TARGET_ORIGIN, NULL, NULL, -1, "/", NULL},
+        {XURL_METHOD_OTHER,   "/index.html", XURL_TARGET_ORIGIN, NULL, NULL, -1, "/index.html", NULL},
+        {XURL_METHOD_OTHER,   "/where?q=now", XURL_TARGET_ORIGIN, NULL, NULL, -1, "/where", "q=now"},
+        {XURL_METHOD_OPTIONS, "/a/b?", XURL_TARGET_ORIGIN, NULL, NULL, -1, "/a/b", ""},
+        {XURL_METHOD_OTHER,   "/a%20b?c=%2F", XURL_TARGET_ORIGIN, NULL, NULL, -1, "/a%20b", "c=%2F"},
+        {XURL_METHOD_OTHER,   "/a//b?c", XURL_TARGET_ORIGIN, NULL, NULL, -1, "/a//b", "c"},
+        {XURL_METHOD_OTHER,   "/a%2F//", XURL_TARGET_ORIGIN, NULL, NULL, -1, "/a%2F//", NULL},
+
+        // An absolute-path can start with empty segments,
+        // so this is an origin-form and not an authority
+        {XURL_METHOD_OTHER,   "//example.com/", XURL_TARGET_ORIGIN, NULL, NULL, -1, "//example.com/", NULL},
+
+        {XURL_METHOD_OTHER,   "/a#frag", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+        {XURL_METHOD_OTHER,   "/a b", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+        {XURL_METHOD_CONNECT, "/index.html", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+
+        // Absolute-form
+        {XURL_METHOD_OTHER,   "http://www.example.org/pub/WWW/TheProject.html", XURL_TARGET_ABSOLUTE, "http", "www.example.org", -1, "/pub/WWW/TheProject.html", NULL},
+        {XURL_METHOD_OTHER,   "http://example.com:8080?q=1", XURL_TARGET_ABSOLUTE, "http", "example.com", 8080, NULL, "q=1"},
+        {XURL_METHOD_OPTIONS, "http://example.com", XURL_TARGET_ABSOLUTE, "http", "example.com", -1, NULL, NULL},
+        {XURL_METHOD_OTHER,   "http://example.com/#frag", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+        {XURL_METHOD_OTHER,   "example.com/index.html", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+
+        // Authority-form
+        {XURL_METHOD_CONNECT, "www.example.com:80", XURL_TARGET_AUTHORITY, NULL, "www.example.com", 80, NULL, NULL},
+        {XURL_METHOD_CONNECT, "127.0.0.1:443", XURL_TARGET_AUTHORITY, NULL, NULL, 443, NULL, NULL},
+        {XURL_METHOD_CONNECT, "[::1]:8443", XURL_TARGET_AUTHORITY, NULL, NULL, 8443, NULL, NULL},
+        {XURL_METHOD_CONNECT, "www.example.com", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+        {XURL_METHOD_CONNECT, "www.example.com:", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+        {XURL_METHOD_CONNECT, "user@www.example.com:80", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+        {XURL_METHOD_CONNECT, "www.example.com:80/", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+        {XURL_METHOD_CONNECT, "http://www.example.com:80", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+
+        // Without CONNECT, this is an absolute URI
+        // with a rootless path.
+        {XURL_METHOD_OTHER,   "www.example.com:80", XURL_TARGET_ABSOLUTE, "www.example.com", NULL, -1, "80", NULL},
+
+        // Asterisk-form
+        {XURL_METHOD_OPTIONS, "*", XURL_TARGET_ASTERISK, NULL, NULL, -1, "*", NULL},
+        {XURL_METHOD_OTHER,   "*", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+        {XURL_METHOD_CONNECT, "*", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+        {XURL_METHOD_OPTIONS, "*/", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+
+        {XURL_METHOD_OTHER,   "", XURL_TARGET_INVALID, NULL, NULL, -1, NULL, NULL},
+    };
+
+    for (size_t i = 0; i < sizeof(list)/sizeof(list[0]); i++) {
+
+        const char *input = list[i].input;
+        xurl_t url;
+        xurl_target_form form = xurl_parse_request_target(input, strlen(input), list[i].method, &url);
+
+        if (form != list[i].form)
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " target %s\n"
+                    "  Got form %d, expected %d\n", input, form, list[i].form);
+        else if (form != XURL_TARGET_INVALID
+              && (!same_slice(input, url.schema, url.schema_len, list[i].schema)
+               || (url.host.mode == XURL_HOSTMODE_NAME && !same_slice(input, url.host.name, url.host.name_len, list[i].host))
+               || url.host.no_port != (list[i].port < 0)
+               || (list[i].port >= 0 && url.host.port != list[i].port)
+               || url.userinfo.username != NULL
+               || !same_slice(input, url.path, url.path_len, list[i].path)
+               || !same_slice(input, url.query, url.query_len, list[i].query)
+               || url.fragment != NULL))
+            fprintf(stderr, "\n" ANSI_COLOR_RED "FAILED" ANSI_COLOR_RESET " target %s\n"
+                    "  Components don't match\n", input);
+        else {
+            fprintf(stderr, ANSI_COLOR_GREEN "PASSED" ANSI_COLOR_RESET " target %s\n", input);
+            (*passed)++;
+        }
+        (*total)++;
+    }
+
+    return 0;
+}
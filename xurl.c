@@ -1,13 +1,81 @@
 #include <assert.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdatomic.h>
 #include "xurl.h"
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#define XURL_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define XURL_X86_SIMD 0
+#endif
+
 // [<schema> : ] // [ <username> [ : <password> ] @ ] { <name> | <IPv4> | "[" <IPv5> "]" } [ : <port> ] [ </path> ] [ ? <query> ] [ # <fragment> ]
 
-static bool is_lower_alpha(char c)
+// Character classes used by the scanners. Each byte of
+// the input is classified by a single lookup in the
+// [char_class] table, so that checking whether a byte
+// belongs to a class costs one load and one AND instead
+// of a chain of comparisons.
+enum {
+    CLASS_ALPHA        = 1 << 0,
+    CLASS_DIGIT        = 1 << 1,
+    CLASS_HEX          = 1 << 2,
+    CLASS_UNRESERVED   = 1 << 3,
+    CLASS_SUBDELIM     = 1 << 4,
+    CLASS_PCHAR        = 1 << 5,
+    CLASS_QUERY        = 1 << 6,
+    CLASS_FRAGMENT     = 1 << 7,
+    CLASS_SCHEMA       = 1 << 8,
+    CLASS_HOSTNAME     = 1 << 9, // Also used for the userinfo
+    CLASS_AUTHORITY    = 1 << 10, // What the authority adds to the hostname
+};
+
+// Shorthands for the table below. Every character that
+// is unreserved or a sub-delimiter is also a pchar, and
+// every pchar is also a query and fragment character.
+#define QU (CLASS_QUERY)
+#define QF (CLASS_QUERY | CLASS_FRAGMENT)
+#define PC (CLASS_PCHAR | QF)
+#define SD (CLASS_SUBDELIM | CLASS_HOSTNAME | PC)
+#define SS (SD | CLASS_SCHEMA)
+#define UN (CLASS_UNRESERVED | CLASS_HOSTNAME | PC)
+#define US (UN | CLASS_SCHEMA)
+#define AL (CLASS_ALPHA | US)
+#define HA (AL | CLASS_HEX)
+#define DI (CLASS_DIGIT | CLASS_HEX | US)
+#define AU (CLASS_AUTHORITY)
+#define CO (PC | AU)
+
+// Bytes from 0x80 onwards are left to zero.
+static const uint16_t char_class[256] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, // 0x00
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, // 0x10
+     0, SD,  0,  0, SD, AU, SD, SD, SD, SD, SD, SS, SD, US, US, QF, // 0x20
+    DI, DI, DI, DI, DI, DI, DI, DI, DI, DI, CO, SD,  0, SD,  0, QU, // 0x30
+    PC, HA, HA, HA, HA, HA, HA, AL, AL, AL, AL, AL, AL, AL, AL, AL, // 0x40
+    AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AU,  0, AU,  0, UN, // 0x50
+     0, HA, HA, HA, HA, HA, HA, AL, AL, AL, AL, AL, AL, AL, AL, AL, // 0x60
+    AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,  0,  0,  0, UN,  0, // 0x70
+};
+
+#undef QU
+#undef QF
+#undef PC
+#undef SD
+#undef SS
+#undef UN
+#undef US
+#undef AL
+#undef HA
+#undef DI
+#undef AU
+#undef CO
+
+static bool has_class(char c, uint16_t mask)
 {
-    return c >= 'a' && c <= 'z';
+    return char_class[(unsigned char) c] & mask;
 }
 
 static bool is_upper_alpha(char c)
@@ -17,58 +85,62 @@ static bool is_upper_alpha(char c)
 
 static bool is_alpha(char c)
 {
-    return is_upper_alpha(c)
-        || is_lower_alpha(c);
+    return has_class(c, CLASS_ALPHA);
 }
 
 static bool is_digit(char c)
 {
-    return c >= '0' && c <= '9';
+    return has_class(c, CLASS_DIGIT);
 }
 
 static bool is_hex_digit(char c)
 {
-    return is_digit(c) 
-        || (c >= 'a' && c <= 'f')
-        || (c >= 'A' && c <= 'F');
+    return has_class(c, CLASS_HEX);
 }
 
-static bool is_unreserved(char c)
+static bool is_pchar(char c)
 {
-    return is_alpha(c) || is_digit(c) 
-        || c == '-' || c == '.' 
-        || c == '_' || c == '~';
+    return has_class(c, CLASS_PCHAR);
 }
 
-static bool is_subdelim(char c)
+static bool is_schema_first(char c)
 {
-    return c == '!' || c == '$' 
-        || c == '&' || c == '\'' 
-        || c == '(' || c == ')' 
-        || c == '*' || c == '+' 
-        || c == ',' || c == ';' 
-        || c == '=';
+    return is_alpha(c);
 }
 
-static bool is_pchar(char c)
+static bool is_schema(char c)
 {
-    return is_unreserved(c) 
-        || is_subdelim(c) 
-        || c == ':' || c == '@';
+    return has_class(c, CLASS_SCHEMA);
 }
 
-static bool is_schema_first(char c)
+// Percent-encoded byte ("%" HEXDIG HEXDIG) starting at [k]
+static bool is_pct_encoded(const char *src, size_t len, size_t k)
 {
-    return is_alpha(c);
+    return k+2 < len
+        && src[k] == '%'
+        && is_hex_digit(src[k+1])
+        && is_hex_digit(src[k+2]);
 }
 
-static bool is_schema(char c)
+/* Symbol: scan_class
+ *   Scan the characters of the class [mask] and the
+ *   percent-encoded bytes starting at [k].
+ *
+ * Returns:
+ *   - The offset of the first byte that wasn't scanned.
+ */
+static size_t scan_class(const char *src, size_t len,
+                         size_t k, uint16_t mask)
 {
-    return is_alpha(c) 
-        || is_digit(c) 
-        || c == '+' 
-        || c == '-'
-        || c == '.';
+    while (k < len) {
+        if (has_class(src[k], mask))
+            k++;
+        else if (is_pct_encoded(src, len, k))
+            k += 3;
+        else
+            break;
+    }
+    return k;
 }
 
 /* Symbol: parse_schema 
@@ -164,29 +236,8 @@ static void parse_schema(XURL_INPUT_CONSTNESS char *src,
     }
 }
 
-static bool is_username(char c)
-{
-    return is_unreserved(c) || is_subdelim(c);
-}
-
-static bool is_username_first(char c)
-{
-    return is_username(c);
-}
-
-static bool is_password(char c)
-{
-    return is_username(c);
-}
-
-static bool is_password_first(char c)
-{
-    return is_password(c);
-}
-
 /* Symbol: parse_userinfo
- *   Parse the userinfo component of an URL,
- *   if there is one.
+ *   Parse the userinfo component of an URL.
  *
  *   The userinfo component is a subcomponent
  *   of the authority. It contains a username
@@ -197,147 +248,69 @@ static bool is_password_first(char c)
  *
  *   This functions parses the portion that
  *   goes from the byte following "//" to 
- *   the '@'.
+ *   the '@', which was already found by
+ *   [scan_authority].
  *
  * Arguments:
  *         (in) src: The source string.
  *
- *              len: The number of bytes pointed by [src]
+ *                i: Offset of the first byte of the
+ *                   userinfo.
  *
- *       (in/out) i: Offset from where the parsing should
- *                   start. When the function returns, its
- *                   value is incremented by the number of
- *                   parsed bytes (therefore pointing to the
- *                   first non-parsed byte). If the url in
- *                   the source has no userinfo, it's value
- *                   is left unchanged.
+ *               at: Offset of the '@' that ends the
+ *                   userinfo.
  *
  *   (out) userinfo: The result of the parsing. 
  * 
  * Returns:
- *   - [i] is incremented by the number of parsed bytes.
- *
- *   - [userinfo] contains the parsed username and
- *     password. These strings are not zero-terminated.
- *     If there was no userinfo component, then
- *     [userinfo.username] and [userinfo.password] are
- *     NULL and [userinfo.username_len] and
- *     [userinfo.password_len] are 0. If the username
- *     is specified but the password isn't, then only
- *     [userinfo.password] is NULL and 
+ *   - [true] if the bytes between [i] and [at] are
+ *     a valid userinfo, in which case [userinfo]
+ *     contains the parsed username and password.
+ *     These strings are not zero-terminated. If the
+ *     username is specified but the password isn't,
+ *     then [userinfo.password] is NULL and
  *     [userinfo.password_len] is 0.
  *
- * Notes:
- *   - This function can never fail.
+ *   - [false] otherwise, in which case the '@'
+ *     doesn't end a userinfo and [userinfo] is
+ *     left unchanged.
  */
-static void parse_userinfo(XURL_INPUT_CONSTNESS char *src, 
-                           size_t len, size_t *i, 
+static bool parse_userinfo(XURL_INPUT_CONSTNESS char *src, 
+                           size_t i, size_t at,
                            xurl_userinfo *userinfo)
 {
-    size_t peek = *i; // Local cursor
+    // Both the username and the password
+    // are non-empty.
+    size_t username_end = scan_class(src, at, i, CLASS_HOSTNAME);
+    if (username_end == i)
+        return false;
 
-    bool no_username;
-    bool no_password;
-    size_t username_offset;
-    size_t username_length;
     size_t password_offset;
     size_t password_length;
 
-    // If the userinfo subcomponent is present,
-    // set [no_username] to false, [username_offset]
-    // to the offset of the username relative to 
-    // [src] and [username_length] to its length. 
-    // If the password was also specified, do the
-    // same.  
-    {
-        if (peek == len || !is_username_first(src[peek])) {
-            // The first character can't be the first
-            // of an username, therefore there's no
-            // userinfo subcomponent.
-            no_username = true;
-            no_password = true;
-        } else {
-
-            // The first character is a valid start
-            // for an username, therefore we'll assume
-            // that there's a userinfo subcomponent
-            // until proven otherwise.
-
-            // Scan the username while keeping track
-            // of it's offset and length.
-            username_offset = peek;
-            do
-                peek++;
-            while (peek < len && is_username(src[peek]));
-            username_length = peek - username_offset;
-            
-            // If the username is followed by a ':' and
-            // a valid password character, we also expect 
-            // a password.
-            if (peek+1 < len && src[peek] == ':' && is_password_first(src[peek+1])) {
-                
-                peek++; // Skip the ':'
-                
-                // Scan the password while keeping track
-                // of it's offset and length.
-                password_offset = peek;
-                do
-                    peek++;
-                while (peek < len && is_password(src[peek]));
-                password_length = peek - password_offset;
-
-                if (peek == len || src[peek] != '@') {
-                    // If the password isn't followed by a '@',
-                    // then this wasn't a userinfo subcomponent
-                    // after all.
-                    no_username = true;
-                    no_password = true;
-                } else {
-                    // All done. 
-                    no_username = false;
-                    no_password = false;
-                    peek++; // Skip the '@'
-                }
-
-            } else if (peek == len || src[peek] != '@') {
-                // Since no password was specified, if the 
-                // username isn't followed by a '@', then 
-                // this wasn't a userinfo subcomponent after 
-                // all.
-                no_username = true;
-                no_password = true;
-            } else {
-                // All done.
-                no_username = false;
-                no_password = true;
-                peek++; // Skip the '@'
-            }
-        }
+    if (username_end == at) {
+        password_offset = 0;
+        password_length = 0;
+    } else {
+        if (src[username_end] != ':')
+            return false;
+        password_offset = username_end + 1;
+        if (password_offset == at || scan_class(src, at, password_offset, CLASS_HOSTNAME) != at)
+            return false;
+        password_length = at - password_offset;
     }
 
-    // Update the output parameters.
-    if (no_username) {
-        assert(no_password);
-        userinfo->username = NULL;
-        userinfo->username_len = 0;
+    userinfo->username = src + i;
+    userinfo->username_len = username_end - i;
+
+    if (password_length == 0) {
         userinfo->password = NULL;
         userinfo->password_len = 0;
-        // Don't update [i]
     } else {
-        
-        userinfo->username = src + username_offset;
-        userinfo->username_len = username_length;
-
-        if (no_password) {
-            userinfo->password = NULL;
-            userinfo->password_len = 0;
-        } else {
-            userinfo->password = src + password_offset;
-            userinfo->password_len = password_length;
-        }
-
-        *i = peek; // Commit changes.
+        userinfo->password = src + password_offset;
+        userinfo->password_len = password_length;
     }
+    return true;
 }
 
 static bool parse_ipv4_byte(const char *src, size_t len,
@@ -351,17 +324,21 @@ static bool parse_ipv4_byte(const char *src, size_t len,
 
     if (start_with_digit) {
 
-        uint8_t byte = 0;
-    
-        // TODO: Don't allow arbitrary sequence of
-        //       0s at the start.
-        do {
-            int d = src[peek] - '0';
-            if (byte > (UINT8_MAX - d) / 10)
-                break; // Overflow! This digit isn't part of the byte.
-            byte = byte * 10 + d;
-            peek++;
-        } while (peek < len && is_digit(src[peek]));
+        int byte = src[peek++] - '0';
+
+        // A byte is at most 3 digits and a 0 can't
+        // be followed by other digits. If a digit
+        // would make the byte overflow, it's not
+        // part of it.
+        if (byte != 0) {
+            for (int n = 1; n < 3 && peek < len && is_digit(src[peek]); n++) {
+                int next = byte * 10 + (src[peek] - '0');
+                if (next > UINT8_MAX)
+                    break;
+                byte = next;
+                peek++;
+            }
+        }
 
         *i = peek;
         *out = byte;
@@ -378,8 +355,8 @@ static uint32_t pack(uint8_t *bytes)
          | ((uint32_t) bytes[3] <<  0);
 }
 
-static bool parse_ipv4(const char *src, size_t len, 
-                       size_t *i, uint32_t *ipv4)
+static bool parse_ipv4_scalar(const char *src, size_t len, 
+                              size_t *i, uint32_t *ipv4)
 {
     size_t peek = *i;
     uint8_t unpacked_ipv4[4];
@@ -402,114 +379,295 @@ static bool parse_ipv4(const char *src, size_t len,
     return true;
 }
 
-static int hex_digit_to_int(char c)
-{
-    assert(is_hex_digit(c));
-    
-    if (is_lower_alpha(c))
-        return c - 'a' + 10;
-    
-    if (is_upper_alpha(c))
-        return c - 'A' + 10;
-    
-    assert(is_digit(c));
-    return c - '0';
-}
+#if XURL_X86_SIMD
 
-static bool parse_ipv6_word(const char *src, size_t len,
-                            size_t *i, uint16_t *out)
+/* Symbol: ipv4_shuffles
+ *   For each combination of octet lengths (from 1
+ *   to 3 digits), the shuffle that moves the digits
+ *   of a dotted-quad into four 32-bit lanes, one per
+ *   octet, as hundreds, tens and units followed by a
+ *   zero. Missing digits are zero too. The index is
+ *   (l0-1)*27 + (l1-1)*9 + (l2-1)*3 + (l3-1).
+ */
+static const uint8_t ipv4_shuffles[81][16] = {
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80}, // 1.1.1.1
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80}, // 1.1.1.2
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80}, // 1.1.1.3
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x07, 0x80}, // 1.1.2.1
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x07, 0x08, 0x80}, // 1.1.2.2
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x07, 0x08, 0x09, 0x80}, // 1.1.2.3
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x08, 0x80}, // 1.1.3.1
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x08, 0x09, 0x80}, // 1.1.3.2
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x08, 0x09, 0x0A, 0x80}, // 1.1.3.3
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x07, 0x80}, // 1.2.1.1
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x07, 0x08, 0x80}, // 1.2.1.2
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x80, 0x05, 0x80, 0x07, 0x08, 0x09, 0x80}, // 1.2.1.3
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x80, 0x08, 0x80}, // 1.2.2.1
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x08, 0x09, 0x80}, // 1.2.2.2
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x05, 0x06, 0x80, 0x08, 0x09, 0x0A, 0x80}, // 1.2.2.3
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x02, 0x03, 0x80, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x09, 0x80}, // 1.2.3.1
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x02, 0x03, 0x80, 0x05, 0x06, 0x07, 0x80, 0x80, 0x09, 0x0A, 0x80}, // 1.2.3.2
+    {0x80, 0x80, 0x00, 0x80, 0x80, 0x02, 0x03, 0x80, 0x05, 0x06, 0x07, 0x80, 0x09, 0x0A, 0x0B, 0x80}, // 1.2.3.3
+    {0x80, 0x80, 0x00, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x08, 0x80}, // 1.3.1.1
+    {0x80, 0x80, 0x00, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x08, 0x09, 0x80}, // 1.3.1.2
+    {0x80, 0x80, 0x00, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80, 0x08, 0x09, 0x0A, 0x80}, // 1.3.1.3
+    {0x80, 0x80, 0x00, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x80, 0x09, 0x80}, // 1.3.2.1
+    {0x80, 0x80, 0x00, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x09, 0x0A, 0x80}, // 1.3.2.2
+    {0x80, 0x80, 0x00, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80, 0x09, 0x0A, 0x0B, 0x80}, // 1.3.2.3
+    {0x80, 0x80, 0x00, 0x80, 0x02, 0x03, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x0A, 0x80}, // 1.3.3.1
+    {0x80, 0x80, 0x00, 0x80, 0x02, 0x03, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80, 0x80, 0x0A, 0x0B, 0x80}, // 1.3.3.2
+    {0x80, 0x80, 0x00, 0x80, 0x02, 0x03, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80, 0x0A, 0x0B, 0x0C, 0x80}, // 1.3.3.3
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x07, 0x80}, // 2.1.1.1
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x07, 0x08, 0x80}, // 2.1.1.2
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x05, 0x80, 0x07, 0x08, 0x09, 0x80}, // 2.1.1.3
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x80, 0x08, 0x80}, // 2.1.2.1
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x08, 0x09, 0x80}, // 2.1.2.2
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x05, 0x06, 0x80, 0x08, 0x09, 0x0A, 0x80}, // 2.1.2.3
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x09, 0x80}, // 2.1.3.1
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x05, 0x06, 0x07, 0x80, 0x80, 0x09, 0x0A, 0x80}, // 2.1.3.2
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x05, 0x06, 0x07, 0x80, 0x09, 0x0A, 0x0B, 0x80}, // 2.1.3.3
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x08, 0x80}, // 2.2.1.1
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x08, 0x09, 0x80}, // 2.2.1.2
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80, 0x08, 0x09, 0x0A, 0x80}, // 2.2.1.3
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x80, 0x09, 0x80}, // 2.2.2.1
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x09, 0x0A, 0x80}, // 2.2.2.2
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80, 0x09, 0x0A, 0x0B, 0x80}, // 2.2.2.3
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x03, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x0A, 0x80}, // 2.2.3.1
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x03, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80, 0x80, 0x0A, 0x0B, 0x80}, // 2.2.3.2
+    {0x80, 0x00, 0x01, 0x80, 0x80, 0x03, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80, 0x0A, 0x0B, 0x0C, 0x80}, // 2.2.3.3
+    {0x80, 0x00, 0x01, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80, 0x09, 0x80}, // 2.3.1.1
+    {0x80, 0x00, 0x01, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x09, 0x0A, 0x80}, // 2.3.1.2
+    {0x80, 0x00, 0x01, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x07, 0x80, 0x09, 0x0A, 0x0B, 0x80}, // 2.3.1.3
+    {0x80, 0x00, 0x01, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80, 0x80, 0x0A, 0x80}, // 2.3.2.1
+    {0x80, 0x00, 0x01, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80, 0x0A, 0x0B, 0x80}, // 2.3.2.2
+    {0x80, 0x00, 0x01, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x07, 0x08, 0x80, 0x0A, 0x0B, 0x0C, 0x80}, // 2.3.2.3
+    {0x80, 0x00, 0x01, 0x80, 0x03, 0x04, 0x05, 0x80, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80, 0x0B, 0x80}, // 2.3.3.1
+    {0x80, 0x00, 0x01, 0x80, 0x03, 0x04, 0x05, 0x80, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0B, 0x0C, 0x80}, // 2.3.3.2
+    {0x80, 0x00, 0x01, 0x80, 0x03, 0x04, 0x05, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0B, 0x0C, 0x0D, 0x80}, // 2.3.3.3
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x08, 0x80}, // 3.1.1.1
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x08, 0x09, 0x80}, // 3.1.1.2
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x06, 0x80, 0x08, 0x09, 0x0A, 0x80}, // 3.1.1.3
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x80, 0x09, 0x80}, // 3.1.2.1
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x09, 0x0A, 0x80}, // 3.1.2.2
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x06, 0x07, 0x80, 0x09, 0x0A, 0x0B, 0x80}, // 3.1.2.3
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x0A, 0x80}, // 3.1.3.1
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80, 0x80, 0x0A, 0x0B, 0x80}, // 3.1.3.2
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x06, 0x07, 0x08, 0x80, 0x0A, 0x0B, 0x0C, 0x80}, // 3.1.3.3
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80, 0x09, 0x80}, // 3.2.1.1
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x09, 0x0A, 0x80}, // 3.2.1.2
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x07, 0x80, 0x09, 0x0A, 0x0B, 0x80}, // 3.2.1.3
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80, 0x80, 0x0A, 0x80}, // 3.2.2.1
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80, 0x0A, 0x0B, 0x80}, // 3.2.2.2
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x07, 0x08, 0x80, 0x0A, 0x0B, 0x0C, 0x80}, // 3.2.2.3
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80, 0x0B, 0x80}, // 3.2.3.1
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0B, 0x0C, 0x80}, // 3.2.3.2
+    {0x00, 0x01, 0x02, 0x80, 0x80, 0x04, 0x05, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0B, 0x0C, 0x0D, 0x80}, // 3.2.3.3
+    {0x00, 0x01, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80, 0x0A, 0x80}, // 3.3.1.1
+    {0x00, 0x01, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x0A, 0x0B, 0x80}, // 3.3.1.2
+    {0x00, 0x01, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x08, 0x80, 0x0A, 0x0B, 0x0C, 0x80}, // 3.3.1.3
+    {0x00, 0x01, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80, 0x80, 0x0B, 0x80}, // 3.3.2.1
+    {0x00, 0x01, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80, 0x0B, 0x0C, 0x80}, // 3.3.2.2
+    {0x00, 0x01, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x08, 0x09, 0x80, 0x0B, 0x0C, 0x0D, 0x80}, // 3.3.2.3
+    {0x00, 0x01, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x08, 0x09, 0x0A, 0x80, 0x80, 0x80, 0x0C, 0x80}, // 3.3.3.1
+    {0x00, 0x01, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x08, 0x09, 0x0A, 0x80, 0x80, 0x0C, 0x0D, 0x80}, // 3.3.3.2
+    {0x00, 0x01, 0x02, 0x80, 0x04, 0x05, 0x06, 0x80, 0x08, 0x09, 0x0A, 0x80, 0x0C, 0x0D, 0x0E, 0x80}, // 3.3.3.3
+};
+
+/* Symbol: parse_ipv4_ssse3
+ *   Parse a dotted-quad by loading up to 16 bytes,
+ *   finding the dots with a mask and converting the
+ *   four octets at once. Only handles addresses with
+ *   valid octets of 1 to 3 digits.
+ *
+ * Returns:
+ *   - [true] if the address was parsed, [false] if
+ *     it must be parsed by [parse_ipv4_scalar], which
+ *     decides whether it's valid.
+ */
+__attribute__((target("ssse3")))
+static bool parse_ipv4_ssse3(const char *src, size_t len,
+                             size_t *i, uint32_t *ipv4)
 {
-    size_t peek = *i;
+    // Shuffles that move the low 8 bytes of a register
+    // up by [s] bytes, starting at offset 8 - s.
+    static const uint8_t slide[32] = {
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    };
 
-    // If there's at least one hex digit at the
-    // current position, then we can parse a word
-    // for sure.
-    bool start_with_hex_digit = (peek < len && is_hex_digit(src[peek]));
+    size_t k = *i;
+    size_t avail = len - k;
+    __m128i b;
+    if (avail >= 16)
+        b = _mm_loadu_si128((const __m128i*) (src + k));
+    else if (avail >= 8) {
+        // Don't read past the end of the source. Load
+        // the first and last 8 bytes, which overlap,
+        // and move the last ones in place. The bytes
+        // after the end are zero.
+        size_t s = avail - 8;
+        __m128i head = _mm_loadl_epi64((const __m128i*) (src + k));
+        __m128i tail = _mm_loadl_epi64((const __m128i*) (src + k + s));
+        tail = _mm_shuffle_epi8(tail, _mm_loadu_si128((const __m128i*) (slide + 8 - s)));
+        b = _mm_or_si128(head, tail);
+    } else {
+        char padded[16] = {0};
+        memcpy(padded, src + k, avail);
+        b = _mm_loadu_si128((const __m128i*) padded);
+    }
 
-    if (start_with_hex_digit) {
+    __m128i digits = _mm_sub_epi8(b, _mm_set1_epi8('0'));
+    uint32_t is_digit = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits));
+    uint32_t is_dot   = _mm_movemask_epi8(_mm_cmpeq_epi8(b, _mm_set1_epi8('.')));
+
+    // Position of the first three dots
+    uint32_t dots = is_dot;
+    if (dots == 0) return false;
+    int p0 = __builtin_ctz(dots);
+    dots &= dots - 1;
+    if (dots == 0) return false;
+    int p1 = __builtin_ctz(dots);
+    dots &= dots - 1;
+    if (dots == 0) return false;
+    int p2 = __builtin_ctz(dots);
+
+    // Everything before the third dot must be digits
+    // or dots, and the last octet is the run of digits
+    // that follows it.
+    uint32_t before = (1u << p2) - 1;
+    if (((is_digit | is_dot) & before) != before)
+        return false;
+    int l0 = p0;
+    int l1 = p1 - p0 - 1;
+    int l2 = p2 - p1 - 1;
+    int l3 = __builtin_ctz(~(is_digit >> (p2 + 1)));
+    if (l0 < 1 || l0 > 3 || l1 < 1 || l1 > 3 || l2 < 1 || l2 > 3 || l3 < 1 || l3 > 3)
+        return false;
 
-        uint16_t word = 0;
+    __m128i shuffle = _mm_loadu_si128((const __m128i*) ipv4_shuffles[(l0-1)*27 + (l1-1)*9 + (l2-1)*3 + (l3-1)]);
+    __m128i placed = _mm_shuffle_epi8(digits, shuffle);
+    __m128i pairs  = _mm_maddubs_epi16(placed, _mm_set1_epi32(0x00010A64)); // 100, 10, 1, 0
+    __m128i values = _mm_madd_epi16(pairs, _mm_set1_epi16(1));
+
+    // Octets can't be greater than 255, and their value
+    // can't be less than 10^(length-1), or they would
+    // start with a zero.
+    static const int min_value[4] = { 0, 10, 100 };
+    __m128i min = _mm_setr_epi32(min_value[l0-1], min_value[l1-1], min_value[l2-1], min_value[l3-1]);
+    __m128i bad = _mm_or_si128(_mm_cmpgt_epi32(values, _mm_set1_epi32(UINT8_MAX)),
+                               _mm_cmplt_epi32(values, min));
+    if (_mm_movemask_epi8(bad))
+        return false;
 
-        // TODO: Don't allow arbitrary sequence of
-        //       0s at the start.
-        do {
-            
-            int d = hex_digit_to_int(src[peek]);
-            if (word > (UINT16_MAX - d) / 16)
-                break; // Overflow! This hex digit isn't part of the word.
-            
-            word = word * 16 + d;
-            
-            peek++;
+    __m128i words = _mm_packs_epi32(values, values);
+    __m128i bytes = _mm_packus_epi16(words, words);
+    *ipv4 = __builtin_bswap32((uint32_t) _mm_cvtsi128_si32(bytes));
+    *i = k + p2 + 1 + l3;
+    return true;
+}
 
-        } while (peek < len && is_hex_digit(src[peek]));
+#endif /* XURL_X86_SIMD */
 
-        *i = peek;
-        *out = word;
-    }
+static bool parse_ipv4(const char *src, size_t len, 
+                       size_t *i, uint32_t *ipv4)
+{
+#if XURL_X86_SIMD
+    // SSSE3 is implied by AVX2
+    if (*i < len && xurl_get_simd() == XURL_SIMD_AVX2 && parse_ipv4_ssse3(src, len, i, ipv4))
+        return true;
+#endif
+    return parse_ipv4_scalar(src, len, i, ipv4);
+}
 
-    return start_with_hex_digit;
+/* Symbol: hex_digit_to_int
+ *   Value of a hex digit. Digits are 0x30-0x39 and
+ *   letters 0x41-0x46 or 0x61-0x66, so the value is
+ *   the low nibble, plus 9 for letters (bit 6 set).
+ *   The result is meaningless for other characters.
+ */
+static int hex_digit_to_int(char c)
+{
+    return (c & 0xF) + 9 * ((c >> 6) & 1);
 }
 
+/* Symbol: parse_ipv6
+ *   Parse the text form of an IPv6 address (RFC 4291,
+ *   section 2.2) in a single pass, classifying bytes
+ *   with the character table. Words are written into
+ *   [ipv6] as they are parsed. When a "::" was found,
+ *   the words that follow it are moved to the end
+ *   once their count is known.
+ *
+ *   The last 32 bits may be written as a dotted-quad
+ *   IPv4 address, like in "::ffff:10.0.0.1".
+ */
 static bool parse_ipv6(const char *src, size_t len,
                        size_t *i, uint16_t ipv6[static 8])
 {
     size_t k = *i;
+    int count = 0; // Words parsed
+    int gap = -1;  // Index of the first word replaced by "::"
 
-    uint16_t tail[8];
-    size_t head_count = 0;
-    size_t tail_count = 0;
-
-    if (k+1 < len && src[k] == ':' && src[k+1] == ':')
+    if (k+1 < len && src[k] == ':' && src[k+1] == ':') {
+        gap = 0;
         k += 2;
-    else {
-        while (1) {
+    }
 
-            uint16_t word;
-            if (!parse_ipv6_word(src, len, &k, &word))
-                return false;
+    while (k < len && has_class(src[k], CLASS_HEX)) {
 
-            ipv6[head_count++] = word;
-            
-            if (head_count == 8)
-                break;
-            
-            if (k == len || src[k] != ':')
-                return false;
-            k++; // Skip the ':'
+        // Words have at most 4 hex digits
+        size_t start = k;
+        uint32_t word = 0;
+        do {
+            word = (word << 4) | hex_digit_to_int(src[k]);
+            k++;
+        } while (k < len && k - start < 4 && has_class(src[k], CLASS_HEX));
 
-            if (k < len && src[k] == ':') {
-                k++;
-                break;
-            }
+        if (k < len && src[k] == '.') {
+
+            // The digits were the first byte of an
+            // IPv4 address, which takes two words
+            // and ends the address.
+            uint32_t ipv4;
+            if (count > 6 || !parse_ipv4(src, len, &start, &ipv4))
+                return false;
+            ipv6[count++] = ipv4 >> 16;
+            ipv6[count++] = ipv4 & 0xFFFF;
+            k = start;
+            break;
         }
-    }
 
-    if (head_count + tail_count < 8) {
-        while (k < len && is_hex_digit(src[k])) {
+        if (k < len && has_class(src[k], CLASS_HEX))
+            return false; // More than 4 digits
 
-            // We know the current character is a
-            // hex digit, therefore [parse_ipv6_word]
-            // won't fail.
-            uint16_t word;
-            (void) parse_ipv6_word(src, len, &k, &word);
+        ipv6[count++] = word;
+        if (count == 8 || k == len || src[k] != ':')
+            break;
 
-            tail[tail_count++] = word;
-            
-            if (head_count + tail_count == 7)
-                break;
-            
-            if (k == len || src[k] != ':')
-                break;
+        if (k+1 < len && src[k+1] == ':') {
+            if (gap >= 0)
+                break; // Only one "::" is allowed
+            gap = count;
+            k += 2;
+        } else {
+            if (k+1 == len || !has_class(src[k+1], CLASS_HEX))
+                return false;
             k++; // Skip the ':'
         }
     }
 
-    for (size_t p = 0; p < 8 - head_count - tail_count; p++)
-        ipv6[head_count + p] = 0;
-
-    for (size_t p = 0; p < tail_count; p++)
-        ipv6[8 - tail_count + p] = tail[p];
+    if (gap < 0) {
+        if (count < 8)
+            return false;
+    } else {
+        if (count == 8)
+            return false; // "::" must stand for at least one word
+        int moved = count - gap;
+        memmove(ipv6 + 8 - moved, ipv6 + gap, moved * sizeof(uint16_t));
+        memset(ipv6 + gap, 0, (8 - count) * sizeof(uint16_t));
+    }
 
     *i = k;
     return true;
@@ -544,31 +702,45 @@ static void parse_port(const char *src, size_t len,
     *i = k;
 }
 
-static bool is_hostname(char c)
-{
-    return is_unreserved(c) || is_subdelim(c);
-}
-
-static bool is_hostname_first(char c)
-{
-    return is_hostname(c);
-}
-
+/* Symbol: parse_host
+ *   Parse the host and port of an authority. If [text]
+ *   isn't NULL, it's set to the span of the text of the
+ *   name or IP address (without brackets), since only
+ *   the binary form of IP addresses is stored in [host].
+ */
 static bool parse_host(XURL_INPUT_CONSTNESS char *src, 
                        size_t len, size_t *i, 
-                       xurl_host *host)
+                       xurl_host *host, xurl_span *text)
 {
     size_t k = *i;
     if (k == len)
         return false;
     
+    size_t text_start = k;
+    size_t text_end;
     if (src[k] == '[') {
 
         k++; // Skip the '['
+        text_start = k;
         
         // IPv6
         if (!parse_ipv6(src, len, &k, host->ipv6))
             return false;
+        text_end = k;
+
+        // Zone identifier (RFC 6874), introduced
+        // by a percent-encoded '%'.
+        host->zone = NULL;
+        host->zone_len = 0;
+        if (k+2 < len && src[k] == '%' && src[k+1] == '2' && src[k+2] == '5') {
+            k += 3;
+            size_t zone_offset = k;
+            k = scan_class(src, len, k, CLASS_UNRESERVED);
+            if (k == zone_offset)
+                return false;
+            host->zone = src + zone_offset;
+            host->zone_len = k - zone_offset;
+        }
 
         if (k == len || src[k] != ']')
             return false;
@@ -589,151 +761,563 @@ static bool parse_host(XURL_INPUT_CONSTNESS char *src,
         if (is_ipv4) {
             host->ipv4 = ipv4;
             host->mode = XURL_HOSTMODE_IPV4;
+            text_end = k;
         } else {
 
-            if (!is_hostname_first(src[k]))
-                return false;
-
             size_t name_offset = k;
-            do 
-                k++;
-            while (k < len && is_hostname(src[k]));
+            k = scan_class(src, len, k, CLASS_HOSTNAME);
+            if (k == name_offset)
+                return false;
             size_t name_length = k - name_offset;
 
             host->mode = XURL_HOSTMODE_NAME;
             host->name = src + name_offset;
             host->name_len = name_length;
+            text_end = k;
         }
     }
 
+    if (text != NULL) {
+        text->offset = text_start;
+        text->len = text_end - text_start;
+    }
+
     uint16_t port;
     bool  no_port;
+    size_t port_start = k;
     parse_port(src, len, &k, &no_port, &port);
     host->port = port;
     host->no_port = no_port;
+
+    // Length of the digits after the ':', or 0 if
+    // they don't fit (all but the last being zeros).
+    size_t port_len = no_port ? 0 : k - port_start - 1;
+    host->port_len = port_len <= UINT8_MAX ? port_len : 0;
     *i = k;
     return true;
 }
 
-static bool parse_path(XURL_INPUT_CONSTNESS char *src, 
-                       size_t len, size_t *i, 
-                       XURL_INPUT_CONSTNESS char **path,
-                       size_t *path_len)
+/* Run scanning
+ *
+ *   Most of the bytes of an URL are in the path, query
+ *   and fragment runs. The [scan_run] function finds the
+ *   end of one of these runs, which is the first byte that
+ *   doesn't belong to it. On x86-64 the bytes are classified
+ *   16 (SSE2) or 32 (AVX2) at a time. The kernel is chosen
+ *   at runtime based on the features of the CPU, and can
+ *   be overridden with [xurl_set_simd].
+ *
+ *   The path run is special because it can't contain two
+ *   consecutive '/' (see [parse_path]), therefore a '/'
+ *   following another '/' also terminates it.
+ */
+
+typedef enum {
+    RUN_PATH,
+    RUN_QUERY,
+    RUN_FRAGMENT,
+} run_kind;
+
+static size_t scan_run_scalar(const char *src, size_t len,
+                              size_t k, run_kind kind)
 {
-    size_t k = *i;
+    switch (kind) {
 
-    size_t path_offset;
-    size_t path_length;
+        case RUN_PATH:
+        while (k < len && is_pchar(src[k])) {
+            do
+                k++;
+            while (k < len && is_pchar(src[k]));
+            if (k == len || src[k] != '/')
+                break;
+            k++; // Skip the '/'
+        }
+        break;
 
-    path_offset = k;
+        case RUN_QUERY:
+        while (k < len && has_class(src[k], CLASS_QUERY))
+            k++;
+        break;
 
-    if (k < len && src[k] == '/') 
-        k++;
-    else {
-        if (k == len || !is_pchar(src[k]))
-            return false;
+        case RUN_FRAGMENT:
+        while (k < len && has_class(src[k], CLASS_FRAGMENT))
+            k++;
+        break;
     }
+    return k;
+}
 
-    while (k < len && is_pchar(src[k])) {
-        do
-            k++;
-        while (k < len && is_pchar(src[k]));
-        if (k == len || src[k] != '/')
-            break;
-        k++; // Skip the '/'
+/* Symbol: scan_run_tail
+ *   Byte-by-byte version of the run scanning that,
+ *   unlike [scan_run_scalar], can resume a path from
+ *   any position. [carry] tells whether the byte that
+ *   precedes [k] in the path is a '/'. It's used by the
+ *   vectorized kernels for the bytes that don't fill a
+ *   block, and by the streaming parser.
+ */
+static size_t scan_run_tail(const char *src, size_t len,
+                            size_t k, run_kind kind,
+                            uint32_t carry)
+{
+    uint16_t mask = (kind == RUN_QUERY) ? CLASS_QUERY : CLASS_FRAGMENT;
+    while (k < len && has_class(src[k], mask)) {
+        if (kind == RUN_PATH) {
+            if (src[k] == '/' && carry)
+                break;
+            carry = (src[k] == '/');
+        }
+        k++;
     }
+    return k;
+}
 
-    path_length = k - path_offset;
+#if XURL_X86_SIMD
 
-    *i = k;
-    *path = src + path_offset;
-    *path_len = path_length;
-    return true;
+/* Symbol: run_stop_mask
+ *   Given the bitmask of the bytes of a block that
+ *   belong to the run and the bitmask of the '/'
+ *   bytes, returns the bitmask of the bytes that
+ *   terminate the run.
+ *
+ *   For paths, [carry] tells whether the byte
+ *   preceding the block is a '/'. It's updated
+ *   to refer to the last byte of the block.
+ */
+static uint32_t run_stop_mask(uint32_t valid, uint32_t slash,
+                              int width, run_kind kind,
+                              uint32_t *carry)
+{
+    uint32_t stop = ~valid;
+    if (kind == RUN_PATH) {
+        stop |= slash & ((slash << 1) | *carry);
+        *carry = (slash >> (width - 1)) & 1;
+    }
+    if (width < 32)
+        stop &= (1u << width) - 1;
+    return stop;
 }
 
-static bool is_query(char c)
+static __m128i sse2_invalid_bytes(__m128i b, run_kind kind)
 {
-    return is_pchar(c) || c == '/' || c == '?';
+    #define EQ(c) _mm_cmpeq_epi8(b, _mm_set1_epi8(c))
+
+    // Signed comparison, therefore it also catches
+    // bytes from 0x80 onwards.
+    __m128i bad = _mm_cmplt_epi8(b, _mm_set1_epi8(0x21));
+    bad = _mm_or_si128(bad, _mm_or_si128(EQ('"'),  EQ('#')));
+    bad = _mm_or_si128(bad, _mm_or_si128(EQ('%'),  EQ('<')));
+    bad = _mm_or_si128(bad, _mm_or_si128(EQ('>'),  EQ('[')));
+    bad = _mm_or_si128(bad, _mm_or_si128(EQ('\\'), EQ(']')));
+    bad = _mm_or_si128(bad, _mm_or_si128(EQ('^'),  EQ('`')));
+    bad = _mm_or_si128(bad, _mm_or_si128(EQ('{'),  EQ('|')));
+    bad = _mm_or_si128(bad, _mm_or_si128(EQ('}'),  EQ(0x7F)));
+    if (kind != RUN_QUERY)
+        bad = _mm_or_si128(bad, EQ('?'));
+
+    #undef EQ
+    return bad;
 }
 
-static void parse_query(XURL_INPUT_CONSTNESS char *src, 
-                        size_t len, size_t *i, 
-                        XURL_INPUT_CONSTNESS char **query, 
-                        size_t *query_len)
+static size_t scan_run_sse2(const char *src, size_t len,
+                            size_t k, run_kind kind,
+                            uint32_t carry)
 {
-    bool no_query;
-    size_t query_offset;
-    size_t query_length;
 
-    size_t peek = *i;
-    if (peek < len && src[peek] == '?') {
-        peek++; // Skip the '?'
-        query_offset = peek;
-        while (peek < len && is_query(src[peek]))
-            peek++;
-        query_length = peek - query_offset;
-        no_query = false;
-    } else {
-        query_offset = 0;
-        query_length = 0;
-        no_query = true;
-    }
+    while (k + 16 <= len) {
 
-    if (no_query) {
-        *query = NULL;
-        *query_len = 0;
-    } else {
-        *i = peek;
-        *query = src + query_offset;
-        *query_len = query_length;
+        __m128i b = _mm_loadu_si128((const __m128i*) (src + k));
+        uint32_t valid = ~_mm_movemask_epi8(sse2_invalid_bytes(b, kind));
+        uint32_t slash = _mm_movemask_epi8(_mm_cmpeq_epi8(b, _mm_set1_epi8('/')));
+        uint32_t stop = run_stop_mask(valid, slash, 16, kind, &carry);
+        if (stop)
+            return k + __builtin_ctz(stop);
+        k += 16;
     }
+    return scan_run_tail(src, len, k, kind, carry);
 }
 
-static bool is_fragment(char c)
+// Nibble tables for the AVX2 kernel. A byte belongs
+// to the class if the entry of its low nibble has the
+// bit of its high nibble set. Bytes from 0x80 onwards
+// have no bits in [high_nibble_bit] and are rejected.
+static const uint8_t fragment_low_nibbles[16] = {
+    0xB8, 0xFC, 0xF8, 0xF8, 0xFC, 0xF8, 0xFC, 0xFC,
+    0xFC, 0xFC, 0xFC, 0x5C, 0x54, 0x5C, 0xD4, 0x74,
+};
+
+static const uint8_t query_low_nibbles[16] = {
+    0xB8, 0xFC, 0xF8, 0xF8, 0xFC, 0xF8, 0xFC, 0xFC,
+    0xFC, 0xFC, 0xFC, 0x5C, 0x54, 0x5C, 0xD4, 0x7C,
+};
+
+static const uint8_t high_nibble_bit[16] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+__attribute__((target("avx2")))
+static size_t scan_run_avx2(const char *src, size_t len,
+                            size_t k, run_kind kind,
+                            uint32_t carry)
 {
-    return is_pchar(c) || c == '/';
+
+    // Paths use the fragment class (pchar and '/')
+    // plus the rule on consecutive slashes.
+    const uint8_t *low = (kind == RUN_QUERY) ? query_low_nibbles : fragment_low_nibbles;
+    __m256i low_table  = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) low));
+    __m256i high_table = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) high_nibble_bit));
+    __m256i nibble = _mm256_set1_epi8(0x0F);
+
+    while (k + 32 <= len) {
+
+        __m256i b = _mm256_loadu_si256((const __m256i*) (src + k));
+        __m256i lo = _mm256_shuffle_epi8(low_table,  _mm256_and_si256(b, nibble));
+        __m256i hi = _mm256_shuffle_epi8(high_table, _mm256_and_si256(_mm256_srli_epi16(b, 4), nibble));
+        __m256i in = _mm256_and_si256(lo, hi);
+
+        uint32_t valid = ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(in, _mm256_setzero_si256()));
+        uint32_t slash = _mm256_movemask_epi8(_mm256_cmpeq_epi8(b, _mm256_set1_epi8('/')));
+        uint32_t stop = run_stop_mask(valid, slash, 32, kind, &carry);
+        if (stop)
+            return k + __builtin_ctz(stop);
+        k += 32;
+    }
+    return scan_run_tail(src, len, k, kind, carry);
 }
 
-static void parse_fragment(XURL_INPUT_CONSTNESS char *src, 
-                           size_t len, size_t *i, 
-                           XURL_INPUT_CONSTNESS char **fragment,
-                           size_t *fragment_len)
+#endif /* XURL_X86_SIMD */
+
+static xurl_simd detect_simd(void)
 {
-    bool no_fragment;
-    size_t fragment_offset;
-    size_t fragment_length;
+#if XURL_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return XURL_SIMD_AVX2;
+    return XURL_SIMD_SSE2;
+#else
+    return XURL_SIMD_NONE;
+#endif
+}
 
-    size_t peek = *i;
-    if (peek < len && src[peek] == '#') {
-        peek++; // Skip the '#'
-        fragment_offset = peek;
-        while (peek < len && is_fragment(src[peek]))
-            peek++;
-        fragment_length = peek - fragment_offset;
-        no_fragment = false;
-    } else {
-        fragment_offset = 0;
-        fragment_length = 0;
-        no_fragment = true;
-    }
+// Read on every parse, possibly from many threads at
+// once. Relaxed accesses are enough: detection gives
+// the same result in every thread, and a level set by
+// [xurl_set_simd] only needs to be seen eventually.
+static _Atomic int simd_level = -1; // Not detected yet
 
-    if (no_fragment) {
-        *fragment = NULL;
-        *fragment_len = 0;
-    } else {
-        *i = peek;
-        *fragment = src + fragment_offset;
-        *fragment_len = fragment_length;
+xurl_simd xurl_get_simd(void)
+{
+    int level = atomic_load_explicit(&simd_level, memory_order_relaxed);
+    if (level < 0) {
+        // Don't overwrite a level set meanwhile
+        int expected = -1;
+        int detected = detect_simd();
+        if (atomic_compare_exchange_strong_explicit(&simd_level, &expected, detected,
+                                                    memory_order_relaxed, memory_order_relaxed))
+            level = detected;
+        else
+            level = expected;
     }
+    return level;
 }
 
-#if XURL_ZEROTERMINATE
-typedef struct {
-    char  *pool;
-    size_t size;
-    size_t used;
-} alloc_t;
-
+bool xurl_set_simd(xurl_simd level)
+{
+    if (level > detect_simd())
+        return false;
+    atomic_store_explicit(&simd_level, level, memory_order_relaxed);
+    return true;
+}
+
+/* Symbol: scan_run_resume
+ *   Like [scan_run], but for runs that started before
+ *   [k]. For paths, [after_slash] tells whether the
+ *   last byte of the run before [k] was a '/'. Unlike
+ *   [scan_run], it stops at percent-encoded bytes.
+ */
+static size_t scan_run_resume(const char *src, size_t len,
+                              size_t k, run_kind kind,
+                              bool after_slash)
+{
+    uint32_t carry = (kind == RUN_PATH && after_slash);
+    switch (xurl_get_simd()) {
+#if XURL_X86_SIMD
+        case XURL_SIMD_AVX2: return scan_run_avx2(src, len, k, kind, carry);
+        case XURL_SIMD_SSE2: return scan_run_sse2(src, len, k, kind, carry);
+#endif
+        default: break;
+    }
+    return scan_run_tail(src, len, k, kind, carry);
+}
+
+static size_t scan_run(const char *src, size_t len,
+                       size_t k, run_kind kind)
+{
+#if XURL_X86_SIMD
+    uint32_t carry = (kind == RUN_PATH && k > 0 && src[k-1] == '/');
+#endif
+    switch (xurl_get_simd()) {
+#if XURL_X86_SIMD
+        case XURL_SIMD_AVX2: k = scan_run_avx2(src, len, k, kind, carry); break;
+        case XURL_SIMD_SSE2: k = scan_run_sse2(src, len, k, kind, carry); break;
+#endif
+        default: k = scan_run_scalar(src, len, k, kind); break;
+    }
+
+    // The kernels stop at '%'. If it starts a
+    // percent-encoded byte, skip it and continue.
+    while (is_pct_encoded(src, len, k))
+        k = scan_run_resume(src, len, k + 3, kind, false);
+    return k;
+}
+
+/* Symbol: find_byte
+ *   Find the first byte starting from [k] which
+ *   is equal to [a], [b] or [c]. On x86-64, 16
+ *   bytes are compared at a time.
+ *
+ * Returns:
+ *   - The offset of the byte, or [len] if there
+ *     is none.
+ */
+static size_t find_byte(const char *src, size_t len, size_t k,
+                        char a, char b, char c)
+{
+#if XURL_X86_SIMD
+    if (xurl_get_simd() != XURL_SIMD_NONE) {
+        __m128i va = _mm_set1_epi8(a);
+        __m128i vb = _mm_set1_epi8(b);
+        __m128i vc = _mm_set1_epi8(c);
+        while (k + 16 <= len) {
+            __m128i x = _mm_loadu_si128((const __m128i*) (src + k));
+            __m128i m = _mm_or_si128(_mm_cmpeq_epi8(x, va), 
+                        _mm_or_si128(_mm_cmpeq_epi8(x, vb), 
+                                     _mm_cmpeq_epi8(x, vc)));
+            int mask = _mm_movemask_epi8(m);
+            if (mask)
+                return k + __builtin_ctz(mask);
+            k += 16;
+        }
+    }
+#endif
+    while (k < len && src[k] != a && src[k] != b && src[k] != c)
+        k++;
+    return k;
+}
+
+static size_t scan_authority_scalar(const char *src, size_t len,
+                                    size_t k, uint16_t mask)
+{
+    while (k < len && has_class(src[k], mask))
+        k++;
+    return k;
+}
+
+/* Symbol: scan_authority
+ *   Find the end of the authority starting at [k]
+ *   and the first '@' in it, in a single pass. On
+ *   x86-64, 16 bytes are classified at a time and
+ *   the authority ends at the first '/', '?' or '#',
+ *   or at any byte that can't belong to an URL
+ *   (spaces, control characters and bytes from 0x80
+ *   onwards).
+ *
+ *   The end found this way may go past the actual
+ *   end of the authority (for instance if it contains
+ *   a '"'), but [parse_userinfo] and [parse_host]
+ *   reject those bytes anyway.
+ *
+ * Returns:
+ *   - The offset of the end of the authority. [at]
+ *     is set to the offset of the first '@', or to
+ *     the end if there is none.
+ */
+static size_t scan_authority(const char *src, size_t len,
+                             size_t k, size_t *at)
+{
+#if XURL_X86_SIMD
+    if (xurl_get_simd() != XURL_SIMD_NONE) {
+        while (k + 16 <= len) {
+            __m128i x = _mm_loadu_si128((const __m128i*) (src + k));
+
+            // Signed comparison, therefore it also
+            // catches bytes from 0x80 onwards.
+            __m128i end = _mm_cmplt_epi8(x, _mm_set1_epi8(0x21));
+            end = _mm_or_si128(end, _mm_cmpeq_epi8(x, _mm_set1_epi8('/')));
+            end = _mm_or_si128(end, _mm_cmpeq_epi8(x, _mm_set1_epi8('?')));
+            end = _mm_or_si128(end, _mm_cmpeq_epi8(x, _mm_set1_epi8('#')));
+            __m128i sign = _mm_cmpeq_epi8(x, _mm_set1_epi8('@'));
+
+            uint32_t end_mask = _mm_movemask_epi8(end);
+            uint32_t at_mask  = _mm_movemask_epi8(sign);
+            if (end_mask) {
+                // Only the '@' bytes that come
+                // before the end count.
+                size_t n = __builtin_ctz(end_mask);
+                at_mask &= (1u << n) - 1;
+                *at = at_mask ? k + __builtin_ctz(at_mask) : k + n;
+                return k + n;
+            }
+            if (at_mask) {
+                // The first '@' was found, now only
+                // the end is missing.
+                *at = k + __builtin_ctz(at_mask);
+                return scan_authority_scalar(src, len, *at + 1, CLASS_HOSTNAME | CLASS_AUTHORITY);
+            }
+            k += 16;
+        }
+    }
+#endif
+    // The scalar version stops at the first byte that
+    // can't belong to an authority, which is an '@' if
+    // there's a userinfo. The end of the authority is
+    // then right before the next one.
+    const uint16_t mask = CLASS_HOSTNAME | CLASS_AUTHORITY;
+    k = scan_authority_scalar(src, len, k, mask);
+    *at = k;
+    if (k < len && src[k] == '@')
+        return scan_authority_scalar(src, len, k + 1, mask);
+    return k;
+}
+
+/* Symbol: parse_authority
+ *   Parse the authority of an URL (the portion that
+ *   follows the "//"). The '@' that ends the userinfo
+ *   is found in the same pass as the end of the
+ *   authority, so that URLs with no userinfo don't
+ *   scan their host twice.
+ *
+ * Returns:
+ *   - [true] on success, in which case [i] refers
+ *     to the first byte after the authority.
+ */
+static bool parse_authority(XURL_INPUT_CONSTNESS char *src, 
+                            size_t len, size_t *i,
+                            xurl_userinfo *userinfo,
+                            xurl_host *host,
+                            xurl_span *host_text)
+{
+    size_t k = *i;
+    size_t at;
+    size_t end = scan_authority(src, len, k, &at);
+
+    if (at < end && parse_userinfo(src, k, at, userinfo))
+        k = at + 1; // Skip the '@'
+    else {
+        userinfo->username = NULL;
+        userinfo->username_len = 0;
+        userinfo->password = NULL;
+        userinfo->password_len = 0;
+    }
+
+    // The host and port can't go past [end]
+    if (!parse_host(src, end, &k, host, host_text))
+        return false;
+
+    *i = k;
+    return true;
+}
+
+static bool parse_path(XURL_INPUT_CONSTNESS char *src, 
+                       size_t len, size_t *i, 
+                       XURL_INPUT_CONSTNESS char **path,
+                       size_t *path_len)
+{
+    size_t k = *i;
+
+    size_t path_offset;
+    size_t path_length;
+
+    path_offset = k;
+
+    if (k < len && src[k] == '/') 
+        k++;
+    else {
+        if (k == len || (!is_pchar(src[k]) && !is_pct_encoded(src, len, k)))
+            return false;
+    }
+
+    k = scan_run(src, len, k, RUN_PATH);
+
+    path_length = k - path_offset;
+
+    *i = k;
+    *path = src + path_offset;
+    *path_len = path_length;
+    return true;
+}
+
+static void parse_query(XURL_INPUT_CONSTNESS char *src, 
+                        size_t len, size_t *i, 
+                        XURL_INPUT_CONSTNESS char **query, 
+                        size_t *query_len)
+{
+    bool no_query;
+    size_t query_offset;
+    size_t query_length;
+
+    size_t peek = *i;
+    if (peek < len && src[peek] == '?') {
+        peek++; // Skip the '?'
+        query_offset = peek;
+        peek = scan_run(src, len, peek, RUN_QUERY);
+        query_length = peek - query_offset;
+        no_query = false;
+    } else {
+        query_offset = 0;
+        query_length = 0;
+        no_query = true;
+    }
+
+    if (no_query) {
+        *query = NULL;
+        *query_len = 0;
+    } else {
+        *i = peek;
+        *query = src + query_offset;
+        *query_len = query_length;
+    }
+}
+
+static void parse_fragment(XURL_INPUT_CONSTNESS char *src, 
+                           size_t len, size_t *i, 
+                           XURL_INPUT_CONSTNESS char **fragment,
+                           size_t *fragment_len)
+{
+    bool no_fragment;
+    size_t fragment_offset;
+    size_t fragment_length;
+
+    size_t peek = *i;
+    if (peek < len && src[peek] == '#') {
+        peek++; // Skip the '#'
+        fragment_offset = peek;
+        peek = scan_run(src, len, peek, RUN_FRAGMENT);
+        fragment_length = peek - fragment_offset;
+        no_fragment = false;
+    } else {
+        fragment_offset = 0;
+        fragment_length = 0;
+        no_fragment = true;
+    }
+
+    if (no_fragment) {
+        *fragment = NULL;
+        *fragment_len = 0;
+    } else {
+        *i = peek;
+        *fragment = src + fragment_offset;
+        *fragment_len = fragment_length;
+    }
+}
+
+#if XURL_ZEROTERMINATE
+typedef struct {
+    char  *pool;
+    size_t size;
+    size_t used;
+} alloc_t;
+
 static char *get_some_memory(alloc_t *alloc, size_t count)
 {
     if (alloc->used + count > alloc->size)
@@ -764,15 +1348,33 @@ static bool follows_authority(const char *src, size_t len,
         && src[i+1] == '/';
 }
 
-bool xurl_parse2(XURL_INPUT_CONSTNESS char *src, 
-                 size_t len, size_t *i, xurl_t *url)
+// Mark the userinfo and host of [url] as absent
+static void clear_authority(xurl_t *url)
 {
-    size_t maybe;
-    if (i == NULL) {
-        maybe = 0;
-        i = &maybe;
-    }
+    url->host.mode = XURL_HOSTMODE_NAME;
+    url->host.name = NULL;
+    url->host.name_len = 0;
+    url->host.no_port = true;
+    url->host.port = 0;
+    url->host.port_len = 0;
+
+    url->userinfo.username = NULL;
+    url->userinfo.password = NULL;
+    url->userinfo.username_len = 0;
+    url->userinfo.password_len = 0;
+}
 
+/* Symbol: parse_components
+ *   Find the components of an URL, without making
+ *   them zero-terminated. If [reference] is set, URLs
+ *   with no authority and an empty path (like "?query",
+ *   "#fragment" or "") are accepted, as they are valid
+ *   relative references.
+ */
+static bool parse_components(XURL_INPUT_CONSTNESS char *src, 
+                             size_t len, size_t *i, xurl_t *url,
+                             bool reference, xurl_span *host_text)
+{
     parse_schema(src, len, i, 
                  &url->schema, 
                  &url->schema_len);
@@ -781,9 +1383,7 @@ bool xurl_parse2(XURL_INPUT_CONSTNESS char *src,
 
         *i += 2; // Skip the "//"
         
-        parse_userinfo(src, len, i, &url->userinfo);
-
-        if (!parse_host(src, len, i, &url->host))
+        if (!parse_authority(src, len, i, &url->userinfo, &url->host, host_text))
             return false;
 
         if (*i < len && src[*i] == '/') {
@@ -800,99 +1400,149 @@ bool xurl_parse2(XURL_INPUT_CONSTNESS char *src,
 
     } else {
 
-        url->host.mode = XURL_HOSTMODE_NAME;
-        url->host.name = NULL;
-        url->host.no_port = true;
-        url->host.port = 0;
-        
-        url->userinfo.username = NULL;
-        url->userinfo.password = NULL;
-        url->userinfo.username_len = 0;
-        url->userinfo.password_len = 0;
+        clear_authority(url);
+
+        if (*i == len || src[*i] == '?' || src[*i] == '#') {
 
-        // TODO: Since there was no authority,
-        //       the path is non optional.
+            // Since there was no authority, the
+            // path is non optional, unless this
+            // is a relative reference.
+            if (!reference)
+                return false; // Missing path
 
-        if (*i == len || src[*i] == '?' || src[*i] == '#')
-            return false; // Missing path
+            url->path = NULL;
+            url->path_len = 0;
 
-        if (!parse_path(src, len, i, &url->path, &url->path_len))
+        } else if (!parse_path(src, len, i, &url->path, &url->path_len))
             return false;
     }
 
     parse_query(src, len, i, &url->query, &url->query_len);
     parse_fragment(src, len, i, &url->fragment, &url->fragment_len);
+    return true;
+}
 
 #if XURL_ZEROTERMINATE
-    {
-        alloc_t alloc = {
-            .pool = url->buffer,
-            .size = sizeof(url->buffer),
-            .used = 0,
-        };
-
-        if (url->schema != NULL) {
-            assert(url->schema[url->schema_len] == ':');
-            url->schema[url->schema_len] = '\0';
-        }
-
-        char  *username = url->userinfo.username;
-        size_t username_len = url->userinfo.username_len;
-        if (username != NULL) {
-            username[username_len] = '\0';
-            char  *password = url->userinfo.password;
-            size_t password_len = url->userinfo.password_len;
-            if (password != NULL)
-                password[password_len] = '\0';
-            
-        }
+/* Symbol: zero_terminate
+ *   Place null bytes after the components of [url],
+ *   copying into [url->buffer] the ones that aren't
+ *   followed by a separator.
+ */
+static bool zero_terminate(xurl_t *url)
+{
+    alloc_t alloc = {
+        .pool = url->buffer,
+        .size = sizeof(url->buffer),
+        .used = 0,
+    };
+
+    if (url->schema != NULL) {
+        assert(url->schema[url->schema_len] == ':');
+        url->schema[url->schema_len] = '\0';
+    }
 
-        if (url->host.mode == XURL_HOSTMODE_NAME) {
-            if (url->host.no_port && (url->path != NULL || (url->query == NULL && url->fragment == NULL))) {
-                
-                url->host.name = my_strdup(url->host.name, url->host.name_len, &alloc);
-                if (url->host.name == NULL)
-                    return false;
+    char  *username = url->userinfo.username;
+    size_t username_len = url->userinfo.username_len;
+    if (username != NULL) {
+        username[username_len] = '\0';
+        char  *password = url->userinfo.password;
+        size_t password_len = url->userinfo.password_len;
+        if (password != NULL)
+            password[password_len] = '\0';
+        
+    }
 
-            } else
-                url->host.name[url->host.name_len] = '\0';
-        }
+    // The zone is followed by the ']'
+    if (url->host.mode == XURL_HOSTMODE_IPV6 && url->host.zone != NULL)
+        url->host.zone[url->host.zone_len] = '\0';
 
-        if (url->fragment != NULL) {
-    
-            // copy fragment to make it zero-terminated
-            url->fragment = my_strdup(url->fragment, url->fragment_len, &alloc);
-            if (url->fragment == NULL)
+    if (url->host.mode == XURL_HOSTMODE_NAME && url->host.name != NULL) {
+        if (url->host.no_port && (url->path != NULL || (url->query == NULL && url->fragment == NULL))) {
+            
+            url->host.name = my_strdup(url->host.name, url->host.name_len, &alloc);
+            if (url->host.name == NULL)
                 return false;
 
-            if (url->query != NULL)
-                url->query[url->query_len] = '\0';
-            
-            if (url->path != NULL)
-                url->path[url->path_len] = '\0';
+        } else
+            url->host.name[url->host.name_len] = '\0';
+    }
 
-        } else if (url->query != NULL) {
+    if (url->fragment != NULL) {
 
-            // copy query to make it zero-terminated
-            url->query = my_strdup(url->query, url->query_len, &alloc);
-            if (url->query == NULL)
-                return false;
+        // copy fragment to make it zero-terminated
+        url->fragment = my_strdup(url->fragment, url->fragment_len, &alloc);
+        if (url->fragment == NULL)
+            return false;
 
-            if (url->path != NULL)
-                url->path[url->path_len] = '\0';
+        if (url->query != NULL)
+            url->query[url->query_len] = '\0';
+        
+        if (url->path != NULL)
+            url->path[url->path_len] = '\0';
 
-        } else if (url->path != NULL) {
+    } else if (url->query != NULL) {
 
-            // copy path to make it zero-terminated
-            url->path = my_strdup(url->path, url->path_len, &alloc);
-            if (url->path == NULL)
-                return false;
-        }
+        // copy query to make it zero-terminated
+        url->query = my_strdup(url->query, url->query_len, &alloc);
+        if (url->query == NULL)
+            return false;
+
+        if (url->path != NULL)
+            url->path[url->path_len] = '\0';
+
+    } else if (url->path != NULL) {
+
+        // copy path to make it zero-terminated
+        url->path = my_strdup(url->path, url->path_len, &alloc);
+        if (url->path == NULL)
+            return false;
     }
+    return true;
+}
+#endif
+
+/* Symbol: parse_url
+ *   Implementation of [xurl_parse2] and of
+ *   [xurl_parse_reference].
+ */
+static bool parse_url(XURL_INPUT_CONSTNESS char *src, 
+                      size_t len, size_t *i, xurl_t *url,
+                      bool reference)
+{
+    if (!parse_components(src, len, i, url, reference, NULL))
+        return false;
+#if XURL_ZEROTERMINATE
+    if (!zero_terminate(url))
+        return false;
 #endif
     return true;
 }
 
+bool xurl_parse2(XURL_INPUT_CONSTNESS char *src, 
+                 size_t len, size_t *i, xurl_t *url)
+{
+    size_t maybe;
+    if (i == NULL) {
+        maybe = 0;
+        i = &maybe;
+    }
+    return parse_url(src, len, i, url, false);
+}
+
+/* Symbol: xurl_parse_reference
+ *   Like [xurl_parse], but also accepts relative
+ *   references with an empty path, such as "?page=2",
+ *   "#top" or "", for which the path is NULL. This is
+ *   meant to parse references for [xurl_resolve].
+ */
+bool xurl_parse_reference(XURL_INPUT_CONSTNESS char *src, 
+                          size_t len, xurl_t *url)
+{
+    size_t i = 0;
+    bool result = parse_url(src, len, &i, url, true);
+    return result && i == len;
+}
+
 bool xurl_parse(XURL_INPUT_CONSTNESS char *src, 
                 size_t len, xurl_t *url)
 {
@@ -901,16 +1551,4153 @@ bool xurl_parse(XURL_INPUT_CONSTNESS char *src,
     return result && i == len;
 }
 
-bool xurl_parse_ipv4(const char *src, size_t len, 
-                     uint32_t *out)
+// Path and query of an origin-form request-target
+// ("/path?query"), which starts with a '/' at [i].
+static void parse_origin(XURL_INPUT_CONSTNESS char *src, 
+                         size_t len, size_t *i, xurl_t *url)
 {
-    size_t i = 0;
-    return parse_ipv4(src, len, &i, out);
+    // Unlike the paths of URIs that have no authority,
+    // an absolute-path (RFC 9110, section 4.1) can have
+    // empty segments ("/a//b", "//x"), so the run is
+    // resumed after every '/' it stops at.
+    size_t k = *i;
+    while (k < len && src[k] == '/')
+        k = scan_run(src, len, k + 1, RUN_PATH);
+    url->path = src + *i;
+    url->path_len = k - *i;
+    *i = k;
+    parse_query(src, len, i, &url->query, &url->query_len);
 }
 
-bool xurl_parse_ipv6(const char *src, size_t len, 
-                     uint16_t out[8])
+/* Symbol: xurl_parse_request_target
+ *   Parse the request-target of an HTTP request line
+ *   (RFC 9112, section 3.2) directly from its buffer.
+ *   [method] tells which forms are allowed:
+ *
+ *     origin-form     /path?query             any method but CONNECT
+ *     absolute-form   http://host/path?query  any method but CONNECT
+ *     authority-form  host:port               CONNECT only
+ *     asterisk-form   *                       OPTIONS only
+ *
+ *   The form is told apart by the first byte, so the
+ *   common origin-form goes straight to the path and
+ *   query parsing.
+ *
+ * Returns:
+ *   - The form of the target, or [XURL_TARGET_INVALID]
+ *     if [src] isn't a valid target for [method]. The
+ *     fragment is always NULL since request-targets
+ *     can't have one. For the authority-form only the
+ *     host (which always has a port) is set, and for
+ *     the asterisk-form only the path, which is "*".
+ */
+xurl_target_form xurl_parse_request_target(XURL_INPUT_CONSTNESS char *src, 
+                                           size_t len, xurl_method_hint method,
+                                           xurl_t *url)
 {
     size_t i = 0;
-    return parse_ipv6(src, len, &i, out);
-}
\ No newline at end of file
+    xurl_target_form form;
+
+    if (method == XURL_METHOD_CONNECT) {
+
+        // uri-host ":" port, with no userinfo
+        clear_authority(url);
+        if (!parse_host(src, len, &i, &url->host, NULL) || url->host.no_port)
+            return XURL_TARGET_INVALID;
+        url->schema = NULL;
+        url->schema_len = 0;
+        url->path = NULL;
+        url->path_len = 0;
+        url->query = NULL;
+        url->query_len = 0;
+        form = XURL_TARGET_AUTHORITY;
+
+    } else if (len > 0 && src[0] == '/') {
+
+        clear_authority(url);
+        url->schema = NULL;
+        url->schema_len = 0;
+        parse_origin(src, len, &i, url);
+        form = XURL_TARGET_ORIGIN;
+
+    } else if (len == 1 && src[0] == '*') {
+
+        if (method != XURL_METHOD_OPTIONS)
+            return XURL_TARGET_INVALID;
+        clear_authority(url);
+        url->schema = NULL;
+        url->schema_len = 0;
+        url->path = src;
+        url->path_len = 1;
+        url->query = NULL;
+        url->query_len = 0;
+        i = 1;
+        form = XURL_TARGET_ASTERISK;
+
+    } else {
+
+        if (!parse_components(src, len, &i, url, false, NULL))
+            return XURL_TARGET_INVALID;
+        if (url->schema == NULL || url->fragment != NULL)
+            return XURL_TARGET_INVALID;
+        form = XURL_TARGET_ABSOLUTE;
+    }
+
+    if (i != len)
+        return XURL_TARGET_INVALID;
+    url->fragment = NULL;
+    url->fragment_len = 0;
+
+#if XURL_ZEROTERMINATE
+    if (!zero_terminate(url))
+        return XURL_TARGET_INVALID;
+#endif
+    return form;
+}
+
+#if XURL_ZEROTERMINATE
+/* Symbol: terminate_part
+ *   Make the component [*str] zero-terminated. If
+ *   it's followed by a separator, the separator is
+ *   overwritten. If it ends with the buffer of its
+ *   part ([part_end]), it's copied into [alloc].
+ */
+static bool terminate_part(char **str, size_t len, 
+                           const char *part_end,
+                           alloc_t *alloc)
+{
+    if (*str == NULL)
+        return true;
+    if (*str + len == part_end) {
+        *str = my_strdup(*str, len, alloc);
+        return *str != NULL;
+    }
+    (*str)[len] = '\0';
+    return true;
+}
+#endif
+
+/* Symbol: xurl_parse_parts
+ *   Parse an URL given as separate parts, like the
+ *   :scheme, :authority and :path pseudo-headers of
+ *   HTTP/2 and HTTP/3. Each part is parsed in place,
+ *   so the slices of [url] point into the buffers of
+ *   the parts and nothing is concatenated.
+ *
+ * Arguments:
+ *   - scheme: The schema, without the ':'.
+ *
+ *   - authority: Host and optional port. It can't
+ *                have a userinfo (RFC 9113, section
+ *                8.3.1).
+ *
+ *   - path: The path with the optional query (an
+ *           origin-form request-target) or "*".
+ *
+ *   Parts that are NULL are absent (a CONNECT
+ *   request only has the authority), while empty
+ *   parts are invalid.
+ *
+ * Returns:
+ *   - [true] on success. The fragment is always NULL.
+ *
+ * Notes:
+ *   - When [XURL_ZEROTERMINATE] is 1, components that
+ *     end with the buffer of their part are copied
+ *     into [url->buffer].
+ */
+bool xurl_parse_parts(XURL_INPUT_CONSTNESS char *scheme, size_t scheme_len,
+                      XURL_INPUT_CONSTNESS char *authority, size_t authority_len,
+                      XURL_INPUT_CONSTNESS char *path, size_t path_len,
+                      xurl_t *url)
+{
+    if (scheme == NULL) {
+        url->schema = NULL;
+        url->schema_len = 0;
+    } else {
+        if (scheme_len == 0 || !is_schema_first(scheme[0]))
+            return false;
+        for (size_t k = 1; k < scheme_len; k++)
+            if (!is_schema(scheme[k]))
+                return false;
+        url->schema = scheme;
+        url->schema_len = scheme_len;
+    }
+
+    // The host is parsed on its own since a userinfo
+    // isn't allowed. If there's one, the parsing stops
+    // before the '@'.
+    clear_authority(url);
+    if (authority != NULL) {
+        size_t i = 0;
+        if (!parse_host(authority, authority_len, &i, &url->host, NULL))
+            return false;
+        if (i != authority_len)
+            return false;
+    }
+
+    url->path = NULL;
+    url->path_len = 0;
+    url->query = NULL;
+    url->query_len = 0;
+    url->fragment = NULL;
+    url->fragment_len = 0;
+
+    if (path != NULL) {
+        size_t i;
+        if (path_len == 1 && path[0] == '*') {
+            url->path = path;
+            url->path_len = 1;
+            i = 1;
+        } else {
+            if (path_len == 0 || path[0] != '/')
+                return false;
+            i = 0;
+            parse_origin(path, path_len, &i, url);
+        }
+        if (i != path_len)
+            return false;
+    }
+
+#if XURL_ZEROTERMINATE
+    alloc_t alloc = {
+        .pool = url->buffer,
+        .size = sizeof(url->buffer),
+        .used = 0,
+    };
+
+    // Absent parts have no end. Their components are
+    // NULL, so [terminate_part] never looks at it.
+    const char *scheme_end = scheme ? scheme + scheme_len : NULL;
+    const char *authority_end = authority ? authority + authority_len : NULL;
+    const char *path_end = path ? path + path_len : NULL;
+
+    // The zone is followed by the ']'
+    if (url->host.mode == XURL_HOSTMODE_IPV6 && url->host.zone != NULL)
+        url->host.zone[url->host.zone_len] = '\0';
+
+    if (!terminate_part(&url->schema, url->schema_len, scheme_end, &alloc)
+        || (url->host.mode == XURL_HOSTMODE_NAME && !terminate_part(&url->host.name, url->host.name_len, authority_end, &alloc))
+        || !terminate_part(&url->path, url->path_len, path_end, &alloc)
+        || !terminate_part(&url->query, url->query_len, path_end, &alloc))
+        return false;
+#endif
+    return true;
+}
+
+static bool has_authority(const xurl_t *url)
+{
+    return url->host.mode != XURL_HOSTMODE_NAME 
+        || url->host.name != NULL;
+}
+
+static void compact_set(xurl_compact_t *url, xurl_component component,
+                        const char *src, const char *slice, size_t len)
+{
+    if (slice == NULL) {
+        url->offset[component] = 0;
+        url->length[component] = 0;
+    } else {
+        url->offset[component] = slice - src;
+        url->length[component] = len;
+        url->present |= 1 << component;
+    }
+}
+
+/* Symbol: xurl_parse_compact
+ *   Like [xurl_parse], but stores the components as
+ *   16-bit offsets relative to [src] into a structure
+ *   that is a fraction of the size of [xurl_t], to
+ *   keep large numbers of parsed URLs in memory.
+ *
+ *   Components are read back with [xurl_compact_get].
+ *
+ * Arguments:
+ *         (in) src: The URL to parse, which must be
+ *                   shorter than 64 KiB.
+ *
+ *              len: The length of [src].
+ *
+ *        (out) url: The parse result.
+ *
+ * Returns:
+ *   - [true] on success, [false] if [src] isn't a
+ *     valid URL or is too long.
+ *
+ * Notes:
+ *   - The source is never modified, even when
+ *     XURL_ZEROTERMINATE is 1.
+ */
+bool xurl_parse_compact(XURL_INPUT_CONSTNESS char *src,
+                        size_t len, xurl_compact_t *url)
+{
+    if (len > UINT16_MAX)
+        return false;
+
+    // The components are found by the same parser as
+    // [xurl_parse], into an [xurl_t] on the stack, and
+    // then converted to offsets. The parser also gives
+    // the span of the host's text.
+    xurl_t full;
+    xurl_span host;
+    size_t i = 0;
+    if (!parse_components(src, len, &i, &full, false, &host) || i != len)
+        return false;
+
+    url->present = 0;
+    url->host_mode = full.host.mode;
+    compact_set(url, XURL_COMPONENT_SCHEMA,   src, full.schema, full.schema_len);
+    compact_set(url, XURL_COMPONENT_USERNAME, src, full.userinfo.username, full.userinfo.username_len);
+    compact_set(url, XURL_COMPONENT_PASSWORD, src, full.userinfo.password, full.userinfo.password_len);
+    compact_set(url, XURL_COMPONENT_PATH,     src, full.path, full.path_len);
+    compact_set(url, XURL_COMPONENT_QUERY,    src, full.query, full.query_len);
+    compact_set(url, XURL_COMPONENT_FRAGMENT, src, full.fragment, full.fragment_len);
+
+    if (has_authority(&full))
+        compact_set(url, XURL_COMPONENT_HOST, src, src + host.offset, host.len);
+
+    url->port = full.host.no_port ? 0 : full.host.port;
+    if (!full.host.no_port)
+        url->present |= XURL_COMPACT_PORT;
+    return true;
+}
+
+/* Symbol: xurl_compact_get
+ *   Get a component of an URL parsed by
+ *   [xurl_parse_compact] from [src].
+ *
+ * Returns:
+ *   - [true] if the component is present, [false]
+ *     otherwise, in which case [slice] is set to
+ *     NULL and [slice_len] to 0.
+ */
+bool xurl_compact_get(const xurl_compact_t *url,
+                      XURL_INPUT_CONSTNESS char *src,
+                      xurl_component component,
+                      XURL_INPUT_CONSTNESS char **slice,
+                      size_t *slice_len)
+{
+    if (!(url->present & (1 << component))) {
+        *slice = NULL;
+        *slice_len = 0;
+        return false;
+    }
+    *slice = src + url->offset[component];
+    *slice_len = url->length[component];
+    return true;
+}
+
+/* Symbol: xurl_host_zone
+ *   Get the zone identifier of an IPv6 host from the
+ *   source of an URL parsed by [xurl_parse_compact]
+ *   or [xurl_parse_columns]. The host slice only holds
+ *   the address, which is followed by "%25<zone>]"
+ *   when there is a zone.
+ *
+ * Arguments:
+ *         (in) src: The source of the URL.
+ *
+ *              len: The length of [src].
+ *
+ *         host_end: The offset of the end of the host
+ *                   slice, which is its offset plus its
+ *                   length.
+ *
+ *  (out) zone, zone_len: The zone, without the "%25".
+ *
+ * Returns:
+ *   - [true] if the host has a zone, [false] otherwise,
+ *     in which case [zone] is set to NULL and [zone_len]
+ *     to 0.
+ */
+bool xurl_host_zone(XURL_INPUT_CONSTNESS char *src, size_t len,
+                    size_t host_end,
+                    XURL_INPUT_CONSTNESS char **zone,
+                    size_t *zone_len)
+{
+    size_t k = host_end;
+    if (k+2 < len && src[k] == '%' && src[k+1] == '2' && src[k+2] == '5') {
+        k += 3;
+        size_t zone_offset = k;
+        while (k < len && src[k] != ']')
+            k++;
+        if (k < len && k > zone_offset) {
+            *zone = src + zone_offset;
+            *zone_len = k - zone_offset;
+            return true;
+        }
+    }
+    *zone = NULL;
+    *zone_len = 0;
+    return false;
+}
+
+// How many items ahead [xurl_parse_batch] prefetches
+#define BATCH_PREFETCH_DISTANCE 4
+
+#if defined(__GNUC__)
+#define PREFETCH(ptr) __builtin_prefetch(ptr)
+#else
+#define PREFETCH(ptr) ((void) (ptr))
+#endif
+
+/* Symbol: xurl_parse_batch
+ *   Parse [n] URLs. The i-th URL is [srcs[i]] with
+ *   length [lens[i]], its result is stored in [out[i]]
+ *   and whether it was parsed successfully in [ok[i]].
+ *   The results are the same of calling [xurl_parse]
+ *   on each URL.
+ *
+ *   While parsing an URL, the source of the ones that
+ *   follow is prefetched.
+ *
+ * Returns:
+ *   - The number of URLs that were parsed successfully.
+ *
+ * Notes:
+ *   - [ok] may be NULL if the caller is only interested
+ *     in the total.
+ */
+size_t xurl_parse_batch(XURL_INPUT_CONSTNESS char **srcs, 
+                        const size_t *lens, size_t n,
+                        xurl_t *out, bool *ok)
+{
+    for (size_t p = 0; p < n && p < BATCH_PREFETCH_DISTANCE; p++)
+        PREFETCH(srcs[p]);
+
+    size_t count = 0;
+    for (size_t p = 0; p < n; p++) {
+
+        if (p + BATCH_PREFETCH_DISTANCE < n)
+            PREFETCH(srcs[p + BATCH_PREFETCH_DISTANCE]);
+
+        size_t i = 0;
+        bool result = xurl_parse2(srcs[p], lens[p], &i, &out[p]) && i == lens[p];
+        if (ok != NULL)
+            ok[p] = result;
+        count += result;
+    }
+    return count;
+}
+
+/* Streaming parser
+ *
+ *   The streaming parser accepts an URL split in
+ *   chunks, as it's received from the network, and
+ *   gives the same results of [xurl_parse2] on the
+ *   concatenation of the chunks. Since the chunks
+ *   aren't contiguous, components are reported as
+ *   offsets relative to the start of the stream.
+ *
+ *   The parser is a state machine that remembers in
+ *   which component it's in between calls. Paths,
+ *   queries and fragments are scanned in place with
+ *   the run scanning kernels. The authority is parsed
+ *   in place when it's contained in a single chunk,
+ *   otherwise its bytes are accumulated in the state
+ *   until its end is found.
+ */
+
+enum {
+    STREAM_START,        // Nothing parsed yet
+    STREAM_SCHEMA,       // Inside something that may be a schema
+    STREAM_AFTER_SCHEMA, // A schema and its ':' were parsed
+    STREAM_SLASH,        // After a '/' that may be followed by another one
+    STREAM_AUTHORITY,
+    STREAM_PATH,
+    STREAM_QUERY,
+    STREAM_FRAGMENT,
+    STREAM_DONE,
+    STREAM_ERROR,
+};
+
+static const xurl_span no_span = { XURL_NO_OFFSET, 0 };
+
+static xurl_span make_span(size_t offset, size_t len)
+{
+    return (xurl_span) { offset, len };
+}
+
+static bool is_authority(char c)
+{
+    return has_class(c, CLASS_HOSTNAME)
+        || c == ':' || c == '@'
+        || c == '[' || c == ']'
+        || c == '%';
+}
+
+static xurl_stream_status stream_status(const xurl_stream_t *stream)
+{
+    switch (stream->state) {
+        case STREAM_DONE: return XURL_STREAM_DONE;
+        case STREAM_ERROR: return XURL_STREAM_ERROR;
+    }
+    return XURL_STREAM_MORE;
+}
+
+static void stream_done(xurl_stream_t *stream, size_t end)
+{
+    stream->state = STREAM_DONE;
+    stream->end = end;
+}
+
+/* Symbol: stream_authority
+ *   Parse the authority of a streamed URL. [src] is
+ *   the run of bytes that may belong to the authority
+ *   and [base] is its logical offset.
+ *
+ * Returns:
+ *   - [true] on success, in which case [used] is set
+ *     to the number of bytes of the run that belong
+ *     to the authority.
+ */
+static bool stream_authority(xurl_stream_t *stream,
+                             const char *src, size_t len,
+                             size_t base, size_t *used)
+{
+    // The parsing routines don't modify the source
+    XURL_INPUT_CONSTNESS char *run = (XURL_INPUT_CONSTNESS char*) src;
+
+    size_t k = 0;
+    xurl_userinfo userinfo;
+    xurl_host host;
+
+    if (!parse_authority(run, len, &k, &userinfo, &host, NULL))
+        return false;
+
+    xurl_offsets *url = &stream->url;
+
+    if (userinfo.username != NULL)
+        url->username = make_span(base + (userinfo.username - run), userinfo.username_len);
+    if (userinfo.password != NULL)
+        url->password = make_span(base + (userinfo.password - run), userinfo.password_len);
+
+    if (host.mode == XURL_HOSTMODE_NAME) {
+        url->host_name = make_span(base + (host.name - run), host.name_len);
+        host.name = NULL;
+        host.name_len = 0;
+    } else if (host.mode == XURL_HOSTMODE_IPV6 && host.zone != NULL) {
+        url->zone = make_span(base + (host.zone - run), host.zone_len);
+        host.zone = NULL;
+        host.zone_len = 0;
+    }
+    url->host = host;
+
+    *used = k;
+    return true;
+}
+
+static bool stream_buffer(xurl_stream_t *stream,
+                          const char *src, size_t len)
+{
+    if (len > sizeof(stream->authority) - stream->authority_len)
+        return false;
+    memcpy(stream->authority + stream->authority_len, src, len);
+    stream->authority_len += len;
+    return true;
+}
+
+/* Symbol: stream_after
+ *   Handle the byte [c] at logical offset [pos] that
+ *   terminated a component. It may start the path, the
+ *   query or the fragment, or terminate the URL.
+ *
+ * Returns:
+ *   - [true] if the byte was consumed.
+ */
+static bool stream_after(xurl_stream_t *stream, char c, size_t pos)
+{
+    if (c == '/' && stream->state == STREAM_AUTHORITY) {
+        stream->state = STREAM_PATH;
+        stream->mark = pos;
+        stream->after_slash = true;
+        return true;
+    }
+
+    if (c == '?' && stream->state != STREAM_QUERY && stream->state != STREAM_FRAGMENT) {
+        stream->state = STREAM_QUERY;
+        stream->mark = pos + 1;
+        return true;
+    }
+
+    if (c == '#' && stream->state != STREAM_FRAGMENT) {
+        stream->state = STREAM_FRAGMENT;
+        stream->mark = pos + 1;
+        return true;
+    }
+
+    stream_done(stream, pos);
+    return false;
+}
+
+/* Symbol: stream_end_run
+ *   Terminate the path, query or fragment run that
+ *   is being parsed at logical offset [pos], where
+ *   the byte [c] is.
+ *
+ * Returns:
+ *   - [true] if the byte was consumed.
+ */
+static bool stream_end_run(xurl_stream_t *stream,
+                           xurl_span *span, size_t pos,
+                           char c)
+{
+    // Paths can't be empty. This only happens when
+    // the path starts with an invalid '%'.
+    if (stream->state == STREAM_PATH && pos == stream->mark) {
+        stream->state = STREAM_ERROR;
+        return false;
+    }
+
+    *span = make_span(stream->mark, pos - stream->mark);
+    return stream_after(stream, c, pos);
+}
+
+void xurl_stream_init(xurl_stream_t *stream)
+{
+    stream->state = STREAM_START;
+    stream->offset = 0;
+    stream->mark = 0;
+    stream->end = 0;
+    stream->after_slash = false;
+    stream->escape_len = 0;
+    stream->authority_len = 0;
+
+    xurl_offsets *url = &stream->url;
+    url->host.mode = XURL_HOSTMODE_NAME;
+    url->host.name = NULL;
+    url->host.name_len = 0;
+    url->host.no_port = true;
+    url->host.port = 0;
+    url->host.port_len = 0;
+    url->host_name = no_span;
+    url->zone = no_span;
+    url->username = no_span;
+    url->password = no_span;
+    url->path = no_span;
+    url->query = no_span;
+    url->schema = no_span;
+    url->fragment = no_span;
+}
+
+/* Symbol: xurl_stream_feed
+ *   Parse the next chunk of a streamed URL.
+ *
+ * Returns:
+ *   - XURL_STREAM_MORE if the URL may continue in the
+ *     next chunk.
+ *
+ *   - XURL_STREAM_DONE if the URL ended. Its logical
+ *     length is stored in [stream->end] (equivalent to
+ *     the [i] of [xurl_parse2]) and its components in
+ *     [stream->url]. Any further chunk is ignored.
+ *
+ *   - XURL_STREAM_ERROR if the URL is invalid.
+ */
+xurl_stream_status xurl_stream_feed(xurl_stream_t *stream,
+                                    const char *chunk,
+                                    size_t len)
+{
+    xurl_offsets *url = &stream->url;
+    size_t k = 0;
+
+    while (k < len && stream->state != STREAM_DONE 
+                   && stream->state != STREAM_ERROR) {
+
+        size_t pos = stream->offset + k;
+        char c = chunk[k];
+
+        switch (stream->state) {
+
+            case STREAM_START:
+            if (is_schema_first(c)) {
+                stream->state = STREAM_SCHEMA;
+                stream->mark = pos;
+                k++;
+                break;
+            }
+            /* fallthrough */
+
+            case STREAM_AFTER_SCHEMA:
+            if (c == '/') {
+                stream->state = STREAM_SLASH;
+                stream->mark = pos;
+                k++;
+            } else if (is_pchar(c) || c == '%') {
+                stream->state = STREAM_PATH;
+                stream->mark = pos;
+                stream->after_slash = false;
+            } else
+                stream->state = STREAM_ERROR; // Missing path
+            break;
+
+            case STREAM_SCHEMA:
+            if (is_schema(c))
+                k++;
+            else if (c == ':') {
+                url->schema = make_span(stream->mark, pos - stream->mark);
+                stream->state = STREAM_AFTER_SCHEMA;
+                k++;
+            } else {
+                // It wasn't a schema after all, but
+                // the start of a relative path.
+                stream->state = STREAM_PATH;
+                stream->after_slash = false;
+            }
+            break;
+
+            case STREAM_SLASH:
+            if (c == '/') {
+                stream->state = STREAM_AUTHORITY;
+                stream->mark = pos + 1;
+                stream->authority_len = 0;
+                k++;
+            } else {
+                stream->state = STREAM_PATH;
+                stream->after_slash = true;
+            }
+            break;
+
+            case STREAM_AUTHORITY:
+            {
+                size_t start = k;
+                while (k < len && is_authority(chunk[k]))
+                    k++;
+
+                if (k == len) {
+                    // The authority may continue in
+                    // the next chunk.
+                    if (!stream_buffer(stream, chunk + start, k - start))
+                        stream->state = STREAM_ERROR;
+                    break;
+                }
+
+                const char *run;
+                size_t run_len;
+                if (stream->authority_len == 0) {
+                    run = chunk + start;
+                    run_len = k - start;
+                } else {
+                    if (!stream_buffer(stream, chunk + start, k - start)) {
+                        stream->state = STREAM_ERROR;
+                        break;
+                    }
+                    run = stream->authority;
+                    run_len = stream->authority_len;
+                }
+
+                size_t used;
+                if (!stream_authority(stream, run, run_len, stream->mark, &used)) {
+                    stream->state = STREAM_ERROR;
+                    break;
+                }
+
+                if (used < run_len)
+                    stream_done(stream, stream->mark + used);
+                else if (stream_after(stream, chunk[k], stream->offset + k))
+                    k++;
+            }
+            break;
+
+            case STREAM_PATH:
+            case STREAM_QUERY:
+            case STREAM_FRAGMENT:
+            {
+                run_kind kind;
+                xurl_span *span;
+                switch (stream->state) {
+                    case STREAM_PATH:  kind = RUN_PATH;  span = &url->path;  break;
+                    case STREAM_QUERY: kind = RUN_QUERY; span = &url->query; break;
+                    default: kind = RUN_FRAGMENT; span = &url->fragment; break;
+                }
+
+                if (stream->escape_len > 0) {
+
+                    // Continue the percent-encoded byte
+                    // started in a previous chunk.
+                    if (is_hex_digit(c)) {
+                        k++;
+                        stream->escape_len++;
+                        if (stream->escape_len == 3) {
+                            stream->escape_len = 0;
+                            stream->after_slash = false;
+                        }
+                        break;
+                    }
+
+                    // It wasn't a percent-encoded byte,
+                    // therefore the run ends at the '%'.
+                    stream_end_run(stream, span, pos - stream->escape_len, '%');
+                    break;
+                }
+
+                size_t end = scan_run_resume(chunk, len, k, kind, stream->after_slash);
+                while (is_pct_encoded(chunk, len, end))
+                    end = scan_run_resume(chunk, len, end + 3, kind, false);
+
+                if (end < len && chunk[end] == '%' && (end+1 == len || (end+2 == len && is_hex_digit(chunk[end+1])))) {
+                    // The percent-encoded byte may continue
+                    // in the next chunk.
+                    stream->escape_len = len - end;
+                    k = len;
+                    break;
+                }
+
+                if (end == len) {
+                    // The run may continue in the next chunk
+                    if (end > k)
+                        stream->after_slash = (chunk[len-1] == '/');
+                    k = len;
+                    break;
+                }
+
+                k = end;
+                if (stream_end_run(stream, span, stream->offset + end, chunk[end]))
+                    k++;
+            }
+            break;
+        }
+    }
+
+    stream->offset += len;
+    return stream_status(stream);
+}
+
+/* Symbol: xurl_stream_finish
+ *   Tell the streaming parser that there are no
+ *   more chunks.
+ *
+ * Returns:
+ *   - XURL_STREAM_DONE or XURL_STREAM_ERROR, with the
+ *     same meaning they have for [xurl_stream_feed].
+ */
+xurl_stream_status xurl_stream_finish(xurl_stream_t *stream)
+{
+    xurl_offsets *url = &stream->url;
+    size_t pos = stream->offset;
+
+    switch (stream->state) {
+
+        case STREAM_START:
+        case STREAM_AFTER_SCHEMA:
+        stream->state = STREAM_ERROR; // Missing path
+        break;
+
+        case STREAM_SCHEMA:
+        // It wasn't a schema after all
+        url->path = make_span(stream->mark, pos - stream->mark);
+        stream_done(stream, pos);
+        break;
+
+        case STREAM_SLASH:
+        url->path = make_span(stream->mark, 1);
+        stream_done(stream, pos);
+        break;
+
+        case STREAM_AUTHORITY:
+        {
+            size_t used;
+            if (stream_authority(stream, stream->authority, stream->authority_len, stream->mark, &used))
+                stream_done(stream, stream->mark + used);
+            else
+                stream->state = STREAM_ERROR;
+        }
+        break;
+
+        case STREAM_PATH:
+        case STREAM_QUERY:
+        case STREAM_FRAGMENT:
+        {
+            xurl_span *span;
+            switch (stream->state) {
+                case STREAM_PATH:  span = &url->path;  break;
+                case STREAM_QUERY: span = &url->query; break;
+                default: span = &url->fragment; break;
+            }
+
+            // An incomplete percent-encoded byte
+            // isn't part of the run.
+            pos -= stream->escape_len;
+
+            if (stream->state == STREAM_PATH && pos == stream->mark)
+                stream->state = STREAM_ERROR;
+            else {
+                *span = make_span(stream->mark, pos - stream->mark);
+                stream_done(stream, pos);
+            }
+        }
+        break;
+    }
+    return stream_status(stream);
+}
+
+bool xurl_parse_ipv4(const char *src, size_t len, 
+                     uint32_t *out)
+{
+    size_t i = 0;
+    return parse_ipv4(src, len, &i, out) && i == len;
+}
+
+bool xurl_parse_ipv6(const char *src, size_t len, 
+                     uint16_t out[8])
+{
+    size_t i = 0;
+    return parse_ipv6(src, len, &i, out) && i == len;
+}
+
+/* Symbol: decode
+ *   Percent-decode [src] into [dst]. If [plus_is_space]
+ *   is set, '+' is decoded as ' '. See [xurl_decode_path].
+ */
+static bool decode(XURL_INPUT_CONSTNESS char *src, size_t len,
+                   char *dst, size_t cap, bool plus_is_space,
+                   XURL_INPUT_CONSTNESS char **out, size_t *out_len)
+{
+    char plus = plus_is_space ? '+' : '%';
+
+    size_t k = find_byte(src, len, 0, '%', plus, '%');
+    if (k == len) {
+        // Nothing to decode
+        *out = src;
+        *out_len = len;
+        return true;
+    }
+
+#if XURL_ZEROTERMINATE
+    // Decode in place. The slices returned by the
+    // parser are followed by their zero terminator,
+    // therefore there's room for a new one.
+    if (dst == NULL) {
+        dst = src;
+        cap = len + 1;
+    }
+#endif
+    if (dst == NULL)
+        return false;
+
+    size_t used = 0;
+    size_t copied = 0; // Bytes of [src] copied or decoded
+    while (k < len) {
+
+        // Copy what comes before the byte to decode.
+        // The decoded string is never longer than the
+        // source, so this also works in place.
+        size_t n = k - copied;
+        if (n > cap - used)
+            return false;
+        memmove(dst + used, src + copied, n);
+        used += n;
+
+        char byte;
+        if (src[k] == '+') {
+            byte = ' ';
+            k++;
+        } else {
+            if (!is_pct_encoded(src, len, k))
+                return false;
+            byte = (hex_digit_to_int(src[k+1]) << 4) | hex_digit_to_int(src[k+2]);
+            k += 3;
+        }
+
+        if (used == cap)
+            return false;
+        dst[used++] = byte;
+
+        copied = k;
+        k = find_byte(src, len, k, '%', plus, '%');
+    }
+
+    size_t n = len - copied;
+    if (n > cap - used)
+        return false;
+    memmove(dst + used, src + copied, n);
+    used += n;
+
+#if XURL_ZEROTERMINATE
+    if (used == cap)
+        return false;
+    dst[used] = '\0';
+#endif
+
+    *out = dst;
+    *out_len = used;
+    return true;
+}
+
+/* Symbol: xurl_decode_path
+ *   Percent-decode a path (or any other component
+ *   other than the query).
+ *
+ * Arguments:
+ *         (in) src: The component, as returned by the
+ *                   parser.
+ *
+ *              len: The number of bytes pointed by [src].
+ *
+ *        (out) dst: Buffer where the decoded component
+ *                   is written, if it needs decoding.
+ *                   When XURL_ZEROTERMINATE is 1, it may
+ *                   be NULL to decode the component in
+ *                   place.
+ *
+ *              cap: The number of bytes pointed by [dst].
+ *
+ *        (out) out: The decoded component. If [src] has
+ *                   nothing to decode, it's [src] itself
+ *                   and nothing is copied.
+ *
+ *    (out) out_len: The length of the decoded component.
+ *
+ * Returns:
+ *   - [true] on success, [false] if [dst] is too small
+ *     or [src] contains an invalid percent-encoded byte.
+ *     On failure the contents of [dst] are unspecified.
+ *
+ * Notes:
+ *   - When XURL_ZEROTERMINATE is 1, the decoded component
+ *     is zero-terminated, which needs one more byte in
+ *     [dst].
+ */
+bool xurl_decode_path(XURL_INPUT_CONSTNESS char *src, size_t len,
+                      char *dst, size_t cap,
+                      XURL_INPUT_CONSTNESS char **out, size_t *out_len)
+{
+    return decode(src, len, dst, cap, false, out, out_len);
+}
+
+/* Symbol: xurl_decode_query
+ *   Like [xurl_decode_path], but '+' is decoded as
+ *   a space as in form-encoded queries. Decoding a
+ *   whole query makes encoded '&' and '=' undistinguishable
+ *   from separators, so it's meant for keys and values.
+ */
+bool xurl_decode_query(XURL_INPUT_CONSTNESS char *src, size_t len,
+                       char *dst, size_t cap,
+                       XURL_INPUT_CONSTNESS char **out, size_t *out_len)
+{
+    return decode(src, len, dst, cap, true, out, out_len);
+}
+
+/* Symbol: xurl_query_init
+ *   Initialize an iterator over the parameters of
+ *   a query, such as the one returned by the parser.
+ *   The iterator refers to the query, which isn't
+ *   copied.
+ *
+ *   Parameters are separated by '&', and also by ';'
+ *   if [flags] contains XURL_QUERY_SEMICOLON. The
+ *   query may be NULL, in which case there are no
+ *   parameters.
+ */
+void xurl_query_init(xurl_query_iter *iter,
+                     XURL_INPUT_CONSTNESS char *query,
+                     size_t len, int flags)
+{
+    iter->src = query;
+    iter->len = (query == NULL) ? 0 : len;
+    iter->cur = 0;
+    iter->sep = (flags & XURL_QUERY_SEMICOLON) ? ';' : '&';
+}
+
+/* Symbol: xurl_query_next
+ *   Get the next parameter of a query. The key and
+ *   value are slices of the query and are not
+ *   percent-decoded (see [xurl_decode_query]).
+ *
+ *   The key ends at the first '=', and the value
+ *   goes from there up to the next separator. The
+ *   key and the value can be empty ("=value" and
+ *   "key="). If there's no '=', the value is NULL.
+ *   Empty parameters (as in "a&&b") are skipped.
+ *
+ * Returns:
+ *   - [true] if a parameter was stored in [param],
+ *     [false] if there are no more.
+ */
+bool xurl_query_next(xurl_query_iter *iter, xurl_query_param *param)
+{
+    XURL_INPUT_CONSTNESS char *src = iter->src;
+    size_t len = iter->len;
+    size_t k = iter->cur;
+
+    // Skip empty parameters
+    while (k < len && (src[k] == '&' || src[k] == iter->sep))
+        k++;
+
+    if (k == len) {
+        iter->cur = k;
+        return false;
+    }
+
+    size_t key_offset = k;
+    k = find_byte(src, len, k, '&', iter->sep, '=');
+    param->key = src + key_offset;
+    param->key_len = k - key_offset;
+
+    if (k < len && src[k] == '=') {
+        k++; // Skip the '='
+        size_t value_offset = k;
+        k = find_byte(src, len, k, '&', iter->sep, '&');
+        param->value = src + value_offset;
+        param->value_len = k - value_offset;
+    } else {
+        param->value = NULL;
+        param->value_len = 0;
+    }
+
+    iter->cur = k;
+    return true;
+}
+
+static uint32_t keyset_hash(const char *key, size_t len, uint32_t seed)
+{
+    // FNV-1a with a seed
+    uint32_t h = seed ^ 2166136261u;
+    for (size_t k = 0; k < len; k++)
+        h = (h ^ (uint8_t) key[k]) * 16777619u;
+    return h ^ (h >> 15);
+}
+
+/* Symbol: xurl_keyset_init
+ *   Build a set of query keys for [xurl_query_lookup].
+ *   This is meant to be done once at startup.
+ *
+ *   The set is a perfect hash table: a seed is searched
+ *   for which no two keys end up in the same slot, so a
+ *   lookup is one hash and one comparison. The strings
+ *   of [keys] aren't copied and must outlive the set.
+ *
+ * Returns:
+ *   - [true] on success, [false] if there are more than
+ *     XURL_KEYSET_MAX keys, a key is repeated or no seed
+ *     could be found.
+ */
+bool xurl_keyset_init(xurl_keyset *set, const char **keys, size_t count)
+{
+    if (count > XURL_KEYSET_MAX)
+        return false;
+
+    set->count = count;
+    for (size_t p = 0; p < count; p++) {
+        set->keys[p] = keys[p];
+        set->key_lens[p] = strlen(keys[p]);
+    }
+
+    // Start with a table of at least twice the
+    // keys and grow it if no seed works.
+    size_t size = 2;
+    while (size < 2 * count)
+        size *= 2;
+
+    for (; size <= sizeof(set->slots); size *= 2) {
+        for (uint32_t seed = 1; seed <= 1000; seed++) {
+
+            memset(set->slots, 0, sizeof(set->slots));
+
+            size_t p;
+            for (p = 0; p < count; p++) {
+                uint32_t h = keyset_hash(set->keys[p], set->key_lens[p], seed) & (size - 1);
+                if (set->slots[h] != 0)
+                    break; // Collision
+                set->slots[h] = p + 1;
+            }
+
+            if (p == count) {
+                set->seed = seed;
+                set->mask = size - 1;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/* Symbol: xurl_query_lookup
+ *   Look for the keys of [set] in a query with a
+ *   single pass over it, however many keys there
+ *   are. [flags] is the same as [xurl_query_init].
+ *
+ *   [params] must have room for one parameter per
+ *   key of the set. The i-th parameter refers to the
+ *   i-th key. If a key appears more than once, the
+ *   first occurrence is used. If it doesn't appear,
+ *   its [key] and [value] are NULL.
+ *
+ * Returns:
+ *   - The number of keys that were found.
+ */
+size_t xurl_query_lookup(const xurl_keyset *set,
+                         XURL_INPUT_CONSTNESS char *query,
+                         size_t len, int flags,
+                         xurl_query_param *params)
+{
+    for (size_t p = 0; p < set->count; p++) {
+        params[p].key = NULL;
+        params[p].value = NULL;
+        params[p].key_len = 0;
+        params[p].value_len = 0;
+    }
+
+    size_t found = 0;
+
+    xurl_query_iter iter;
+    xurl_query_param param;
+    xurl_query_init(&iter, query, len, flags);
+    while (found < set->count && xurl_query_next(&iter, &param)) {
+
+        uint32_t h = keyset_hash(param.key, param.key_len, set->seed) & set->mask;
+        size_t slot = set->slots[h];
+        if (slot == 0)
+            continue;
+
+        size_t p = slot - 1;
+        if (param.key_len == set->key_lens[p]
+            && !memcmp(param.key, set->keys[p], param.key_len)
+            && params[p].key == NULL) {
+            params[p] = param;
+            found++;
+        }
+    }
+    return found;
+}
+
+/* Symbol: xurl_path_init
+ *   Initialize an iterator over the segments of a
+ *   path, such as the one returned by the parser.
+ *   The path may be NULL, in which case there are
+ *   no segments.
+ */
+void xurl_path_init(xurl_path_iter *iter,
+                    XURL_INPUT_CONSTNESS char *path,
+                    size_t len)
+{
+    iter->src = path;
+    iter->len = (path == NULL) ? 0 : len;
+    iter->cur = 0;
+}
+
+/* Symbol: xurl_path_next
+ *   Get the next segment of a path as a slice of
+ *   the path. Segments are separated by '/'. The
+ *   leading '/' of absolute paths doesn't start a
+ *   segment, while a trailing '/' ends with an
+ *   empty one. For instance "/a/b/" has segments
+ *   "a", "b" and "".
+ *
+ * Returns:
+ *   - [true] if a segment was returned, [false] if
+ *     there are no more.
+ */
+bool xurl_path_next(xurl_path_iter *iter,
+                    XURL_INPUT_CONSTNESS char **segment,
+                    size_t *segment_len)
+{
+    XURL_INPUT_CONSTNESS char *src = iter->src;
+    size_t len = iter->len;
+    size_t k = iter->cur;
+
+    // [cur] is past [len] when the last
+    // segment was already returned.
+    if (k > len || len == 0)
+        return false;
+
+    if (k == 0 && src[0] == '/')
+        k++;
+
+    size_t offset = k;
+    k = find_byte(src, len, k, '/', '/', '/');
+    *segment = src + offset;
+    *segment_len = k - offset;
+
+    iter->cur = k + 1; // Skip the '/'
+    return true;
+}
+
+/* Symbol: remove_dot_segments
+ *   Implementation of [xurl_remove_dot_segments],
+ *   without the zero terminator.
+ */
+static bool remove_dot_segments(const char *src, size_t len,
+                                char *dst, size_t cap,
+                                size_t *out_len)
+{
+    size_t r = 0; // Read cursor
+    size_t w = 0; // Write cursor
+
+    // The algorithm of the RFC replaces some prefixes
+    // of the input with a "/". Instead of writing it
+    // in the input, this flag tells that the input is
+    // preceded by a virtual '/'.
+    bool slash = false;
+
+    while (slash || r < len) {
+
+        size_t n = len - r;
+        const char *in = src + r;
+
+        if (!slash) {
+
+            // A. Remove a leading "../" or "./"
+            if (n >= 3 && in[0] == '.' && in[1] == '.' && in[2] == '/') {
+                r += 3;
+                continue;
+            }
+            if (n >= 2 && in[0] == '.' && in[1] == '/') {
+                r += 2;
+                continue;
+            }
+
+            // D. The input is "." or ".."
+            if ((n == 1 && in[0] == '.') || (n == 2 && in[0] == '.' && in[1] == '.'))
+                break;
+
+            if (in[0] == '/') {
+                // Make the leading '/' virtual, so that
+                // the cases below only look at [slash].
+                slash = true;
+                r++;
+                continue;
+            }
+
+        } else {
+
+            // B. Replace "/./" or a final "/." with "/"
+            if (n >= 1 && in[0] == '.' && (n == 1 || in[1] == '/')) {
+                r += (n == 1) ? 1 : 2;
+                continue;
+            }
+
+            // C. Replace "/../" or a final "/.." with "/"
+            //    and remove the last output segment.
+            if (n >= 2 && in[0] == '.' && in[1] == '.' && (n == 2 || in[2] == '/')) {
+                r += (n == 2) ? 2 : 3;
+                while (w > 0 && dst[w-1] != '/')
+                    w--;
+                if (w > 0)
+                    w--;
+                continue;
+            }
+        }
+
+        // E. Move the first segment, with its leading
+        //    '/' if there is one, to the output.
+        if (slash) {
+            if (w == cap)
+                return false;
+            dst[w++] = '/';
+            slash = false;
+        }
+
+        size_t end = find_byte(src, len, r, '/', '/', '/');
+        if (end - r > cap - w)
+            return false;
+        memmove(dst + w, src + r, end - r);
+        w += end - r;
+        r = end;
+    }
+
+    *out_len = w;
+    return true;
+}
+
+/* Symbol: xurl_remove_dot_segments
+ *   Remove the "." and ".." segments from a path as
+ *   described in RFC 3986, section 5.2.4. For example,
+ *   "/a/b/c/./../../g" becomes "/a/g".
+ *
+ *   This is done in a single pass. Each segment is
+ *   looked at once, and a ".." only walks back over
+ *   the output segment it removes, so the cost is
+ *   linear in the length of the path.
+ *
+ * Arguments:
+ *         (in) src: The path.
+ *
+ *              len: The number of bytes pointed by [src].
+ *
+ *        (out) dst: Where the resulting path is written.
+ *                   It can be equal to [src] to do the
+ *                   operation in place, since the result
+ *                   is never longer than the source.
+ *
+ *              cap: The number of bytes pointed by [dst].
+ *
+ *    (out) out_len: The length of the resulting path.
+ *
+ * Returns:
+ *   - [true] on success, [false] if [dst] is too small.
+ *
+ * Notes:
+ *   - When XURL_ZEROTERMINATE is 1, the result is
+ *     zero-terminated, which needs one more byte in
+ *     [dst].
+ */
+bool xurl_remove_dot_segments(const char *src, size_t len,
+                              char *dst, size_t cap,
+                              size_t *out_len)
+{
+    if (!remove_dot_segments(src, len, dst, cap, out_len))
+        return false;
+
+#if XURL_ZEROTERMINATE
+    if (*out_len == cap)
+        return false;
+    dst[*out_len] = '\0';
+#endif
+    return true;
+}
+
+/* Output
+ *
+ *   Functions that build strings (canonicalization,
+ *   formatting, resolution) write through a [writer_t],
+ *   which never writes past the capacity of the buffer
+ *   but keeps counting the bytes, so that overflows
+ *   are detected once at the end.
+ */
+
+typedef struct {
+    char  *dst;
+    size_t cap;
+    size_t len;
+} writer_t;
+
+static void put(writer_t *w, const char *src, size_t len)
+{
+    if (len > 0 && len <= w->cap && w->len <= w->cap - len)
+        memcpy(w->dst + w->len, src, len);
+    w->len += len;
+}
+
+static void put_char(writer_t *w, char c)
+{
+    if (w->len < w->cap)
+        w->dst[w->len] = c;
+    w->len++;
+}
+
+static bool overflowed(const writer_t *w)
+{
+    return w->len > w->cap;
+}
+
+static char to_lower(char c)
+{
+    return is_upper_alpha(c) ? c - 'A' + 'a' : c;
+}
+
+static const char upper_hex[] = "0123456789ABCDEF";
+
+// Two-digit forms of 0 to 99 and of the bytes in
+// lowercase hex, so that IP addresses are written
+// two digits at a time.
+static const char dec_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899"
+    ;
+
+static const char hex_pairs[] =
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+    "404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+    "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+    "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+    "a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+    "c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+    "e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff"
+    ;
+
+// Size of the buffers passed to [format_ipv4] and
+// [format_ipv6], which may write a few bytes past
+// the end of the address.
+#define IPV4_TEXT_BUFFER 16
+#define IPV6_TEXT_BUFFER 40
+
+/* Symbol: format_ipv4
+ *   Write the dotted-decimal form of [ipv4] into
+ *   [dst], which must have room for [IPV4_TEXT_BUFFER]
+ *   bytes.
+ *
+ * Returns:
+ *   - The number of bytes of the address.
+ */
+static size_t format_ipv4(uint32_t ipv4, char *dst)
+{
+    size_t k = 0;
+    for (int u = 3; u >= 0; u--) {
+        unsigned byte = (ipv4 >> (u * 8)) & 0xFF;
+        if (byte >= 100) {
+            unsigned hundreds = byte / 100;
+            dst[k++] = '0' + hundreds;
+            memcpy(dst + k, dec_pairs + 2 * (byte - 100 * hundreds), 2);
+            k += 2;
+        } else if (byte >= 10) {
+            memcpy(dst + k, dec_pairs + 2 * byte, 2);
+            k += 2;
+        } else
+            dst[k++] = '0' + byte;
+        dst[k++] = '.';
+    }
+    return k - 1;
+}
+
+/* Symbol: format_ipv6
+ *   Write the text form of [ipv6] into [dst], which
+ *   must have room for [IPV6_TEXT_BUFFER] bytes. The
+ *   form is the one recommended by RFC 5952: lowercase
+ *   hex digits without leading zeros, the longest run
+ *   of two or more zero words (the first one, if there's
+ *   a tie) replaced by "::", and IPv4-mapped addresses
+ *   written as "::ffff:" followed by the IPv4 address.
+ *
+ * Returns:
+ *   - The number of bytes of the address.
+ */
+static size_t format_ipv6(const uint16_t ipv6[static 8], char *dst)
+{
+    // Bit p is set if word p is zero
+    unsigned zeros = 0;
+    for (int p = 0; p < 8; p++)
+        zeros |= (unsigned) (ipv6[p] == 0) << p;
+
+    if ((zeros & 0x3F) == 0x1F && ipv6[5] == 0xFFFF) {
+        memcpy(dst, "::ffff:", 7);
+        return 7 + format_ipv4(((uint32_t) ipv6[6] << 16) | ipv6[7], dst + 7);
+    }
+
+    // After the n-th step, bit p of [run] is set if the
+    // words from p to p+n are zero. The last non-empty
+    // step has the starts of the longest runs.
+    int start = 8;
+    int end = 8;
+    unsigned run = zeros & (zeros >> 1);
+    if (run != 0) {
+        int count = 2;
+        while (run & (run >> 1)) {
+            run &= run >> 1;
+            count++;
+        }
+        start = __builtin_ctz(run);
+        end = start + count;
+    }
+
+    size_t k = 0;
+    if (start == 0)
+        dst[k++] = ':';
+    for (int p = 0; p < 8; p++) {
+
+        if (p == start) {
+            dst[k++] = ':';
+            p = end - 1;
+            continue;
+        }
+
+        // The word is written as four digits and a ':'
+        // starting from its first significant digit.
+        // The copy has a fixed size, so the bytes after
+        // the ':' are garbage, which is overwritten by
+        // the next word.
+        uint16_t word = ipv6[p];
+        char digits[8] = {0};
+        memcpy(digits, hex_pairs + 2 * (word >> 8), 2);
+        memcpy(digits + 2, hex_pairs + 2 * (word & 0xFF), 2);
+        digits[4] = ':';
+        int n = (32 - __builtin_clz(word | 1) + 3) >> 2;
+        memcpy(dst + k, digits + 4 - n, 5);
+        k += n + 1;
+    }
+
+    // Drop the ':' after the last word, unless the
+    // address ends with "::".
+    return end == 8 && start < 8 ? k : k - 1;
+}
+
+/* Symbol: xurl_format_ipv4
+ *   Write the dotted-decimal form of an IPv4 address,
+ *   as parsed by [xurl_parse_ipv4].
+ *
+ * Returns:
+ *   - The number of bytes written into [dst], or 0 if
+ *     [dst] is too small. [XURL_IPV4_TEXT_MAX] bytes
+ *     are always enough.
+ *
+ * Notes:
+ *   - When XURL_ZEROTERMINATE is 1, the result is
+ *     zero-terminated, which needs one more byte in
+ *     [dst]. The terminator isn't counted in the
+ *     returned length.
+ */
+size_t xurl_format_ipv4(uint32_t ipv4, char *dst, size_t cap)
+{
+    // The address is written in place when [dst] can
+    // also hold the extra bytes written by [format_ipv4].
+    char buffer[IPV4_TEXT_BUFFER];
+    char *out = cap >= sizeof(buffer) ? dst : buffer;
+    size_t len = format_ipv4(ipv4, out);
+    if (len + XURL_ZEROTERMINATE > cap)
+        return 0;
+    if (out != dst)
+        memcpy(dst, buffer, len);
+#if XURL_ZEROTERMINATE
+    dst[len] = '\0';
+#endif
+    return len;
+}
+
+/* Symbol: xurl_format_ipv6
+ *   Write the text form of an IPv6 address, as parsed
+ *   by [xurl_parse_ipv6], in the canonical form of
+ *   RFC 5952 and without brackets.
+ *
+ * Returns:
+ *   - The number of bytes written into [dst], or 0 if
+ *     [dst] is too small. [XURL_IPV6_TEXT_MAX] bytes
+ *     are always enough.
+ *
+ * Notes:
+ *   - When XURL_ZEROTERMINATE is 1, the result is
+ *     zero-terminated, which needs one more byte in
+ *     [dst]. The terminator isn't counted in the
+ *     returned length.
+ */
+size_t xurl_format_ipv6(const uint16_t ipv6[8], char *dst, size_t cap)
+{
+    // The address is written in place when [dst] can
+    // also hold the extra bytes written by [format_ipv6].
+    char buffer[IPV6_TEXT_BUFFER];
+    char *out = cap >= sizeof(buffer) ? dst : buffer;
+    size_t len = format_ipv6(ipv6, out);
+    if (len + XURL_ZEROTERMINATE > cap)
+        return 0;
+    if (out != dst)
+        memcpy(dst, buffer, len);
+#if XURL_ZEROTERMINATE
+    dst[len] = '\0';
+#endif
+    return len;
+}
+
+/* Symbol: put_normalized
+ *   Write a component applying the normalizations
+ *   of RFC 3986, section 6.2.2: percent-encoded
+ *   unreserved characters are decoded and the hex
+ *   digits of the other ones are made uppercase. If
+ *   [lower] is set, letters are also made lowercase.
+ *
+ * Returns:
+ *   - [true] if the written component is different
+ *     from [src].
+ */
+static bool put_normalized(writer_t *w, const char *src,
+                           size_t len, bool lower)
+{
+    bool changed = false;
+    size_t k = 0;
+    while (k < len) {
+
+        if (!lower) {
+            // Copy everything up to the next '%'
+            size_t end = find_byte(src, len, k, '%', '%', '%');
+            put(w, src + k, end - k);
+            k = end;
+            if (k == len)
+                break;
+        }
+
+        char c = src[k];
+        if (is_pct_encoded(src, len, k)) {
+            char byte = (hex_digit_to_int(src[k+1]) << 4) | hex_digit_to_int(src[k+2]);
+            if (has_class(byte, CLASS_UNRESERVED)) {
+                put_char(w, lower ? to_lower(byte) : byte);
+                changed = true;
+            } else {
+                char hex[3] = { '%', upper_hex[(uint8_t) byte >> 4], upper_hex[byte & 0xF] };
+                put(w, hex, 3);
+                if (hex[1] != src[k+1] || hex[2] != src[k+2])
+                    changed = true;
+            }
+            k += 3;
+        } else {
+            if (lower && is_upper_alpha(c)) {
+                c = to_lower(c);
+                changed = true;
+            }
+            put_char(w, c);
+            k++;
+        }
+    }
+    return changed;
+}
+
+static bool equals_nocase(const char *a, size_t a_len, const char *b)
+{
+    size_t b_len = strlen(b);
+    if (a_len != b_len)
+        return false;
+    for (size_t k = 0; k < a_len; k++)
+        if (to_lower(a[k]) != b[k])
+            return false;
+    return true;
+}
+
+/* Symbol: default_port
+ *   Returns the default port of the schema, or 0
+ *   if it's unknown.
+ */
+static uint16_t default_port(const char *schema, size_t schema_len)
+{
+    static const struct {
+        const char *schema;
+        uint16_t port;
+    } ports[] = {
+        {"http",  80},
+        {"https", 443},
+        {"ws",    80},
+        {"wss",   443},
+        {"ftp",   21},
+    };
+
+    if (schema == NULL)
+        return 0;
+
+    for (size_t p = 0; p < sizeof(ports)/sizeof(ports[0]); p++)
+        if (equals_nocase(schema, schema_len, ports[p].schema))
+            return ports[p].port;
+    return 0;
+}
+
+static void put_port(writer_t *w, uint16_t port)
+{
+    char buffer[5];
+    size_t k = sizeof(buffer);
+    do {
+        buffer[--k] = '0' + port % 10;
+        port /= 10;
+    } while (port > 0);
+    put(w, buffer + k, sizeof(buffer) - k);
+}
+
+/* Symbol: put_host
+ *   Write the host of [url]. IP addresses are written
+ *   from their binary form, with brackets for IPv6.
+ *   Names are written as they are, or normalized if
+ *   [normalize] is set.
+ *
+ * Returns:
+ *   - [true] if the host may be different from the
+ *     source. Since the text of IP addresses isn't
+ *     available, they are always considered changed.
+ */
+static bool put_host(writer_t *w, const xurl_host *host, bool normalize)
+{
+    char buffer[IPV6_TEXT_BUFFER];
+    switch (host->mode) {
+
+        case XURL_HOSTMODE_NAME:
+        if (normalize)
+            return put_normalized(w, host->name, host->name_len, true);
+        put(w, host->name, host->name_len);
+        break;
+
+        case XURL_HOSTMODE_IPV4:
+        put(w, buffer, format_ipv4(host->ipv4, buffer));
+        break;
+
+        case XURL_HOSTMODE_IPV6:
+        put_char(w, '[');
+        put(w, buffer, format_ipv6(host->ipv6, buffer));
+        if (host->zone != NULL) {
+            put(w, "%25", 3);
+            put(w, host->zone, host->zone_len);
+        }
+        put_char(w, ']');
+        break;
+    }
+    return host->mode != XURL_HOSTMODE_NAME;
+}
+
+/* Symbol: xurl_canonicalize
+ *   Write the normalized form of a parsed URL, as
+ *   described by RFC 3986, section 6, for instance
+ *   to be used as cache key. The normalizations are:
+ *
+ *     - The schema and host name are made lowercase.
+ *
+ *     - Percent-encoded unreserved characters are
+ *       decoded, and the hex digits of the others
+ *       are made uppercase.
+ *
+ *     - Dot segments are removed from absolute paths.
+ *
+ *     - The port is omitted when it's the default
+ *       one of the schema (http, https, ws, wss and
+ *       ftp are known), and an empty path becomes
+ *       "/" for these schemas.
+ *
+ *     - IP addresses are written in their canonical
+ *       text form.
+ *
+ *   The URL is built in a single pass over its
+ *   components, with no dynamic memory.
+ *
+ * Arguments:
+ *         (in) url: The parsed URL.
+ *
+ *        (out) dst: Where the normalized URL is written.
+ *
+ *              cap: The number of bytes pointed by [dst].
+ *
+ *    (out) out_len: The length of the normalized URL.
+ *
+ *  (out) canonical: Set to [true] if normalization didn't
+ *                   change any component, which means the
+ *                   source URL can be used as it is. May
+ *                   be NULL. URLs with an IP address as
+ *                   host are never reported as canonical,
+ *                   since the text of the address isn't
+ *                   known, and neither are ports whose
+ *                   [port_len] is 0.
+ *
+ * Returns:
+ *   - [true] on success, [false] if [dst] is too small.
+ *
+ * Notes:
+ *   - When XURL_ZEROTERMINATE is 1, the result is
+ *     zero-terminated, which needs one more byte in
+ *     [dst].
+ */
+bool xurl_canonicalize(const xurl_t *url, char *dst, size_t cap,
+                       size_t *out_len, bool *canonical)
+{
+    writer_t w = { dst, cap, 0 };
+    bool changed = false;
+
+    if (url->schema != NULL) {
+        changed |= put_normalized(&w, url->schema, url->schema_len, true);
+        put_char(&w, ':');
+    }
+
+    uint16_t port = default_port(url->schema, url->schema_len);
+
+    if (has_authority(url)) {
+
+        put(&w, "//", 2);
+
+        if (url->userinfo.username != NULL) {
+            changed |= put_normalized(&w, url->userinfo.username, url->userinfo.username_len, false);
+            if (url->userinfo.password != NULL) {
+                put_char(&w, ':');
+                changed |= put_normalized(&w, url->userinfo.password, url->userinfo.password_len, false);
+            }
+            put_char(&w, '@');
+        }
+
+        changed |= put_host(&w, &url->host, true);
+
+        if (!url->host.no_port) {
+            if (url->host.port == port && port != 0)
+                changed = true;
+            else {
+                // Leading zeros are dropped, and if the
+                // text of the port is unknown it's taken
+                // as changed.
+                put_char(&w, ':');
+                size_t port_start = w.len;
+                put_port(&w, url->host.port);
+                if (w.len - port_start != url->host.port_len)
+                    changed = true;
+            }
+        }
+
+        if (url->path == NULL && port != 0) {
+            put_char(&w, '/');
+            changed = true;
+        }
+    }
+
+    if (url->path != NULL) {
+
+        size_t start = w.len;
+        changed |= put_normalized(&w, url->path, url->path_len, false);
+
+        if (!overflowed(&w) && url->path[0] == '/') {
+            size_t path_len = w.len - start;
+            size_t new_len;
+            (void) remove_dot_segments(dst + start, path_len, dst + start, path_len, &new_len);
+            if (new_len != path_len) {
+                w.len = start + new_len;
+                changed = true;
+            }
+        }
+    }
+
+    if (url->query != NULL) {
+        put_char(&w, '?');
+        changed |= put_normalized(&w, url->query, url->query_len, false);
+    }
+
+    if (url->fragment != NULL) {
+        put_char(&w, '#');
+        changed |= put_normalized(&w, url->fragment, url->fragment_len, false);
+    }
+
+    if (overflowed(&w))
+        return false;
+
+#if XURL_ZEROTERMINATE
+    if (w.len == cap)
+        return false;
+    dst[w.len] = '\0';
+#endif
+
+    *out_len = w.len;
+    if (canonical != NULL)
+        *canonical = !changed;
+    return true;
+}
+
+/* Symbol: put_url
+ *   Write the components of [url] as they are. This
+ *   is the inverse of [xurl_parse], except for IP
+ *   addresses, which are written in their canonical
+ *   text form.
+ */
+static void put_url(writer_t *w, const xurl_t *url)
+{
+    if (url->schema != NULL) {
+        put(w, url->schema, url->schema_len);
+        put_char(w, ':');
+    }
+
+    if (has_authority(url)) {
+
+        put(w, "//", 2);
+
+        if (url->userinfo.username != NULL) {
+            put(w, url->userinfo.username, url->userinfo.username_len);
+            if (url->userinfo.password != NULL) {
+                put_char(w, ':');
+                put(w, url->userinfo.password, url->userinfo.password_len);
+            }
+            put_char(w, '@');
+        }
+
+        put_host(w, &url->host, false);
+
+        if (!url->host.no_port) {
+            put_char(w, ':');
+            put_port(w, url->host.port);
+        }
+    }
+
+    if (url->path != NULL)
+        put(w, url->path, url->path_len);
+
+    if (url->query != NULL) {
+        put_char(w, '?');
+        put(w, url->query, url->query_len);
+    }
+
+    if (url->fragment != NULL) {
+        put_char(w, '#');
+        put(w, url->fragment, url->fragment_len);
+    }
+}
+
+/* Symbol: xurl_format_length
+ *   Calculate the length of the string [xurl_format]
+ *   would build from [url], without building it.
+ *
+ * Returns:
+ *   - The length of the URL. When XURL_ZEROTERMINATE
+ *     is 1, the zero terminator isn't counted.
+ */
+size_t xurl_format_length(const xurl_t *url)
+{
+    writer_t w = { NULL, 0, 0 };
+    put_url(&w, url);
+    return w.len;
+}
+
+/* Symbol: xurl_format
+ *   Build the string form of a URL, which may have
+ *   been modified after parsing it (for instance by
+ *   changing its host or path).
+ *
+ *   IPv6 hosts are written between brackets, IPv4
+ *   and IPv6 hosts are written from their binary
+ *   form and the port is omitted when [no_port] is
+ *   set. The other components are written as they
+ *   are.
+ *
+ * Arguments:
+ *         (in) url: The URL to write.
+ *
+ *        (out) dst: Where the URL is written.
+ *
+ *              cap: The number of bytes pointed by [dst].
+ *                   Using [xurl_format_length] to choose
+ *                   it, the URL always fits.
+ *
+ * Returns:
+ *   - The number of bytes written into [dst], or 0 if
+ *     [dst] is too small.
+ *
+ * Notes:
+ *   - When XURL_ZEROTERMINATE is 1, the result is
+ *     zero-terminated, which needs one more byte in
+ *     [dst] than what [xurl_format_length] returns.
+ *     The terminator isn't counted in the returned
+ *     length.
+ */
+size_t xurl_format(const xurl_t *url, char *dst, size_t cap)
+{
+    writer_t w = { dst, cap, 0 };
+    put_url(&w, url);
+
+    if (overflowed(&w))
+        return 0;
+
+#if XURL_ZEROTERMINATE
+    if (w.len == cap)
+        return 0;
+    dst[w.len] = '\0';
+#endif
+
+    return w.len;
+}
+
+/* Symbol: put_span
+ *   Write a component and return where it was
+ *   written, or an absent span if [src] is NULL.
+ */
+static xurl_span put_span(writer_t *w, const char *src, size_t len)
+{
+    if (src == NULL)
+        return no_span;
+    xurl_span span = make_span(w->len, len);
+    put(w, src, len);
+    return span;
+}
+
+#if !XURL_ZEROTERMINATE
+static char *span_ptr(char *dst, xurl_span span)
+{
+    return span.offset == XURL_NO_OFFSET ? NULL : dst + span.offset;
+}
+#endif
+
+/* Symbol: xurl_resolve
+ *   Resolve the reference [ref] against the base URL
+ *   [base] as described in RFC 3986, section 5.2,
+ *   including the merge of relative paths and the
+ *   removal of dot segments.
+ *
+ *   The resulting URL is written into [dst] and its
+ *   components are stored in [out], which refers to
+ *   [dst]. Since the position of each component is
+ *   known while writing it, the result doesn't need
+ *   to be parsed again.
+ *
+ * Arguments:
+ *        (in) base: The base URL, which must have a
+ *                   schema.
+ *
+ *         (in) ref: The reference. References with an
+ *                   empty path can be parsed with
+ *                   [xurl_parse_reference].
+ *
+ *        (out) dst: Where the resulting URL is written.
+ *
+ *              cap: The number of bytes pointed by [dst].
+ *
+ *    (out) out_len: The length of the resulting URL.
+ *
+ *        (out) out: The parsed resulting URL.
+ *
+ * Returns:
+ *   - [true] on success, [false] if [base] has no
+ *     schema or [dst] is too small.
+ *
+ * Notes:
+ *   - When XURL_ZEROTERMINATE is 1, the resulting URL
+ *     is parsed from [dst] as usual, since zero bytes
+ *     must be placed between its components.
+ */
+bool xurl_resolve(const xurl_t *base, const xurl_t *ref,
+                  char *dst, size_t cap, size_t *out_len,
+                  xurl_t *out)
+{
+    if (base->schema == NULL)
+        return false;
+
+    // Choose where each component comes from
+    // (RFC 3986, section 5.2.2).
+    enum {
+        PATH_OF_REF,
+        PATH_OF_BASE,
+        PATH_MERGED,
+    } path_mode;
+    const xurl_t *schema_from;
+    const xurl_t *authority_from;
+    const xurl_t *query_from;
+
+    if (ref->schema != NULL) {
+        schema_from = ref;
+        authority_from = ref;
+        query_from = ref;
+        path_mode = PATH_OF_REF;
+    } else if (has_authority(ref)) {
+        schema_from = base;
+        authority_from = ref;
+        query_from = ref;
+        path_mode = PATH_OF_REF;
+    } else {
+        schema_from = base;
+        authority_from = base;
+        if (ref->path == NULL) {
+            path_mode = PATH_OF_BASE;
+            query_from = (ref->query != NULL) ? ref : base;
+        } else {
+            path_mode = (ref->path[0] == '/') ? PATH_OF_REF : PATH_MERGED;
+            query_from = ref;
+        }
+    }
+
+    writer_t w = { dst, cap, 0 };
+
+    xurl_span schema = put_span(&w, schema_from->schema, schema_from->schema_len);
+    put_char(&w, ':');
+
+    xurl_span username = no_span;
+    xurl_span password = no_span;
+    xurl_span host_name = no_span;
+    size_t port_len = 0;
+    if (has_authority(authority_from)) {
+
+        const xurl_userinfo *userinfo = &authority_from->userinfo;
+        const xurl_host *host = &authority_from->host;
+
+        put(&w, "//", 2);
+        if (userinfo->username != NULL) {
+            username = put_span(&w, userinfo->username, userinfo->username_len);
+            if (userinfo->password != NULL) {
+                put_char(&w, ':');
+                password = put_span(&w, userinfo->password, userinfo->password_len);
+            }
+            put_char(&w, '@');
+        }
+
+        if (host->mode == XURL_HOSTMODE_NAME)
+            host_name = put_span(&w, host->name, host->name_len);
+        else {
+            put_host(&w, host, false);
+            if (host->mode == XURL_HOSTMODE_IPV6 && host->zone != NULL)
+                host_name = make_span(w.len - 1 - host->zone_len, host->zone_len); // Before the ']'
+        }
+
+        if (!host->no_port) {
+            put_char(&w, ':');
+            size_t port_start = w.len;
+            put_port(&w, host->port);
+            port_len = w.len - port_start;
+        }
+    }
+
+    size_t path_start = w.len;
+    switch (path_mode) {
+
+        case PATH_OF_BASE:
+        if (base->path != NULL)
+            put(&w, base->path, base->path_len);
+        break;
+
+        case PATH_OF_REF:
+        put(&w, ref->path, ref->path_len);
+        break;
+
+        case PATH_MERGED:
+        // Merge the paths (RFC 3986, section 5.2.3)
+        if (has_authority(base) && base->path == NULL)
+            put_char(&w, '/');
+        else if (base->path != NULL) {
+            size_t keep = base->path_len;
+            while (keep > 0 && base->path[keep-1] != '/')
+                keep--;
+            put(&w, base->path, keep);
+        }
+        put(&w, ref->path, ref->path_len);
+        break;
+    }
+
+    if (path_mode != PATH_OF_BASE && !overflowed(&w)) {
+        size_t path_len = w.len - path_start;
+        size_t new_len;
+        (void) remove_dot_segments(dst + path_start, path_len, dst + path_start, path_len, &new_len);
+        w.len = path_start + new_len;
+    }
+
+    xurl_span path = no_span;
+    if (w.len > path_start)
+        path = make_span(path_start, w.len - path_start);
+
+    xurl_span query = no_span;
+    if (query_from->query != NULL) {
+        put_char(&w, '?');
+        query = put_span(&w, query_from->query, query_from->query_len);
+    }
+
+    xurl_span fragment = no_span;
+    if (ref->fragment != NULL) {
+        put_char(&w, '#');
+        fragment = put_span(&w, ref->fragment, ref->fragment_len);
+    }
+
+    if (overflowed(&w))
+        return false;
+
+    *out_len = w.len;
+
+#if XURL_ZEROTERMINATE
+    (void) schema;
+    (void) port_len;
+    (void) username;
+    (void) password;
+    (void) host_name;
+    (void) path;
+    (void) query;
+    (void) fragment;
+    return xurl_parse(dst, w.len, out);
+#else
+    out->schema = span_ptr(dst, schema);
+    out->schema_len = schema.len;
+    out->userinfo.username = span_ptr(dst, username);
+    out->userinfo.username_len = username.len;
+    out->userinfo.password = span_ptr(dst, password);
+    out->userinfo.password_len = password.len;
+    out->path = span_ptr(dst, path);
+    out->path_len = path.len;
+    out->query = span_ptr(dst, query);
+    out->query_len = query.len;
+    out->fragment = span_ptr(dst, fragment);
+    out->fragment_len = fragment.len;
+
+    if (has_authority(authority_from)) {
+        out->host = authority_from->host;
+        out->host.port_len = port_len;
+        if (out->host.mode == XURL_HOSTMODE_NAME)
+            out->host.name = span_ptr(dst, host_name);
+        else if (out->host.mode == XURL_HOSTMODE_IPV6 && out->host.zone != NULL)
+            out->host.zone = span_ptr(dst, host_name);
+    } else {
+        out->host.mode = XURL_HOSTMODE_NAME;
+        out->host.name = NULL;
+        out->host.name_len = 0;
+        out->host.no_port = true;
+        out->host.port = 0;
+        out->host.port_len = 0;
+    }
+    return true;
+#endif
+}
+
+/* Hashing
+ *
+ *   [xurl_hash] combines the selected components of a
+ *   URL 8 bytes at a time with a multiply-xorshift
+ *   mixer. Long components are first reduced by four
+ *   independent accumulators over 32-byte stripes, which
+ *   map to SSE2 and AVX2 registers. All kernels compute
+ *   the same values, so hashes don't depend on the CPU.
+ */
+
+#define HASH_PRIME 0x9E3779B97F4A7C15ULL
+#define HASH_WIDE_MIN 128 // Components at least this long use the stripe accumulators
+
+static const uint64_t hash_secret[4] = {
+    0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL,
+    0x85EBCA77C2B2AE63ULL, 0x27D4EB2F165667C5ULL,
+};
+
+static uint64_t load64(const char *src)
+{
+    uint64_t word;
+    memcpy(&word, src, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+static uint64_t load_tail(const char *src, size_t len)
+{
+    uint64_t word = 0;
+    for (size_t k = 0; k < len; k++)
+        word |= (uint64_t) (uint8_t) src[k] << (8 * k);
+    return word;
+}
+
+/* Symbol: lower_word
+ *   Make the ASCII uppercase letters of the 8 bytes
+ *   of [word] lowercase, leaving the other bytes as
+ *   they are.
+ */
+static uint64_t lower_word(uint64_t word)
+{
+    const uint64_t ones = 0x0101010101010101ULL;
+    uint64_t heptets = word & (0x7F * ones);
+    uint64_t above_A = heptets + (0x80 - 'A') * ones;     // High bit set if >= 'A'
+    uint64_t above_Z = heptets + (0x80 - 'Z' - 1) * ones; // High bit set if >  'Z'
+    uint64_t upper = (above_A ^ above_Z) & ~word & (0x80 * ones);
+    return word | (upper >> 2);
+}
+
+static uint64_t hash_mix(uint64_t h, uint64_t word)
+{
+    h ^= word;
+    h *= HASH_PRIME;
+    return h ^ (h >> 32);
+}
+
+static uint64_t hash_final(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    return h ^ (h >> 33);
+}
+
+static void hash_stripes_scalar(const char *src, size_t stripes,
+                                const uint64_t key[4], uint64_t acc[4])
+{
+    for (size_t s = 0; s < stripes; s++, src += 32)
+        for (int l = 0; l < 4; l++) {
+            uint64_t data = load64(src + 8 * l);
+            uint64_t keyed = data ^ key[l];
+            acc[l] += data + (keyed & 0xFFFFFFFF) * (keyed >> 32);
+        }
+}
+
+#if XURL_X86_SIMD
+
+static void hash_stripes_sse2(const char *src, size_t stripes,
+                              const uint64_t key[4], uint64_t acc[4])
+{
+    __m128i key0 = _mm_loadu_si128((const __m128i*) key);
+    __m128i key1 = _mm_loadu_si128((const __m128i*) (key + 2));
+    __m128i acc0 = _mm_loadu_si128((const __m128i*) acc);
+    __m128i acc1 = _mm_loadu_si128((const __m128i*) (acc + 2));
+
+    for (size_t s = 0; s < stripes; s++, src += 32) {
+        __m128i data0 = _mm_loadu_si128((const __m128i*) src);
+        __m128i data1 = _mm_loadu_si128((const __m128i*) (src + 16));
+        __m128i keyed0 = _mm_xor_si128(data0, key0);
+        __m128i keyed1 = _mm_xor_si128(data1, key1);
+        acc0 = _mm_add_epi64(acc0, _mm_add_epi64(data0, _mm_mul_epu32(keyed0, _mm_srli_epi64(keyed0, 32))));
+        acc1 = _mm_add_epi64(acc1, _mm_add_epi64(data1, _mm_mul_epu32(keyed1, _mm_srli_epi64(keyed1, 32))));
+    }
+
+    _mm_storeu_si128((__m128i*) acc, acc0);
+    _mm_storeu_si128((__m128i*) (acc + 2), acc1);
+}
+
+__attribute__((target("avx2")))
+static void hash_stripes_avx2(const char *src, size_t stripes,
+                              const uint64_t key[4], uint64_t acc[4])
+{
+    __m256i vkey = _mm256_loadu_si256((const __m256i*) key);
+    __m256i vacc = _mm256_loadu_si256((const __m256i*) acc);
+
+    for (size_t s = 0; s < stripes; s++, src += 32) {
+        __m256i data  = _mm256_loadu_si256((const __m256i*) src);
+        __m256i keyed = _mm256_xor_si256(data, vkey);
+        vacc = _mm256_add_epi64(vacc, _mm256_add_epi64(data, _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32))));
+    }
+
+    _mm256_storeu_si256((__m256i*) acc, vacc);
+}
+
+#endif /* XURL_X86_SIMD */
+
+/* Symbol: hash_bytes
+ *   Mix [len] bytes into [h]. If [lower] is set,
+ *   ASCII letters are hashed as if they were
+ *   lowercase.
+ */
+static uint64_t hash_bytes(uint64_t h, uint64_t seed,
+                           const char *src, size_t len,
+                           bool lower)
+{
+    size_t k = 0;
+
+    // Case-insensitive components (schema and host)
+    // are short, so they never use the stripes.
+    if (!lower && len >= HASH_WIDE_MIN) {
+
+        uint64_t key[4];
+        uint64_t acc[4];
+        for (int l = 0; l < 4; l++) {
+            key[l] = hash_secret[l] ^ seed;
+            acc[l] = hash_secret[3-l];
+        }
+
+        size_t stripes = len / 32;
+        switch (xurl_get_simd()) {
+#if XURL_X86_SIMD
+            case XURL_SIMD_AVX2: hash_stripes_avx2(src, stripes, key, acc); break;
+            case XURL_SIMD_SSE2: hash_stripes_sse2(src, stripes, key, acc); break;
+#endif
+            default: hash_stripes_scalar(src, stripes, key, acc); break;
+        }
+        for (int l = 0; l < 4; l++)
+            h = hash_mix(h, acc[l]);
+        k = stripes * 32;
+    }
+
+    for (; k + 8 <= len; k += 8) {
+        uint64_t word = load64(src + k);
+        h = hash_mix(h, lower ? lower_word(word) : word);
+    }
+
+    if (k < len) {
+        uint64_t word = load_tail(src + k, len - k);
+        h = hash_mix(h, lower ? lower_word(word) : word);
+    }
+    return h;
+}
+
+/* Symbol: hash_slice
+ *   Mix a component into [h]. The tag and length
+ *   come first, so that components can't be confused
+ *   with each other and absent components hash
+ *   differently than empty ones.
+ */
+static uint64_t hash_slice(uint64_t h, uint64_t seed, uint64_t tag,
+                           const char *src, size_t len, bool lower)
+{
+    if (src == NULL)
+        return hash_mix(h, (tag << 56) | (1ULL << 55));
+    h = hash_mix(h, (tag << 56) | len);
+    return hash_bytes(h, seed, src, len, lower);
+}
+
+/* Symbol: xurl_hash
+ *   Calculate a 64-bit hash of the components of a
+ *   parsed URL selected by [component_mask], for
+ *   instance to choose the shard of a cache.
+ *
+ *   The schema and host name are hashed ignoring
+ *   the case of ASCII letters, and IP addresses are
+ *   hashed by their binary value, so URLs that only
+ *   differ by these details hash equally without being
+ *   canonicalized first. The other components are
+ *   hashed as they are.
+ *
+ * Arguments:
+ *              url: The parsed URL.
+ *
+ *   component_mask: A combination of the XURL_HASH_*
+ *                   flags. XURL_HASH_HOST doesn't include
+ *                   the port, which is XURL_HASH_PORT.
+ *
+ *             seed: Any value. Different seeds give
+ *                   unrelated hashes.
+ *
+ * Returns:
+ *   - The hash. It's the same for any SIMD level,
+ *     but not meant to be stored across versions
+ *     of the library.
+ */
+uint64_t xurl_hash(const xurl_t *url, unsigned component_mask, uint64_t seed)
+{
+    uint64_t h = hash_mix(seed, HASH_PRIME ^ component_mask);
+
+    if (component_mask & XURL_HASH_SCHEMA)
+        h = hash_slice(h, seed, 1, url->schema, url->schema_len, true);
+
+    if (component_mask & XURL_HASH_USERINFO) {
+        h = hash_slice(h, seed, 2, url->userinfo.username, url->userinfo.username_len, false);
+        h = hash_slice(h, seed, 3, url->userinfo.password, url->userinfo.password_len, false);
+    }
+
+    if (component_mask & XURL_HASH_HOST) {
+        const xurl_host *host = &url->host;
+        switch (host->mode) {
+
+            case XURL_HOSTMODE_NAME:
+            h = hash_slice(h, seed, 4, host->name, host->name_len, true);
+            break;
+
+            case XURL_HOSTMODE_IPV4:
+            h = hash_mix(h, (5ULL << 56) | host->ipv4);
+            break;
+
+            case XURL_HOSTMODE_IPV6:
+            h = hash_mix(h, 6ULL << 56);
+            for (int w = 0; w < 8; w += 4)
+                h = hash_mix(h, ((uint64_t) host->ipv6[w+0] << 48)
+                              | ((uint64_t) host->ipv6[w+1] << 32)
+                              | ((uint64_t) host->ipv6[w+2] << 16)
+                              | ((uint64_t) host->ipv6[w+3] <<  0));
+            if (host->zone != NULL)
+                h = hash_slice(h, seed, 11, host->zone, host->zone_len, false);
+            break;
+        }
+    }
+
+    if (component_mask & XURL_HASH_PORT) {
+        if (url->host.no_port)
+            h = hash_mix(h, (7ULL << 56) | (1ULL << 55));
+        else
+            h = hash_mix(h, (7ULL << 56) | url->host.port);
+    }
+
+    if (component_mask & XURL_HASH_PATH)
+        h = hash_slice(h, seed, 8, url->path, url->path_len, false);
+
+    if (component_mask & XURL_HASH_QUERY)
+        h = hash_slice(h, seed, 9, url->query, url->query_len, false);
+
+    if (component_mask & XURL_HASH_FRAGMENT)
+        h = hash_slice(h, seed, 10, url->fragment, url->fragment_len, false);
+
+    return hash_final(h);
+}
+
+/* Columnar parsing
+ *
+ *   [xurl_parse_columns] parses a batch of URLs into
+ *   one array per field instead of one [xurl_t] per
+ *   URL, so that aggregations only read the columns
+ *   they need. Schemas are dictionary-encoded into
+ *   one byte and hosts are interned into 32-bit ids
+ *   by an open-addressing hash table.
+ */
+
+void xurl_schema_dict_init(xurl_schema_dict *dict)
+{
+    dict->count = 0;
+}
+
+/* Symbol: xurl_intern_init
+ *   Initialize a host table using memory provided by
+ *   the caller.
+ *
+ * Arguments:
+ *        (out) table: The table to initialize.
+ *
+ *        (in) entries: Room for [max_entries] hosts.
+ *
+ *    max_entries: The maximum number of distinct hosts.
+ *
+ *      (in) slots: The slots of the hash table.
+ *
+ *      num_slots: The number of slots, which must be a
+ *                 power of two greater than [max_entries].
+ *                 Twice [max_entries] keeps probing short.
+ *
+ * Returns:
+ *   - [true] on success, [false] if [num_slots] isn't
+ *     valid.
+ */
+bool xurl_intern_init(xurl_intern *table,
+                      xurl_intern_entry *entries, size_t max_entries,
+                      uint32_t *slots, size_t num_slots)
+{
+    if (num_slots == 0 || (num_slots & (num_slots - 1)) || num_slots <= max_entries)
+        return false;
+    if (max_entries >= UINT32_MAX)
+        return false;
+
+    memset(slots, 0, num_slots * sizeof(uint32_t));
+    table->entries = entries;
+    table->count = 0;
+    table->max_entries = max_entries;
+    table->slots = slots;
+    table->mask = num_slots - 1;
+    return true;
+}
+
+/* Symbol: schema_id
+ *   Find the id of a schema in [dict], adding it if
+ *   it's new. Dictionaries are small enough for a
+ *   linear scan.
+ */
+static uint8_t schema_id(xurl_schema_dict *dict, const char *schema, size_t len)
+{
+    if (schema == NULL)
+        return XURL_SCHEMA_NONE;
+
+    if (len > XURL_SCHEMA_LEN_MAX)
+        return XURL_SCHEMA_OTHER;
+
+    for (size_t d = 0; d < dict->count; d++)
+        if (equals_nocase(schema, len, dict->names[d]))
+            return d + 1;
+
+    if (dict->count == XURL_SCHEMAS_MAX)
+        return XURL_SCHEMA_OTHER;
+
+    char *name = dict->names[dict->count++];
+    for (size_t k = 0; k < len; k++)
+        name[k] = to_lower(schema[k]);
+    name[len] = '\0';
+    return dict->count;
+}
+
+static bool same_host(const xurl_intern_entry *entry, const xurl_host *host,
+                      const char *text, size_t text_len)
+{
+    if (entry->mode != host->mode)
+        return false;
+    switch (host->mode) {
+        case XURL_HOSTMODE_NAME:
+        if (entry->text_len != text_len)
+            return false;
+        for (size_t k = 0; k < text_len; k++)
+            if (to_lower(entry->text[k]) != to_lower(text[k]))
+                return false;
+        return true;
+
+        case XURL_HOSTMODE_IPV4:
+        return entry->ipv4 == host->ipv4;
+
+        case XURL_HOSTMODE_IPV6:
+        if (memcmp(entry->ipv6, host->ipv6, sizeof(host->ipv6)))
+            return false;
+        {
+            // The zone is at the end of the text, after "%25"
+            const char *zone = memchr(entry->text, '%', entry->text_len);
+            if (zone == NULL || host->zone == NULL)
+                return zone == NULL && host->zone == NULL;
+            zone += 3;
+            size_t zone_len = entry->text + entry->text_len - zone;
+            return zone_len == host->zone_len && !memcmp(zone, host->zone, zone_len);
+        }
+    }
+    return false;
+}
+
+/* Symbol: intern_host
+ *   Find the id of a host in [table], adding it if
+ *   it's new. [text] is the text of the host and is
+ *   stored in new entries.
+ */
+static uint32_t intern_host(xurl_intern *table, const xurl_host *host,
+                            XURL_INPUT_CONSTNESS char *text,
+                            size_t text_len)
+{
+    uint64_t hash;
+    switch (host->mode) {
+        default:
+        case XURL_HOSTMODE_NAME: hash = hash_bytes(HASH_PRIME, 0, text, text_len, true); break;
+        case XURL_HOSTMODE_IPV4: hash = hash_mix(HASH_PRIME, host->ipv4); break;
+        case XURL_HOSTMODE_IPV6:
+        hash = hash_bytes(HASH_PRIME, 0, (const char*) host->ipv6, sizeof(host->ipv6), false);
+        if (host->zone != NULL)
+            hash = hash_bytes(hash, 0, host->zone, host->zone_len, false);
+        break;
+    }
+    hash = hash_final(hash);
+
+    size_t slot = hash & table->mask;
+    while (table->slots[slot] != 0) {
+        uint32_t id = table->slots[slot] - 1;
+        xurl_intern_entry *entry = &table->entries[id];
+        if (entry->hash == hash && same_host(entry, host, text, text_len))
+            return id;
+        slot = (slot + 1) & table->mask;
+    }
+
+    if (table->count == table->max_entries)
+        return XURL_NO_ID;
+
+    uint32_t id = table->count++;
+    xurl_intern_entry *entry = &table->entries[id];
+    entry->text = text;
+    entry->text_len = text_len;
+    entry->hash = hash;
+    entry->mode = host->mode;
+    if (host->mode == XURL_HOSTMODE_IPV4)
+        entry->ipv4 = host->ipv4;
+    else if (host->mode == XURL_HOSTMODE_IPV6)
+        memcpy(entry->ipv6, host->ipv6, sizeof(host->ipv6));
+    table->slots[slot] = id + 1;
+    return id;
+}
+
+static void column_set(xurl_columns *columns, size_t row, xurl_component component,
+                       const char *src, const char *slice, size_t len, uint8_t *present)
+{
+    uint32_t offset = 0;
+    if (slice != NULL) {
+        offset = slice - src;
+        *present |= 1 << component;
+    } else
+        len = 0;
+
+    if (columns->offset[component] != NULL)
+        columns->offset[component][row] = offset;
+    if (columns->length[component] != NULL)
+        columns->length[component][row] = len;
+}
+
+/* Symbol: xurl_parse_columns
+ *   Parse [n] URLs like [xurl_parse_batch], but store
+ *   the results by column. For the i-th URL:
+ *
+ *     - [offset[c][i]] and [length[c][i]] locate the
+ *       component [c] in [srcs[i]], or are 0 if the
+ *       component is absent. The host is the text of
+ *       the name or IP address, without brackets.
+ *
+ *     - [present[i]] has the bit (1 << c) set for
+ *       each component [c], plus XURL_COMPACT_PORT.
+ *       It's 0 if the URL is invalid.
+ *
+ *     - [port[i]] is the port, or 0 if there's none.
+ *
+ *     - [schema_id[i]] is the id of the schema in
+ *       [schemas], or XURL_SCHEMA_NONE.
+ *
+ *     - [host_id[i]] is the id of the host in [hosts],
+ *       or XURL_NO_ID.
+ *
+ *   The dictionary and the host table keep growing
+ *   across calls, so ids stay the same for all the
+ *   batches of a data set.
+ *
+ * Returns:
+ *   - The number of URLs that were parsed successfully.
+ *
+ * Notes:
+ *   - URLs of 4 GiB or more are considered invalid.
+ *
+ *   - The host table refers to the sources of the
+ *     URLs, which must outlive it.
+ *
+ *   - The sources are never modified, even when
+ *     XURL_ZEROTERMINATE is 1.
+ */
+size_t xurl_parse_columns(XURL_INPUT_CONSTNESS char **srcs,
+                          const size_t *lens, size_t n,
+                          xurl_columns *columns)
+{
+    for (size_t p = 0; p < n && p < BATCH_PREFETCH_DISTANCE; p++)
+        PREFETCH(srcs[p]);
+
+    size_t count = 0;
+    for (size_t p = 0; p < n; p++) {
+
+        if (p + BATCH_PREFETCH_DISTANCE < n)
+            PREFETCH(srcs[p + BATCH_PREFETCH_DISTANCE]);
+
+        XURL_INPUT_CONSTNESS char *src = srcs[p];
+        size_t len = lens[p];
+
+        xurl_t url;
+        xurl_span host;
+        size_t i = 0;
+        bool ok = len <= UINT32_MAX
+               && parse_components(src, len, &i, &url, false, &host)
+               && i == len;
+        if (!ok) {
+            url.schema = NULL;
+            url.userinfo.username = NULL;
+            url.userinfo.password = NULL;
+            url.path = NULL;
+            url.query = NULL;
+            url.fragment = NULL;
+            url.host.mode = XURL_HOSTMODE_NAME;
+            url.host.name = NULL;
+            url.host.no_port = true;
+        }
+
+        uint8_t present = 0;
+        column_set(columns, p, XURL_COMPONENT_SCHEMA,   src, url.schema, url.schema_len, &present);
+        column_set(columns, p, XURL_COMPONENT_USERNAME, src, url.userinfo.username, url.userinfo.username_len, &present);
+        column_set(columns, p, XURL_COMPONENT_PASSWORD, src, url.userinfo.password, url.userinfo.password_len, &present);
+        column_set(columns, p, XURL_COMPONENT_PATH,     src, url.path, url.path_len, &present);
+        column_set(columns, p, XURL_COMPONENT_QUERY,    src, url.query, url.query_len, &present);
+        column_set(columns, p, XURL_COMPONENT_FRAGMENT, src, url.fragment, url.fragment_len, &present);
+
+        uint32_t host_id = XURL_NO_ID;
+        if (has_authority(&url)) {
+            column_set(columns, p, XURL_COMPONENT_HOST, src, src + host.offset, host.len, &present);
+            if (columns->hosts != NULL)
+                host_id = intern_host(columns->hosts, &url.host, src + host.offset, host.len);
+        } else
+            column_set(columns, p, XURL_COMPONENT_HOST, src, NULL, 0, &present);
+
+        if (!url.host.no_port)
+            present |= XURL_COMPACT_PORT;
+
+        if (columns->present != NULL)
+            columns->present[p] = present;
+        if (columns->port != NULL)
+            columns->port[p] = url.host.no_port ? 0 : url.host.port;
+        if (columns->schema_id != NULL)
+            columns->schema_id[p] = (columns->schemas != NULL) ? schema_id(columns->schemas, url.schema, url.schema_len) : XURL_SCHEMA_NONE;
+        if (columns->host_id != NULL)
+            columns->host_id[p] = host_id;
+
+        count += ok;
+    }
+    return count;
+}
+
+/* Host sets
+ *
+ *   A host set is a hash table keyed by domains. Each
+ *   slot holds the ids of the exact rule and of the
+ *   suffix rule for its domain ("example.com" and
+ *   "*.example.com"). The hash of a domain is computed
+ *   on its lowercase bytes from right to left, so that
+ *   [xurl_hostset_match] gets the hash of each suffix
+ *   of the host ("com", "example.com", ...) in a single
+ *   pass over the name and probes the table once per
+ *   label. The longest matching rule wins.
+ *
+ *   The image built by [xurl_hostset_build] is made of
+ *   a header, the slots and the text of the domains,
+ *   and only contains offsets, so it can be written to
+ *   a file and memory-mapped. Numbers are in the byte
+ *   order of the machine that built it.
+ */
+
+#define HOSTSET_MAGIC   0x31534858 // "XHS1"
+#define HOSTSET_SEED    0x84222325CBF29CE4ULL
+#define HOSTSET_MAX_LEN 255
+
+enum {
+    HOSTSET_EXACT  = 1 << 0,
+    HOSTSET_SUFFIX = 1 << 1,
+};
+
+typedef struct {
+    uint32_t magic;
+    uint32_t num_slots;
+    uint32_t text_size;
+    uint32_t unused;
+} hostset_header;
+
+typedef struct {
+    uint64_t hash;
+    uint32_t text; // Offset of the domain in the text
+    uint32_t exact_id;
+    uint32_t suffix_id;
+    uint16_t text_len;
+    uint8_t  flags; // 0 if the slot is empty
+    uint8_t  unused;
+} hostset_slot;
+
+static uint64_t hostset_mix(uint64_t h, char c)
+{
+    return (h ^ (unsigned char) to_lower(c)) * HASH_PRIME;
+}
+
+// Like [equals_nocase], but [b] isn't zero-terminated
+static bool same_domain(const char *a, size_t a_len,
+                        const char *b, size_t b_len)
+{
+    if (a_len != b_len)
+        return false;
+    for (size_t k = 0; k < a_len; k++)
+        if (to_lower(a[k]) != b[k])
+            return false;
+    return true;
+}
+
+/* Symbol: hostset_find
+ *   Find the slot of the domain [src] with hash [h],
+ *   or the empty slot where it would go.
+ */
+static const hostset_slot *hostset_find(const hostset_slot *slots, size_t mask,
+                                        const char *text, uint64_t h,
+                                        const char *src, size_t len)
+{
+    size_t k = hash_final(h) & mask;
+    while (slots[k].flags != 0) {
+        const hostset_slot *slot = &slots[k];
+        if (slot->hash == h && same_domain(src, len, text + slot->text, slot->text_len))
+            break;
+        k = (k + 1) & mask;
+    }
+    return &slots[k];
+}
+
+// Number of slots for [count] rules, which keeps
+// the table at most half full.
+static size_t hostset_slots(size_t count)
+{
+    size_t n = 2;
+    while (n < 2 * count)
+        n *= 2;
+    return n;
+}
+
+/* Symbol: hostset_rule
+ *   Validate a rule and find its domain, which is the
+ *   rule itself or what follows the "*." of a suffix
+ *   rule. Domains are made of non-empty labels of
+ *   host name characters other than '*'.
+ */
+static bool hostset_rule(const char *rule, size_t len,
+                         const char **domain, size_t *domain_len,
+                         bool *suffix)
+{
+    *suffix = (len > 2 && rule[0] == '*' && rule[1] == '.');
+    if (*suffix) {
+        rule += 2;
+        len -= 2;
+    }
+    if (len == 0 || len > HOSTSET_MAX_LEN)
+        return false;
+
+    for (size_t k = 0; k < len; k++) {
+        if (rule[k] == '.') {
+            if (k == 0 || k+1 == len || rule[k+1] == '.')
+                return false; // Empty label
+        } else if (rule[k] == '*' || !has_class(rule[k], CLASS_HOSTNAME))
+            return false; // Wildcards are only allowed as "*."
+    }
+
+    *domain = rule;
+    *domain_len = len;
+    return true;
+}
+
+/* Symbol: xurl_hostset_size
+ *   Returns the number of bytes [xurl_hostset_build]
+ *   needs for the given rules. It's an upper bound, as
+ *   domains shared by more rules are stored once.
+ *   Invalid rules are skipped, since they make the
+ *   build fail anyway.
+ */
+size_t xurl_hostset_size(const char **rules, const size_t *lens, size_t count)
+{
+    size_t size = sizeof(hostset_header) + hostset_slots(count) * sizeof(hostset_slot);
+    for (size_t i = 0; i < count; i++) {
+        const char *domain;
+        size_t domain_len;
+        bool suffix;
+        if (hostset_rule(rules[i], lens[i], &domain, &domain_len, &suffix))
+            size += domain_len;
+    }
+    return size;
+}
+
+/* Symbol: xurl_hostset_build
+ *   Build the image of a host set into [mem], which
+ *   must be aligned to 8 bytes.
+ *
+ * Arguments:
+ *   - rules, lens: The [count] rules, either domains
+ *                  ("example.com") or suffixes
+ *                  ("*.example.com", which matches the
+ *                  subdomains of "example.com" but not
+ *                  "example.com" itself).
+ *
+ *   - ids: The id of each rule, which is reported by
+ *          [xurl_hostset_match]. If NULL, the id of a
+ *          rule is its index.
+ *
+ *   - cap: The capacity of [mem], which should be at
+ *          least [xurl_hostset_size] bytes.
+ *
+ * Returns:
+ *   - The size of the image, which can be passed to
+ *     [xurl_hostset_load] or saved to a file, or 0 if
+ *     a rule isn't valid or [mem] is too small. When
+ *     the same rule appears more than once, the first
+ *     id is kept.
+ */
+size_t xurl_hostset_build(const char **rules, const size_t *lens,
+                          const uint32_t *ids, size_t count,
+                          void *mem, size_t cap)
+{
+    size_t num_slots = hostset_slots(count);
+    size_t text_offset = sizeof(hostset_header) + num_slots * sizeof(hostset_slot);
+    if (num_slots > UINT32_MAX || text_offset > cap || ((uintptr_t) mem & 7))
+        return 0;
+
+    hostset_header *header = mem;
+    hostset_slot *slots = (hostset_slot*) (header + 1);
+    char *text = (char*) mem + text_offset;
+    size_t text_size = 0;
+    memset(slots, 0, num_slots * sizeof(hostset_slot));
+
+    for (size_t i = 0; i < count; i++) {
+
+        const char *domain;
+        size_t domain_len;
+        bool suffix;
+        if (!hostset_rule(rules[i], lens[i], &domain, &domain_len, &suffix))
+            return 0;
+
+        uint64_t h = HOSTSET_SEED;
+        for (size_t k = domain_len; k > 0; k--)
+            h = hostset_mix(h, domain[k-1]);
+
+        hostset_slot *slot = (hostset_slot*) hostset_find(slots, num_slots - 1, text, h, domain, domain_len);
+        if (slot->flags == 0) {
+            if (text_offset + text_size + domain_len > cap || text_size + domain_len > UINT32_MAX)
+                return 0;
+            for (size_t k = 0; k < domain_len; k++)
+                text[text_size + k] = to_lower(domain[k]);
+            slot->hash = h;
+            slot->text = text_size;
+            slot->text_len = domain_len;
+            text_size += domain_len;
+        }
+
+        uint32_t id = ids ? ids[i] : i;
+        if (suffix && !(slot->flags & HOSTSET_SUFFIX)) {
+            slot->suffix_id = id;
+            slot->flags |= HOSTSET_SUFFIX;
+        }
+        if (!suffix && !(slot->flags & HOSTSET_EXACT)) {
+            slot->exact_id = id;
+            slot->flags |= HOSTSET_EXACT;
+        }
+    }
+
+    header->magic = HOSTSET_MAGIC;
+    header->num_slots = num_slots;
+    header->text_size = text_size;
+    header->unused = 0;
+    return text_offset + text_size;
+}
+
+/* Symbol: xurl_hostset_load
+ *   Use the image of a host set built by
+ *   [xurl_hostset_build], for instance after mapping
+ *   its file into memory. The image isn't copied and
+ *   must stay valid while the set is in use.
+ *
+ *   Every slot is checked once, in O(slots) time, so
+ *   that matching never reads outside of the image or
+ *   probes forever. Hashes and ids aren't checked, so
+ *   images from untrusted sources may still give wrong
+ *   matches.
+ *
+ * Returns:
+ *   - [true] on success, [false] if the image is not
+ *     aligned to 8 bytes, was built on a machine with
+ *     a different byte order, is truncated or has a
+ *     slot that is inconsistent.
+ */
+bool xurl_hostset_load(const void *mem, size_t size, xurl_hostset *set)
+{
+    if (size < sizeof(hostset_header) || ((uintptr_t) mem & 7))
+        return false;
+
+    const hostset_header *header = mem;
+    size_t num_slots = header->num_slots;
+    if (header->magic != HOSTSET_MAGIC || num_slots < 2 || (num_slots & (num_slots - 1)))
+        return false;
+    if (num_slots > (size - sizeof(hostset_header)) / sizeof(hostset_slot))
+        return false;
+
+    size_t text_offset = sizeof(hostset_header) + num_slots * sizeof(hostset_slot);
+    if (header->text_size > size - text_offset)
+        return false;
+
+    // Domains must be inside the text, and there must
+    // be an empty slot for the probing to stop at.
+    const hostset_slot *slots = (const hostset_slot*) (header + 1);
+    bool has_empty = false;
+    for (size_t i = 0; i < num_slots; i++) {
+        if (slots[i].flags == 0)
+            has_empty = true;
+        else if (slots[i].text > header->text_size
+              || slots[i].text_len > header->text_size - slots[i].text)
+            return false;
+    }
+    if (!has_empty)
+        return false;
+
+    set->slots = header + 1;
+    set->text = (const char*) mem + text_offset;
+    set->mask = num_slots - 1;
+    return true;
+}
+
+/* Symbol: xurl_hostset_match
+ *   Match the host of an URL against a host set, in a
+ *   single pass over its name and ignoring its case. A
+ *   final '.' is ignored. IP addresses never match.
+ *
+ * Returns:
+ *   - [true] if a rule matches, in which case [rule_id]
+ *     is set to the id of the most specific one (an
+ *     exact rule, or the suffix rule with the longest
+ *     domain).
+ */
+bool xurl_hostset_match(const xurl_hostset *set, const xurl_host *host,
+                        uint32_t *rule_id)
+{
+    if (host->mode != XURL_HOSTMODE_NAME || host->name == NULL)
+        return false;
+
+    const char *name = host->name;
+    size_t end = host->name_len;
+    if (end > 0 && name[end-1] == '.')
+        end--;
+    if (end == 0 || end > HOSTSET_MAX_LEN)
+        return false;
+
+    const hostset_slot *slots = set->slots;
+    bool found = false;
+    uint64_t h = HOSTSET_SEED;
+    for (size_t k = end; k > 0; k--) {
+
+        if (name[k-1] == '.') {
+            // The host is a subdomain of what
+            // follows the '.'
+            const hostset_slot *slot = hostset_find(slots, set->mask, set->text, h, name + k, end - k);
+            if (slot->flags & HOSTSET_SUFFIX) {
+                *rule_id = slot->suffix_id;
+                found = true;
+            }
+        }
+        h = hostset_mix(h, name[k-1]);
+    }
+
+    const hostset_slot *slot = hostset_find(slots, set->mask, set->text, h, name, end);
+    if (slot->flags & HOSTSET_EXACT) {
+        *rule_id = slot->exact_id;
+        found = true;
+    }
+    return found;
+}
+
+/* CIDR sets
+ *
+ *   A CIDR set is a path-compressed binary trie of
+ *   address prefixes. IPv4 prefixes are stored as
+ *   IPv4-mapped IPv6 prefixes (::ffff:0:0/96), so a
+ *   single trie holds both families and the host
+ *   "[::ffff:10.0.0.1]" matches the same rules as
+ *   "10.0.0.1". Nodes only exist where a prefix was
+ *   added or where two prefixes branch, so a lookup
+ *   visits at most two nodes per rule on the path to
+ *   the address, and checks the whole prefix of each
+ *   node at once, by counting the leading zeros of
+ *   its XOR with the address, instead of going bit by
+ *   bit.
+ *
+ *   The nodes are provided by the caller. A set needs
+ *   one for the root plus two for each prefix.
+ */
+
+// Mask of the first [len] bits of a 64-bit word.
+// [len] may be out of the 0 to 64 range.
+static uint64_t cidr_mask(int len)
+{
+    if (len <= 0)
+        return 0;
+    if (len >= 64)
+        return ~(uint64_t) 0;
+    return ~(uint64_t) 0 << (64 - len);
+}
+
+// Length of the common prefix of [a] and [b], up to [max]
+static int cidr_common(const uint64_t a[2], const uint64_t b[2], int max)
+{
+    int n;
+    if (a[0] != b[0])
+        n = __builtin_clzll(a[0] ^ b[0]);
+    else if (a[1] != b[1])
+        n = 64 + __builtin_clzll(a[1] ^ b[1]);
+    else
+        n = 128;
+    return n < max ? n : max;
+}
+
+static int cidr_bit(const uint64_t key[2], int k)
+{
+    return (key[k >> 6] >> (63 - (k & 63))) & 1;
+}
+
+static bool cidr_key(const xurl_host *host, uint64_t key[2])
+{
+    switch (host->mode) {
+
+        case XURL_HOSTMODE_IPV4:
+        key[0] = 0;
+        key[1] = 0xFFFF00000000ULL | host->ipv4;
+        return true;
+
+        case XURL_HOSTMODE_IPV6:
+        key[0] = 0;
+        key[1] = 0;
+        for (int k = 0; k < 8; k++)
+            key[k >> 2] = (key[k >> 2] << 16) | host->ipv6[k];
+        return true;
+
+        default:
+        return false;
+    }
+}
+
+// Parse "address/length" or just "address", which is
+// the same as using the full length of the address.
+static bool cidr_parse(const char *src, size_t len,
+                       uint64_t key[2], int *prefix_len)
+{
+    size_t slash = 0;
+    while (slash < len && src[slash] != '/')
+        slash++;
+
+    xurl_host host;
+    int max;
+    if (xurl_parse_ipv4(src, slash, &host.ipv4)) {
+        host.mode = XURL_HOSTMODE_IPV4;
+        max = 32;
+    } else if (xurl_parse_ipv6(src, slash, host.ipv6)) {
+        host.mode = XURL_HOSTMODE_IPV6;
+        max = 128;
+    } else
+        return false;
+    cidr_key(&host, key);
+
+    int n = max;
+    if (slash < len) {
+        size_t i = slash + 1;
+        if (i == len || len - i > 3)
+            return false;
+        n = 0;
+        for (; i < len; i++) {
+            if (!is_digit(src[i]))
+                return false;
+            n = n * 10 + src[i] - '0';
+        }
+        if (n > max)
+            return false;
+    }
+    n += 128 - max;
+
+    // Bits after the prefix must be zero, as a
+    // typo like "10.0.0.1/8" is likely to mean
+    // something else than 10.0.0.0/8.
+    if ((key[0] & ~cidr_mask(n)) || (key[1] & ~cidr_mask(n - 64)))
+        return false;
+
+    *prefix_len = n;
+    return true;
+}
+
+static uint32_t cidr_new_node(xurl_cidr_set *set, const uint64_t key[2], int len)
+{
+    uint32_t k = set->count++;
+    xurl_cidr_node *node = &set->nodes[k];
+    node->key[0] = key[0] & cidr_mask(len);
+    node->key[1] = key[1] & cidr_mask(len - 64);
+    node->child[0] = 0;
+    node->child[1] = 0;
+    node->id = 0;
+    node->len = len;
+    node->has_id = false;
+    return k;
+}
+
+/* Symbol: xurl_cidr_init
+ *   Create an empty CIDR set that stores its trie in
+ *   the [max_nodes] elements of [nodes]. Each prefix
+ *   added needs at most two nodes, and one is used
+ *   by the root.
+ *
+ * Returns:
+ *   - [false] if [max_nodes] is 0 or too big.
+ */
+bool xurl_cidr_init(xurl_cidr_set *set, xurl_cidr_node *nodes, size_t max_nodes)
+{
+    if (max_nodes == 0 || max_nodes > UINT32_MAX)
+        return false;
+    set->nodes = nodes;
+    set->count = 0;
+    set->max_nodes = max_nodes;
+    uint64_t zero[2] = {0, 0};
+    cidr_new_node(set, zero, 0);
+    return true;
+}
+
+/* Symbol: xurl_cidr_add
+ *   Add a prefix like "10.0.0.0/8" or "fe80::/10" to a
+ *   CIDR set, with [id] as the value returned when it
+ *   matches. A plain address is the same as a prefix
+ *   with the full length. If the prefix was already
+ *   added, the first id is kept.
+ *
+ * Returns:
+ *   - [false] if the prefix is invalid, the address has
+ *     bits set after the prefix length, or there may not
+ *     be enough nodes left. The set is left unchanged.
+ */
+bool xurl_cidr_add(xurl_cidr_set *set, const char *src, size_t len, uint32_t id)
+{
+    uint64_t key[2];
+    int prefix_len;
+    if (!cidr_parse(src, len, key, &prefix_len) || set->max_nodes - set->count < 2)
+        return false;
+
+    xurl_cidr_node *nodes = set->nodes;
+    uint32_t cur = 0;
+    while (nodes[cur].len < prefix_len) {
+
+        int b = cidr_bit(key, nodes[cur].len);
+        uint32_t next = nodes[cur].child[b];
+        if (next == 0) {
+            next = cidr_new_node(set, key, prefix_len);
+            nodes[cur].child[b] = next;
+            cur = next;
+            break;
+        }
+
+        int max = prefix_len < nodes[next].len ? prefix_len : nodes[next].len;
+        int common = cidr_common(key, nodes[next].key, max);
+        if (common < nodes[next].len) {
+            // The child's prefix goes past the new
+            // one or diverges from it, so a node is
+            // added where they branch.
+            uint32_t fork = cidr_new_node(set, key, common);
+            nodes[fork].child[cidr_bit(nodes[next].key, common)] = next;
+            nodes[cur].child[b] = fork;
+            next = fork;
+        }
+        cur = next;
+    }
+
+    if (!nodes[cur].has_id) {
+        nodes[cur].id = id;
+        nodes[cur].has_id = true;
+    }
+    return true;
+}
+
+/* Symbol: xurl_cidr_match
+ *   Look up the address of an URL's host in a CIDR set.
+ *   Zone identifiers are ignored.
+ *
+ * Returns:
+ *   - [true] if the address is inside one of the prefixes,
+ *     in which case [id] is set to the id of the longest
+ *     one. Names never match.
+ */
+bool xurl_cidr_match(const xurl_cidr_set *set, const xurl_host *host, uint32_t *id)
+{
+    uint64_t key[2];
+    if (!cidr_key(host, key))
+        return false;
+
+    const xurl_cidr_node *nodes = set->nodes;
+    const xurl_cidr_node *node = &nodes[0];
+    bool found = false;
+    for (;;) {
+        if (node->has_id) {
+            *id = node->id;
+            found = true;
+        }
+        if (node->len == 128)
+            break;
+        uint32_t next = node->child[cidr_bit(key, node->len)];
+        if (next == 0)
+            break;
+        node = &nodes[next];
+        if (cidr_common(key, node->key, 128) < node->len)
+            break;
+    }
+    return found;
+}
+
+static xurl_ip_class classify_ipv4(uint32_t a)
+{
+    switch (a >> 24) {
+        case 0:   return XURL_IP_UNSPECIFIED;
+        case 10:  return XURL_IP_PRIVATE;
+        case 127: return XURL_IP_LOOPBACK;
+
+        case 100:
+        if ((a & 0xFFC00000) == 0x64400000) // 100.64.0.0/10
+            return XURL_IP_SHARED;
+        break;
+
+        case 169:
+        if ((a >> 16) == 0xA9FE) // 169.254.0.0/16
+            return XURL_IP_LINK_LOCAL;
+        break;
+
+        case 172:
+        if ((a & 0xFFF00000) == 0xAC100000) // 172.16.0.0/12
+            return XURL_IP_PRIVATE;
+        break;
+
+        case 192:
+        if ((a >> 8) == 0xC00000) // 192.0.0.0/24
+            return XURL_IP_RESERVED;
+        if ((a >> 8) == 0xC00002) // 192.0.2.0/24
+            return XURL_IP_DOCUMENTATION;
+        if ((a >> 16) == 0xC0A8) // 192.168.0.0/16
+            return XURL_IP_PRIVATE;
+        break;
+
+        case 198:
+        if ((a & 0xFFFE0000) == 0xC6120000) // 198.18.0.0/15
+            return XURL_IP_BENCHMARKING;
+        if ((a >> 8) == 0xC63364) // 198.51.100.0/24
+            return XURL_IP_DOCUMENTATION;
+        break;
+
+        case 203:
+        if ((a >> 8) == 0xCB0071) // 203.0.113.0/24
+            return XURL_IP_DOCUMENTATION;
+        break;
+    }
+
+    if (a == 0xFFFFFFFF)
+        return XURL_IP_BROADCAST;
+    if ((a >> 28) == 0xE)
+        return XURL_IP_MULTICAST;
+    if ((a >> 28) == 0xF)
+        return XURL_IP_RESERVED;
+    return XURL_IP_GLOBAL;
+}
+
+static xurl_ip_class classify_ipv6(const uint16_t w[8])
+{
+    // Global unicast (2000::/3)
+    if ((w[0] & 0xE000) == 0x2000) {
+        if (w[0] == 0x2001) {
+            if (w[1] == 0x0DB8) // 2001:db8::/32
+                return XURL_IP_DOCUMENTATION;
+            if (w[1] == 0x0002 && w[2] == 0) // 2001:2::/48
+                return XURL_IP_BENCHMARKING;
+            if (w[1] < 0x0200) // 2001::/23
+                return XURL_IP_RESERVED;
+        }
+        if (w[0] == 0x3FFF && w[1] < 0x1000) // 3fff::/20
+            return XURL_IP_DOCUMENTATION;
+        return XURL_IP_GLOBAL;
+    }
+
+    if ((w[0] & 0xFE00) == 0xFC00)
+        return XURL_IP_PRIVATE;
+    if ((w[0] & 0xFFC0) == 0xFE80)
+        return XURL_IP_LINK_LOCAL;
+    if ((w[0] & 0xFF00) == 0xFF00)
+        return XURL_IP_MULTICAST;
+
+    if (w[0] == 0 && w[1] == 0 && w[2] == 0 && w[3] == 0 && w[4] == 0) {
+        if (w[5] == 0 && w[6] == 0 && w[7] == 0)
+            return XURL_IP_UNSPECIFIED;
+        if (w[5] == 0 && w[6] == 0 && w[7] == 1)
+            return XURL_IP_LOOPBACK;
+        if (w[5] == 0xFFFF) // ::ffff:0:0/96
+            return classify_ipv4(((uint32_t) w[6] << 16) | w[7]);
+    }
+
+    // The NAT64 well-known prefix (64:ff9b::/96) reaches
+    // the embedded IPv4 address.
+    if (w[0] == 0x0064 && w[1] == 0xFF9B && w[2] == 0 && w[3] == 0 && w[4] == 0 && w[5] == 0)
+        return classify_ipv4(((uint32_t) w[6] << 16) | w[7]);
+
+    // Everything else is unassigned or reserved, like
+    // the discard-only prefix (100::/64).
+    return XURL_IP_RESERVED;
+}
+
+/* Symbol: xurl_classify_ip
+ *   Tell whether the address of an URL's host is in a
+ *   special-purpose range (RFC 6890), which is what an
+ *   SSRF check usually needs without building a CIDR
+ *   set. IPv4-mapped and NAT64 (64:ff9b::/96) addresses
+ *   are classified by their IPv4 address.
+ *
+ * Returns:
+ *   - The range, [XURL_IP_GLOBAL] if it's not special or
+ *     [XURL_IP_NONE] if the host is a name.
+ */
+xurl_ip_class xurl_classify_ip(const xurl_host *host)
+{
+    switch (host->mode) {
+        case XURL_HOSTMODE_IPV4: return classify_ipv4(host->ipv4);
+        case XURL_HOSTMODE_IPV6: return classify_ipv6(host->ipv6);
+        default: return XURL_IP_NONE;
+    }
+}
+
+/* Internationalized hosts
+ *
+ *   Names with non-ASCII labels reach the parser either
+ *   as UTF-8, percent-encoded as RFC 3986 requires, or
+ *   already converted to Punycode (RFC 3492) in labels
+ *   starting with "xn--". [xurl_host_to_ascii] and
+ *   [xurl_host_to_unicode] convert between the two
+ *   forms one label at a time, so that both spellings
+ *   of a host can be compared. Labels are decoded into
+ *   code points on the stack and written out through a
+ *   [writer_t], so no memory is allocated.
+ *
+ *   Only the Punycode conversion of IDNA is done: labels
+ *   aren't mapped or normalized (UTS #46), which would
+ *   need the Unicode tables.
+ */
+
+#define IDNA_MAX_LABEL 255 // In code points
+#define IDNA_MAX_ACE   63  // Longest "xn--" label
+
+#define PUNYCODE_BASE         36
+#define PUNYCODE_TMIN         1
+#define PUNYCODE_TMAX         26
+#define PUNYCODE_SKEW         38
+#define PUNYCODE_DAMP         700
+#define PUNYCODE_INITIAL_BIAS 72
+#define PUNYCODE_INITIAL_N    0x80
+
+/* Symbol: is_plain_host
+ *   Tell whether a name can't change when converted
+ *   in either direction, which is when it has no byte
+ *   from 0x80 onwards, no '%' and no label with "--"
+ *   as its third and fourth characters (like every
+ *   "xn--" label). On x86-64, 16 bytes are checked at
+ *   a time, comparing each byte with the next one and
+ *   with the one 3 bytes before, which is the '.' that
+ *   precedes the label.
+ */
+static bool is_plain_host(const char *src, size_t len)
+{
+    size_t k = 0;
+#if XURL_X86_SIMD
+    // The blocks start at 3 so that the byte 3
+    // positions back is always in the name. The
+    // first bytes are left to the scalar loop.
+    if (xurl_get_simd() != XURL_SIMD_NONE && len >= 20) {
+        for (; k < 3; k++)
+            if ((src[k] & 0x80) || src[k] == '%')
+                return false;
+        if (src[2] == '-' && src[3] == '-')
+            return false;
+        __m128i bad = _mm_setzero_si128();
+        __m128i dash = _mm_set1_epi8('-');
+        while (k + 17 <= len) {
+            __m128i x = _mm_loadu_si128((const __m128i*) (src + k));
+            __m128i y = _mm_loadu_si128((const __m128i*) (src + k + 1));
+            __m128i z = _mm_loadu_si128((const __m128i*) (src + k - 3));
+            __m128i ace = _mm_and_si128(_mm_cmpeq_epi8(x, dash), _mm_cmpeq_epi8(y, dash));
+            ace = _mm_and_si128(ace, _mm_cmpeq_epi8(z, _mm_set1_epi8('.')));
+            bad = _mm_or_si128(bad, _mm_cmplt_epi8(x, _mm_setzero_si128()));
+            bad = _mm_or_si128(bad, _mm_cmpeq_epi8(x, _mm_set1_epi8('%')));
+            bad = _mm_or_si128(bad, ace);
+            k += 16;
+        }
+        if (_mm_movemask_epi8(bad))
+            return false;
+    }
+#endif
+    for (; k < len; k++) {
+        char c = src[k];
+        if ((c & 0x80) || c == '%')
+            return false;
+        if (c == '-' && k + 1 < len && src[k+1] == '-'
+            && (k == 2 || (k > 2 && src[k-3] == '.')))
+            return false;
+    }
+    return true;
+}
+
+// Read the next byte of a label, decoding it if it's
+// percent-encoded. Decoded ASCII bytes must be valid
+// in a host name, and can't be a '.'.
+static bool idna_next_byte(const char *src, size_t len, size_t *i, uint8_t *byte)
+{
+    char c = src[*i];
+    if (c != '%') {
+        (*i)++;
+        *byte = c;
+        return (c & 0x80) || has_class(c, CLASS_HOSTNAME);
+    }
+    if (*i + 2 >= len || !is_hex_digit(src[*i+1]) || !is_hex_digit(src[*i+2]))
+        return false;
+    *byte = (hex_digit_to_int(src[*i+1]) << 4) | hex_digit_to_int(src[*i+2]);
+    *i += 3;
+    return (*byte & 0x80) || (has_class(*byte, CLASS_HOSTNAME) && *byte != '.');
+}
+
+/* Symbol: idna_decode_label
+ *   Decode a label made of UTF-8 bytes, which may be
+ *   percent-encoded, into code points. Overlong forms,
+ *   surrogates and truncated sequences are rejected.
+ *
+ * Returns:
+ *   - [true] on success, [false] if the label is not
+ *     valid UTF-8 or has more than [IDNA_MAX_LABEL]
+ *     code points.
+ */
+static bool idna_decode_label(const char *src, size_t len,
+                              uint32_t *cps, size_t *num_cps)
+{
+    size_t n = 0;
+    size_t i = 0;
+    while (i < len) {
+
+        uint8_t byte;
+        if (!idna_next_byte(src, len, &i, &byte) || n == IDNA_MAX_LABEL)
+            return false;
+
+        uint32_t cp;
+        int follow;
+        uint32_t min;
+        if (byte < 0x80) {
+            cp = byte;
+            follow = 0;
+            min = 0;
+        } else if ((byte & 0xE0) == 0xC0) {
+            cp = byte & 0x1F;
+            follow = 1;
+            min = 0x80;
+        } else if ((byte & 0xF0) == 0xE0) {
+            cp = byte & 0x0F;
+            follow = 2;
+            min = 0x800;
+        } else if ((byte & 0xF8) == 0xF0) {
+            cp = byte & 0x07;
+            follow = 3;
+            min = 0x10000;
+        } else
+            return false;
+
+        for (int u = 0; u < follow; u++) {
+            if (i == len || !idna_next_byte(src, len, &i, &byte) || (byte & 0xC0) != 0x80)
+                return false;
+            cp = (cp << 6) | (byte & 0x3F);
+        }
+        if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+            return false;
+        cps[n++] = cp;
+    }
+    *num_cps = n;
+    return true;
+}
+
+static void put_utf8(writer_t *w, uint32_t cp)
+{
+    char buffer[4];
+    size_t n;
+    if (cp < 0x80) {
+        buffer[0] = cp;
+        n = 1;
+    } else if (cp < 0x800) {
+        buffer[0] = 0xC0 | (cp >> 6);
+        buffer[1] = 0x80 | (cp & 0x3F);
+        n = 2;
+    } else if (cp < 0x10000) {
+        buffer[0] = 0xE0 | (cp >> 12);
+        buffer[1] = 0x80 | ((cp >> 6) & 0x3F);
+        buffer[2] = 0x80 | (cp & 0x3F);
+        n = 3;
+    } else {
+        buffer[0] = 0xF0 | (cp >> 18);
+        buffer[1] = 0x80 | ((cp >> 12) & 0x3F);
+        buffer[2] = 0x80 | ((cp >> 6) & 0x3F);
+        buffer[3] = 0x80 | (cp & 0x3F);
+        n = 4;
+    }
+    put(w, buffer, n);
+}
+
+// Bias adaptation function (RFC 3492, section 6.1)
+static uint32_t punycode_adapt(uint32_t delta, uint32_t num_points, bool first)
+{
+    delta = first ? delta / PUNYCODE_DAMP : delta / 2;
+    delta += delta / num_points;
+    uint32_t k = 0;
+    while (delta > ((PUNYCODE_BASE - PUNYCODE_TMIN) * PUNYCODE_TMAX) / 2) {
+        delta /= PUNYCODE_BASE - PUNYCODE_TMIN;
+        k += PUNYCODE_BASE;
+    }
+    return k + (PUNYCODE_BASE - PUNYCODE_TMIN + 1) * delta / (delta + PUNYCODE_SKEW);
+}
+
+static uint32_t punycode_threshold(uint32_t k, uint32_t bias)
+{
+    if (k <= bias)
+        return PUNYCODE_TMIN;
+    if (k >= bias + PUNYCODE_TMAX)
+        return PUNYCODE_TMAX;
+    return k - bias;
+}
+
+static char punycode_digit(uint32_t d)
+{
+    return d < 26 ? 'a' + d : '0' + d - 26;
+}
+
+static int punycode_digit_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0' + 26;
+    if (is_alpha(c))
+        return to_lower(c) - 'a';
+    return -1;
+}
+
+/* Symbol: punycode_encode
+ *   Write the "xn--" form of a label with at least
+ *   one non-ASCII code point (RFC 3492, section 6.3).
+ *
+ * Returns:
+ *   - [false] if the result is longer than
+ *     [IDNA_MAX_ACE] bytes.
+ */
+static bool punycode_encode(writer_t *w, const uint32_t *cps, size_t num_cps)
+{
+    size_t start = w->len;
+    put(w, "xn--", 4);
+
+    uint32_t basic = 0;
+    for (size_t p = 0; p < num_cps; p++) {
+        if (cps[p] < 0x80) {
+            put_char(w, cps[p]);
+            basic++;
+        }
+    }
+    if (basic > 0)
+        put_char(w, '-');
+
+    uint32_t n = PUNYCODE_INITIAL_N;
+    uint32_t bias = PUNYCODE_INITIAL_BIAS;
+    uint32_t delta = 0;
+    for (uint32_t h = basic; h < num_cps; n++, delta++) {
+
+        uint32_t m = UINT32_MAX;
+        for (size_t p = 0; p < num_cps; p++)
+            if (cps[p] >= n && cps[p] < m)
+                m = cps[p];
+
+        // Labels are short and code points are at most
+        // 0x10FFFF, so [delta] can't overflow.
+        delta += (m - n) * (h + 1);
+        n = m;
+
+        for (size_t p = 0; p < num_cps; p++) {
+            if (cps[p] < n)
+                delta++;
+            if (cps[p] != n)
+                continue;
+            uint32_t q = delta;
+            for (uint32_t k = PUNYCODE_BASE;; k += PUNYCODE_BASE) {
+                uint32_t t = punycode_threshold(k, bias);
+                if (q < t)
+                    break;
+                put_char(w, punycode_digit(t + (q - t) % (PUNYCODE_BASE - t)));
+                q = (q - t) / (PUNYCODE_BASE - t);
+            }
+            put_char(w, punycode_digit(q));
+            bias = punycode_adapt(delta, h + 1, h == basic);
+            delta = 0;
+            h++;
+        }
+    }
+    return w->len - start <= IDNA_MAX_ACE;
+}
+
+/* Symbol: punycode_decode
+ *   Decode the part of an "xn--" label after the
+ *   prefix into code points (RFC 3492, section 6.2).
+ *
+ * Returns:
+ *   - [false] if the input isn't valid Punycode, if it
+ *     would overflow or if it only has ASCII characters,
+ *     since those labels are never encoded.
+ */
+static bool punycode_decode(const char *src, size_t len,
+                            uint32_t *cps, size_t *num_cps)
+{
+    // Basic code points are the ones before
+    // the last '-', if there is one.
+    size_t basic = len;
+    while (basic > 0 && src[basic-1] != '-')
+        basic--;
+    size_t in = 0;
+    size_t n = 0;
+    if (basic > 0) {
+        if (basic - 1 > IDNA_MAX_LABEL)
+            return false;
+        for (; n < basic - 1; n++) {
+            if (!has_class(src[n], CLASS_HOSTNAME))
+                return false;
+            cps[n] = src[n];
+        }
+        in = basic;
+    }
+    if (in == len)
+        return false;
+
+    uint32_t code = PUNYCODE_INITIAL_N;
+    uint32_t bias = PUNYCODE_INITIAL_BIAS;
+    uint32_t i = 0;
+    while (in < len) {
+
+        uint32_t old_i = i;
+        uint32_t weight = 1;
+        for (uint32_t k = PUNYCODE_BASE;; k += PUNYCODE_BASE) {
+            if (in == len)
+                return false;
+            int digit = punycode_digit_value(src[in++]);
+            if (digit < 0 || (uint32_t) digit > (UINT32_MAX - i) / weight)
+                return false;
+            i += digit * weight;
+            uint32_t t = punycode_threshold(k, bias);
+            if ((uint32_t) digit < t)
+                break;
+            if (weight > UINT32_MAX / (PUNYCODE_BASE - t))
+                return false;
+            weight *= PUNYCODE_BASE - t;
+        }
+
+        if (n == IDNA_MAX_LABEL)
+            return false;
+        bias = punycode_adapt(i - old_i, n + 1, old_i == 0);
+        if (i / (n + 1) > 0x10FFFF - code)
+            return false;
+        code += i / (n + 1);
+        i %= n + 1;
+        if (code < 0x80 || (code >= 0xD800 && code <= 0xDFFF))
+            return false;
+
+        memmove(cps + i + 1, cps + i, (n - i) * sizeof(uint32_t));
+        cps[i++] = code;
+        n++;
+    }
+    *num_cps = n;
+    return true;
+}
+
+static bool is_ace_label(const char *src, size_t len)
+{
+    return len >= 4 && to_lower(src[0]) == 'x' && to_lower(src[1]) == 'n'
+        && src[2] == '-' && src[3] == '-';
+}
+
+// Finish the conversion of a host into [w]
+static bool idna_done(writer_t *w, const char **out, size_t *out_len)
+{
+    if (overflowed(w))
+        return false;
+#if XURL_ZEROTERMINATE
+    if (w->len == w->cap)
+        return false;
+    w->dst[w->len] = '\0';
+#endif
+    *out = w->dst;
+    *out_len = w->len;
+    return true;
+}
+
+/* Symbol: xurl_host_to_ascii
+ *   Convert the name of an URL's host to the form
+ *   used by DNS, where non-ASCII labels are encoded
+ *   as "xn--" followed by their Punycode. The labels
+ *   may be UTF-8, raw or percent-encoded, and the
+ *   percent-encoded ASCII characters are decoded.
+ *   The other ASCII labels are left as they are.
+ *
+ * Arguments:
+ *         (in) host: The host to convert.
+ *
+ *        (out) dst: Where the converted name is written.
+ *
+ *              cap: The number of bytes pointed by [dst].
+ *
+ *        (out) out: The converted name. When it's the same
+ *                   as the original one, this is the name
+ *                   of [host] and [dst] isn't used.
+ *
+ *    (out) out_len: The length of the converted name.
+ *
+ * Returns:
+ *   - [true] on success, [false] if the host isn't a
+ *     name, a label isn't valid UTF-8, an encoded label
+ *     is longer than 63 bytes or [dst] is too small.
+ *
+ * Notes:
+ *   - When XURL_ZEROTERMINATE is 1, the result written
+ *     into [dst] is zero-terminated, which needs one
+ *     more byte.
+ */
+bool xurl_host_to_ascii(const xurl_host *host, char *dst, size_t cap,
+                        const char **out, size_t *out_len)
+{
+    if (host->mode != XURL_HOSTMODE_NAME || host->name == NULL)
+        return false;
+
+    const char *name = host->name;
+    size_t len = host->name_len;
+    if (is_plain_host(name, len)) {
+        *out = name;
+        *out_len = len;
+        return true;
+    }
+
+    // The labels are converted even if [dst] is too
+    // small, to find out whether any of them changes.
+    writer_t w = { dst, cap, 0 };
+    uint32_t cps[IDNA_MAX_LABEL];
+    bool changed = false;
+    size_t start = 0;
+    for (size_t k = 0; k <= len; k++) {
+
+        if (k < len && name[k] != '.')
+            continue;
+
+        size_t num_cps;
+        if (!idna_decode_label(name + start, k - start, cps, &num_cps))
+            return false;
+
+        bool ascii = true;
+        for (size_t p = 0; p < num_cps; p++)
+            ascii = ascii && cps[p] < 0x80;
+
+        if (ascii) {
+            for (size_t p = 0; p < num_cps; p++)
+                put_char(&w, cps[p]);
+            // Percent-encoded characters were decoded
+            changed = changed || num_cps != k - start;
+        } else {
+            if (!punycode_encode(&w, cps, num_cps))
+                return false;
+            changed = true;
+        }
+
+        if (k < len)
+            put_char(&w, '.');
+        start = k + 1;
+    }
+    if (!changed) {
+        *out = name;
+        *out_len = len;
+        return true;
+    }
+    return idna_done(&w, out, out_len);
+}
+
+/* Symbol: xurl_host_to_unicode
+ *   Convert the name of an URL's host to UTF-8,
+ *   decoding the "xn--" labels (in any case) and the
+ *   percent-encoded characters.
+ *
+ *   The arguments and the result are the same as for
+ *   [xurl_host_to_ascii]. The conversion fails if an
+ *   "xn--" label isn't valid Punycode.
+ */
+bool xurl_host_to_unicode(const xurl_host *host, char *dst, size_t cap,
+                          const char **out, size_t *out_len)
+{
+    if (host->mode != XURL_HOSTMODE_NAME || host->name == NULL)
+        return false;
+
+    const char *name = host->name;
+    size_t len = host->name_len;
+    if (is_plain_host(name, len)) {
+        *out = name;
+        *out_len = len;
+        return true;
+    }
+
+    writer_t w = { dst, cap, 0 };
+    uint32_t cps[IDNA_MAX_LABEL];
+    bool changed = false;
+    size_t start = 0;
+    for (size_t k = 0; k <= len; k++) {
+
+        if (k < len && name[k] != '.')
+            continue;
+
+        const char *label = name + start;
+        size_t label_len = k - start;
+        size_t num_cps;
+        bool ok;
+        if (is_ace_label(label, label_len))
+            ok = punycode_decode(label + 4, label_len - 4, cps, &num_cps);
+        else
+            ok = idna_decode_label(label, label_len, cps, &num_cps);
+        if (!ok)
+            return false;
+
+        // Labels that aren't "xn--" change only if they
+        // have percent-encoded characters
+        changed = changed || is_ace_label(label, label_len)
+               || memchr(label, '%', label_len) != NULL;
+
+        for (size_t p = 0; p < num_cps; p++)
+            put_utf8(&w, cps[p]);
+
+        if (k < len)
+            put_char(&w, '.');
+        start = k + 1;
+    }
+    if (!changed) {
+        *out = name;
+        *out_len = len;
+        return true;
+    }
+    return idna_done(&w, out, out_len);
+}
+
+#if XURL_PUBLIC_SUFFIXES
+
+/* Public suffixes
+ *
+ *   The Public Suffix List is compiled by gen_suffixes.py
+ *   into a trie of reversed labels ("www.example.co.uk"
+ *   is looked up as "uk", "co", "example", "www"). The
+ *   children of a node are contiguous and sorted, so
+ *   each label costs one binary search.
+ */
+
+enum {
+    SUFFIX_RULE      = 1 << 0, // The labels up to this node are a public suffix
+    SUFFIX_WILDCARD  = 1 << 1, // Any child of this node is a public suffix
+    SUFFIX_EXCEPTION = 1 << 2, // The labels up to this node are not a public suffix
+};
+
+typedef struct {
+    uint32_t key;   // First 4 bytes of the label, big-endian and zero-padded
+    uint16_t label; // Offset in [suffix_labels]
+    uint8_t  label_len;
+    uint8_t  flags;
+    uint16_t first_child;
+    uint16_t num_children;
+} suffix_node;
+
+#include "xurl_suffixes.h"
+
+// Labels of the table are at most this long
+#define SUFFIX_LABEL_MAX 63
+
+static const suffix_node *find_child(const suffix_node *node,
+                                     const char *label, size_t len)
+{
+    // The labels of the table are lowercase
+    char lower[SUFFIX_LABEL_MAX];
+    if (len > SUFFIX_LABEL_MAX)
+        return NULL;
+    uint32_t key = 0;
+    for (size_t k = 0; k < len; k++) {
+        lower[k] = to_lower(label[k]);
+        if (k < 4)
+            key |= (uint32_t) (unsigned char) lower[k] << (24 - 8 * k);
+    }
+
+    // Keys compare like the first 4 bytes of the
+    // labels, so the rest is only compared when
+    // they're equal.
+    size_t lo = node->first_child;
+    size_t hi = lo + node->num_children;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        const suffix_node *child = &suffix_nodes[mid];
+        int cmp = (key > child->key) - (key < child->key);
+        if (cmp == 0) {
+            const char *rest = suffix_labels + child->label;
+            size_t n = (len < child->label_len) ? len : child->label_len;
+            for (size_t k = 4; k < n && cmp == 0; k++)
+                cmp = (unsigned char) lower[k] - (unsigned char) rest[k];
+            if (cmp == 0)
+                cmp = (len > child->label_len) - (len < child->label_len);
+        }
+        if (cmp == 0)
+            return child;
+        if (cmp < 0)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return NULL;
+}
+
+/* Symbol: xurl_registrable_domain
+ *   Find the registrable domain of a host name, which
+ *   is its public suffix plus one label (for instance
+ *   "example.co.uk" for "www.example.co.uk"), following
+ *   the algorithm of the Public Suffix List. Labels are
+ *   compared ignoring their case. Hosts with a final
+ *   '.' keep it in the result.
+ *
+ * Returns:
+ *   - [true] if the host has a registrable domain, in
+ *     which case [domain] and [domain_len] refer to the
+ *     end of [host->name].
+ *
+ *   - [false] if the host is an IP address, is itself
+ *     a public suffix or has an empty label.
+ */
+bool xurl_registrable_domain(const xurl_host *host,
+                             XURL_INPUT_CONSTNESS char **domain,
+                             size_t *domain_len)
+{
+    if (host->mode != XURL_HOSTMODE_NAME || host->name == NULL)
+        return false;
+
+    XURL_INPUT_CONSTNESS char *name = host->name;
+    size_t end = host->name_len;
+    if (end > 0 && name[end-1] == '.')
+        end--;
+    if (end == 0)
+        return false;
+
+    // Walk the labels from the right. [suffix] is the
+    // offset of the public suffix found so far, which
+    // by default is the last label.
+    const suffix_node *node = &suffix_nodes[0];
+    size_t suffix = SIZE_MAX;
+    size_t label_end = end;
+    size_t node_start = end; // Start of the labels matched by [node]
+    for (;;) {
+
+        size_t label_start = label_end;
+        while (label_start > 0 && name[label_start-1] != '.')
+            label_start--;
+        if (label_start == label_end)
+            return false; // Empty label
+
+        if (suffix == SIZE_MAX)
+            suffix = label_start;
+
+        const suffix_node *child = find_child(node, name + label_start, label_end - label_start);
+        if (child != NULL && (child->flags & SUFFIX_EXCEPTION)) {
+            // The exception overrides the wildcard
+            // of the parent.
+            suffix = node_start;
+            break;
+        }
+        if ((node->flags & SUFFIX_WILDCARD) || (child != NULL && (child->flags & SUFFIX_RULE)))
+            suffix = label_start;
+
+        if (child == NULL || label_start == 0)
+            break;
+        node = child;
+        node_start = label_start;
+        label_end = label_start - 1; // Skip the '.'
+    }
+
+    // The registrable domain has one more label
+    if (suffix == 0)
+        return false;
+    size_t start = suffix - 1;
+    while (start > 0 && name[start-1] != '.')
+        start--;
+    if (start == suffix - 1)
+        return false; // Empty label
+
+    *domain = name + start;
+    *domain_len = host->name_len - start;
+    return true;
+}
+
+#endif /* XURL_PUBLIC_SUFFIXES */
@@ -6,6 +6,12 @@
 #define XURL_ZEROTERMINATE 0
 #endif
 
+// Build with XURL_PUBLIC_SUFFIXES set to 1 (and xurl_suffixes.h
+// next to xurl.c) for xurl_registrable_domain.
+#ifndef XURL_PUBLIC_SUFFIXES
+#define XURL_PUBLIC_SUFFIXES 0
+#endif
+
 #if XURL_ZEROTERMINATE
 #define XURL_INPUT_CONSTNESS
 #else
@@ -18,11 +24,21 @@ typedef enum {
     XURL_HOSTMODE_IPV6,
 } xurl_hostmode;
 
+typedef enum {
+    XURL_SIMD_NONE,
+    XURL_SIMD_SSE2,
+    XURL_SIMD_AVX2,
+} xurl_simd;
+
 typedef struct {
     xurl_hostmode mode;
     union {
         uint32_t ipv4;
-        uint16_t ipv6[8];
+        struct {
+            uint16_t ipv6[8];
+            XURL_INPUT_CONSTNESS char *zone; // Zone identifier (RFC 6874), or NULL
+            size_t zone_len;
+        };
         struct {
             XURL_INPUT_CONSTNESS char *name;
             size_t name_len;
@@ -30,6 +46,7 @@ typedef struct {
     };
     bool  no_port;
     uint16_t port;
+    uint8_t  port_len; // Digits of the port in the source, or 0 if unknown
 } xurl_host;
 
 typedef struct {
@@ -55,7 +72,291 @@ typedef struct {
 #endif
 } xurl_t;
 
+// Which of the request-target forms of RFC 9112 (section 3.2)
+// are allowed depends on the method of the request.
+typedef enum {
+    XURL_METHOD_OTHER,   // Origin or absolute form
+    XURL_METHOD_CONNECT, // Authority form only
+    XURL_METHOD_OPTIONS, // Also the asterisk form
+} xurl_method_hint;
+
+typedef enum {
+    XURL_TARGET_INVALID,   // Not a valid request-target
+    XURL_TARGET_ORIGIN,    // "/path?query"
+    XURL_TARGET_ABSOLUTE,  // "http://host/path?query"
+    XURL_TARGET_AUTHORITY, // "host:port" (the path is NULL)
+    XURL_TARGET_ASTERISK,  // "*" (the path is "*")
+} xurl_target_form;
+
+// Offset and length of a component of a streamed URL,
+// relative to the start of the stream. Components that
+// are not present have offset XURL_NO_OFFSET.
+#define XURL_NO_OFFSET SIZE_MAX
+
+typedef struct {
+    size_t offset;
+    size_t len;
+} xurl_span;
+
+typedef struct {
+    xurl_host host; // If the host is a name, it's in [host_name] and [host.name] is NULL
+    xurl_span host_name;
+    xurl_span zone; // Zone of IPv6 hosts, whose [host.zone] is NULL
+    xurl_span username;
+    xurl_span password;
+    xurl_span path;
+    xurl_span query;
+    xurl_span schema;
+    xurl_span fragment;
+} xurl_offsets;
+
+typedef enum {
+    XURL_STREAM_MORE,
+    XURL_STREAM_DONE,
+    XURL_STREAM_ERROR,
+} xurl_stream_status;
+
+// Maximum length of an authority that is split
+// between two or more chunks.
+#ifndef XURL_STREAM_AUTHORITY_MAX
+#define XURL_STREAM_AUTHORITY_MAX 512
+#endif
+
+typedef struct {
+    int    state;
+    size_t offset; // Logical offset of the next chunk
+    size_t mark;   // Logical offset of the current component
+    size_t end;    // Logical offset of the end of the URL, once done
+    bool   after_slash;
+    int    escape_len; // Bytes of an incomplete percent-encoded byte
+    size_t authority_len;
+    char   authority[XURL_STREAM_AUTHORITY_MAX];
+    xurl_offsets url;
+} xurl_stream_t;
+
+// Flags of xurl_query_init
+#define XURL_QUERY_SEMICOLON 1 // Also use ';' as separator
+
+typedef struct {
+    XURL_INPUT_CONSTNESS char *src;
+    size_t len;
+    size_t cur;
+    char   sep; // Second separator, or '&' if there's none
+} xurl_query_iter;
+
+typedef struct {
+    XURL_INPUT_CONSTNESS char *key;
+    XURL_INPUT_CONSTNESS char *value; // NULL if the key has no '='
+    size_t key_len;
+    size_t value_len;
+} xurl_query_param;
+
+// Maximum number of keys of a xurl_keyset
+#define XURL_KEYSET_MAX 32
+
+typedef struct {
+    const char *keys[XURL_KEYSET_MAX];
+    size_t   key_lens[XURL_KEYSET_MAX];
+    size_t   count;
+    uint32_t seed;
+    uint32_t mask;
+    uint8_t  slots[4 * XURL_KEYSET_MAX]; // Key index plus one, or 0 if the slot is empty
+} xurl_keyset;
+
+typedef struct {
+    XURL_INPUT_CONSTNESS char *src;
+    size_t len;
+    size_t cur;
+} xurl_path_iter;
+
+// Components of an URL, in the order they appear
+typedef enum {
+    XURL_COMPONENT_SCHEMA,
+    XURL_COMPONENT_USERNAME,
+    XURL_COMPONENT_PASSWORD,
+    XURL_COMPONENT_HOST,
+    XURL_COMPONENT_PATH,
+    XURL_COMPONENT_QUERY,
+    XURL_COMPONENT_FRAGMENT,
+    XURL_COMPONENT_COUNT,
+} xurl_component;
+
+// Bit of xurl_compact_t.present set when there's a port
+#define XURL_COMPACT_PORT (1 << XURL_COMPONENT_COUNT)
+
+// Parse result that refers to the source by 16-bit offsets
+// instead of pointers, for URLs shorter than 64 KiB. The
+// host is the text of the name or IP address (without
+// brackets and zone), which can be converted using
+// xurl_parse_ipv4 and xurl_parse_ipv6. The zone of IPv6
+// hosts is read with xurl_host_zone.
+typedef struct {
+    uint16_t offset[XURL_COMPONENT_COUNT];
+    uint16_t length[XURL_COMPONENT_COUNT];
+    uint16_t port;
+    uint8_t  present;   // Bit (1 << component) for each component, plus XURL_COMPACT_PORT
+    uint8_t  host_mode; // An xurl_hostmode
+} xurl_compact_t;
+
+// Schema dictionary of xurl_parse_columns. Schemas are
+// stored lowercase and get ids from 1 in the order they
+// are first seen.
+#define XURL_SCHEMAS_MAX 16
+#define XURL_SCHEMA_LEN_MAX 15
+#define XURL_SCHEMA_NONE  0   // Id of rows with no schema or invalid
+#define XURL_SCHEMA_OTHER 255 // Id of schemas that don't fit in the dictionary
+
+typedef struct {
+    char   names[XURL_SCHEMAS_MAX][XURL_SCHEMA_LEN_MAX + 1]; // Name of id i+1
+    size_t count;
+} xurl_schema_dict;
+
+// Longest text written by xurl_format_ipv4 and
+// xurl_format_ipv6, not counting the zero terminator
+#define XURL_IPV4_TEXT_MAX 15
+#define XURL_IPV6_TEXT_MAX 39
+
+// Id of hosts that are absent or don't fit in the table
+#define XURL_NO_ID UINT32_MAX
+
+// Interned host. Names are compared ignoring case and
+// IP addresses by value. The text is the one of the
+// first occurrence and refers to its source.
+typedef struct {
+    XURL_INPUT_CONSTNESS char *text;
+    size_t   text_len;
+    uint64_t hash;
+    xurl_hostmode mode;
+    union {
+        uint32_t ipv4;
+        uint16_t ipv6[8];
+    };
+} xurl_intern_entry;
+
+typedef struct {
+    xurl_intern_entry *entries; // The id of a host is its index
+    size_t    count;
+    size_t    max_entries;
+    uint32_t *slots; // Index plus one of an entry, or 0 if empty
+    size_t    mask;
+} xurl_intern;
+
+// Structure-of-arrays output of xurl_parse_columns. Each
+// column has room for one value per row and may be NULL
+// if the caller doesn't need it. The host column is like
+// the one of xurl_compact_t.
+typedef struct {
+    uint32_t *offset[XURL_COMPONENT_COUNT];
+    uint32_t *length[XURL_COMPONENT_COUNT];
+    uint8_t  *present;   // Like xurl_compact_t.present, 0 for invalid rows
+    uint16_t *port;
+    uint8_t  *schema_id; // Requires [schemas]
+    uint32_t *host_id;   // Requires [hosts]
+    xurl_schema_dict *schemas;
+    xurl_intern      *hosts;
+} xurl_columns;
+
+// Set of host rules built by xurl_hostset_build into a flat
+// image made only of offsets, which can be saved to a file and
+// memory-mapped. A rule is either a domain ("example.com"),
+// which matches that host only, or a suffix ("*.example.com"),
+// which matches its subdomains.
+typedef struct {
+    const void *slots;  // Open-addressing hash table of rules
+    const char *text;   // Lowercase text of the rules
+    size_t      mask;   // Number of slots minus one
+} xurl_hostset;
+
+// Node of a CIDR set, which is a path-compressed binary trie
+// over 128-bit keys. IPv4 addresses are mapped into ::ffff:0:0/96.
+typedef struct {
+    uint64_t key[2];   // The prefix, most significant half first
+    uint32_t child[2]; // Index of the children, or 0 if none
+    uint32_t id;
+    uint8_t  len;      // Length of the prefix in bits
+    bool     has_id;   // Whether the prefix was added to the set
+} xurl_cidr_node;
+
+typedef struct {
+    xurl_cidr_node *nodes; // The first one is the root
+    size_t count;
+    size_t max_nodes;
+} xurl_cidr_set;
+
+// Special-purpose address ranges (RFC 6890, plus multicast),
+// as reported by xurl_classify_ip.
+typedef enum {
+    XURL_IP_NONE,          // The host is not an IP address
+    XURL_IP_GLOBAL,        // Not special-purpose
+    XURL_IP_UNSPECIFIED,   // 0.0.0.0/8, ::/128
+    XURL_IP_LOOPBACK,      // 127.0.0.0/8, ::1/128
+    XURL_IP_PRIVATE,       // 10.0.0.0/8, 172.16.0.0/12, 192.168.0.0/16, fc00::/7
+    XURL_IP_SHARED,        // 100.64.0.0/10
+    XURL_IP_LINK_LOCAL,    // 169.254.0.0/16, fe80::/10
+    XURL_IP_DOCUMENTATION, // 192.0.2.0/24, 198.51.100.0/24, 203.0.113.0/24,
+                           // 2001:db8::/32, 3fff::/20
+    XURL_IP_BENCHMARKING,  // 198.18.0.0/15, 2001:2::/48
+    XURL_IP_MULTICAST,     // 224.0.0.0/4, ff00::/8
+    XURL_IP_BROADCAST,     // 255.255.255.255/32
+    XURL_IP_RESERVED,      // 192.0.0.0/24, 240.0.0.0/4, 2001::/23 and the
+                           // unassigned IPv6 ranges, like 100::/64
+} xurl_ip_class;
+
+// Components selected by the mask of xurl_hash
+#define XURL_HASH_SCHEMA   (1 << 0)
+#define XURL_HASH_USERINFO (1 << 1)
+#define XURL_HASH_HOST     (1 << 2)
+#define XURL_HASH_PORT     (1 << 3)
+#define XURL_HASH_PATH     (1 << 4)
+#define XURL_HASH_QUERY    (1 << 5)
+#define XURL_HASH_FRAGMENT (1 << 6)
+#define XURL_HASH_ALL      0x7F
+
 bool xurl_parse2(XURL_INPUT_CONSTNESS char *src, size_t len, size_t *i, xurl_t *url);
 bool xurl_parse(XURL_INPUT_CONSTNESS char *src, size_t len, xurl_t *url);
+bool xurl_parse_reference(XURL_INPUT_CONSTNESS char *src, size_t len, xurl_t *url);
+xurl_target_form xurl_parse_request_target(XURL_INPUT_CONSTNESS char *src, size_t len, xurl_method_hint method, xurl_t *url);
+bool xurl_parse_parts(XURL_INPUT_CONSTNESS char *scheme, size_t scheme_len, XURL_INPUT_CONSTNESS char *authority, size_t authority_len, XURL_INPUT_CONSTNESS char *path, size_t path_len, xurl_t *url);
+bool xurl_parse_compact(XURL_INPUT_CONSTNESS char *src, size_t len, xurl_compact_t *url);
+bool xurl_compact_get(const xurl_compact_t *url, XURL_INPUT_CONSTNESS char *src, xurl_component component, XURL_INPUT_CONSTNESS char **slice, size_t *slice_len);
+bool xurl_host_zone(XURL_INPUT_CONSTNESS char *src, size_t len, size_t host_end, XURL_INPUT_CONSTNESS char **zone, size_t *zone_len);
+size_t xurl_parse_batch(XURL_INPUT_CONSTNESS char **srcs, const size_t *lens, size_t n, xurl_t *out, bool *ok);
+void xurl_stream_init(xurl_stream_t *stream);
+xurl_stream_status xurl_stream_feed(xurl_stream_t *stream, const char *chunk, size_t len);
+xurl_stream_status xurl_stream_finish(xurl_stream_t *stream);
+bool xurl_decode_path(XURL_INPUT_CONSTNESS char *src, size_t len, char *dst, size_t cap, XURL_INPUT_CONSTNESS char **out, size_t *out_len);
+bool xurl_decode_query(XURL_INPUT_CONSTNESS char *src, size_t len, char *dst, size_t cap, XURL_INPUT_CONSTNESS char **out, size_t *out_len);
+void xurl_query_init(xurl_query_iter *iter, XURL_INPUT_CONSTNESS char *query, size_t len, int flags);
+bool xurl_query_next(xurl_query_iter *iter, xurl_query_param *param);
+bool xurl_keyset_init(xurl_keyset *set, const char **keys, size_t count);
+size_t xurl_query_lookup(const xurl_keyset *set, XURL_INPUT_CONSTNESS char *query, size_t len, int flags, xurl_query_param *params);
+void xurl_path_init(xurl_path_iter *iter, XURL_INPUT_CONSTNESS char *path, size_t len);
+bool xurl_path_next(xurl_path_iter *iter, XURL_INPUT_CONSTNESS char **segment, size_t *segment_len);
+bool xurl_remove_dot_segments(const char *src, size_t len, char *dst, size_t cap, size_t *out_len);
+bool xurl_canonicalize(const xurl_t *url, char *dst, size_t cap, size_t *out_len, bool *canonical);
+size_t xurl_format_length(const xurl_t *url);
+size_t xurl_format(const xurl_t *url, char *dst, size_t cap);
+bool xurl_resolve(const xurl_t *base, const xurl_t *ref, char *dst, size_t cap, size_t *out_len, xurl_t *out);
+uint64_t xurl_hash(const xurl_t *url, unsigned component_mask, uint64_t seed);
+void xurl_schema_dict_init(xurl_schema_dict *dict);
+bool xurl_intern_init(xurl_intern *table, xurl_intern_entry *entries, size_t max_entries, uint32_t *slots, size_t num_slots);
+size_t xurl_parse_columns(XURL_INPUT_CONSTNESS char **srcs, const size_t *lens, size_t n, xurl_columns *columns);
+size_t xurl_hostset_size(const char **rules, const size_t *lens, size_t count);
+size_t xurl_hostset_build(const char **rules, const size_t *lens, const uint32_t *ids, size_t count, void *mem, size_t cap);
+bool xurl_hostset_load(const void *mem, size_t size, xurl_hostset *set);
+bool xurl_hostset_match(const xurl_hostset *set, const xurl_host *host, uint32_t *rule_id);
+bool xurl_cidr_init(xurl_cidr_set *set, xurl_cidr_node *nodes, size_t max_nodes);
+bool xurl_cidr_add(xurl_cidr_set *set, const char *src, size_t len, uint32_t id);
+bool xurl_cidr_match(const xurl_cidr_set *set, const xurl_host *host, uint32_t *id);
+xurl_ip_class xurl_classify_ip(const xurl_host *host);
+bool xurl_host_to_ascii(const xurl_host *host, char *dst, size_t cap, const char **out, size_t *out_len);
+bool xurl_host_to_unicode(const xurl_host *host, char *dst, size_t cap, const char **out, size_t *out_len);
 bool xurl_parse_ipv6(const char *src, size_t len, uint16_t out[8]);
-bool xurl_parse_ipv4(const char *src, size_t len, uint32_t *out);
\ No newline at end of file
+bool xurl_parse_ipv4(const char *src, size_t len, uint32_t *out);
+size_t xurl_format_ipv6(const uint16_t ipv6[8], char *dst, size_t cap);
+size_t xurl_format_ipv4(uint32_t ipv4, char *dst, size_t cap);
+#if XURL_PUBLIC_SUFFIXES
+bool xurl_registrable_domain(const xurl_host *host, XURL_INPUT_CONSTNESS char **domain, size_t *domain_len);
+#endif
+xurl_simd xurl_get_simd(void);
+bool xurl_set_simd(xurl_simd level);
\ No newline at end of file
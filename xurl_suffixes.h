@@ -0,0 +1,10373 @@
+// Generated by gen_suffixes.py from the Public Suffix List
+// Don't edit by hand.
+
+static const char suffix_labels[] =
+    "xn--correios-e-telecomunicaes-ghc29achirurgiens-dentistes-en-fra"
+    "nceposts-and-telecommunicationsenvironmentalconservations3-websi"
+    "te-ap-northeast-1s3-website-ap-southeast-1s3-website-ap-southeas"
+    "t-2xn--trentino-sd-tirol-c3bprivatizehealthinsurancexn--trentin-"
+    "sd-tirol-rzbxn--trentino-sdtirol-szbxn--trentinosd-tirol-rzbxn--"
+    "vermgensberatung-pwbxn--gnstigbestellen-zvbxn--trentin-sdtirol-7"
+    "vbxn--trentinosdtirol-7vbxn--trentinsd-tirol-6vbxn--vermgensbera"
+    "ter-ctbaccident-investigationindependent-commissionxn--balsan-sd"
+    "tirol-nsbxn--bulsan-sdtirol-nsbxn--clchc0ea0b2g2a9gcdxn--mre-og-"
+    "romsdal-qqbxn--stjrdalshalsen-sqbxn--trentinsdtirol-nsbandria-ba"
+    "rletta-traniandria-trani-barlettabarletta-trani-andriafriuli-ven"
+    "ezia-giuliais-a-financialadvisormonza-e-della-brianzaobservableu"
+    "sercontentpassenger-associations3-fips-us-gov-west-1trani-andria"
+    "-barlettatrani-barletta-andriaxn--aurskog-hland-jnbxn--bozen-sdt"
+    "irol-2obxn--gnstigliefern-wobxn--nmesjevuemie-tcbaxn--valle-d-ao"
+    "ste-ehbakamaiorigin-stagingawsglobalacceleratorbarrell-of-knowle"
+    "dgecolonialwilliamsburgfriuli-veneziagiuliafriulivenezia-giuliai"
+    "s-a-personaltrainernaturalhistorymuseums3-website-eu-west-1s3-we"
+    "bsite-sa-east-1s3-website-us-east-1s3-website-us-west-1s3-websit"
+    "e-us-west-2synology-diskstationxn--comunicaes-v6a2oxn--mtta-vrjj"
+    "at-k7afxn--w4r85el8fhu5dnraxn--ystre-slidre-ujbaccident-preventi"
+    "onair-traffic-controlandriabarlettatraniandriatranibarlettaappsp"
+    "aceusercontentbarrel-of-knowledgefriuliveneziagiuliaindependent-"
+    "inquestindependent-inquirymedizinhistorischesnatuurwetenschappen"
+    "traniandriabarlettatranibarlettaandriatrentino-alto-adigetrentin"
+    "o-sued-tirolxn--bhccavuotna-k7axn--cesena-forl-mcbxn--forl-cesen"
+    "a-fcbxn--ggaviika-8ya47hxn--hcesuolo-7ya35bxn--hmmrfeasta-s4acxn"
+    "--koluokta-7ya57hxn--krjohka-hwab49jxn--mgberp4a5d4a87gxn--mgbql"
+    "y7c0a67fbcxn--sandnessjen-ogbxn--sr-varanger-ggbxn--valle-aoste-"
+    "ebbxn--valledaoste-ebbakamaiedge-stagingboldlygoingnowheredigita"
+    "loceanspacesdiskussionsbereichexperts-comptablesharvestcelebrati"
+    "onhosted-by-previderindependent-reviewinterhostsolutionsis-a-cub"
+    "icle-slavemonzaedellabrianzanorthwesternmutualpagespeedmobilizer"
+    "scienceandindustrysciencesnaturellesservecounterstriketravelersi"
+    "nsurancetrentin-sued-tiroltrentino-altoadigetrentino-sud-tiroltr"
+    "entino-suedtiroltrentinoalto-adigetrentinosued-tirolxn--bearalvh"
+    "ki-y4axn--bhcavuotna-s4axn--brnnysund-m8acxn--cesenaforl-i8axn--"
+    "davvenjrga-y4axn--forlcesena-c8axn--leagaviika-52bxn--mgbai9a5ev"
+    "a00bxn--mlatvuopmi-s4axn--rhkkervju-01afxn--sndre-land-0cbxn--st"
+    "re-toten-zcbxn--valleaoste-e7aakamaized-stagingalpha-myqnapcloud"
+    "bolzano-altoadigebrowsersafetymarkcarbonia-iglesiasedgesuite-sta"
+    "ginggithubusercontenthealth-carereformhigashimatsushimahistorica"
+    "lsocietyiglesias-carboniaindependent-panelis-a-conservativeis-a-"
+    "photographeris-an-entertainerlinodeusercontentmyactivedirectoryn"
+    "aturhistorischesplaystation-clouds3-ap-northeast-1s3-ap-northeas"
+    "t-2s3-ap-southeast-1s3-ap-southeast-2scienceandhistorystackhero-"
+    "networktelekommunikationtrentin-sud-tiroltrentin-suedtiroltrenti"
+    "no-sudtiroltrentinoaltoadigetrentinosud-tiroltrentinosuedtiroltr"
+    "entinsued-tirolxn--5su34j936bgsgxn--bck1b9a5dre4cxn--eveni-0qa01"
+    "gaxn--hgebostad-g3axn--krdsherad-m8axn--mgbah1a3hjkrdxn--mgbai9a"
+    "zgqp6jxn--mgberp4a5d4arxn--porsgu-sta26fxn--sr-aurdal-l8axn--ves"
+    "tvgy-ixa6oxn--vre-eiker-k8axn--xkc2dl3a5ee0hair-surveillanceakam"
+    "aihd-stagingamericanantiquesauthgear-stagingbalsan-suedtirolbran"
+    "dywinevalleybulsan-suedtirolcarboniaiglesiascouchpotatofrieselas"
+    "ticbeanstalkendoftheinternetest-mon-blogueurfastly-terrariumfedo"
+    "rainfracloudfirewall-gatewayfirewalledreplitfriuli-ve-giuliahiga"
+    "shihiroshimahigashimatsuyamahigashishirakawahigashisumiyoshihist"
+    "oryofsciencehuissier-justiceiglesiascarboniais-a-hard-workeris-a"
+    "-libertarianis-an-accountantis-into-cartoonsis-not-certifiedissm"
+    "arterthanyoumuseumverenigingmysecuritycameranationalfirearmsnati"
+    "onalheritagenorth-kazakhstanphiladelphiaarearoyal-commissions3-u"
+    "s-gov-west-1saves-the-whalestownnews-stagingtrentin-sudtiroltren"
+    "tino-a-adigetrentino-s-tiroltrentinosudtiroltrentinsud-tiroltren"
+    "tinsuedtirolusdecorativeartsxn--12co0c3b4evaxn--btsfjord-9zaxn--"
+    "fzys8d69uvgmxn--gildeskl-g0axn--givuotna-8yaxn--hylandet-54axn--"
+    "jrpeland-54axn--kranghke-b0axn--kvnangen-k0axn--laheadju-7yaxn--"
+    "lrenskog-54axn--mgba7c0bbn0axn--mgbcpq6gpa1axn--mgbqly7cvafrxn--"
+    "mjndalen-64axn--vegrshei-c0axn--xkc2al3hye2aaffinitylotteryameri"
+    "canexpressazurestaticappsbalsan-sudtirolbotanicalgardenbozen-sue"
+    "dtirolbritishcolumbiabulsan-sudtirolcampidano-mediochildrensgard"
+    "encloudcontrolappcloudcontrolledcloudflare-ipfscoloradoplateauco"
+    "mputerhistorycontemporaryartdev-myqnapclouddynamisches-dnseast-k"
+    "azakhstanedgekey-stagingenterprisecloudest-a-la-maisonest-a-la-m"
+    "asionevje-og-hornnesfriuli-v-giuliafriuli-vegiuliafriulive-giuli"
+    "afuettertdasnetzfujikawaguchikogeometre-experthembygdsforbundhig"
+    "ashiagatsumahigashichichibuhigashimurayamahigashiyodogawahomesec"
+    "uritymachosting-clusterhotelwithflightis-a-bookkeeperis-a-celtic"
+    "sfanis-a-landscaperis-a-linux-useris-a-republicanis-an-anarchist"
+    "is-with-thebandivano-frankivskkazimierz-dolnykerrypropertieskomm"
+    "unalforbundmedio-campidanominamiyamashiromore-og-romsdalmusashim"
+    "urayamanaturalsciencesoceanographiqueoutsystemscloudreggio-calab"
+    "rias3-ca-central-1s3-eu-central-1sandvikcoromantscience-fictions"
+    "ecuritytacticsstateofdelawarestjordalshalsentrentino-aadigetrent"
+    "ino-stiroltrentinoa-adigetrentinos-tiroltrentinsudtiroltuleap-pa"
+    "rtnersuscountryestateuslivinghistorywatch-and-clockwpenginepower"
+    "edxn--12cfi8ixb8lxn--aroport-byaxn--bdddj-mrabdxn--berlevg-jxaxn"
+    "--hkkinen-5waxn--hnefoss-q1axn--holtlen-hxaxn--hyanger-q1axn--i1"
+    "b6b1a6a2exn--kcrx77d1x4axn--krehamn-dxaxn--kvfjord-nxaxn--langev"
+    "g-jxaxn--ldingen-q1axn--lgbbat1ad8jxn--mgba3a4f16axn--mgbaakc7dv"
+    "fxn--mgbc0a9azcgxn--nqv7fs00emaxn--nttery-byaexn--nvuotna-hwaxn-"
+    "-oppegrd-ixaxn--rennesy-v1axn--rlingen-mxaxn--sdtirol-n2axn--skj"
+    "ervy-v1axn--sknland-fxaxn--sr-fron-q1axn--sr-odal-q1axn--srreisa"
+    "-q1axn--stjrdal-s1axn--tnsberg-q1axn--trgstad-r1axn--ygarden-p1a"
+    "yokoshibahikariadobeio-staticadobeioruntimeakamai-stagingamerica"
+    "nfamilyap-northeast-3appspacehostedarchaeologicalaurskog-holanda"
+    "zurecontainerbalena-devicesbananarepublicbmoattachmentsbozen-sud"
+    "tirolcampidanomediocasadelamonedachihayaakasakachristiansburgclo"
+    "udfunctionscn-northwest-1coastaldefencecookingchannelculturalcen"
+    "terdell-ogliastradnepropetrovskdnipropetrovskdyndns-at-homedyndn"
+    "s-at-workeating-organicecommerce-shopemilia-romagnafastvps-serve"
+    "rfriuli-vgiuliafriuliv-giuliafriulivegiuliagroundhandlingheimatu"
+    "nduhrenhigashiyoshinohistorichouseshome-webserverhomesecuritypci"
+    "chikawamisatois-a-anarchistis-a-bruinsfanis-a-bulls-fanis-a-cand"
+    "idateis-a-nascarfanis-a-socialistis-a-therapistis-an-engineerjcl"
+    "oud-ver-jpckerrylogisticskitanakagusukukunstunddesignlinkyard-cl"
+    "oudmediocampidanomidtre-gauldalminamiashigaranaamesjevuemienativ"
+    "eamericannaturbruksgymnondigitaloceanpublic-inquirypythonanywher"
+    "ereggiocalabriareserve-onlineschulplattformsciencecentersscience"
+    "historysells-for-lessserveminecraftsoundandvisiontrentinoaadiget"
+    "rentinostirolvallee-d-aosteweatherchannelwebview-assetswritesthi"
+    "sblogxn--54b7fta0ccxn--6qq986b3xlxn--80aaa0cvacxn--80aqecdr1axn-"
+    "-9dbhblg6dixn--b4w605ferdxn--bjarky-fyaxn--bjddar-ptaxn--brnny-w"
+    "uacxn--d5qv7z876cxn--djrs72d6uyxn--fiq228c5hsxn--h2breg3evexn--i"
+    "ndery-fyaxn--jlq480n2rgxn--jlster-byaxn--kfjord-iuaxn--krager-gy"
+    "axn--kvitsy-fyaxn--lesund-huaxn--merker-kuaxn--mgba3a3ejtxn--mgb"
+    "a3a4fraxn--mgbaam7a8hxn--mgbayh7gpaxn--mgbbh1a71exn--mgbca7dzdox"
+    "n--mgbi4ecexpxn--mgbx4cd0abxn--mlselv-iuaxn--moreke-juaxn--mosje"
+    "n-eyaxn--ntso0iqx3axn--ostery-fyaxn--rmskog-byaxn--rvc1e0am3exn-"
+    "-ryrvik-byaxn--skierv-utaxn--srfold-byaxn--stfold-9xaxn--unjrga-"
+    "rtaxn--vgsy-qoa0jxn--vrggt-xqadyamatokoriyama123hjemmesideadobea"
+    "emcloudairkitapps-auaizuwakamatsuartsandcraftsascoli-picenoassas"
+    "sinationatlassian-devazurewebsitesbeeldengeluidbotanicgardenbuil"
+    "twithdarkcaltanissettacampinagrandecarrara-massacertificationche"
+    "sapeakebaycivilaviationcloudplatformcloudyclustercommunity-prode"
+    "llogliastradevcdnaccessodielddanuorridivttasvuotnadyndns-officed"
+    "yndns-remotedyndns-serveremiliaromagnaendofinternetentertainment"
+    "est-le-patronfantasyleaguefarmequipmentfedoraprojectfriulivgiuli"
+    "afuturehostingfuturemailinggiehtavuoatnagithubpreviewguovdageaid"
+    "nuhere-for-morehigashikagawahigashikagurahigashikurumehigashinar"
+    "usehigashiyamatoimageandsoundinternationalis-a-democratis-a-desi"
+    "gneris-a-musicianis-a-rockstaris-an-actressis-into-animeis-into-"
+    "gamesis-very-sweetisa-hockeynutkawachinaganokisofukushimakitahir"
+    "oshimakunstsammlunglifeinsurancelinodeobjectslpusercontentmassa-"
+    "carraramatta-varjjatminamiechizenminamisanrikumonza-brianzamonza"
+    "ebrianzamyhome-servermythic-beastsnachikatsuuranieruchomoscinore"
+    "-og-uvdaloamishirasatooceanographicoffice-on-theosakikamijimaoys"
+    "tre-slidrepesaro-urbinoplurinacionalreggio-emiliarikuzentakatas3"
+    "-ap-south-1s3-external-1satsumasendaiscrapper-sitesellsyourhomes"
+    "erveexchangeservehalflifeshichikashukushimokitayamashinyoshitomi"
+    "skedsmokorsetsmartlabelingsouthcarolinaspace-to-rentstatic-acces"
+    "sthingdustdatatraeumtgeradetravelchanneltrycloudflareunusualpers"
+    "onurbino-pesarovalle-d-aostavestre-slidrevibo-valentiavirtualser"
+    "verwatchandclockweeklylotterywellbeingzonewolterskluwerxn--0trq7"
+    "p7nnxn--12c1fe0brxn--4dbgdty6cxn--avery-yuaxn--bidr-5nacxn--biev"
+    "t-0qaxn--cckwcxetdxn--drbak-wuaxn--eckvdtc9dxn--finny-yuaxn--fjo"
+    "rd-lraxn--fpcrj9c3dxn--fzc2c9e2cxn--gjvik-wuaxn--h2brj9c8cxn--h3"
+    "cuzk1dixn--hbmer-xqaxn--hpmir-xqaxn--karmy-yuaxn--ksnes-uuaxn--l"
+    "grd-poacxn--lhppi-xqaxn--linds-praxn--loabt-0qaxn--lrdal-sraxn--"
+    "msy-ula0hxn--muost-0qaxn--nry-yla5gxn--osyro-wuaxn--rholt-mraxn-"
+    "-rland-uuaxn--rskog-uuaxn--ryken-vuaxn--sandy-yuaxn--seral-lraxn"
+    "--sknit-yqaxn--snase-nraxn--tiq49xqyjxn--trany-yuaxn--troms-zuax"
+    "n--tysvr-vraxn--vry-yla5gxn--yfro4i67oxn--ygbi2ammx123paginaweba"
+    "nthropologyaosta-valleyarchitectureartanddesignarteducationascol"
+    "ipicenoat-band-campauthgearappsazure-mobilebackplaneappbahccavuo"
+    "tnablackbaudcdncarraramassacdn77-securecesena-forlichampionshipc"
+    "hiropracticcivilisationcivilizationclicketcloudconstructioncusto"
+    "mer-ocideno-stagingdivtasvuodnadreamhostersencyclopedicfashionst"
+    "orefedorapeopleflynnhostingfolionetworkforli-cesenafortmissoulaf"
+    "ramercanvasfranziskanergentlentapisham-radio-ophamatonbetsuhamma"
+    "rfeastahattfjelldalhigashiizumohigashiosakahigashitsunohitachiom"
+    "iyahostyhostinghs-heilbronnillustrationilovecollegeimpertrixcdni"
+    "ndianapolisindianmarketinstantcloudintelligenceinternet-dnsis-a-"
+    "bloggeris-a-catereris-a-liberalis-a-painteris-a-patsfanis-a-stud"
+    "entis-a-teacheris-an-artistis-certifiedis-into-carsis-very-evili"
+    "s-very-goodis-very-niceitcouldbeworjelenia-gorajinsekikogenkakam"
+    "igaharakamikitayamakamisunagawakhmelnitskiykhmelnytskyikitashiob"
+    "arakomatsushimakristiansandkristiansundkrokstadelvakuromatsunail"
+    "aakesvuemielcube-serverlocalhistorylplfinancialmassacarraraminam"
+    "ifuranominamiminowaminamiuonumamonzabrianzamuseumcentermyshopblo"
+    "cksmyspreadshopnakasatsunainakatombetsunasushiobaranesoddtangenn"
+    "ewhampshirenishiawakuranishikatsuranishinoomotenishinoshimanodeb"
+    "alancernordeste-idcolbia-tempioonflashdrivepagefrontapppantheons"
+    "itepesarourbinopostman-echoprequalifymepreservationpublishproxyq"
+    "uickconnectquipelementsrag-cloud-chreggioemiliaregruhostingresin"
+    "stagingriodejaneiros3-eu-west-1s3-eu-west-2s3-eu-west-3s3-sa-eas"
+    "t-1s3-us-east-2s3-us-west-1s3-us-west-2salvadordalisandnessjoens"
+    "anfranciscosantabarbarasaskatchewanschlesischesscholarshipsserve"
+    "sarcasmshinanomachishinkamigotoshinshinotsusor-varangerspeedpart"
+    "nerstalowa-wolastarachowicestpetersburgstreamlitappstuff-4-sales"
+    "urgeonshallteaches-yogatempio-olbiatondabayashitrendhostingtry-s"
+    "nowplowtsurugashimaurbinopesarovalle-daostavalled-aostavallee-ao"
+    "stevalleedaosteversicherungvestre-totenvibovalentiavirtual-userv"
+    "irtualcloudvultrobjectswashingtondcwoltlab-demoworkinggroupworki"
+    "sboringwphostedmailxn--3e0b707exn--45br5cylxn--4dbrk0cexn--7t0a2"
+    "64cxn--80adxhksxn--80asehdbxn--8y0a063axn--andy-iraxn--asky-irax"
+    "n--blt-elabxn--bmlo-graxn--brum-voaxn--dnna-graxn--dyry-iraxn--f"
+    "lor-jraxn--frde-graxn--frna-woaxn--frya-hraxn--gckr3f0fxn--gls-e"
+    "lacxn--hery-iraxn--hobl-iraxn--klbu-woaxn--lten-graxn--lury-irax"
+    "n--m3ch0j3axn--mely-iraxn--mgb2ddesxn--mgb9awbfxn--mgbab2bdxn--m"
+    "gbgu82axn--mgbpl2fhxn--mgbt3dhdxn--mgbtf8flxn--mk1bu44cxn--mori-"
+    "qsaxn--ngbc5azdxn--ngbe9e0axn--ogbpf8flxn--qcka1pmcxn--rady-irax"
+    "n--rdal-poaxn--rdy-0nabxn--risa-5naxn--risr-iraxn--rros-graxn--r"
+    "sta-fraxn--sgne-graxn--skjk-soaxn--slat-5naxn--slt-elabxn--smla-"
+    "hraxn--smna-graxn--snes-poaxn--snsa-roaxn--srum-graxn--tjme-hrax"
+    "n--trna-woaxn--vads-jraxn--vard-jraxn--vgan-qoaxn--vler-qoaxn--z"
+    "f0ao64ayamatotakadazaporizhzhia123homepage123kotisivu123webseite"
+    "accountantsactivetrailagriculturealessandriaamericanartaostavall"
+    "eyarchaeologyarchitectesarkhangelskbahcavuotnabanzaicloudbarclay"
+    "cardbarsycenterbarsyonlinebasicserverbeagleboardbearalvahkibette"
+    "r-thanblackfridayblockbusterboleslawiecbounty-fullbridgestonebro"
+    "nnoysundbungotakadacable-modemcalvinkleincesenaforlichannelsdvrc"
+    "hattanoogachippubetsuclickrisingcloudaccesscontractorscooperativ"
+    "acorporationcreditunioncryptonomicdavvenjargadelmenhorstdev-buil"
+    "derdevelopmentdiscordsaysditchyouripdoesntexistdynamic-dnsdyndns"
+    "-blogdyndns-freedyndns-homedyndns-maildyndns-picsdyndns-wikidynd"
+    "ns-workedgecomputeeducationalengineeringenterprisesfastly-edgefh"
+    "-muensterfilegear-aufilegear-defilegear-gbfilegear-iefilegear-jp"
+    "filegear-sgfirebaseappflekkefjordfoodnetworkforgeblocksforlicese"
+    "nafredrikstadfreedesktopfreemasonryfujiyoshidafukuchiyamagame-se"
+    "rvergemologicalgotpantheongrandrapidshachirogatahandcraftedhangg"
+    "lidinghatsukaichihigashikawahitachinakaholmestrandin-the-bandint"
+    "eractiveinvestmentsis-a-doctoris-a-hunteris-a-knightis-a-lawyeri"
+    "s-a-playeris-a-soxfanis-a-techieis-an-actoris-uberleetis-very-ba"
+    "diservschulejudygarlandkamiamakusakamishihorokashiwazakikasumiga"
+    "urakazteleportkerryhotelsknightpointkongsvingerlamborghiniland-4"
+    "-saleleangaviikalewismillerlillehammermagentositemaintenancemala"
+    "tvuopmimassivegridmesswithdnsmetacentrummidatlanticminami-alpsmi"
+    "namiawajiminamidaitominamiogunimisconfusedmotorcyclesmozilla-iot"
+    "my-firewallnakaniikawanakatsugawanedre-eikernishinomiyanishiokop"
+    "penoboribetsunord-aurdalnordre-landnospamproxynozawaonsenolayang"
+    "roupolbiatempioomihachimanorangecloudoregontrailosakasayamaostre"
+    "-totenownproviderpalmspringsparachutingparaglidingpharmacienspho"
+    "tographyplanetariumplatter-appprivatelinkproductionsprofesionalp"
+    "rogressivequalifioappraffleentryrahkkeravjureadthedocsredumbrell"
+    "aresindevicerishirifujisakaiminatosaobernardosaveincloudschoenbr"
+    "unnschokoladenschulserversells-for-uservehumourshiftcryptoshijon"
+    "awateshikokuchuoshimonosekishizukuishisondre-landstg-builderstor"
+    "-elvdalstufftoreadsweetpepperswinoujsciesynology-dstamatsukurita"
+    "tebayashitempioolbiatimekeepingtosashimizutrafficplextselinograd"
+    "tvedestrandval-d-aostavalle-aostavalledaostavalleeaosteveterinai"
+    "revirtualuservladikavkazvolkenkundevossevangenwebredirectwilliam"
+    "hillwithyoutubexn--11b4c3dxn--1ck2e1bxn--1lqs03nxn--1lqs71dxn--1"
+    "qqw23axn--2m4a15exn--2scrj9cxn--32vp30hxn--3bst00mxn--3ds443gxn-"
+    "-3hcrj9cxn--42c2d9axn--45brj9cxn--4it168dxn--4it797kxn--55qw42gx"
+    "n--5dbhl8dxn--5js045dxn--5rtp49cxn--5rtq34kxn--6frz82gxn--80ao21"
+    "axn--8ltr62kxn--9krt00axn--bod-2naxn--cck2b3bxn--czr694bxn--czrw"
+    "28bxn--d1acj3bxn--efvy88hxn--ehqz56nxn--elqq16hxn--f6qx53axn--fc"
+    "t429kxn--fjq720axn--flw351exn--g2xx48cxn--gecrj9cxn--gk3at1exn--"
+    "gmq050ixn--hebda8bxn--hxt814exn--imr513nxn--j1ael8bxn--j6w193gxn"
+    "--jvr189mxn--k7yn95exn--klt787dxn--kprw13dxn--kpry57dxn--lcvr32d"
+    "xn--lns-qlaxn--lt-liacxn--mgbtx2bxn--mix082fxn--mix891fxn--mkru4"
+    "5ixn--mli-tlaxn--mot-tlaxn--nit225kxn--nnx388axn--ntsq17gxn--nyq"
+    "y26axn--o3cyx2axn--od0aq3bxn--otu796dxn--pgbs0dhxn--pssu33lxn--q"
+    "9jyb4cxn--qqqt11mxn--rde-ulaxn--rhqv96gxn--rovu88bxn--rst-0naxn-"
+    "-s9brj9cxn--ses554gxn--t60b56axn--tor131oxn--uc0ay4axn--uist22hx"
+    "n--uuwu58axn--vg-yiabxn--vgu402cxn--vuq861bxn--w4rs40lxn--wcvs22"
+    "dxn--xhq521bxn--yer-znaxn--zbx025dxn--zfr164byandexcloudyoshinog"
+    "arizaporizhzhe123minsida123siteweb123website3utilitiesaf-south-1"
+    "airtrafficaivencloudaizumisatoaknoluoktaaktyubinskaltervistaalwa"
+    "ysdataamscomputeapartmentsartgalleryassociatesautomotiveazerbaij"
+    "anbabia-gorabalestrandballooningbasilicatabasketballbeebyteappbe"
+    "tainaboxbialowiezabieszczadybirthplacebnpparibasboehringerbookon"
+    "linebrumunddalbuyshousescahcesuolocaliforniacampobassocanva-apps"
+    "capebretoncapitalonecartoonartcheltenhamchernivtsichernovtsychik"
+    "ushinocincinnaticiscofreakclerkstagecleverappscloudfrontcloudjif"
+    "fycn-north-1collectioncollegefanconferenceconsultantconsultingco"
+    "penhagencreditcardcuisinelladamnserverdatacenterdatadetectdattol"
+    "ocaldattorelaydavvesiidademocraciadiscordsezdnsiskinkydnsupdater"
+    "dyn-berlindyn-o-saurdyndns-webeastafricaeero-stageelvendrellembr"
+    "oideryentomologyeu-north-1eu-south-1eurovisionexhibitionextraspa"
+    "cefaststacksfederationfor-betterfoundationfreebox-osfrenchkissfu"
+    "jinomiyafylkesbiblgangaviikageekgalaxygirlfriendgoogleapisgoogle"
+    "codegovernmentgroks-thishagebostadhalloffamehammerfesthanamigawa"
+    "hasura-apphealthcarehigashiomihigashiurahitachiotahjelmelandhobb"
+    "y-sitehomeofficehumanitiesichinomiyaichinosekiiliadboxosimmobili"
+    "eninawashiroindustriesis-a-greenis-a-llamais-a-nurseishinomakiis"
+    "teingeekjenv-arubajournalismjournalistjuedischeskagamiishikamifu"
+    "ranokaminokawakaminoyamakanegasakikarasjohkakarasuyamakatsushika"
+    "kautokeinokawaiishopkawaminamikeymachinekirovogradkitakyushuknow"
+    "sitallknx-serverkobierzycekoebenhavnkonskowolakouzushimakrodsher"
+    "adkuchinotsukvinnheradlancashirelayershiftlebtimnetzleitungsenli"
+    "kescandylittlestarlolitapunklosangelesloseyouripluxembourgmakino"
+    "haramakurazakimalopolskamamurogawamanagementmanchestermangyshlak"
+    "marylhurstmasfjordenmatsubushimatsushigeme-south-1mein-iservmein"
+    "-vigormicrolightminamiaikiminamibosominamimakiminamitaneminiserv"
+    "ermitsubishimiyakonojomo-siemensmonticellomovimientomy-gatewaymy"
+    "firewallnaganoharanagaokakyonagareyamanakadomarinamdalseidnameri"
+    "kawanamsskogannavigationnet-freaksnextdirectnishiaritaniyodogawa"
+    "northflanknoticeableokinoshimaomasvuotnaon-aptibleon-rancheron-t"
+    "he-webopensocialoperauniteostrowwlkpovre-eikerowariasahiparliame"
+    "ntpittsburghplantationplatformshpoint2thisportlligatprochowicepr"
+    "otectionprudentialpyatigorskquicksytesread-booksreadmyblogreales"
+    "taterecreationredirectmeresistancerestaurantrotorcraftsagamihara"
+    "saintlouissakuragawasandefjordsantamariasantoandresavannahgascal"
+    "eforceschaefflerschokokekssebastopolsekigaharasenseeringsensiosi"
+    "teservequakesettlementsevastopolsherbrookeshichinoheshimotsukesh"
+    "imotsumashopitsiteshopselectsimple-urlsimplesiteskygearappsnillf"
+    "jordsor-aurdalspjelkaviksteiermarkswiebodzintabitordertaifun-dns"
+    "takanezawatakarazukatarnobrzegtatamotorstawaramototb-hostingtech"
+    "nologytecnologiatelevisiontest-iservtokorozawatomigusukutorproje"
+    "cttranslatedtransporteullensakerullensvanguniversityusantiquesut"
+    "sunomiyaval-daostavald-aostavalleaostavaporcloudversaillesvindaf"
+    "jordvipsinaappvlaanderenvolkswagenwafaicloudwafflecellwebhosting"
+    "westeuropewithgoogleworse-thanwpdevcloudxn--30rr7yxn--3pxu8kxn--"
+    "45q11cxn--4gbrimxn--55qx5dxn--5tzm5gxn--6btw5axn--6orx2rxn--80as"
+    "wgxn--8dbq2axn--8pvr4uxn--90a1afxn--90a3acxn--9dbq2axn--9et52uxn"
+    "--c2br7gxn--c3s14mxn--cg4bkixn--czrs0txn--czru2dxn--djty4kxn--ef"
+    "vn9sxn--fiq64bxn--fiqs8sxn--fiqz9sxn--fl-ziaxn--gmqw5axn--h1aegh"
+    "xn--h1alizxn--io0a7ixn--kbrq7oxn--kltp7dxn--kltx9axn--klty5xxn--"
+    "kput3ixn--mk0axixn--mxtq1mxn--o3cw4hxn--od0algxn--pssy2uxn--q7ce"
+    "6axn--rht27zxn--rht61exn--rny31hxn--uc0atvxn--uisz3gxn--unup4yxn"
+    "--wgbh1cxn--wgbl6axn--y9a3aqxn--zf0avxyamanakakoyamanouchiyatsus"
+    "hiroyawatahamayokaichibayotsukaidozoologicalaccentureaccesscamae"
+    "robaticaerodromeagrigentoaizubangealaheadjualfaromeoallfinanzals"
+    "tahaugamagasakiamazonawsambulanceamsterdamamusementanalyticsanda"
+    "suoloann-arborannefrankaogashimaap-east-1aparecidaappengineaquar"
+    "ellearboretumaridagawaartcenterasahikawaasaminamiashibetsuastron"
+    "omyaudnedalnaustevollaustraliaaustrheimbackyardsballangenbalsfjo"
+    "rdbaltimorebarcelonabaremetalbashkiriabatsfjordbeauxartsbenevent"
+    "obialystokbitbridgebitbucketbjerkreimbloombergboyfriendbremanger"
+    "broadcastbruxellesbydgoszczcambridgecatanzarocdn-edgescdn77-sslc"
+    "entraluschambagricherkassychernigovchernihivchigasakichikuhokuch"
+    "ocolatechristmascloud-fr1cloudappscloudletscloudsitecompute-1con"
+    "suladocranbrookdeveloperdiscoursediscoverydlugolekadontexistdran"
+    "gedaldualstackdynathomedyndns-ipeastcoasteasypaneledgestackeiger"
+    "sundeisenbahnelementorembaixadaemergencyencoreapiethnologyfairwi"
+    "ndsfarmsteadfilateliafirestoneflatangerfolkebiblforgerockfortwor"
+    "thfrancaisefrankfurtfreeboxosfreseniusfrontdoorfrosinoneftpacces"
+    "sfujiiderafujishirofukumitsufunabashifunahashifunkfeuerfurniture"
+    "futurecmsgaivuotnagame-hostgeelvinckgildeskalgit-pagesgit-reposg"
+    "oldpointgratangengroks-thegushikamigyeongbukgyeongnamhachinoheha"
+    "mamatsuhashikamihashimotohaugesundhayashimaherokuappherokusslhig"
+    "ashinehimeshimahiraizumihiratsukahisamitsuhomebuilthomedepothome"
+    "goodshomelinuxhomesensehomesklephordalandhornindalhorokanaihoyla"
+    "ndethyllestadiamallamaik-serverin-berlinin-butterindustriainstan"
+    "cesinstituteis-a-chefis-a-geekis-a-guruisleofmanitayanagiiwamiza"
+    "waizumiotsuizumisanoizumizakiizumozakiizunokunijan-mayenjdevclou"
+    "djeffersonjellybeanjerusalemjewishartjoinvillejorpelandkagoshima"
+    "kamiizumikamikoanikamitondakaragandakarikaturkaruizawakasamatsuk"
+    "ashiharakashiwarakasserverkatashinakatsuragikatsuyamakawanehonka"
+    "wanishikhakassiakicks-asskilatironkimobetsukishiwadakitaakitakit"
+    "adaitokobayashikokubunjikolobrzegkongsbergkoshigayakoshimizukraa"
+    "nghkekrasnodarkudamatsukumakogenkunitachikuokgroupkurashikikushi"
+    "motokvanangenkvinesdalkviteseidkyotanabel-o-g-i-nla-spezialancas"
+    "terlandroverleadpagesleikangerleirfjordlifestylelikes-pielillesa"
+    "ndlima-citylindesneslocalcertlocalhostlocalzoneloginlinelolipopm"
+    "clombardialorenskogmarketingmarnardalmarshallsmatsubaramatsukawa"
+    "matsumotomatsusakamatsuzakimediatechmeinforummelbournemesaverdem"
+    "eteorappmicrosoftmigrationminamiiseminamiizuminnesotamiyashiromj"
+    "ondalenmo-i-ranamochizukimodellingmongolianmoonscalemoriguchimor"
+    "imachimoriyoshimorotsukamusashinomutsuzawamy-routermyasustormydi"
+    "ssentmymediapcmyshopifynakamichinannestadnarashinonewjerseynewme"
+    "xiconewspapernishiaizunishiazainishiharanishikatanishikawanishim"
+    "eranishitosanishiwakinord-fronnord-odalnordreisaobanazawaogasawa"
+    "raonavstackonfabricaonthewifiopencraftostrolekaostrowiecotoinepp"
+    "uoverhallaoyamazakipaderbornpanasonicpassagensperspectaphilately"
+    "platform0polkowicepomorskieponiatowapordenoneporsangerporsgrunnp"
+    "ramericaprzeworskrakkestadrandabergreadymaderetrosnubrichardliri"
+    "kubetsuringerikeringsakerriobrancorochesterryugasakisamnangersan"
+    "agochisantacruzsarpsborgsarufutsuscalebookschoolbusscientistscra"
+    "ppingseranishiservebeerserveblogservegameservehttpservepicsshang"
+    "rilashibukawashifteditshimabarashimamakishimamotoshimodateshimof"
+    "usashimoichishimokawashimonitashimosuwashinagawashinonsenshinshi"
+    "roshirahamashiranukashiratakashiriuchishiroishishirosatoshishiku"
+    "ishoparenaskydivingsmall-websnowflakesodegaurasongdalensosnowiec"
+    "soundcastsouthwestspydebergstarnbergstarostwostatebankstatefarms"
+    "tathellestavangersteinkjerstockholmstorebasestorfjordstuttgartsu"
+    "persalesvn-repossykkylventachiaraitachikawatailscaletakahashitak"
+    "amatsutakashimatakatsukitateshinateshikagatheworkpctjeldsundtobi"
+    "shimatogakushitogliattitokamachitokashikitokushimatomakomaitoolf"
+    "orgetoyohashitrondheimtsuchiuratsukigatatsukiyonoturystykatuxfam"
+    "ilytypedreamuberspaceujitawarauscultureushistoryutashinaivacatio"
+    "nsvaldaostavegarsheivestvagoyvevelstadvinnytsiavoorloperwalbrzyc"
+    "hwashtenawwebthingswestfalenwhitesnowwloclawekwodzislawxn--1ctwo"
+    "xn--4pvxsxn--90aisxn--90amcxn--90azhxn--b-5gaxn--c1avgxn--ciqpnx"
+    "n--d1alfxn--e1a4cxn--fhbeixn--h-2faxn--h1ahnxn--j1adpxn--j1aefxn"
+    "--j1amhxn--l-1faxn--l1accxn--ngbrxxn--o1achxn--p1acfxn--qxa6axn-"
+    "-rht3dxn--s-1faxn--tckwexn--tn0agxn--vhquvyachimatayamaguchiyama"
+    "nashiyamashinayamatsuriyodobashiyokkaichiyorkshireyoshikawayukuh"
+    "ashiyurihonjozachpomorzgorzelec123miwebaarborteabashiriabkhaziaa"
+    "budhabiacademiaaeroclubaeroportagematsuaircraftairforceairguarda"
+    "kershusakrehamnallstateappchiziapplinziaquariumasakuchiashgabada"
+    "smatartattorneyaugustowautocodeavellinobabybluebabymilkbackdropb"
+    "adaddjabalashovbarclaysbarefootbargainsbaseballbellevueberkeleyb"
+    "erlevagbiratoribirkenesblogsiteblogspotblogsytebluebiteboavistab"
+    "ouncemeboutiquebradescobrasiliabrindisibroadwaybroke-itbrusselsb"
+    "uildingbungoonobusinessbuskerudbytemarkcadaquescagliaricampaignc"
+    "ampaniacampinascandypopcapetowncateringcatholiccherkasychicappac"
+    "hikuseichikuzenchilloutchimkentchungbukchungnamciprianicityeatsc"
+    "ivilwarcleaningcliniqueclothingclouderacodebergcodespotcolumbusc"
+    "ommbankcontagemcoolblogcorvettecraftingcuritibacutegirldagestand"
+    "appnodedatabasedattowebddnsfreeddnsgeekddnskingddnslivedefinimad"
+    "eliverydeloittediamondsdinosaurdiscountdnsaliasdnstracedonostiad"
+    "ownloaddray-dnsdrayddnsdyn-ip24dynaliaseastasiaecologiaeconomiae"
+    "ducatoregersundegyptianeidfjordeidsbergeidsvollengerdalenscalede"
+    "pilepsyericssonetisalatevenassievennodefamilydsfastlylbfeedbackf"
+    "entigerfeste-ipfidelityfigueresfineartsfirmdaleflakstadflandersf"
+    "lesbergflorencefootballfor-somefr-par-1fr-par-2freemyipfreesitef"
+    "reiburgfribourgfrontierfujiminofujisatofujisawafukagawafukudomif"
+    "ukusakifukuyamafunagatafundaciofurubirafurudonofurukawafyresdalg"
+    "amagorigentappsgjerdrumgjerstadgoodyeargraingergraphicsgrimstadg"
+    "rossetoguardianguernseygyeonggihabikinohachiojihakodatehamatamah"
+    "anamakihashbanghatogayahatoyamahayakawahdfcbankhelsinkihemsedalh"
+    "epforgehinoharahirakatahirogawahirokawahirosakihisayamahistoireh"
+    "jartdalhokkaidohokksundholdingsholtalenhomelinkhomeunixhonbetsuh"
+    "onefosshorologyhoronobehospitalhostedpihoyangerichiharainashikii"
+    "natsukiindigenainfinitiingatlanipirangais-a-cpais-foundis-savedi"
+    "s-slickisa-geekishigakiishikariistanbulitabashiitoigawaiwaizumii"
+    "watsukijaworznojelasticjessheimjevnakerjls-sto1jls-sto2jls-sto3j"
+    "otelulujpmorgankadogawakagaminokakegawakakinokikakogawakalmykiak"
+    "amagayakamaishikamakurakameyamakamigorikamiichikamikawakamiminek"
+    "amisatokamitsuekamoenaikamogawakanagawakanazawakaneyamakarasjokk"
+    "asaharakasukabekatagamikatowicekawaharakawajimakawakitakawamatak"
+    "awanabekawasakikawatanakembuchikibichuokikirarakikugawakinghostk"
+    "inokawakirkeneskisarazukisosakikitaaikikitagatakitagawakitahatak"
+    "itakamikitakatakitamotokiyokawakiyosatokomaganekonsulatkonyvelok"
+    "opervikkotohirakozagawakrellianktistorykudoyamakujukurikuleuvenk"
+    "umagayakumamotokumatorikumejimakumiyamakunigamikunisakikunitomik"
+    "unneppukuriyamakuroishikurotakikustanaikuzumakikvafjordkvalsundk"
+    "yotambakyotangolangevaglaspezialavangenlclstagelevangerlightingl"
+    "imanowalodingenlombardylondrinalovesickloyalistlubartowlundbeckm"
+    "aceratamaebashimagazinemallorcamansionsmaritimemaritimomarriottm"
+    "arugamemarumorimarylandmaseratimatsumaematsuuramayfirstmazeplaym"
+    "azowszemckinseymedicinamemorialmerckmsdmerseinemesserlimichiganm"
+    "ilitaryminakamiminamataminisiteminokamomircloudmiyawakamiyazakim"
+    "izumakimizunamimizusawamombetsumonmouthmontrealmordoviamoriyamam"
+    "oroyamamortgagemoseushimoskenesmotoyamamuenchenmulhousemunakatam"
+    "urakamimurmanskmy-vigormydobissmyeffectmyiphostmykolaivmymailerm"
+    "yphotosmytuleapnagahamanagasakinagatoronakagawanakamuranakanojon"
+    "akanotonakatanenakayamanamegatanamegawanamikatanaoshimanarusawan"
+    "arviikanaumburgnaustdalnavuotnaneat-urlnebraskanesoddenneyagawan"
+    "ichinanniikappunikolaevninomiyanirasakinishiizunissedalnittedaln"
+    "l-ams-1nonoichinordkappnordlandnosegawanotairesnoticiasnotoddenn"
+    "otogawanotteroynovecorenowarudaobserverofficialohtawaraokuizumoo"
+    "maezakion-acornonomichionporteronrenderoppegardoristanoorkangero"
+    "rtsinfooygardenparallelparasitepasadenapaywhirlpharmacypiacenzap"
+    "icturespiedmontpiemontepimientapixolinoplatterpplumbingpodlasiep"
+    "okrovskpoliticaporsanguportlandpresidioprimetelprincipepropertyp"
+    "rotonetpruszkowpussycatrackmazerailroadraindropralingenrankoshir"
+    "awa-mazredstonerelianceremotewdrendalenrennesoyresearchribeiraor"
+    "iopretorokunohesaarlandsakahogisakegawasalangensalzburgsamegawas"
+    "amsclubsamukawasandcatssandiegosaogoncasardegnasardiniasasaguris"
+    "asayamasauheradscotlandsdscloudsekikawasells-itservebbsserveftps"
+    "erveircservemp3servep2pservicessetagayasetouchisettlersshacknets"
+    "hakotanshibechashinichishinjukushintokushintomishiogamashiojiris"
+    "hiraokashizuokashoppingshopwareshowtimesiracusasiteleafskanlands"
+    "kiptvetskjervoysmushcdnsoftbanksoftwaresor-fronsor-odalsorocabas"
+    "orreisasortlandspacekitspectrumstalbansstargardstcgroupstgstages"
+    "trippersuginamisukagawasunnydaysupabasesuppliessurnadalsvalbards"
+    "vizzeraswidnicasyncloudszczecinszczytnot3l3p0rttabayamatakahagit"
+    "akahamatakaharutakahatatakaishitakamoritakanabetakasagotakasakit"
+    "akatoritakayamatakazakitakeharataketomitakikawatakinouetamakawat"
+    "amamuratanaguratanangertanohatatarumizutashkenttateyamatelemarkt"
+    "emp-dnsternopilthruheretingvolltohnoshotokigawatokonametokuyamat"
+    "omisatotonkotsutonsbergtopologytorahimetoyokawatoyonakatoyosatot"
+    "oyotomitrainingtransurltroandintrogstadtsubetsutsukaerutsumagoit"
+    "suruokatypeformtysfjordu2-localuchiharauchinadauchinomiuenoharau"
+    "nderseaunicloudunispaceureshinousgardenuzhgorodvanguardvanylvenv"
+    "brplsbxvenneslaventuresverbaniavercelliverisignvestfoldvirginiav"
+    "ladimirvps-hostwakayamawakkanaiwalloniewanouchiwarszawawebspacew"
+    "edeploywest1-uswiardwebwildlifewindmillwoodsideworkshopxn--80aux"
+    "n--90aexn--d1atxn--nodexn--p1aixn--qxamyamagatayamakitayamamotoy"
+    "amanobeyanagawayokohamayokosukayolasiteyonabaruyonaguniyonezaway"
+    "osemiteyoshiokayugawarayusuharazakopanezentsujizhitomirzhytomyr1"
+    "23saitabogadoabruzzoacademyadygeyaagakhanagdenesaibetsuairlineai"
+    "rportakabiraakirunoakkeshialabamaalesundalibabaanamizuandroidanp"
+    "achiappspotaremarkarendalarmeniaartdecoasakawaaseinetaskvollathl"
+    "etaatlantaauctionaudibleaurlandauspostaviancaavocatsawsmpplaxarn"
+    "etayagawaazimuthazuminobadajozbaghdadbajddarbambinabanamexbaruer"
+    "ibauhausbellunobentleybergamobergbaubeskidybestbuybielawabirdart"
+    "bjarkoyblogdnsbloxcmsboliviabolognabookingboxfusebplacedbrendlyb"
+    "resciabristolbrotherbryanskbudejjubukharaburghofbuyshopbyglandca"
+    "racalcaravancareerscarriercasacamcasertacastrescataniacatfoodcec"
+    "hirecertmgrcf-ipfscharitycharterchicagochijiwachikugochikujochik"
+    "umachintaichitosechiyodachowdercienciacieszyncistroncitadelcldma"
+    "ilclintoncloud66cloudnsclubmedcocottecoldwarcolognecomcastcommun"
+    "ecompanycomparecontactconventcorsicacosenzacosidnscostumecouncil"
+    "couponscoursescremonacricketcrotonecruisescupcakeczeladzdaejeond"
+    "azaifudediboxdenmarkdeportedetroitdnsdojodnshomedoes-itdomainsdo"
+    "netskdoomdnsdrammendraydnsdsmynasduckdnsdyn-vpndyndns1dynserveas"
+    "tus2edgeappeditorxedogawaeidskogeiheijieklogeselverumembetsuempr"
+    "esaen-rootencowayenebakkenglanderoticaerotikaetajimaetnedaleurod"
+    "irexposedezproxyfakefurfarmersfarsundferraraferrariferrerofetsun"
+    "dfinancefinlandfirenetfirenzefirewebfishingfitnessflightsflorida"
+    "floripafloristflowersfolldalfor-ourfor-theforsaleforsandfra1-def"
+    "reetlsfrogansfrolandfrom-akfrom-alfrom-arfrom-azfrom-cafrom-cofr"
+    "om-ctfrom-dcfrom-defrom-flfrom-gafrom-hifrom-iafrom-idfrom-ilfro"
+    "m-infrom-ksfrom-kyfrom-lafrom-mafrom-mdfrom-mefrom-mifrom-mnfrom"
+    "-mofrom-msfrom-mtfrom-ncfrom-ndfrom-nefrom-nhfrom-njfrom-nmfrom-"
+    "nvfrom-nyfrom-ohfrom-okfrom-orfrom-pafrom-prfrom-rifrom-scfrom-s"
+    "dfrom-tnfrom-txfrom-utfrom-vafrom-vtfrom-wafrom-wifrom-wvfrom-wy"
+    "fuefukifujiedafujiokafujitsufukuokafukuroifuoiskufuosskogangwong"
+    "ausdalgentinggeologygeorgiagetmyipgets-itgiessenginowangitpagegj"
+    "emnesgjesdalgliwicegloppengnieznogodaddygoianiagolffangoriziagor"
+    "licegoshikigotembagoupilegrajewogranvingraphoxgreatergrocerygron"
+    "darguitarsgujaratgwangjugyokutohachijohaebaruhaibarahakusanhamar"
+    "oyhamburghandsonhangoutharstadhashimahedmarkhekinanhichisohirana"
+    "ihokuryuholidayhomednshomeftphosteurhoteleshotmailhttpbinhyundai"
+    "ibarakiibestadibigawaichikaiikarugaikusakaimabariimakaneimperiai"
+    "n-addrinazawaincheoninderoyinuyamaipifonyis-goneis-leetis-lostis"
+    "ahayaiseharaiserniaisesakiismailiisshikiistmeinitakuraivanovoive"
+    "landiwafuneiwakuniiwakuraiwanumajamisonjeonbukjeonnamjewelryjols"
+    "terjudaicajuniperkafjordkaizukakameokakamiokakanmakikannamikanon"
+    "jikanzakikaracolkaratsukareliakarlsoykarpaczkartuzykarumaikasaok"
+    "akashibakasugaikaszubykawagoekeliwebketrzynkharkivkharkovkherson"
+    "kikonaikikuchikimitsukitaurakitchenklodzkokodairakoganeikokonoek"
+    "omforbkommunekotourakouhokukounosukouyamakragerokrasnikkumenanku"
+    "roisokusatsukushirokutchankvitsoykyuragilacaixalajollalandinglan"
+    "xesslaquilalarssonlasallelatrobelavagisleasinglebesbyleclerclegn"
+    "icaleirvikleksviklezajskligurialimitedlincolnlivornologintoloisi"
+    "rslovepoplucanialucernelugansklyngdalmachidamaibaramaizurumalbor"
+    "kmalselvmantovamarburgmaringamarketsmashikemashikimashikomatsuda"
+    "matsudomatsunomedecinmedicalmembersmerakermessinamidsundminterem"
+    "ishimamissilemitsukemoarekemodalenmonstermoriokamosjoenmragowomu"
+    "roranmyamazemycloudmydattomydrobomyforummyfritzmytabitnakagyonak"
+    "ijinnalchiknamastenankokunanmokunanporonerdpolnessebynetbanknetf"
+    "lixnetlifyneustarnewportnewyorknfshostnh-servniigataniihamanishi"
+    "gonisshinniteroinobeokanobushinodeartnorddalnorfolknoshironow-dn"
+    "sobihiroobninskodawaraofunatoogawaraoishidaokagakiokayamaokazaki"
+    "okegawaokinawaokutamaoldnavyolsztynomigawaomitamaomotegoonagawao"
+    "ncillaontarioooshikaopenairopocznooriginsorsitesosteroyostfoldos"
+    "trodaotofukeotsuchipacificpalermoperugiapescaraphilipsphoenixpig"
+    "boatpioneerpistoiaplesknspodhalepodzonepointtopoivronpolitiepolt"
+    "avapomorzepotagerpotenzarailwayravendbravennaravpagerealtorrecip"
+    "esreclaimrenneburentalsrepbodyreservdreviewsrevistarexrothrhclou"
+    "dringeburockartromskogroyrvikryokamirzeszowsaigawasaitamasakurai"
+    "salernosaltdalsamsungsannohesantafesaotomesapporosassarisatoshos"
+    "chmidtschoolsschwarzschweizscrysecseaportseljordsembokushibatash"
+    "ibuyashikabeshikaoishikshashimadashimaneshimogoshimojishirakoshi"
+    "raoishitarashobarasibeniksiciliasiellaksiiitessinglesskiervaskoc"
+    "zowslattumsobetsusogndalsokndalsolognesondriosorfoldsquare7stapl"
+    "esstaticsstavernsteigenstoragestordalstrandasunndalsupportsurger"
+    "ysuwalkisvelvikswidniksyno-dstadaokatadotsutaishintakaokataranto"
+    "tatsunoteckidstelebittemasektempurltenkawatestingtextiletheatert"
+    "heatretheshopticketstiffanytobetsutochigitogitsutomiokatonoshoto"
+    "rskentoscanatoshibatoshimatottoritourismtoyoaketoyookatoyotsutoy"
+    "ouratradingtransiptrapanitrevisotriestetroitsktrolleytrusteetsub"
+    "ametsubatatsugarutsukubatsukumitsurugitsurutatsuwanotuscanyunazu"
+    "kiunjargaurakawaurayasuushuaiautwenteuwajimavaapstevaksdalvargga"
+    "tvestnesvicenzavillagevinnicavirtuelviterbovologdavpnpluswalmart"
+    "wanggouwassamuwataraiwatcheswebhareweblikewebpaasweddingwestus2w"
+    "halingwhoswhowindowswinnerswixsitewmcloudwmflabswolominworkerswp"
+    "mucdnwpmudevwroclawxfinityxn--41ayachiyoyamaxunyamazoeyanaizuyas"
+    "uokayatsukayomitanyoshimizoologyzuerich001www9guacuabarthabbotta"
+    "bbvieadachiaejrieagencyagentsaikawaairbusairtelakadnsakaiwaalask"
+    "aalipayalsacealstomalvdalanconaandebuannakaanquanaogakiaomoriapi"
+    "geeappudoaramcoarezzoariakeaseralashoroassabuassisiatsugiaustina"
+    "uthoraveroyavouesb-databaidarbamblebandaibauernbayernbeardubeaut"
+    "ybedzinbeiarnbergenbhartibiellabievatbifukabihorobilbaobindalbit"
+    "terboomlabostikbostonbotanyboutirbrokerbrunelbunkyobusheycamdvrc"
+    "anadacasinocastlecaxiaschanelchietichiryuchonanchoseichoshichrom"
+    "echurchcinemacirclecircusclaimscliniccloud9coffeecomseccondoscou"
+    "ntycrankycrimeacuiabadaemondaisendallasdapliedatingdatsundd-dnsd"
+    "ealerdeatnudebiandegreedentaldiademdigickdisrecdnsfordogadodopaa"
+    "sdrobakdunlopdupontdurbandurhamdvrcamdvrdnsdynvpnebetsuedugitego"
+    "ismelastxelblagelburgemerckenergyesashieveneseventsexeterfauskef"
+    "bx-osfinnoyfitjarfjalerflickrfloppyfoggiaforgotfortalforumzfosne"
+    "sfrostafruskyfukayafutabafutbolfuttsugallupgamvikgaulargdanskgdy"
+    "niagehirngeiseigenkaigenovageorgeginozagitappgitlabgivinggjovikg"
+    "leezeglitchglogowgloomygojomegokasegonohegotdnsgratisgroznyhabme"
+    "rhaborohadanohadselhakatahakonehakubahaldenhamadahamurahanawahan"
+    "nanhapmirhappouhareidharimahasamahasamihasudahasvikhawaiihegurih"
+    "ellashemneshermeshetemlhidakahidorahikonehimejihiphophiradohirar"
+    "ahirayahokutohomeiphonjyohoplixhortenhugheshungryhurdalhvalericu"
+    "rusidrettiijimaiitateiiyamaiizukaiizunaimamatin-brbin-dslin-vpni"
+    "nsureintuitiopsysitomaniwanaijaguarjambyljobojijoburgjoetsujogas"
+    "zjohanajoyentjuegoskadenakahokukainankaiseikakudakaliszkalugakan"
+    "oyakanumakaratekariwakariyakarmoykasuyakatanokaufenkawabakawarak"
+    "awauekawazukayabekazunokeisenkhplaykihokukiminokinderkindlekitam"
+    "ikiyamakiyosekiyosukomakikomonokomorokomvuxkoobinkosakakosherkos"
+    "ugekozakikrakowkumanokundenkunimikuratekurgankurobekurogikuwanak"
+    "yonanlabourlahppilanbiblancialandeslardallarviklatinalatinolebor"
+    "klecznalefraklenviklerdalliernelindasloabatlockerlogoiplohmuslon"
+    "donlouvrelowiczlublinlunnerluxuryluzernlyngenmacapamaceiomadridm"
+    "agnetmakeupmalvikmanausmandalmarchemarinemarkermasakimasudamater"
+    "amatsuemattelmazurymeeresmeguromeldalmelhusmemsetmiastamidorimie"
+    "lecmielnomifunemihamamiharumikasamilanomimataminanomincomminersm"
+    "iningminobumisakimisasamisawamisugimitakamitakemitoyomiyadamiyag"
+    "imiyakemiyazumiyotamizuhomlbfanmmafanmobaramodenamodernmolisemon"
+    "ashmorenamormonmoscowmosvikmotegimotobumotosumunciemuosatmurotom"
+    "useetmusicamy-wanmyddnsmyfastmyjinomypetsmywirenabarinagaranagas"
+    "unagisonagoyanaharinakamanamsosnantannaplesnaritanarutonarviknat"
+    "orinayoronemuronerimanessetnflfannhlfanniepcenikahonikitaninohen"
+    "issannissaynogatanohejinohostnombrenortonnovaranowruznumatanumaz"
+    "unyuzenocelotodessaoguchiohkuraoiraseoksnesoleckoolkuszomniweon-"
+    "k3son-rioon-webonjukuookuwaoppdaloracleorkdalorlandorskogosascoo"
+    "soyrootsukioxfordpadovapagexlpalacepalmaspanamaparochpatriapecor"
+    "ipeeweepfizerpgafanphysiopictetpilotspinokopl-wawplantspolicepon"
+    "pesportalpowiatpoznanpressepubtlspueblopugliapulawyqbuserquebecr"
+    "acingragusaraholtranzanrealtyrecifereisenreklamrepairreportrimin"
+    "irindalrocherrogersrollagrovigoroykenruovatrussiarybnikryukyusad"
+    "istsaikaisakadosakakisakatasakuhosandoysannansanofisanukisaromas"
+    "asebosavonasecaassecretseidatseirouselfipsellfyseminesenasasenna"
+    "nsettsushiibashingoshingushinjoshioyashisuishonaishoujishunansic"
+    "ilysigdalsiljansirdalskanitskodjeslupsksnaasesnoasasoccersolunds"
+    "phinxstangestdlibstjohnstokkestolosstudiosugitosuissesukumosulda"
+    "lsumidasumitasupplysurreysusakisusonosuzakasuzukasuzukiswatchswe"
+    "densydneyszkolatabusetagajotaharatainaitaipeitajimitajiritakagit"
+    "akasutaketatamakitamanotamayutaobaotaramatargettattootennisteram"
+    "otermeztiendatjmaxxtkmaxxtochiotoganetoguratomaritomikatomiyatom"
+    "obetonakitonamitoridetorinotowadatoyakotoyonetoyonotoyotatozawat"
+    "ozsdetradertranbytranoytrentotritontromsatromsotrysiltsuikitsuku"
+    "itsunantwmailtynsettysnestysvarufcfanumbriaunicomurasoeurausuusa"
+    "rtsushikuutazasutsirav-infovagsoyvantaavaresevelvetvenetovenicev"
+    "erdalveronaverranversusvestbyviajesvikingvillasvivianvoagatvotin"
+    "gvoyagevpndnsvueloswajikiwakuyawalterwarabiwarmiawatariwatsonweb"
+    "camwebhopwegrowwielunwzmiuwxihuanxs4allyabukiyachtsyahabayahikoy"
+    "akageyakumoyamadayaotsuyasakayashioyasudayasugiyatomiyawarayoich"
+    "iyokoteyokozeyonagoyuzawazamamizapposzombie1kapp4limaabenoabikoa"
+    "dimoadultaetnaagraraisaiakunealcesamberamfamamicaamuneananiangry"
+    "appleaskeraskimaskoyasnesassurasukeaudioaukraautosawdevbaidubala"
+    "tbandobardubarumbaselbathsbeatsbegetbelaubelembeppubibaibiblebih"
+    "arbingobizenbjugnblushboatsbomloboschbrynebusanbuzenbyklebytomca"
+    "fjscanoncapoocardscargocarrdchasecheapchipschitachofuchoyociticc"
+    "oachcoprocrowncuneocybercymruczestdaburdaegudaigodaiwadanceddns5"
+    "ddnssdealsdedyndelhideltademondiherdollsdonnadoshidovredubaidyn5"
+    "3dynnsdynv6dyroyeartheatonebinaebinoedekaeniwaepsonerimoessexexn"
+    "etfaithfbsbxfbxosfedexfedjefeirafermofieldfinalfldrvflierflorafl"
+    "orofordeforexfortefranafrognfroyafuchufudaifukuifussagallogalsag"
+    "enoagiftsgiizeginangirlygiskegivesglassglobogmailgminagonnagorge"
+    "gosengotsugranegretagripegronggucciguidegulengunmahaccahakuihals"
+    "ahandahannohanyuheavyheroyhicamhiokihippyhitrahobolhondahongohop"
+    "tohorsehurumhyatthyogohyugaibxosiheyaikedailawaimariinabeinagiin"
+    "dieinzaiirumais-byitakoitanoitigoiwadeiwamaiwataiwateizenajampaj"
+    "etztjgorakaitakanankaniekanrakapsikasaikepnokinkokiryuklabuklepp"
+    "kmpspkochikoelnkomaekonankoninkoorikoryokosaikoseikoshukozowkpps"
+    "pkuronkutnokwpspkyotokyowalaborlakaslamerlazioleaselecceleccoleg"
+    "alleluxlenuglesjalexuslillylipsyloanslocuslomzalon-1lon-2loppalo"
+    "tenlottolubinluccalukowluroylutskmacysmangomannomaorimasoymcdirm"
+    "cpremeiwameloymiamimiasaminohmitoumiuramodummoldemoneymoviemuika"
+    "myftpmyokomypepmypsxmytismyvncnagainakainaklonanaenanaonanbunang"
+    "onanjonantonanyonaroynatalnavalnavoinesnaneuesnexusniiminiizanik"
+    "konikonninjano-ipnodesnokianowtvntdllnuorooaraiobamaobiraobuseod"
+    "esaoganoogimiogoriogoseoharuojiyaoketoolawaomahaomegaomutaoniono"
+    "oguyopoleosetootagootakeotariotaruotobeowaniownipoyabeoyodoozora"
+    "paduapaleoparisparmapartipartspartypaviapennepenzapermapgfogphon"
+    "epippupizzaplazapokerpratopraxiprgmrpromoprvcypstmnpubolpunyupym"
+    "ntradomradoyraumarebunrechtrehabricohrietirisorrissarittorivnero"
+    "ckyrodeorodoyrorosrovnorugbyryggeryuohsabaesagaesaijosaikisaitos"
+    "akaesakyosalonsaludsampasangosanjosanoksattesaudaseihiseiyosejny"
+    "sekd1selbuseljesenerseoulsharisharpshellshoesshowasienaskaunskie"
+    "nskjakskoleskypeslaskslingsmilesmolasnasasochisoedasognesolarsom"
+    "nasopotsorumspawnspdnsstabasteamstorjstrynstudysuckssuifusuitasv"
+    "eioswisstaijitaikitairataitotakkotargitaruitendoteneitenriternit"
+    "exastgorythicktirestjometksattmalltodaytohmatokaitolgatoolstoray"
+    "totaltourstranatunesturekturintushutychytydalubankudineujiieukih"
+    "aulvikumajiunnanunzenupaasupperurawaurownusersustkausukiutazuvad"
+    "sovaganvardovaroyvefsnvegasvideovodkavoldavolvovolynwalesweberwe"
+    "ibownextworldxeroxxnbayyaeseyahooyaitayaizuyaltayoitayomboyoriiy"
+    "outhyuasayusuizaganzaptozarowzgora0emm12hp133716-b2000203832-b64"
+    "-baarpacctaioiakdnalp1arvoassnaureaxisbar0bar1bar2bbvabeepbieibi"
+    "gvbikebillbodobofaboknboltbondbonnbuzzbyencafecallcbreciaoclancn"
+    "pycoalcodycomocrewcurvcyoncyoudclkdetadgcadietdishdruddvagdynue1"
+    "64ebizes-1eu-1eu-2eu-3eu-4fagefailfansfhskfiatfidofilmflapflirfl"
+    "ogfnwkfoolfr-1fuelfusogbizggeegifugluggmbhgobogodogouvgovtgrazgr"
+    "iwgrueguamgugegujohagahelphgtvhlx3holeholyhsbci234icbcieeeimdbio"
+    "bbiraqivgujavajeepjejujobsjosojoyojozijprsjuifkaaskazokddikievki"
+    "jokillkilokiwikizukobekofukokakpmgkredkrymkujikurekusukvamkyivla"
+    "irlanslapylegolgbtlidllimolmpmlugslvivlynxmaifmanxmcpemeetmememe"
+    "numibumihomockmodsmossmugimukomycdmydsmypina4unabunaieneennikeno"
+    "ginoipnoopny-1ny-2nyaanyannynynysaoddaohdaoirmollooopsoslootapoy"
+    "erparspccwpinbpinkpisapiszpohlpornpupuqotoqponreitriikroomrsvpru"
+    "hrrzgwsadosarlsatxsaxosayoseatseeksexysg-1shawshoosilksncfsohuso"
+    "jasokasomasonysowasrcfsrhtsulisumysurfszextanktaxitcp4tiaatinnti"
+    "pstlontobatoeitogotoystreetulatunktuvauedauni5uozuupliupowus-1us"
+    "-2us-3us-4utahuvicvisavivavivovlogvotevotowakeweirwienwiihwinbwi"
+    "oswitdwskrwuozx443xboxyufuyukizero2ix611abcarqbbcbbtbcgbcnbhzbip"
+    "bmdbmsbmwbnrbzhbzzc66cbgcbncbsceocfdcimcngcnscntcogcozcrdcrscsxd"
+    "dsdhldiydnpdrremrenfesqfemfhvfltfncfndfotfoxfozfrlfstftrfvgfyig1"
+    "2gapggfgopgrpgsjgubhkthzcibmidvip6itvjcbjdfjedjfkjlljmpjnjjpnk12"
+    "k8skfhkpnlk3llpmtnmtrmupn4tnhknhsnidnjsnrwnsnnswocpomgovhoxaphdp"
+    "hxpiwplcpmnpncprdpvhpvtpwcq-aqa2qcxqldqsls5ysbsscbscwsewshwsjcsl"
+    "dslgslzsoospbsrlsrvsvctcitcmtdktjxtmptrdtrvtvsuk0ulmusrvaovfsvix"
+    "vp4vxlwhmwiwwowwtcwtfxenxinxxxxyzynhyuuzipzlgkzqhxjxzzw"
+    ;
+
+static const suffix_node suffix_nodes[] = {
+    {0x00000000, 0, 0, 0, 1, 1490},
+    {0x61616100, 7079, 3, 1, 1491, 0},
+    {0x61617270, 40962, 4, 1, 1491, 0},
+    {0x61626172, 34163, 6, 1, 1491, 0},
+    {0x61626200, 34169, 3, 1, 1491, 0},
+    {0x6162626f, 34169, 6, 1, 1491, 0},
+    {0x61626276, 34175, 6, 1, 1491, 0},
+    {0x61626300, 42024, 3, 1, 1491, 0},
+    {0x61626c65, 763, 4, 1, 1491, 0},
+    {0x61626f67, 29062, 7, 1, 1491, 0},
+    {0x61627564, 23679, 8, 1, 1491, 0},
+    {0x61630000, 35, 2, 1, 1491, 7},
+    {0x61636164, 29076, 7, 1, 1498, 1},
+    {0x61636365, 19372, 9, 1, 1499, 0},
+    {0x6163636f, 3730, 10, 1, 1499, 0},
+    {0x6163636f, 12544, 11, 1, 1499, 0},
+    {0x61636f00, 12928, 3, 1, 1499, 0},
+    {0x6163746f, 12912, 5, 1, 1499, 0},
+    {0x61640000, 729, 2, 1, 1499, 1},
+    {0x61647300, 10825, 3, 1, 1500, 0},
+    {0x6164756c, 38340, 5, 1, 1500, 0},
+    {0x61650000, 26, 2, 1, 1500, 8},
+    {0x61656700, 19068, 3, 1, 1508, 0},
+    {0x6165726f, 19390, 4, 1, 1508, 86},
+    {0x6165746e, 38345, 5, 1, 1594, 0},
+    {0x61660000, 693, 2, 1, 1594, 5},
+    {0x61666c00, 30335, 3, 1, 1599, 0},
+    {0x61667269, 16546, 6, 1, 1599, 0},
+    {0x61670000, 982, 2, 1, 1599, 5},
+    {0x6167616b, 29090, 7, 1, 1604, 0},
+    {0x6167656e, 34193, 6, 1, 1604, 0},
+    {0x61690000, 714, 2, 1, 1604, 5},
+    {0x61696700, 3427, 3, 1, 1609, 0},
+    {0x61697262, 34211, 6, 1, 1609, 0},
+    {0x61697266, 23727, 8, 1, 1609, 0},
+    {0x61697274, 34217, 6, 1, 1609, 0},
+    {0x616b646e, 40974, 4, 1, 1609, 0},
+    {0x616c0000, 106, 2, 1, 1609, 7},
+    {0x616c6661, 19435, 9, 1, 1616, 0},
+    {0x616c6962, 29160, 7, 1, 1616, 0},
+    {0x616c6970, 34241, 6, 1, 1616, 0},
+    {0x616c6c66, 19444, 9, 1, 1616, 0},
+    {0x616c6c73, 23759, 8, 1, 1616, 0},
+    {0x616c6c79, 38180, 4, 1, 1616, 0},
+    {0x616c7361, 34247, 6, 1, 1616, 0},
+    {0x616c7374, 34253, 6, 1, 1616, 0},
+    {0x616d0000, 969, 2, 1, 1616, 9},
+    {0x616d617a, 19471, 6, 1, 1625, 0},
+    {0x616d6572, 4347, 15, 1, 1625, 0},
+    {0x616d6572, 6009, 14, 1, 1625, 0},
+    {0x616d6578, 29366, 4, 1, 1625, 0},
+    {0x616d6661, 38375, 5, 1, 1625, 0},
+    {0x616d6963, 38380, 5, 1, 1625, 0},
+    {0x616d7374, 19489, 9, 1, 1625, 0},
+    {0x616e616c, 19507, 9, 1, 1625, 0},
+    {0x616e6472, 29174, 7, 1, 1625, 0},
+    {0x616e7175, 34283, 6, 1, 1625, 0},
+    {0x616e7a00, 753, 3, 1, 1625, 0},
+    {0x616f0000, 756, 2, 1, 1625, 6},
+    {0x616f6c00, 32596, 3, 1, 1631, 0},
+    {0x61706172, 15952, 10, 1, 1631, 0},
+    {0x61707000, 1403, 3, 1, 1631, 28},
+    {0x6170706c, 38400, 5, 1, 1659, 0},
+    {0x61710000, 7093, 2, 1, 1659, 0},
+    {0x61717561, 19579, 9, 1, 1659, 0},
+    {0x61720000, 639, 2, 1, 1659, 14},
+    {0x61726162, 29542, 4, 1, 1673, 0},
+    {0x6172616d, 34313, 6, 1, 1673, 0},
+    {0x61726368, 4985, 5, 1, 1673, 0},
+    {0x61726d79, 9382, 4, 1, 1673, 0},
+    {0x61727061, 31590, 4, 1, 1673, 6},
+    {0x61727400, 3749, 3, 1, 1679, 0},
+    {0x61727465, 3776, 4, 1, 1679, 0},
+    {0x61730000, 140, 2, 1, 1679, 1},
+    {0x61736461, 34725, 4, 1, 1680, 0},
+    {0x61736961, 24555, 4, 1, 1680, 1},
+    {0x6173736f, 15972, 10, 1, 1681, 0},
+    {0x61740000, 89, 2, 1, 1681, 18},
+    {0x6174686c, 29244, 7, 1, 1699, 0},
+    {0x6174746f, 23815, 8, 1, 1699, 0},
+    {0x61750000, 866, 2, 1, 1699, 18},
+    {0x61756374, 29258, 7, 1, 1717, 0},
+    {0x61756469, 29265, 4, 1, 1717, 0},
+    {0x61756469, 29265, 7, 1, 1717, 0},
+    {0x61756469, 38435, 5, 1, 1717, 0},
+    {0x61757370, 29279, 7, 1, 1717, 0},
+    {0x61757468, 34367, 6, 1, 1717, 0},
+    {0x6175746f, 15982, 4, 1, 1717, 0},
+    {0x6175746f, 38445, 5, 1, 1717, 0},
+    {0x61766961, 29286, 7, 1, 1717, 0},
+    {0x61770000, 987, 2, 1, 1717, 1},
+    {0x61777300, 987, 3, 1, 1718, 0},
+    {0x61780000, 861, 2, 1, 1718, 8},
+    {0x61786100, 29307, 3, 1, 1726, 0},
+    {0x617a0000, 3199, 2, 1, 1726, 12},
+    {0x617a7572, 4362, 5, 1, 1738, 0},
+    {0x62610000, 454, 2, 1, 1738, 8},
+    {0x62616279, 23847, 4, 1, 1746, 0},
+    {0x62616964, 38455, 5, 1, 1746, 0},
+    {0x62616e61, 29363, 7, 1, 1746, 0},
+    {0x62616e61, 6107, 14, 1, 1746, 0},
+    {0x62616e64, 630, 4, 1, 1746, 0},
+    {0x62616e6b, 22770, 4, 1, 1746, 0},
+    {0x62617200, 638, 3, 1, 1746, 0},
+    {0x62617263, 19723, 9, 1, 1746, 0},
+    {0x62617263, 12665, 11, 1, 1746, 0},
+    {0x62617263, 23887, 8, 1, 1746, 0},
+    {0x62617265, 23895, 8, 1, 1746, 0},
+    {0x62617267, 23903, 8, 1, 1746, 0},
+    {0x62617365, 23911, 8, 1, 1746, 0},
+    {0x6261736b, 16042, 10, 1, 1746, 2},
+    {0x62617568, 29377, 7, 1, 1748, 0},
+    {0x62617965, 34415, 6, 1, 1748, 0},
+    {0x62620000, 1857, 2, 1, 1748, 10},
+    {0x62626300, 42030, 3, 1, 1758, 0},
+    {0x62627400, 42033, 3, 1, 1758, 0},
+    {0x62627661, 41010, 4, 1, 1758, 0},
+    {0x62636700, 42036, 3, 1, 1758, 0},
+    {0x62636e00, 42039, 3, 1, 1758, 0},
+    {0x62640000, 5476, 2, 2, 1758, 0},
+    {0x62650000, 328, 2, 1, 1758, 8},
+    {0x62656174, 38490, 5, 1, 1766, 0},
+    {0x62656175, 34427, 6, 1, 1766, 0},
+    {0x62656572, 22419, 4, 1, 1766, 0},
+    {0x62656e74, 29391, 7, 1, 1766, 0},
+    {0x6265726c, 16516, 6, 1, 1766, 0},
+    {0x62657374, 350, 4, 1, 1766, 0},
+    {0x62657374, 29419, 7, 1, 1766, 0},
+    {0x62657400, 10166, 3, 1, 1766, 0},
+    {0x62660000, 12077, 2, 1, 1766, 1},
+    {0x62670000, 3100, 2, 1, 1767, 38},
+    {0x62680000, 1616, 2, 1, 1805, 5},
+    {0x62686172, 34451, 6, 1, 1810, 0},
+    {0x62690000, 2047, 2, 1, 1810, 5},
+    {0x6269626c, 38520, 5, 1, 1815, 0},
+    {0x62696400, 9199, 3, 1, 1815, 0},
+    {0x62696b65, 41026, 4, 1, 1815, 0},
+    {0x62696e67, 27315, 4, 1, 1815, 0},
+    {0x62696e67, 38530, 5, 1, 1815, 0},
+    {0x62696f00, 41341, 3, 1, 1815, 0},
+    {0x62697a00, 38535, 3, 1, 1815, 15},
+    {0x626a0000, 7133, 2, 1, 1830, 21},
+    {0x626c6163, 9859, 5, 1, 1851, 0},
+    {0x626c6163, 12742, 11, 1, 1851, 0},
+    {0x626c6f63, 12753, 11, 1, 1851, 0},
+    {0x626c6f67, 3492, 4, 1, 1851, 0},
+    {0x626c6f6f, 19813, 9, 1, 1851, 0},
+    {0x626c7565, 23851, 4, 1, 1851, 0},
+    {0x626d0000, 6121, 2, 1, 1851, 5},
+    {0x626d7300, 42051, 3, 1, 1856, 0},
+    {0x626d7700, 42054, 3, 1, 1856, 0},
+    {0x626e0000, 4248, 2, 1, 1856, 6},
+    {0x626e7070, 16102, 10, 1, 1862, 0},
+    {0x626f0000, 887, 2, 1, 1862, 41},
+    {0x626f6174, 38550, 5, 1, 1903, 0},
+    {0x626f6568, 16112, 10, 1, 1903, 0},
+    {0x626f6661, 41038, 4, 1, 1903, 0},
+    {0x626f6d00, 32287, 3, 1, 1903, 0},
+    {0x626f6e64, 41050, 4, 1, 1903, 0},
+    {0x626f6f00, 4907, 3, 1, 1903, 0},
+    {0x626f6f6b, 4907, 4, 1, 1903, 0},
+    {0x626f6f6b, 29475, 7, 1, 1903, 0},
+    {0x626f7363, 38560, 5, 1, 1903, 0},
+    {0x626f7374, 34505, 6, 1, 1903, 0},
+    {0x626f7374, 34511, 6, 1, 1903, 0},
+    {0x626f7400, 4392, 3, 1, 1903, 0},
+    {0x626f7574, 24007, 8, 1, 1903, 0},
+    {0x626f7800, 16069, 3, 1, 1903, 0},
+    {0x62720000, 750, 2, 1, 1903, 141},
+    {0x62726164, 24015, 8, 1, 2044, 0},
+    {0x62726964, 12786, 11, 1, 2044, 0},
+    {0x62726f61, 24039, 8, 1, 2044, 0},
+    {0x62726f6b, 34529, 6, 1, 2044, 0},
+    {0x62726f74, 29517, 7, 1, 2044, 0},
+    {0x62727573, 24055, 8, 1, 2044, 0},
+    {0x62730000, 125, 2, 1, 2044, 6},
+    {0x62740000, 4080, 2, 1, 2050, 5},
+    {0x6275696c, 12988, 5, 1, 2055, 0},
+    {0x6275696c, 14517, 8, 1, 2055, 1},
+    {0x62757369, 24079, 8, 1, 2056, 1},
+    {0x62757900, 16142, 3, 1, 2057, 0},
+    {0x62757a7a, 41058, 4, 1, 2057, 0},
+    {0x62760000, 7019, 2, 1, 2057, 0},
+    {0x62770000, 28822, 2, 1, 2057, 2},
+    {0x62790000, 1993, 2, 1, 2059, 6},
+    {0x627a0000, 42060, 2, 1, 2065, 7},
+    {0x627a6800, 42060, 3, 1, 2072, 0},
+    {0x63610000, 25, 2, 1, 2072, 21},
+    {0x63616200, 12819, 3, 1, 2093, 0},
+    {0x63616665, 41066, 4, 1, 2093, 0},
+    {0x63616c00, 2686, 3, 1, 2093, 0},
+    {0x63616c6c, 41070, 4, 1, 2093, 0},
+    {0x63616c76, 12830, 11, 1, 2093, 0},
+    {0x63616d00, 3814, 3, 1, 2093, 0},
+    {0x63616d65, 3814, 6, 1, 2093, 0},
+    {0x63616d70, 4452, 4, 1, 2093, 0},
+    {0x63616e6f, 38595, 5, 1, 2093, 0},
+    {0x63617065, 24151, 8, 1, 2093, 0},
+    {0x63617069, 16202, 7, 1, 2093, 0},
+    {0x63617069, 16202, 10, 1, 2093, 0},
+    {0x63617200, 2594, 3, 1, 2093, 0},
+    {0x63617261, 29573, 7, 1, 2093, 0},
+    {0x63617264, 38605, 5, 1, 2093, 0},
+    {0x63617265, 2652, 4, 1, 2093, 0},
+    {0x63617265, 29580, 6, 1, 2093, 0},
+    {0x63617265, 29580, 7, 1, 2093, 0},
+    {0x63617273, 10479, 4, 1, 2093, 0},
+    {0x63617361, 6163, 4, 1, 2093, 1},
+    {0x63617365, 29601, 4, 1, 2094, 0},
+    {0x63617368, 17305, 4, 1, 2094, 0},
+    {0x63617369, 34565, 6, 1, 2094, 0},
+    {0x63617400, 88, 3, 1, 2094, 0},
+    {0x63617465, 24159, 8, 1, 2094, 0},
+    {0x63617468, 24167, 8, 1, 2094, 0},
+    {0x63626100, 943, 3, 1, 2094, 0},
+    {0x63626e00, 42072, 3, 1, 2094, 0},
+    {0x63627265, 41074, 4, 1, 2094, 0},
+    {0x63627300, 42075, 3, 1, 2094, 0},
+    {0x63630000, 456, 2, 1, 2094, 9},
+    {0x63640000, 563, 2, 1, 2103, 1},
+    {0x63656e74, 6269, 6, 1, 2104, 0},
+    {0x63656f00, 42078, 3, 1, 2104, 0},
+    {0x6365726e, 10948, 4, 1, 2104, 0},
+    {0x63660000, 5448, 2, 1, 2104, 1},
+    {0x63666100, 10038, 3, 1, 2105, 0},
+    {0x63666400, 42081, 3, 1, 2105, 0},
+    {0x63670000, 5710, 2, 1, 2105, 0},
+    {0x63680000, 36, 2, 1, 2105, 13},
+    {0x6368616e, 34583, 6, 1, 2118, 0},
+    {0x6368616e, 6254, 7, 1, 2118, 0},
+    {0x63686172, 29650, 7, 1, 2118, 0},
+    {0x63686173, 38620, 5, 1, 2118, 0},
+    {0x63686174, 12863, 4, 1, 2118, 0},
+    {0x63686561, 38625, 5, 1, 2118, 0},
+    {0x6368696e, 29699, 7, 1, 2118, 0},
+    {0x63687269, 19975, 9, 1, 2118, 0},
+    {0x6368726f, 34619, 6, 1, 2118, 0},
+    {0x63687572, 34625, 6, 1, 2118, 0},
+    {0x63690000, 457, 2, 1, 2118, 17},
+    {0x63697072, 24239, 8, 1, 2135, 0},
+    {0x63697263, 34637, 6, 1, 2135, 0},
+    {0x63697363, 11270, 5, 1, 2135, 0},
+    {0x63697461, 29748, 7, 1, 2135, 0},
+    {0x63697469, 38650, 4, 1, 2135, 0},
+    {0x63697469, 38650, 5, 1, 2135, 0},
+    {0x63697479, 21447, 4, 1, 2135, 0},
+    {0x63697479, 24247, 8, 1, 2135, 0},
+    {0x636b0000, 2937, 2, 2, 2135, 1},
+    {0x636c0000, 547, 2, 1, 2136, 5},
+    {0x636c6169, 34649, 6, 1, 2141, 0},
+    {0x636c6561, 24263, 8, 1, 2141, 0},
+    {0x636c6963, 9955, 5, 1, 2141, 0},
+    {0x636c696e, 34655, 6, 1, 2141, 0},
+    {0x636c696e, 24271, 8, 1, 2141, 0},
+    {0x636c6f74, 24279, 8, 1, 2141, 0},
+    {0x636c6f75, 2555, 5, 1, 2141, 27},
+    {0x636c7562, 23699, 4, 1, 2168, 3},
+    {0x636c7562, 29783, 7, 1, 2171, 0},
+    {0x636d0000, 13874, 2, 1, 2171, 4},
+    {0x636e0000, 6219, 2, 1, 2175, 47},
+    {0x636f0000, 4, 2, 1, 2222, 23},
+    {0x636f6163, 38655, 5, 1, 2245, 0},
+    {0x636f6465, 24303, 5, 1, 2245, 1},
+    {0x636f6666, 34667, 6, 1, 2246, 0},
+    {0x636f6c6c, 10284, 7, 1, 2246, 0},
+    {0x636f6c6f, 29804, 7, 1, 2246, 0},
+    {0x636f6d00, 19, 3, 1, 2246, 399},
+    {0x636f6d63, 29811, 7, 1, 2645, 0},
+    {0x636f6d6d, 24319, 8, 1, 2645, 0},
+    {0x636f6d6d, 7921, 9, 1, 2645, 3},
+    {0x636f6d70, 29825, 7, 1, 2648, 0},
+    {0x636f6d70, 29832, 7, 1, 2648, 0},
+    {0x636f6d70, 4542, 8, 1, 2648, 0},
+    {0x636f6d73, 34673, 6, 1, 2648, 0},
+    {0x636f6e64, 34679, 6, 1, 2648, 0},
+    {0x636f6e73, 9967, 12, 1, 2648, 0},
+    {0x636f6e73, 16372, 10, 1, 2648, 0},
+    {0x636f6e74, 29839, 7, 1, 2648, 0},
+    {0x636f6e74, 12907, 11, 1, 2648, 0},
+    {0x636f6f6b, 6247, 7, 1, 2648, 0},
+    {0x636f6f6b, 6247, 14, 1, 2648, 0},
+    {0x636f6f6c, 24335, 4, 1, 2648, 2},
+    {0x636f6f70, 12918, 4, 1, 2650, 0},
+    {0x636f7273, 29853, 7, 1, 2650, 0},
+    {0x636f756e, 5384, 7, 1, 2650, 0},
+    {0x636f7570, 29888, 6, 1, 2650, 0},
+    {0x636f7570, 29888, 7, 1, 2650, 0},
+    {0x636f7572, 29895, 7, 1, 2650, 0},
+    {0x63706100, 22116, 3, 1, 2650, 0},
+    {0x63720000, 5582, 2, 1, 2650, 7},
+    {0x63726564, 12940, 6, 1, 2657, 0},
+    {0x63726564, 16392, 10, 1, 2657, 0},
+    {0x63726564, 12940, 11, 1, 2657, 0},
+    {0x63726963, 29909, 7, 1, 2657, 0},
+    {0x63726f77, 38665, 5, 1, 2657, 0},
+    {0x63727300, 42105, 3, 1, 2657, 0},
+    {0x63727569, 29923, 6, 1, 2657, 0},
+    {0x63727569, 29923, 7, 1, 2657, 0},
+    {0x63750000, 2045, 2, 1, 2657, 6},
+    {0x63756973, 16402, 10, 1, 2663, 0},
+    {0x63760000, 4279, 2, 1, 2663, 6},
+    {0x63770000, 11682, 2, 1, 2669, 4},
+    {0x63780000, 1725, 2, 1, 2673, 3},
+    {0x63790000, 10029, 2, 1, 2676, 12},
+    {0x63796d72, 38680, 5, 1, 2688, 0},
+    {0x63796f75, 41114, 4, 1, 2688, 0},
+    {0x637a0000, 15089, 2, 1, 2688, 6},
+    {0x64616275, 38690, 5, 1, 2694, 0},
+    {0x64616400, 16470, 3, 1, 2694, 0},
+    {0x64616e63, 38710, 5, 1, 2694, 0},
+    {0x64617461, 8970, 4, 1, 2694, 0},
+    {0x64617465, 6593, 4, 1, 2694, 0},
+    {0x64617469, 34733, 6, 1, 2694, 0},
+    {0x64617473, 34739, 6, 1, 2694, 0},
+    {0x64617900, 12750, 3, 1, 2694, 0},
+    {0x64636c6b, 41118, 4, 1, 2694, 0},
+    {0x64647300, 42111, 3, 1, 2694, 0},
+    {0x64650000, 48, 2, 1, 2694, 71},
+    {0x6465616c, 34751, 4, 1, 2765, 0},
+    {0x6465616c, 34751, 6, 1, 2765, 0},
+    {0x6465616c, 38725, 5, 1, 2765, 0},
+    {0x64656772, 34769, 6, 1, 2765, 0},
+    {0x64656c69, 24447, 8, 1, 2765, 0},
+    {0x64656c6c, 744, 4, 1, 2765, 0},
+    {0x64656c6f, 24455, 8, 1, 2765, 0},
+    {0x64656c74, 38740, 5, 1, 2765, 0},
+    {0x64656d6f, 8303, 8, 1, 2765, 0},
+    {0x64656e74, 34775, 6, 1, 2765, 0},
+    {0x64656e74, 48, 7, 1, 2765, 0},
+    {0x64657369, 6703, 4, 1, 2765, 0},
+    {0x64657369, 6703, 6, 1, 2765, 1},
+    {0x64657600, 4572, 3, 1, 2766, 23},
+    {0x64686c00, 42114, 3, 1, 2789, 0},
+    {0x6469616d, 24463, 8, 1, 2789, 0},
+    {0x64696574, 41130, 4, 1, 2789, 0},
+    {0x64696769, 1914, 7, 1, 2789, 1},
+    {0x64697265, 2806, 6, 1, 2790, 0},
+    {0x64697265, 2806, 9, 1, 2790, 0},
+    {0x64697363, 24479, 8, 1, 2790, 0},
+    {0x64697363, 20065, 8, 1, 2790, 0},
+    {0x64697368, 41134, 4, 1, 2790, 0},
+    {0x64697900, 42117, 3, 1, 2790, 0},
+    {0x646a0000, 4213, 2, 1, 2790, 0},
+    {0x646b0000, 10650, 2, 1, 2790, 8},
+    {0x646d0000, 2102, 2, 1, 2798, 5},
+    {0x646e7000, 42120, 3, 1, 2803, 0},
+    {0x646f0000, 3470, 2, 1, 2803, 10},
+    {0x646f6373, 14322, 4, 1, 2813, 0},
+    {0x646f6374, 13528, 6, 1, 2813, 0},
+    {0x646f6700, 4851, 3, 1, 2813, 0},
+    {0x646f6d61, 30007, 7, 1, 2813, 0},
+    {0x646f7400, 33446, 3, 1, 2813, 0},
+    {0x646f776e, 24511, 8, 1, 2813, 0},
+    {0x64726976, 10982, 5, 1, 2813, 0},
+    {0x64747600, 14655, 3, 1, 2813, 0},
+    {0x64756261, 38775, 5, 1, 2813, 0},
+    {0x64756e6c, 34823, 6, 1, 2813, 0},
+    {0x6475706f, 34829, 6, 1, 2813, 0},
+    {0x64757262, 34835, 6, 1, 2813, 0},
+    {0x64766167, 41142, 4, 1, 2813, 0},
+    {0x64767200, 12860, 3, 1, 2813, 0},
+    {0x647a0000, 7419, 2, 1, 2813, 10},
+    {0x65617274, 38800, 5, 1, 2823, 1},
+    {0x65617400, 6345, 3, 1, 2824, 0},
+    {0x65630000, 18, 2, 1, 2824, 14},
+    {0x65636f00, 18, 3, 1, 2838, 0},
+    {0x6564656b, 38820, 5, 1, 2838, 0},
+    {0x65647500, 9778, 3, 1, 2838, 1},
+    {0x65647563, 9778, 9, 1, 2839, 1},
+    {0x65650000, 2100, 2, 1, 2840, 10},
+    {0x65670000, 4305, 2, 1, 2850, 9},
+    {0x656d6169, 8147, 5, 1, 2859, 0},
+    {0x656d6572, 34901, 6, 1, 2859, 0},
+    {0x656e6572, 34907, 6, 1, 2859, 0},
+    {0x656e6769, 6645, 8, 1, 2859, 0},
+    {0x656e6769, 13149, 11, 1, 2859, 0},
+    {0x656e7465, 13160, 11, 1, 2859, 0},
+    {0x6570736f, 38830, 5, 1, 2859, 0},
+    {0x65717569, 8094, 9, 1, 2859, 0},
+    {0x65720000, 112, 2, 2, 2859, 0},
+    {0x65726963, 24647, 8, 1, 2859, 0},
+    {0x65726e69, 13994, 4, 1, 2859, 0},
+    {0x65730000, 27, 2, 1, 2859, 7},
+    {0x65737100, 42132, 3, 1, 2866, 0},
+    {0x65737461, 5391, 6, 1, 2866, 1},
+    {0x65740000, 642, 2, 1, 2867, 8},
+    {0x65746973, 24655, 8, 1, 2875, 0},
+    {0x65750000, 766, 2, 1, 2875, 9},
+    {0x6575726f, 16612, 10, 1, 2884, 0},
+    {0x65757300, 766, 3, 1, 2884, 1},
+    {0x6576656e, 34925, 6, 1, 2885, 2},
+    {0x65786368, 8836, 8, 1, 2887, 0},
+    {0x65787065, 1950, 6, 1, 2887, 0},
+    {0x6578706f, 30210, 7, 1, 2887, 0},
+    {0x65787072, 4355, 7, 1, 2887, 0},
+    {0x65787472, 16632, 10, 1, 2887, 0},
+    {0x66616765, 41178, 4, 1, 2887, 0},
+    {0x6661696c, 41182, 4, 1, 2887, 0},
+    {0x66616972, 20218, 9, 1, 2887, 0},
+    {0x66616974, 38850, 5, 1, 2887, 1},
+    {0x66616d69, 6017, 6, 1, 2888, 0},
+    {0x66616e00, 4929, 3, 1, 2888, 0},
+    {0x66616e73, 41186, 4, 1, 2888, 0},
+    {0x6661726d, 8090, 4, 1, 2888, 1},
+    {0x6661726d, 30231, 7, 1, 2889, 0},
+    {0x66617368, 10039, 7, 1, 2889, 0},
+    {0x66617374, 3500, 4, 1, 2889, 0},
+    {0x66656465, 38865, 5, 1, 2889, 0},
+    {0x66656564, 24695, 8, 1, 2889, 0},
+    {0x66657272, 30252, 7, 1, 2889, 0},
+    {0x66657272, 30259, 7, 1, 2889, 0},
+    {0x66690000, 720, 2, 1, 2889, 10},
+    {0x66696174, 41194, 4, 1, 2899, 0},
+    {0x66696465, 24719, 8, 1, 2899, 0},
+    {0x6669646f, 41198, 4, 1, 2899, 0},
+    {0x66696c6d, 41202, 4, 1, 2899, 0},
+    {0x66696e61, 38890, 5, 1, 2899, 0},
+    {0x66696e61, 30273, 7, 1, 2899, 0},
+    {0x66696e61, 720, 9, 1, 2899, 1},
+    {0x66697265, 3532, 4, 1, 2900, 0},
+    {0x66697265, 20245, 9, 1, 2900, 0},
+    {0x6669726d, 24743, 8, 1, 2900, 0},
+    {0x66697368, 30308, 4, 1, 2900, 0},
+    {0x66697368, 30308, 7, 1, 2900, 0},
+    {0x66697400, 30315, 3, 1, 2900, 0},
+    {0x6669746e, 30315, 7, 1, 2900, 0},
+    {0x666a0000, 4083, 2, 1, 2900, 10},
+    {0x666b0000, 41389, 2, 2, 2910, 0},
+    {0x666c6963, 34967, 6, 1, 2910, 0},
+    {0x666c6967, 30322, 7, 1, 2910, 0},
+    {0x666c6972, 41210, 4, 1, 2910, 0},
+    {0x666c6f72, 30343, 7, 1, 2910, 0},
+    {0x666c6f77, 30350, 7, 1, 2910, 0},
+    {0x666c7900, 10063, 3, 1, 2910, 0},
+    {0x666d0000, 20844, 2, 1, 2910, 6},
+    {0x666f0000, 1642, 2, 1, 2916, 0},
+    {0x666f6f00, 13281, 3, 1, 2916, 0},
+    {0x666f6f64, 13281, 4, 1, 2916, 0},
+    {0x666f6f64, 13281, 11, 1, 2916, 0},
+    {0x666f6f74, 24783, 8, 1, 2916, 0},
+    {0x666f7264, 34802, 4, 1, 2916, 0},
+    {0x666f7265, 38920, 5, 1, 2916, 0},
+    {0x666f7273, 30378, 7, 1, 2916, 0},
+    {0x666f7275, 21608, 5, 1, 2916, 0},
+    {0x666f756e, 16672, 10, 1, 2916, 0},
+    {0x666f7800, 42153, 3, 1, 2916, 0},
+    {0x66720000, 61, 2, 1, 2916, 34},
+    {0x66726565, 13068, 4, 1, 2950, 0},
+    {0x66726573, 20317, 9, 1, 2950, 0},
+    {0x66726c00, 42159, 3, 1, 2950, 0},
+    {0x66726f67, 30406, 7, 1, 2950, 0},
+    {0x66726f6e, 20326, 9, 1, 2950, 0},
+    {0x66726f6e, 24847, 8, 1, 2950, 0},
+    {0x66747200, 42165, 3, 1, 2950, 0},
+    {0x66756a69, 30805, 7, 1, 2950, 0},
+    {0x66756e00, 6210, 3, 1, 2950, 0},
+    {0x66756e64, 24919, 4, 1, 2950, 0},
+    {0x6675726e, 20407, 9, 1, 2950, 0},
+    {0x66757462, 35033, 6, 1, 2950, 0},
+    {0x66796900, 42171, 3, 1, 2950, 0},
+    {0x67610000, 471, 2, 1, 2950, 0},
+    {0x67616c00, 2542, 3, 1, 2950, 0},
+    {0x67616c6c, 15965, 7, 1, 2950, 0},
+    {0x67616c6c, 38965, 5, 1, 2950, 0},
+    {0x67616c6c, 35045, 6, 1, 2950, 0},
+    {0x67616d65, 3339, 4, 1, 2950, 0},
+    {0x67616d65, 8384, 5, 1, 2950, 0},
+    {0x67617000, 42177, 3, 1, 2950, 0},
+    {0x67617264, 4401, 6, 1, 2950, 0},
+    {0x67617900, 21231, 3, 1, 2950, 0},
+    {0x67620000, 349, 2, 1, 2950, 0},
+    {0x6762697a, 41238, 4, 1, 2950, 0},
+    {0x67640000, 4787, 2, 1, 2950, 2},
+    {0x67646e00, 29450, 3, 1, 2952, 1},
+    {0x67650000, 324, 2, 1, 2953, 7},
+    {0x67656100, 3360, 3, 1, 2960, 0},
+    {0x67656e74, 4631, 4, 1, 2960, 0},
+    {0x67656e74, 30854, 7, 1, 2960, 0},
+    {0x67656f72, 35099, 6, 1, 2960, 0},
+    {0x67660000, 1046, 2, 1, 2960, 0},
+    {0x67670000, 1673, 2, 1, 2960, 6},
+    {0x67676565, 41242, 4, 1, 2966, 0},
+    {0x67680000, 30, 2, 1, 2966, 5},
+    {0x67690000, 42, 2, 1, 2971, 6},
+    {0x67696674, 38980, 4, 1, 2977, 0},
+    {0x67696674, 38980, 5, 1, 2977, 0},
+    {0x67697665, 39005, 5, 1, 2977, 0},
+    {0x67697669, 35123, 6, 1, 2977, 0},
+    {0x676c0000, 913, 2, 1, 2977, 7},
+    {0x676c6173, 39010, 5, 1, 2984, 0},
+    {0x676c6500, 2604, 3, 1, 2984, 0},
+    {0x676c6f62, 990, 6, 1, 2984, 0},
+    {0x676c6f62, 39015, 5, 1, 2984, 0},
+    {0x676d0000, 3803, 2, 1, 2984, 0},
+    {0x676d6169, 39020, 5, 1, 2984, 0},
+    {0x676d6268, 41254, 4, 1, 2984, 0},
+    {0x676d6f00, 21729, 3, 1, 2984, 0},
+    {0x676d7800, 4106, 3, 1, 2984, 0},
+    {0x676e0000, 344, 2, 1, 2984, 6},
+    {0x676f6461, 30945, 7, 1, 2990, 0},
+    {0x676f6c64, 20479, 4, 1, 2990, 0},
+    {0x676f6c64, 20479, 9, 1, 2990, 0},
+    {0x676f6c66, 30959, 4, 1, 2990, 0},
+    {0x676f6f00, 10503, 3, 1, 2990, 0},
+    {0x676f6f64, 24991, 8, 1, 2990, 0},
+    {0x676f6f67, 16752, 4, 1, 2990, 3},
+    {0x676f6f67, 16752, 6, 1, 2993, 0},
+    {0x676f7000, 42183, 3, 1, 2993, 0},
+    {0x676f7400, 11355, 3, 1, 2993, 0},
+    {0x676f7600, 810, 3, 1, 2993, 0},
+    {0x67700000, 4263, 2, 1, 2993, 7},
+    {0x67710000, 3201, 2, 1, 3000, 0},
+    {0x67720000, 2757, 2, 1, 3000, 7},
+    {0x67726169, 24999, 8, 1, 3007, 0},
+    {0x67726170, 25007, 8, 1, 3007, 0},
+    {0x67726174, 35183, 6, 1, 3007, 0},
+    {0x67726565, 16987, 5, 1, 3007, 0},
+    {0x67726970, 39060, 5, 1, 3007, 0},
+    {0x67726f63, 31029, 7, 1, 3007, 0},
+    {0x67726f75, 11702, 5, 1, 3007, 1},
+    {0x67730000, 3101, 2, 1, 3008, 0},
+    {0x67740000, 3947, 2, 1, 3008, 10},
+    {0x67750000, 3231, 2, 1, 3018, 8},
+    {0x67756172, 25031, 8, 1, 3026, 0},
+    {0x67756363, 39070, 5, 1, 3026, 0},
+    {0x67756765, 41290, 4, 1, 3026, 0},
+    {0x67756964, 39075, 5, 1, 3026, 0},
+    {0x67756974, 31043, 7, 1, 3026, 0},
+    {0x67757275, 20835, 4, 1, 3026, 0},
+    {0x67770000, 11718, 2, 1, 3026, 0},
+    {0x67790000, 1233, 2, 1, 3026, 7},
+    {0x68616972, 3307, 4, 1, 3033, 0},
+    {0x68616d62, 31106, 7, 1, 3033, 0},
+    {0x68616e67, 31120, 7, 1, 3033, 0},
+    {0x68617573, 29380, 4, 1, 3033, 0},
+    {0x68626f00, 38549, 3, 1, 3033, 0},
+    {0x68646663, 25127, 4, 1, 3033, 0},
+    {0x68646663, 25127, 8, 1, 3033, 0},
+    {0x6865616c, 229, 6, 1, 3033, 1},
+    {0x6865616c, 16842, 10, 1, 3034, 0},
+    {0x68656c70, 41302, 4, 1, 3034, 0},
+    {0x68656c73, 25135, 8, 1, 3034, 0},
+    {0x68657265, 1910, 4, 1, 3034, 0},
+    {0x6865726d, 35339, 6, 1, 3034, 0},
+    {0x68677476, 41306, 4, 1, 3034, 0},
+    {0x68697068, 35375, 6, 1, 3034, 0},
+    {0x68697361, 20641, 9, 1, 3034, 0},
+    {0x68697461, 10231, 7, 1, 3034, 0},
+    {0x68697600, 19945, 3, 1, 3034, 0},
+    {0x686b0000, 1753, 2, 1, 3034, 25},
+    {0x686b7400, 42195, 3, 1, 3059, 0},
+    {0x686d0000, 1711, 2, 1, 3059, 0},
+    {0x686e0000, 5521, 2, 1, 3059, 7},
+    {0x686f636b, 8406, 6, 1, 3066, 0},
+    {0x686f6c64, 25239, 8, 1, 3066, 0},
+    {0x686f6c69, 31176, 7, 1, 3066, 0},
+    {0x686f6d65, 20659, 9, 1, 3066, 0},
+    {0x686f6d65, 20668, 9, 1, 3066, 0},
+    {0x686f6d65, 4857, 5, 1, 3066, 0},
+    {0x686f6d65, 20686, 9, 1, 3066, 0},
+    {0x686f6e64, 39155, 5, 1, 3066, 0},
+    {0x686f7273, 39170, 5, 1, 3066, 0},
+    {0x686f7370, 25303, 8, 1, 3066, 0},
+    {0x686f7374, 1986, 4, 1, 3066, 11},
+    {0x686f7374, 4872, 7, 1, 3077, 1},
+    {0x686f7400, 2753, 3, 1, 3078, 0},
+    {0x686f7465, 31204, 7, 1, 3078, 0},
+    {0x686f7465, 13715, 6, 1, 3078, 0},
+    {0x686f746d, 31211, 7, 1, 3078, 0},
+    {0x686f7573, 6493, 5, 1, 3078, 0},
+    {0x686f7700, 11413, 3, 1, 3078, 0},
+    {0x68720000, 6192, 2, 1, 3078, 6},
+    {0x68736263, 41322, 4, 1, 3084, 0},
+    {0x68740000, 4900, 2, 1, 3084, 17},
+    {0x68750000, 1300, 2, 1, 3101, 32},
+    {0x68756768, 35429, 6, 1, 3133, 0},
+    {0x68796174, 39180, 5, 1, 3133, 0},
+    {0x6879756e, 31225, 7, 1, 3133, 0},
+    {0x69626d00, 42201, 3, 1, 3133, 0},
+    {0x69636263, 41330, 4, 1, 3133, 0},
+    {0x69636500, 3673, 3, 1, 3133, 0},
+    {0x69637500, 12569, 3, 1, 3133, 0},
+    {0x69640000, 458, 2, 1, 3133, 14},
+    {0x69650000, 43, 2, 1, 3147, 3},
+    {0x69656565, 41334, 4, 1, 3150, 0},
+    {0x69666d00, 41516, 3, 1, 3150, 0},
+    {0x696b616e, 31546, 5, 1, 3150, 0},
+    {0x696c0000, 1036, 2, 1, 3150, 8},
+    {0x696d0000, 2668, 2, 1, 3158, 8},
+    {0x696d616d, 35495, 6, 1, 3166, 0},
+    {0x696d6462, 41338, 4, 1, 3166, 0},
+    {0x696d6d6f, 16952, 4, 1, 3166, 0},
+    {0x696d6d6f, 16952, 10, 1, 3166, 0},
+    {0x696e0000, 204, 2, 1, 3166, 46},
+    {0x696e6300, 12839, 3, 1, 3212, 0},
+    {0x696e6475, 16972, 10, 1, 3212, 0},
+    {0x696e6669, 25359, 8, 1, 3212, 0},
+    {0x696e666f, 21606, 4, 1, 3212, 21},
+    {0x696e6700, 984, 3, 1, 3233, 0},
+    {0x696e6b00, 6710, 3, 1, 3233, 0},
+    {0x696e7374, 20803, 9, 1, 3233, 0},
+    {0x696e7375, 235, 9, 1, 3233, 0},
+    {0x696e7375, 35519, 6, 1, 3233, 0},
+    {0x696e7400, 2022, 3, 1, 3233, 1},
+    {0x696e7465, 8285, 13, 1, 3234, 0},
+    {0x696e7475, 35525, 6, 1, 3234, 0},
+    {0x696e7665, 13512, 11, 1, 3234, 0},
+    {0x696f0000, 9, 2, 1, 3234, 72},
+    {0x69706972, 25375, 8, 1, 3306, 0},
+    {0x69710000, 3351, 2, 1, 3306, 6},
+    {0x69720000, 38, 2, 1, 3312, 9},
+    {0x69726973, 27836, 5, 1, 3321, 0},
+    {0x69730000, 52, 2, 1, 3321, 8},
+    {0x69736d61, 31386, 7, 1, 3329, 0},
+    {0x69737400, 52, 3, 1, 3329, 0},
+    {0x69737461, 25439, 8, 1, 3329, 0},
+    {0x69740000, 127, 2, 1, 3329, 417},
+    {0x69746175, 31702, 4, 1, 3746, 0},
+    {0x69747600, 42210, 3, 1, 3746, 0},
+    {0x6a616775, 35549, 6, 1, 3746, 0},
+    {0x6a617661, 41354, 4, 1, 3746, 0},
+    {0x6a636200, 42213, 3, 1, 3746, 0},
+    {0x6a650000, 933, 2, 1, 3746, 4},
+    {0x6a656570, 41358, 4, 1, 3750, 0},
+    {0x6a65747a, 39295, 5, 1, 3750, 0},
+    {0x6a657765, 31477, 7, 1, 3750, 0},
+    {0x6a696f00, 30800, 3, 1, 3750, 0},
+    {0x6a6c6c00, 42225, 3, 1, 3750, 0},
+    {0x6a6d0000, 12408, 2, 2, 3750, 0},
+    {0x6a6d7000, 42228, 3, 1, 3750, 0},
+    {0x6a6e6a00, 42231, 3, 1, 3750, 0},
+    {0x6a6f0000, 1751, 2, 1, 3750, 8},
+    {0x6a6f6273, 41366, 4, 1, 3758, 0},
+    {0x6a6f6275, 35567, 6, 1, 3758, 0},
+    {0x6a6f7400, 25535, 3, 1, 3758, 0},
+    {0x6a6f7900, 35591, 3, 1, 3758, 0},
+    {0x6a700000, 6664, 2, 1, 3758, 223},
+    {0x6a706d6f, 25543, 8, 1, 3981, 0},
+    {0x6a707273, 41382, 4, 1, 3981, 0},
+    {0x6a756567, 35597, 6, 1, 3981, 0},
+    {0x6a756e69, 31498, 7, 1, 3981, 0},
+    {0x6b617566, 35693, 6, 1, 3981, 0},
+    {0x6b646469, 41398, 4, 1, 3981, 0},
+    {0x6b650000, 2164, 2, 1, 3981, 9},
+    {0x6b657272, 13710, 11, 1, 3990, 0},
+    {0x6b657272, 6667, 14, 1, 3990, 0},
+    {0x6b657272, 5037, 15, 1, 3990, 0},
+    {0x6b666800, 42243, 3, 1, 3990, 0},
+    {0x6b670000, 16735, 2, 1, 3990, 12},
+    {0x6b680000, 2938, 2, 2, 4002, 0},
+    {0x6b690000, 2304, 2, 1, 4002, 7},
+    {0x6b696100, 19469, 3, 1, 4009, 0},
+    {0x6b696473, 33482, 4, 1, 4009, 0},
+    {0x6b696d00, 17420, 3, 1, 4009, 0},
+    {0x6b696e64, 35759, 6, 1, 4009, 0},
+    {0x6b696e64, 35765, 6, 1, 4009, 0},
+    {0x6b697463, 31708, 7, 1, 4009, 0},
+    {0x6b697769, 41418, 4, 1, 4009, 0},
+    {0x6b6d0000, 17471, 2, 1, 4009, 17},
+    {0x6b6e0000, 1018, 2, 1, 4026, 4},
+    {0x6b6f656c, 39370, 5, 1, 4030, 0},
+    {0x6b6f6d61, 10627, 7, 1, 4030, 0},
+    {0x6b6f7368, 35831, 6, 1, 4030, 0},
+    {0x6b700000, 9838, 2, 1, 4030, 6},
+    {0x6b706d67, 41438, 4, 1, 4036, 0},
+    {0x6b706e00, 42246, 3, 1, 4036, 0},
+    {0x6b720000, 1749, 2, 1, 4036, 30},
+    {0x6b726400, 3159, 3, 1, 4066, 2},
+    {0x6b726564, 41442, 4, 1, 4068, 0},
+    {0x6b756f6b, 21289, 9, 1, 4068, 0},
+    {0x6b770000, 5426, 2, 1, 4068, 7},
+    {0x6b790000, 6712, 2, 1, 4075, 4},
+    {0x6b796f74, 39440, 5, 1, 4079, 0},
+    {0x6b7a0000, 42477, 2, 1, 4079, 8},
+    {0x6c610000, 728, 2, 1, 4087, 10},
+    {0x6c616361, 31848, 7, 1, 4097, 0},
+    {0x6c616d62, 13743, 11, 1, 4097, 0},
+    {0x6c616d65, 39460, 5, 1, 4097, 0},
+    {0x6c616e63, 21370, 9, 1, 4097, 0},
+    {0x6c616e63, 35927, 6, 1, 4097, 0},
+    {0x6c616e64, 875, 4, 1, 4097, 1},
+    {0x6c616e64, 21379, 9, 1, 4098, 0},
+    {0x6c616e78, 31869, 7, 1, 4098, 0},
+    {0x6c617361, 31890, 7, 1, 4098, 0},
+    {0x6c617400, 2441, 3, 1, 4098, 0},
+    {0x6c617469, 35957, 6, 1, 4098, 0},
+    {0x6c617472, 31897, 7, 1, 4098, 0},
+    {0x6c617700, 5271, 3, 1, 4098, 0},
+    {0x6c617779, 13561, 6, 1, 4098, 0},
+    {0x6c620000, 3387, 2, 1, 4098, 5},
+    {0x6c630000, 107, 2, 1, 4103, 7},
+    {0x6c647300, 22966, 3, 1, 4110, 0},
+    {0x6c656173, 39470, 5, 1, 4110, 0},
+    {0x6c65636c, 31925, 7, 1, 4110, 0},
+    {0x6c656672, 35975, 6, 1, 4110, 0},
+    {0x6c656761, 39485, 5, 1, 4110, 0},
+    {0x6c65676f, 41482, 4, 1, 4110, 0},
+    {0x6c657875, 39505, 5, 1, 4110, 0},
+    {0x6c676274, 41486, 4, 1, 4110, 0},
+    {0x6c690000, 698, 2, 1, 4110, 2},
+    {0x6c69646c, 41490, 4, 1, 4112, 0},
+    {0x6c696665, 8467, 4, 1, 4112, 0},
+    {0x6c696665, 8467, 13, 1, 4112, 0},
+    {0x6c696665, 21415, 9, 1, 4112, 0},
+    {0x6c696768, 26231, 8, 1, 4112, 0},
+    {0x6c696b65, 17342, 4, 1, 4112, 0},
+    {0x6c696c6c, 39510, 5, 1, 4112, 0},
+    {0x6c696d69, 31967, 7, 1, 4112, 0},
+    {0x6c696d6f, 41494, 4, 1, 4112, 0},
+    {0x6c696e63, 31974, 7, 1, 4112, 0},
+    {0x6c696e64, 21451, 5, 1, 4112, 0},
+    {0x6c696e6b, 6709, 4, 1, 4112, 3},
+    {0x6c697073, 39515, 5, 1, 4115, 0},
+    {0x6c697665, 1071, 4, 1, 4115, 1},
+    {0x6c697669, 5399, 6, 1, 4116, 0},
+    {0x6c6b0000, 3466, 2, 1, 4116, 15},
+    {0x6c6c6300, 41072, 3, 1, 4131, 0},
+    {0x6c6c7000, 42252, 3, 1, 4131, 0},
+    {0x6c6f616e, 19523, 4, 1, 4131, 0},
+    {0x6c6f616e, 39520, 5, 1, 4131, 0},
+    {0x6c6f636b, 36011, 6, 1, 4131, 0},
+    {0x6c6f6375, 39525, 5, 1, 4131, 0},
+    {0x6c6f6c00, 17362, 3, 1, 4131, 1},
+    {0x6c6f6e64, 36029, 6, 1, 4132, 0},
+    {0x6c6f7474, 4340, 5, 1, 4132, 0},
+    {0x6c6f7474, 39555, 5, 1, 4132, 0},
+    {0x6c6f7665, 10280, 4, 1, 4132, 0},
+    {0x6c706c00, 6881, 3, 1, 4132, 0},
+    {0x6c706c66, 10723, 12, 1, 4132, 0},
+    {0x6c720000, 4224, 2, 1, 4132, 5},
+    {0x6c730000, 505, 2, 1, 4137, 10},
+    {0x6c740000, 232, 2, 1, 4147, 2},
+    {0x6c746400, 33033, 3, 1, 4149, 0},
+    {0x6c746461, 33033, 4, 1, 4149, 0},
+    {0x6c750000, 1732, 2, 1, 4149, 2},
+    {0x6c756e64, 26295, 8, 1, 4151, 0},
+    {0x6c757865, 17392, 4, 1, 4151, 0},
+    {0x6c757875, 36059, 6, 1, 4151, 0},
+    {0x6c760000, 2301, 2, 1, 4151, 9},
+    {0x6c790000, 1791, 2, 1, 4160, 9},
+    {0x6d610000, 970, 2, 1, 4169, 6},
+    {0x6d616379, 39585, 5, 1, 4175, 0},
+    {0x6d616472, 36089, 6, 1, 4175, 0},
+    {0x6d616966, 41514, 4, 1, 4175, 0},
+    {0x6d616973, 4656, 6, 1, 4175, 0},
+    {0x6d616b65, 36101, 6, 1, 4175, 0},
+    {0x6d616e00, 5125, 3, 1, 4175, 0},
+    {0x6d616e61, 17442, 10, 1, 4175, 1},
+    {0x6d616e67, 39590, 5, 1, 4176, 0},
+    {0x6d617000, 36909, 3, 1, 4176, 0},
+    {0x6d61726b, 10321, 6, 1, 4176, 0},
+    {0x6d61726b, 21523, 9, 1, 4176, 0},
+    {0x6d61726b, 32093, 7, 1, 4176, 0},
+    {0x6d617272, 26359, 8, 1, 4176, 0},
+    {0x6d617273, 21541, 9, 1, 4176, 0},
+    {0x6d617365, 26391, 8, 1, 4176, 0},
+    {0x6d617474, 36167, 6, 1, 4176, 0},
+    {0x6d626100, 19686, 3, 1, 4176, 0},
+    {0x6d630000, 1647, 2, 1, 4176, 2},
+    {0x6d636b69, 26439, 8, 1, 4178, 0},
+    {0x6d640000, 17714, 2, 1, 4178, 5},
+    {0x6d650000, 102, 2, 1, 4183, 43},
+    {0x6d656400, 1498, 3, 1, 4226, 0},
+    {0x6d656469, 21595, 5, 1, 4226, 1},
+    {0x6d656574, 41526, 4, 1, 4227, 0},
+    {0x6d656c62, 21613, 9, 1, 4227, 0},
+    {0x6d656d65, 41530, 4, 1, 4227, 0},
+    {0x6d656d6f, 26455, 8, 1, 4227, 0},
+    {0x6d656e00, 102, 3, 1, 4227, 0},
+    {0x6d656e75, 41534, 4, 1, 4227, 1},
+    {0x6d657263, 26463, 8, 1, 4228, 0},
+    {0x6d670000, 323, 2, 1, 4228, 9},
+    {0x6d680000, 2661, 2, 1, 4237, 0},
+    {0x6d69616d, 39630, 5, 1, 4237, 0},
+    {0x6d696372, 21640, 9, 1, 4237, 0},
+    {0x6d696c00, 6019, 3, 1, 4237, 0},
+    {0x6d696e69, 17592, 4, 1, 4237, 0},
+    {0x6d696e74, 32184, 4, 1, 4237, 0},
+    {0x6d697400, 17586, 3, 1, 4237, 0},
+    {0x6d697473, 17602, 10, 1, 4237, 0},
+    {0x6d6b0000, 12143, 2, 1, 4237, 8},
+    {0x6d6c0000, 2440, 2, 1, 4245, 7},
+    {0x6d6c6200, 36377, 3, 1, 4252, 0},
+    {0x6d6c7300, 7455, 3, 1, 4252, 0},
+    {0x6d6d0000, 83, 2, 2, 4252, 0},
+    {0x6d6d6100, 10173, 3, 1, 4252, 0},
+    {0x6d6e0000, 5601, 2, 1, 4252, 4},
+    {0x6d6f0000, 736, 2, 1, 4256, 5},
+    {0x6d6f6269, 2103, 4, 1, 4261, 2},
+    {0x6d6f6269, 9829, 6, 1, 4263, 0},
+    {0x6d6f6461, 22516, 4, 1, 4263, 0},
+    {0x6d6f6500, 25681, 3, 1, 4263, 0},
+    {0x6d6f6900, 22534, 3, 1, 4263, 0},
+    {0x6d6f6d00, 26357, 3, 1, 4263, 0},
+    {0x6d6f6e61, 36413, 6, 1, 4263, 0},
+    {0x6d6f6e65, 39665, 5, 1, 4263, 0},
+    {0x6d6f6e73, 32226, 7, 1, 4263, 0},
+    {0x6d6f726d, 36425, 6, 1, 4263, 0},
+    {0x6d6f7274, 26631, 8, 1, 4263, 0},
+    {0x6d6f7363, 36431, 6, 1, 4263, 0},
+    {0x6d6f746f, 13930, 4, 1, 4263, 0},
+    {0x6d6f746f, 13930, 11, 1, 4263, 0},
+    {0x6d6f7600, 17642, 3, 1, 4263, 0},
+    {0x6d6f7669, 39670, 5, 1, 4263, 0},
+    {0x6d700000, 1960, 2, 1, 4263, 1},
+    {0x6d710000, 15233, 2, 1, 4264, 0},
+    {0x6d720000, 569, 2, 1, 4264, 2},
+    {0x6d730000, 578, 2, 1, 4266, 7},
+    {0x6d736400, 578, 3, 1, 4273, 0},
+    {0x6d740000, 1271, 2, 1, 4273, 4},
+    {0x6d746e00, 42255, 3, 1, 4277, 0},
+    {0x6d747200, 42258, 3, 1, 4277, 0},
+    {0x6d750000, 21, 2, 1, 4277, 7},
+    {0x6d757365, 1121, 6, 1, 4284, 546},
+    {0x6d757369, 8329, 5, 1, 4830, 0},
+    {0x6d757475, 2088, 6, 1, 4830, 0},
+    {0x6d760000, 3793, 2, 1, 4830, 14},
+    {0x6d770000, 38146, 2, 1, 4844, 11},
+    {0x6d780000, 4107, 2, 1, 4855, 6},
+    {0x6d790000, 2549, 2, 1, 4861, 9},
+    {0x6d7a0000, 35001, 2, 1, 4870, 8},
+    {0x6e610000, 722, 2, 1, 4878, 17},
+    {0x6e616200, 9857, 3, 1, 4895, 0},
+    {0x6e61676f, 36551, 6, 1, 4895, 0},
+    {0x6e616d65, 17722, 4, 1, 4895, 2},
+    {0x6e617475, 1107, 6, 1, 4897, 0},
+    {0x6e617679, 32600, 4, 1, 4897, 0},
+    {0x6e626100, 16001, 3, 1, 4897, 0},
+    {0x6e630000, 64, 2, 1, 4897, 2},
+    {0x6e650000, 703, 2, 1, 4899, 0},
+    {0x6e656300, 6940, 3, 1, 4899, 0},
+    {0x6e657400, 2944, 3, 1, 4899, 165},
+    {0x6e657462, 32373, 7, 1, 5064, 0},
+    {0x6e657466, 32380, 7, 1, 5064, 0},
+    {0x6e657477, 2944, 7, 1, 5064, 5},
+    {0x6e657573, 32394, 7, 1, 5069, 0},
+    {0x6e657700, 3936, 3, 1, 5069, 0},
+    {0x6e657773, 3936, 4, 1, 5069, 1},
+    {0x6e657874, 16631, 4, 1, 5070, 0},
+    {0x6e657874, 17762, 10, 1, 5070, 0},
+    {0x6e657875, 39790, 5, 1, 5070, 0},
+    {0x6e660000, 3523, 2, 1, 5070, 10},
+    {0x6e666c00, 10976, 3, 1, 5080, 0},
+    {0x6e670000, 334, 2, 1, 5080, 15},
+    {0x6e676f00, 12810, 3, 1, 5095, 0},
+    {0x6e686b00, 42267, 3, 1, 5095, 0},
+    {0x6e690000, 23, 2, 1, 5095, 14},
+    {0x6e69636f, 37932, 4, 1, 5109, 0},
+    {0x6e696b65, 41594, 4, 1, 5109, 0},
+    {0x6e696b6f, 39810, 5, 1, 5109, 0},
+    {0x6e696e6a, 39815, 5, 1, 5109, 0},
+    {0x6e697373, 36671, 6, 1, 5109, 0},
+    {0x6e697373, 36677, 6, 1, 5109, 0},
+    {0x6e6c0000, 5838, 2, 1, 5109, 10},
+    {0x6e6f0000, 134, 2, 1, 5119, 728},
+    {0x6e6f6b69, 39830, 5, 1, 5847, 0},
+    {0x6e6f7274, 2076, 18, 1, 5847, 0},
+    {0x6e6f7274, 36707, 6, 1, 5847, 0},
+    {0x6e6f7700, 1019, 3, 1, 5847, 0},
+    {0x6e6f7772, 36719, 6, 1, 5847, 0},
+    {0x6e6f7774, 39835, 5, 1, 5847, 0},
+    {0x6e700000, 3867, 2, 2, 5847, 0},
+    {0x6e720000, 1304, 2, 1, 5847, 7},
+    {0x6e726100, 1304, 3, 1, 5854, 0},
+    {0x6e727700, 42279, 3, 1, 5854, 0},
+    {0x6e747400, 5731, 3, 1, 5854, 0},
+    {0x6e750000, 4954, 2, 1, 5854, 4},
+    {0x6e796300, 29830, 3, 1, 5858, 0},
+    {0x6e7a0000, 738, 2, 1, 5858, 16},
+    {0x6f626900, 2104, 3, 1, 5874, 0},
+    {0x6f627365, 27103, 8, 1, 5874, 0},
+    {0x6f666669, 7993, 6, 1, 5874, 0},
+    {0x6f6b696e, 32583, 7, 1, 5874, 0},
+    {0x6f6c6179, 14073, 6, 1, 5874, 0},
+    {0x6f6c6179, 14073, 11, 1, 5874, 0},
+    {0x6f6c646e, 32597, 7, 1, 5874, 0},
+    {0x6f6c6c6f, 41646, 4, 1, 5874, 0},
+    {0x6f6d0000, 20, 2, 1, 5874, 9},
+    {0x6f6d6567, 39920, 5, 1, 5883, 0},
+    {0x6f6e6500, 4660, 3, 1, 5883, 3},
+    {0x6f6e6700, 13400, 3, 1, 5886, 0},
+    {0x6f6e696f, 39930, 5, 1, 5886, 0},
+    {0x6f6e6c00, 6871, 3, 1, 5886, 0},
+    {0x6f6e6c69, 6871, 6, 1, 5886, 3},
+    {0x6f6f6f00, 32652, 3, 1, 5889, 0},
+    {0x6f70656e, 16383, 4, 1, 5889, 0},
+    {0x6f726163, 36833, 6, 1, 5889, 0},
+    {0x6f72616e, 14106, 6, 1, 5889, 1},
+    {0x6f726700, 6352, 3, 1, 5890, 114},
+    {0x6f726761, 6352, 7, 1, 6004, 0},
+    {0x6f726967, 32674, 7, 1, 6004, 0},
+    {0x6f73616b, 10214, 5, 1, 6004, 0},
+    {0x6f747375, 19353, 6, 1, 6004, 0},
+    {0x6f747400, 4341, 3, 1, 6004, 0},
+    {0x6f766800, 42294, 3, 1, 6004, 1},
+    {0x70610000, 778, 2, 1, 6005, 11},
+    {0x70616765, 2094, 4, 1, 6016, 9},
+    {0x70616e61, 22108, 9, 1, 6025, 0},
+    {0x70617269, 40010, 5, 1, 6025, 0},
+    {0x70617273, 41666, 4, 1, 6025, 0},
+    {0x70617274, 5374, 8, 1, 6025, 0},
+    {0x70617274, 40025, 5, 1, 6025, 0},
+    {0x70617274, 40030, 5, 1, 6025, 1},
+    {0x70617373, 22117, 9, 1, 6026, 0},
+    {0x70617900, 27239, 3, 1, 6026, 0},
+    {0x70636377, 41670, 4, 1, 6026, 0},
+    {0x70650000, 481, 2, 1, 6026, 8},
+    {0x70657400, 6295, 3, 1, 6034, 0},
+    {0x70660000, 4524, 2, 1, 6034, 3},
+    {0x7066697a, 36935, 6, 1, 6037, 0},
+    {0x70670000, 15529, 2, 2, 6037, 0},
+    {0x70680000, 2545, 2, 1, 6037, 8},
+    {0x70686172, 27247, 8, 1, 6045, 0},
+    {0x70686400, 42300, 3, 1, 6045, 0},
+    {0x7068696c, 32751, 7, 1, 6045, 0},
+    {0x70686f6e, 40060, 5, 1, 6045, 0},
+    {0x70686f74, 2752, 5, 1, 6045, 0},
+    {0x70686f74, 14205, 11, 1, 6045, 0},
+    {0x70686f74, 26753, 6, 1, 6045, 1},
+    {0x70687973, 36947, 6, 1, 6046, 0},
+    {0x70696373, 13101, 4, 1, 6046, 0},
+    {0x70696374, 36953, 6, 1, 6046, 0},
+    {0x70696374, 27263, 8, 1, 6046, 1},
+    {0x70696400, 4455, 3, 1, 6047, 0},
+    {0x70696e00, 7833, 3, 1, 6047, 0},
+    {0x70696e67, 14619, 4, 1, 6047, 0},
+    {0x70696e6b, 41678, 4, 1, 6047, 0},
+    {0x70696f6e, 32772, 7, 1, 6047, 0},
+    {0x70697a7a, 40070, 5, 1, 6047, 0},
+    {0x706b0000, 17171, 2, 1, 6047, 14},
+    {0x706c0000, 2832, 2, 1, 6061, 179},
+    {0x706c6163, 16097, 5, 1, 6240, 1},
+    {0x706c6179, 2832, 4, 1, 6241, 0},
+    {0x706c6179, 2832, 11, 1, 6241, 0},
+    {0x706c756d, 27311, 8, 1, 6241, 0},
+    {0x706c7573, 33909, 4, 1, 6241, 0},
+    {0x706d0000, 2447, 2, 1, 6241, 2},
+    {0x706e0000, 10830, 2, 1, 6243, 5},
+    {0x706e6300, 42315, 3, 1, 6248, 0},
+    {0x706f686c, 41690, 4, 1, 6248, 0},
+    {0x706f6b65, 40080, 5, 1, 6248, 0},
+    {0x706f6c69, 32821, 7, 1, 6248, 0},
+    {0x706f726e, 41694, 4, 1, 6248, 1},
+    {0x706f7374, 67, 4, 1, 6249, 0},
+    {0x70720000, 220, 2, 1, 6249, 13},
+    {0x7072616d, 22207, 9, 1, 6262, 0},
+    {0x70726178, 40090, 5, 1, 6262, 0},
+    {0x70726573, 4357, 5, 1, 6262, 0},
+    {0x7072696d, 27367, 5, 1, 6262, 0},
+    {0x70726f00, 5042, 3, 1, 6262, 14},
+    {0x70726f64, 7931, 4, 1, 6276, 0},
+    {0x70726f64, 14249, 11, 1, 6276, 0},
+    {0x70726f66, 14260, 4, 1, 6276, 0},
+    {0x70726f67, 14271, 11, 1, 6276, 0},
+    {0x70726f6d, 40100, 5, 1, 6276, 0},
+    {0x70726f70, 5042, 10, 1, 6276, 0},
+    {0x70726f70, 27383, 8, 1, 6276, 0},
+    {0x70726f74, 17982, 10, 1, 6276, 0},
+    {0x70727500, 17992, 3, 1, 6276, 0},
+    {0x70727564, 17992, 10, 1, 6276, 0},
+    {0x70730000, 804, 2, 1, 6276, 7},
+    {0x70740000, 1961, 2, 1, 6283, 10},
+    {0x70756200, 4969, 3, 1, 6293, 1},
+    {0x70770000, 337, 2, 1, 6294, 8},
+    {0x70776300, 42327, 3, 1, 6302, 0},
+    {0x70790000, 6835, 2, 1, 6302, 7},
+    {0x71610000, 3132, 2, 1, 6309, 9},
+    {0x71706f6e, 41706, 4, 1, 6318, 0},
+    {0x71756562, 37049, 6, 1, 6318, 0},
+    {0x71756573, 1474, 5, 1, 6318, 0},
+    {0x72616369, 37055, 6, 1, 6318, 0},
+    {0x72616469, 10151, 5, 1, 6318, 0},
+    {0x72650000, 7, 2, 1, 6318, 4},
+    {0x72656164, 10823, 4, 1, 6322, 0},
+    {0x7265616c, 18042, 10, 1, 6322, 0},
+    {0x7265616c, 32884, 7, 1, 6322, 0},
+    {0x7265616c, 37079, 6, 1, 6322, 0},
+    {0x72656369, 32891, 7, 1, 6322, 0},
+    {0x72656400, 1912, 3, 1, 6322, 0},
+    {0x72656473, 27463, 8, 1, 6322, 0},
+    {0x72656475, 14326, 11, 1, 6322, 0},
+    {0x72656861, 40155, 5, 1, 6322, 0},
+    {0x72656973, 37091, 5, 1, 6322, 0},
+    {0x72656973, 37091, 6, 1, 6322, 0},
+    {0x72656974, 41710, 4, 1, 6322, 0},
+    {0x72656c69, 27471, 8, 1, 6322, 0},
+    {0x72656e00, 200, 3, 1, 6322, 0},
+    {0x72656e74, 200, 4, 1, 6322, 0},
+    {0x72656e74, 32912, 7, 1, 6322, 0},
+    {0x72657061, 37103, 6, 1, 6322, 0},
+    {0x7265706f, 37109, 6, 1, 6322, 0},
+    {0x72657075, 4967, 10, 1, 6322, 0},
+    {0x72657374, 4365, 4, 1, 6322, 0},
+    {0x72657374, 18082, 10, 1, 6322, 0},
+    {0x72657669, 2016, 6, 1, 6322, 1},
+    {0x72657669, 32933, 7, 1, 6323, 0},
+    {0x72657872, 32947, 7, 1, 6323, 0},
+    {0x72696368, 6490, 4, 1, 6323, 0},
+    {0x72696368, 22261, 9, 1, 6323, 0},
+    {0x7269636f, 40160, 5, 1, 6323, 0},
+    {0x72696c00, 22464, 3, 1, 6323, 0},
+    {0x72696f00, 11143, 3, 1, 6323, 0},
+    {0x72697000, 13025, 3, 1, 6323, 1},
+    {0x726f0000, 99, 2, 1, 6324, 15},
+    {0x726f6368, 37127, 6, 1, 6339, 0},
+    {0x726f636b, 8342, 5, 1, 6339, 3},
+    {0x726f6465, 40195, 5, 1, 6342, 0},
+    {0x726f6765, 37133, 6, 1, 6342, 0},
+    {0x726f6f6d, 41718, 4, 1, 6342, 0},
+    {0x72730000, 868, 2, 1, 6342, 10},
+    {0x72737670, 41722, 4, 1, 6352, 0},
+    {0x72750000, 39, 2, 1, 6352, 40},
+    {0x72756762, 40215, 5, 1, 6392, 0},
+    {0x72756872, 41726, 4, 1, 6392, 0},
+    {0x72756e00, 5988, 3, 1, 6392, 10},
+    {0x72770000, 1522, 2, 1, 6402, 7},
+    {0x72776500, 1522, 3, 1, 6409, 0},
+    {0x7279756b, 37175, 6, 1, 6409, 0},
+    {0x73610000, 506, 2, 1, 6409, 8},
+    {0x73616172, 27535, 8, 1, 6417, 0},
+    {0x73616665, 2584, 4, 1, 6417, 0},
+    {0x73616665, 2584, 6, 1, 6417, 0},
+    {0x73616b75, 18122, 6, 1, 6417, 0},
+    {0x73616c65, 11451, 4, 1, 6417, 0},
+    {0x73616c6f, 40265, 5, 1, 6417, 0},
+    {0x73616d73, 27583, 8, 1, 6417, 0},
+    {0x73616d73, 33038, 7, 1, 6417, 0},
+    {0x73616e64, 5217, 7, 1, 6417, 0},
+    {0x73616e64, 5217, 15, 1, 6417, 0},
+    {0x73616e6f, 37229, 6, 1, 6417, 0},
+    {0x73617000, 7872, 3, 1, 6417, 0},
+    {0x7361726c, 41738, 4, 1, 6417, 0},
+    {0x73617300, 5114, 3, 1, 6417, 0},
+    {0x73617665, 3916, 4, 1, 6417, 0},
+    {0x7361786f, 41746, 4, 1, 6417, 0},
+    {0x73620000, 327, 2, 1, 6417, 5},
+    {0x73626900, 16717, 3, 1, 6422, 0},
+    {0x73627300, 42348, 3, 1, 6422, 0},
+    {0x73630000, 1512, 2, 1, 6422, 5},
+    {0x73636100, 3683, 3, 1, 6427, 0},
+    {0x73636200, 42351, 3, 1, 6427, 0},
+    {0x73636861, 18182, 10, 1, 6427, 0},
+    {0x7363686d, 33087, 7, 1, 6427, 0},
+    {0x7363686f, 11311, 12, 1, 6427, 0},
+    {0x7363686f, 22378, 6, 1, 6427, 0},
+    {0x73636875, 13638, 6, 1, 6427, 0},
+    {0x73636877, 33101, 7, 1, 6427, 0},
+    {0x73636965, 2112, 7, 1, 6427, 1},
+    {0x73636f74, 27663, 4, 1, 6428, 2},
+    {0x73640000, 208, 2, 1, 6430, 8},
+    {0x73650000, 94, 2, 1, 6438, 47},
+    {0x73656172, 27505, 6, 1, 6485, 0},
+    {0x73656174, 41754, 4, 1, 6485, 0},
+    {0x73656375, 9889, 6, 1, 6485, 0},
+    {0x73656375, 3806, 8, 1, 6485, 0},
+    {0x7365656b, 41758, 4, 1, 6485, 0},
+    {0x73656c65, 18326, 6, 1, 6485, 0},
+    {0x73656e65, 40335, 5, 1, 6485, 0},
+    {0x73657276, 27735, 8, 1, 6485, 1},
+    {0x73657665, 34924, 5, 1, 6486, 0},
+    {0x73657700, 42357, 3, 1, 6486, 0},
+    {0x73657800, 34930, 3, 1, 6486, 0},
+    {0x73657879, 41762, 4, 1, 6486, 0},
+    {0x73667200, 4691, 3, 1, 6486, 0},
+    {0x73670000, 989, 2, 1, 6486, 8},
+    {0x73680000, 598, 2, 1, 6494, 11},
+    {0x7368616e, 22459, 9, 1, 6505, 0},
+    {0x73686172, 40350, 5, 1, 6505, 0},
+    {0x73686177, 41770, 4, 1, 6505, 0},
+    {0x7368656c, 40355, 5, 1, 6505, 0},
+    {0x73686961, 4801, 4, 1, 6505, 0},
+    {0x7368696b, 33171, 7, 1, 6505, 0},
+    {0x73686f65, 40360, 5, 1, 6505, 0},
+    {0x73686f70, 6369, 4, 1, 6505, 3},
+    {0x73686f70, 27855, 8, 1, 6508, 0},
+    {0x73686f75, 37361, 6, 1, 6508, 0},
+    {0x73686f77, 27871, 4, 1, 6508, 0},
+    {0x73686f77, 27871, 8, 1, 6508, 0},
+    {0x73690000, 126, 2, 1, 6508, 3},
+    {0x73696c6b, 41778, 4, 1, 6511, 0},
+    {0x73696e61, 7744, 4, 1, 6511, 0},
+    {0x73696e67, 33262, 7, 1, 6511, 0},
+    {0x73697465, 126, 4, 1, 6511, 17},
+    {0x736a0000, 932, 2, 1, 6528, 0},
+    {0x736b0000, 869, 2, 1, 6528, 1},
+    {0x736b6900, 6680, 3, 1, 6529, 0},
+    {0x736b696e, 16496, 4, 1, 6529, 0},
+    {0x736b7900, 10611, 3, 1, 6529, 0},
+    {0x736b7970, 40395, 5, 1, 6529, 0},
+    {0x736c0000, 1317, 2, 1, 6529, 5},
+    {0x736c696e, 40405, 5, 1, 6534, 0},
+    {0x736d0000, 3774, 2, 1, 6534, 0},
+    {0x736d6172, 3774, 5, 1, 6534, 0},
+    {0x736d696c, 40410, 5, 1, 6534, 0},
+    {0x736e0000, 1516, 2, 1, 6534, 8},
+    {0x736e6366, 41782, 4, 1, 6542, 0},
+    {0x736f0000, 159, 2, 1, 6542, 7},
+    {0x736f6363, 37427, 6, 1, 6549, 0},
+    {0x736f6369, 6616, 6, 1, 6549, 0},
+    {0x736f6674, 27927, 8, 1, 6549, 0},
+    {0x736f6674, 27935, 8, 1, 6549, 0},
+    {0x736f6875, 41786, 4, 1, 6549, 0},
+    {0x736f6c61, 40440, 5, 1, 6549, 0},
+    {0x736f6c75, 2031, 9, 1, 6549, 1},
+    {0x736f6e67, 22702, 4, 1, 6550, 0},
+    {0x736f6e79, 41802, 4, 1, 6550, 0},
+    {0x736f7900, 27500, 3, 1, 6550, 0},
+    {0x73706100, 1406, 3, 1, 6550, 0},
+    {0x73706163, 1406, 5, 1, 6550, 3},
+    {0x73706f72, 17961, 5, 1, 6553, 0},
+    {0x73706f74, 23971, 4, 1, 6553, 0},
+    {0x73720000, 1825, 2, 1, 6553, 0},
+    {0x73726c00, 42381, 3, 1, 6553, 0},
+    {0x73730000, 494, 2, 1, 6553, 8},
+    {0x73740000, 53, 2, 1, 6561, 12},
+    {0x73746164, 33436, 5, 1, 6573, 0},
+    {0x73746170, 33339, 7, 1, 6573, 0},
+    {0x73746172, 8346, 4, 1, 6573, 0},
+    {0x73746174, 22765, 9, 1, 6573, 0},
+    {0x73746174, 22774, 9, 1, 6573, 0},
+    {0x73746300, 1973, 3, 1, 6573, 0},
+    {0x73746367, 28015, 8, 1, 6573, 0},
+    {0x73746f63, 22810, 9, 1, 6573, 0},
+    {0x73746f72, 33367, 7, 1, 6573, 0},
+    {0x73746f72, 10046, 5, 1, 6573, 3},
+    {0x73747265, 11431, 6, 1, 6576, 0},
+    {0x73747564, 37475, 6, 1, 6576, 0},
+    {0x73747564, 40490, 5, 1, 6576, 0},
+    {0x7374796c, 21419, 5, 1, 6576, 0},
+    {0x73750000, 237, 2, 1, 6576, 52},
+    {0x7375636b, 40495, 5, 1, 6628, 0},
+    {0x73757070, 28071, 8, 1, 6628, 0},
+    {0x73757070, 37517, 6, 1, 6628, 0},
+    {0x73757070, 33395, 7, 1, 6628, 1},
+    {0x73757266, 41826, 4, 1, 6629, 0},
+    {0x73757267, 33402, 7, 1, 6629, 0},
+    {0x73757a75, 37553, 6, 1, 6629, 0},
+    {0x73760000, 7979, 2, 1, 6629, 5},
+    {0x73776174, 37559, 6, 1, 6634, 0},
+    {0x73776973, 40515, 5, 1, 6634, 0},
+    {0x73780000, 4059, 2, 1, 6634, 1},
+    {0x73790000, 1227, 2, 1, 6635, 6},
+    {0x7379646e, 37571, 6, 1, 6641, 0},
+    {0x73797374, 5160, 7, 1, 6641, 1},
+    {0x737a0000, 289, 2, 1, 6642, 3},
+    {0x74616200, 671, 3, 1, 6645, 0},
+    {0x74616970, 37607, 6, 1, 6645, 0},
+    {0x74616c6b, 3464, 4, 1, 6645, 0},
+    {0x74616f62, 37661, 6, 1, 6645, 0},
+    {0x74617267, 37673, 6, 1, 6645, 0},
+    {0x74617461, 18462, 10, 1, 6645, 0},
+    {0x74617461, 28317, 5, 1, 6645, 0},
+    {0x74617474, 37679, 6, 1, 6645, 0},
+    {0x74617800, 7155, 3, 1, 6645, 0},
+    {0x74617869, 41838, 4, 1, 6645, 0},
+    {0x74630000, 942, 2, 1, 6645, 3},
+    {0x74636900, 42390, 3, 1, 6648, 0},
+    {0x74640000, 4571, 2, 1, 6648, 1},
+    {0x74646b00, 42396, 3, 1, 6649, 0},
+    {0x7465616d, 40476, 4, 1, 6649, 2},
+    {0x74656368, 13594, 4, 1, 6651, 0},
+    {0x74656368, 18492, 10, 1, 6651, 1},
+    {0x74656c00, 15, 3, 1, 6652, 0},
+    {0x74656d61, 33493, 7, 1, 6652, 0},
+    {0x74656e6e, 37685, 6, 1, 6652, 0},
+    {0x74657661, 11585, 4, 1, 6652, 0},
+    {0x74660000, 3563, 2, 1, 6652, 1},
+    {0x74670000, 8980, 2, 1, 6653, 0},
+    {0x74680000, 137, 2, 1, 6653, 9},
+    {0x74686400, 7811, 3, 1, 6662, 0},
+    {0x74686561, 33528, 7, 1, 6662, 0},
+    {0x74686561, 33535, 7, 1, 6662, 0},
+    {0x74696161, 41846, 4, 1, 6662, 0},
+    {0x7469636b, 33549, 7, 1, 6662, 0},
+    {0x7469656e, 37703, 6, 1, 6662, 0},
+    {0x74696666, 33556, 7, 1, 6662, 0},
+    {0x74697073, 41854, 4, 1, 6662, 0},
+    {0x74697265, 40590, 5, 1, 6662, 0},
+    {0x7469726f, 211, 5, 1, 6662, 0},
+    {0x746a0000, 592, 2, 1, 6662, 15},
+    {0x746a6d61, 37709, 6, 1, 6677, 0},
+    {0x746a7800, 42399, 3, 1, 6677, 0},
+    {0x746b0000, 8414, 2, 1, 6677, 0},
+    {0x746b6d61, 37715, 6, 1, 6677, 0},
+    {0x746c0000, 3503, 2, 1, 6677, 1},
+    {0x746d0000, 2797, 2, 1, 6678, 8},
+    {0x746d616c, 40605, 5, 1, 6686, 0},
+    {0x746e0000, 1624, 2, 1, 6686, 14},
+    {0x746f0000, 1004, 2, 1, 6700, 12},
+    {0x746f6461, 40610, 5, 1, 6712, 1},
+    {0x746f6b79, 39443, 5, 1, 6713, 0},
+    {0x746f6f6c, 40630, 5, 1, 6713, 0},
+    {0x746f7000, 13333, 3, 1, 6713, 2},
+    {0x746f7261, 40635, 5, 1, 6715, 0},
+    {0x746f7368, 33612, 7, 1, 6715, 0},
+    {0x746f7461, 40640, 5, 1, 6715, 0},
+    {0x746f7572, 40645, 5, 1, 6715, 0},
+    {0x746f776e, 3932, 4, 1, 6715, 0},
+    {0x746f796f, 37811, 6, 1, 6715, 0},
+    {0x746f7973, 41874, 4, 1, 6715, 0},
+    {0x74720000, 199, 2, 1, 6715, 22},
+    {0x74726164, 7944, 5, 1, 6737, 1},
+    {0x74726164, 33668, 7, 1, 6738, 0},
+    {0x74726169, 28487, 8, 1, 6738, 0},
+    {0x74726176, 2166, 6, 1, 6738, 0},
+    {0x74726176, 8987, 13, 1, 6738, 0},
+    {0x74726176, 2166, 9, 1, 6738, 0},
+    {0x74726176, 2166, 18, 1, 6738, 0},
+    {0x74727573, 33717, 5, 1, 6738, 0},
+    {0x74727600, 42408, 3, 1, 6738, 0},
+    {0x74740000, 643, 2, 1, 6738, 17},
+    {0x74756265, 14795, 4, 1, 6755, 0},
+    {0x74756900, 35527, 3, 1, 6755, 0},
+    {0x74756e65, 40655, 5, 1, 6755, 0},
+    {0x74757368, 40670, 5, 1, 6755, 0},
+    {0x74760000, 2443, 2, 1, 6755, 4},
+    {0x74767300, 42411, 3, 1, 6759, 0},
+    {0x74770000, 2946, 2, 1, 6759, 15},
+    {0x747a0000, 4750, 2, 1, 6774, 12},
+    {0x75610000, 2091, 2, 1, 6786, 83},
+    {0x7562616e, 40685, 5, 1, 6869, 0},
+    {0x75627300, 27589, 3, 1, 6869, 0},
+    {0x75670000, 11531, 2, 1, 6869, 9},
+    {0x756b0000, 6692, 2, 1, 6878, 23},
+    {0x756e6963, 37931, 6, 1, 6901, 0},
+    {0x756e6976, 18602, 10, 1, 6901, 0},
+    {0x756e6f00, 10228, 3, 1, 6901, 0},
+    {0x756f6c00, 1696, 3, 1, 6901, 0},
+    {0x75707300, 28021, 3, 1, 6901, 0},
+    {0x75730000, 767, 2, 1, 6901, 73},
+    {0x75790000, 3607, 2, 1, 6974, 6},
+    {0x757a0000, 8756, 2, 1, 6980, 4},
+    {0x76610000, 114, 2, 1, 6984, 0},
+    {0x76616361, 23161, 9, 1, 6984, 0},
+    {0x76616e61, 21317, 4, 1, 6984, 0},
+    {0x76616e67, 28655, 8, 1, 6984, 0},
+    {0x76630000, 7540, 2, 1, 6984, 8},
+    {0x76650000, 320, 2, 1, 6992, 20},
+    {0x76656761, 40790, 5, 1, 7012, 0},
+    {0x76656e74, 28687, 8, 1, 7012, 0},
+    {0x76657269, 28711, 8, 1, 7012, 0},
+    {0x76657273, 11599, 12, 1, 7012, 0},
+    {0x76657400, 12559, 3, 1, 7012, 0},
+    {0x76670000, 3265, 2, 1, 7012, 1},
+    {0x76690000, 97, 2, 1, 7013, 5},
+    {0x7669616a, 38045, 6, 1, 7018, 0},
+    {0x76696465, 40795, 5, 1, 7018, 0},
+    {0x76696700, 17537, 3, 1, 7018, 0},
+    {0x76696b69, 38051, 6, 1, 7018, 0},
+    {0x76696c6c, 38057, 6, 1, 7018, 0},
+    {0x76696e00, 5401, 3, 1, 7018, 0},
+    {0x76697000, 18692, 3, 1, 7018, 0},
+    {0x76697267, 28727, 6, 1, 7018, 0},
+    {0x76697361, 41938, 4, 1, 7018, 0},
+    {0x76697369, 6955, 6, 1, 7018, 0},
+    {0x76697661, 41942, 4, 1, 7018, 0},
+    {0x7669766f, 41946, 4, 1, 7018, 0},
+    {0x766c6161, 18702, 10, 1, 7018, 0},
+    {0x766e0000, 4193, 2, 1, 7018, 13},
+    {0x766f646b, 40800, 5, 1, 7031, 0},
+    {0x766f6c6b, 18712, 10, 1, 7031, 0},
+    {0x766f6c76, 40810, 5, 1, 7031, 0},
+    {0x766f7465, 41954, 4, 1, 7031, 0},
+    {0x766f7469, 38075, 6, 1, 7031, 0},
+    {0x766f746f, 41958, 4, 1, 7031, 0},
+    {0x766f7961, 38081, 6, 1, 7031, 0},
+    {0x76750000, 935, 2, 1, 7031, 8},
+    {0x7675656c, 38093, 6, 1, 7039, 0},
+    {0x77616c65, 40820, 5, 1, 7039, 0},
+    {0x77616c6d, 33913, 7, 1, 7039, 0},
+    {0x77616c74, 38111, 6, 1, 7039, 0},
+    {0x77616e67, 30900, 4, 1, 7039, 0},
+    {0x77616e67, 33920, 7, 1, 7039, 0},
+    {0x77617463, 5412, 5, 1, 7039, 0},
+    {0x77617463, 33941, 7, 1, 7039, 0},
+    {0x77656174, 7003, 7, 1, 7039, 0},
+    {0x77656174, 7003, 14, 1, 7039, 0},
+    {0x77656263, 38141, 6, 1, 7039, 0},
+    {0x77656265, 40825, 5, 1, 7039, 0},
+    {0x77656273, 123, 7, 1, 7039, 1},
+    {0x77656464, 33969, 7, 1, 7040, 0},
+    {0x77656962, 40830, 5, 1, 7040, 0},
+    {0x77656972, 41966, 4, 1, 7040, 0},
+    {0x77660000, 22687, 2, 1, 7040, 2},
+    {0x77686f73, 33990, 7, 1, 7042, 0},
+    {0x7769656e, 41970, 4, 1, 7042, 0},
+    {0x77696b69, 13112, 4, 1, 7042, 1},
+    {0x77696c6c, 14777, 11, 1, 7043, 0},
+    {0x77696e00, 2021, 3, 1, 7043, 0},
+    {0x77696e64, 33997, 7, 1, 7043, 0},
+    {0x77696e65, 3394, 4, 1, 7043, 0},
+    {0x77696e6e, 34004, 7, 1, 7043, 0},
+    {0x776d6500, 21885, 3, 1, 7043, 0},
+    {0x776f6c74, 9130, 13, 1, 7043, 0},
+    {0x776f6f64, 28839, 8, 1, 7043, 0},
+    {0x776f726b, 2947, 4, 1, 7043, 0},
+    {0x776f726b, 28847, 5, 1, 7043, 0},
+    {0x776f726c, 40840, 5, 1, 7043, 0},
+    {0x776f7700, 42444, 3, 1, 7043, 0},
+    {0x77730000, 988, 2, 1, 7043, 9},
+    {0x77746300, 42447, 3, 1, 7052, 0},
+    {0x77746600, 42450, 3, 1, 7052, 0},
+    {0x78626f78, 42002, 4, 1, 7052, 0},
+    {0x7865726f, 40845, 5, 1, 7052, 0},
+    {0x7866696e, 34067, 7, 1, 7052, 0},
+    {0x78696875, 38171, 6, 1, 7052, 0},
+    {0x78696e00, 42456, 3, 1, 7052, 0},
+    {0x786e2d2d, 14799, 11, 1, 7052, 0},
+    {0x786e2d2d, 14810, 11, 1, 7052, 0},
+    {0x786e2d2d, 14843, 11, 1, 7052, 0},
+    {0x786e2d2d, 14865, 11, 1, 7052, 0},
+    {0x786e2d2d, 18792, 10, 1, 7052, 0},
+    {0x786e2d2d, 14887, 11, 1, 7052, 0},
+    {0x786e2d2d, 14898, 11, 1, 7052, 0},
+    {0x786e2d2d, 11731, 12, 1, 7052, 0},
+    {0x786e2d2d, 14909, 11, 1, 7052, 0},
+    {0x786e2d2d, 18802, 10, 1, 7052, 0},
+    {0x786e2d2d, 14920, 11, 1, 7052, 0},
+    {0x786e2d2d, 11743, 12, 1, 7052, 0},
+    {0x786e2d2d, 14931, 11, 1, 7052, 0},
+    {0x786e2d2d, 18812, 10, 1, 7052, 0},
+    {0x786e2d2d, 11755, 12, 1, 7052, 4},
+    {0x786e2d2d, 18822, 10, 1, 7056, 0},
+    {0x786e2d2d, 7045, 14, 1, 7056, 0},
+    {0x786e2d2d, 14964, 11, 1, 7056, 0},
+    {0x786e2d2d, 18832, 10, 1, 7056, 0},
+    {0x786e2d2d, 3087, 17, 1, 7056, 0},
+    {0x786e2d2d, 18842, 10, 1, 7056, 0},
+    {0x786e2d2d, 15019, 11, 1, 7056, 0},
+    {0x786e2d2d, 7059, 14, 1, 7056, 0},
+    {0x786e2d2d, 11779, 12, 1, 7056, 0},
+    {0x786e2d2d, 15030, 11, 1, 7056, 0},
+    {0x786e2d2d, 7087, 14, 1, 7056, 0},
+    {0x786e2d2d, 11791, 12, 1, 7056, 0},
+    {0x786e2d2d, 18872, 10, 1, 7056, 0},
+    {0x786e2d2d, 11803, 12, 1, 7056, 0},
+    {0x786e2d2d, 18912, 10, 1, 7056, 6},
+    {0x786e2d2d, 28863, 8, 1, 7062, 0},
+    {0x786e2d2d, 23305, 9, 1, 7062, 0},
+    {0x786e2d2d, 18922, 10, 1, 7062, 0},
+    {0x786e2d2d, 18932, 10, 1, 7062, 0},
+    {0x786e2d2d, 15052, 11, 1, 7062, 0},
+    {0x786e2d2d, 7115, 14, 1, 7062, 0},
+    {0x786e2d2d, 3104, 17, 1, 7062, 0},
+    {0x786e2d2d, 23341, 9, 1, 7062, 0},
+    {0x786e2d2d, 18942, 10, 1, 7062, 0},
+    {0x786e2d2d, 15074, 11, 1, 7062, 0},
+    {0x786e2d2d, 9221, 13, 1, 7062, 0},
+    {0x786e2d2d, 18962, 10, 1, 7062, 0},
+    {0x786e2d2d, 543, 22, 1, 7062, 0},
+    {0x786e2d2d, 15085, 11, 1, 7062, 0},
+    {0x786e2d2d, 18972, 10, 1, 7062, 0},
+    {0x786e2d2d, 18982, 10, 1, 7062, 0},
+    {0x786e2d2d, 15107, 11, 1, 7062, 0},
+    {0x786e2d2d, 23359, 9, 1, 7062, 0},
+    {0x786e2d2d, 23368, 9, 1, 7062, 0},
+    {0x786e2d2d, 9247, 13, 1, 7062, 0},
+    {0x786e2d2d, 15118, 11, 1, 7062, 0},
+    {0x786e2d2d, 15162, 11, 1, 7062, 0},
+    {0x786e2d2d, 23377, 9, 1, 7062, 0},
+    {0x786e2d2d, 7199, 14, 1, 7062, 0},
+    {0x786e2d2d, 19012, 10, 1, 7062, 0},
+    {0x786e2d2d, 19022, 10, 1, 7062, 0},
+    {0x786e2d2d, 19032, 10, 1, 7062, 0},
+    {0x786e2d2d, 15173, 11, 1, 7062, 0},
+    {0x786e2d2d, 15184, 11, 1, 7062, 0},
+    {0x786e2d2d, 9286, 13, 1, 7062, 0},
+    {0x786e2d2d, 9299, 13, 1, 7062, 0},
+    {0x786e2d2d, 4092, 16, 1, 7062, 0},
+    {0x786e2d2d, 15195, 11, 1, 7062, 0},
+    {0x786e2d2d, 11947, 12, 1, 7062, 0},
+    {0x786e2d2d, 15206, 11, 1, 7062, 0},
+    {0x786e2d2d, 15217, 11, 1, 7062, 0},
+    {0x786e2d2d, 7213, 14, 1, 7062, 0},
+    {0x786e2d2d, 9325, 11, 1, 7062, 0},
+    {0x786e2d2d, 9325, 13, 1, 7062, 0},
+    {0x786e2d2d, 15250, 11, 1, 7062, 0},
+    {0x786e2d2d, 5562, 15, 1, 7062, 0},
+    {0x786e2d2d, 15261, 11, 1, 7062, 0},
+    {0x786e2d2d, 19082, 10, 1, 7062, 0},
+    {0x786e2d2d, 23413, 9, 1, 7062, 0},
+    {0x786e2d2d, 23422, 9, 1, 7062, 0},
+    {0x786e2d2d, 15283, 11, 1, 7062, 6},
+    {0x786e2d2d, 7241, 14, 1, 7068, 0},
+    {0x786e2d2d, 15294, 11, 1, 7068, 0},
+    {0x786e2d2d, 5577, 15, 1, 7068, 0},
+    {0x786e2d2d, 15327, 11, 1, 7068, 0},
+    {0x786e2d2d, 15338, 11, 1, 7068, 0},
+    {0x786e2d2d, 19132, 10, 1, 7068, 0},
+    {0x786e2d2d, 23440, 9, 1, 7068, 0},
+    {0x786e2d2d, 5652, 15, 1, 7068, 0},
+    {0x786e2d2d, 12055, 12, 1, 7068, 0},
+    {0x786e2d2d, 12067, 12, 1, 7068, 0},
+    {0x786e2d2d, 7339, 14, 1, 7068, 0},
+    {0x786e2d2d, 5667, 15, 1, 7068, 0},
+    {0x786e2d2d, 7353, 14, 1, 7068, 0},
+    {0x786e2d2d, 4236, 16, 1, 7068, 0},
+    {0x786e2d2d, 5682, 15, 1, 7068, 0},
+    {0x786e2d2d, 7367, 14, 1, 7068, 0},
+    {0x786e2d2d, 12079, 12, 1, 7068, 0},
+    {0x786e2d2d, 3172, 17, 1, 7068, 0},
+    {0x786e2d2d, 2418, 18, 1, 7068, 0},
+    {0x786e2d2d, 3189, 17, 1, 7068, 0},
+    {0x786e2d2d, 7381, 14, 1, 7068, 0},
+    {0x786e2d2d, 7395, 11, 1, 7068, 0},
+    {0x786e2d2d, 7395, 14, 1, 7068, 0},
+    {0x786e2d2d, 5697, 15, 1, 7068, 0},
+    {0x786e2d2d, 7409, 14, 1, 7068, 0},
+    {0x786e2d2d, 4252, 16, 1, 7068, 0},
+    {0x786e2d2d, 1764, 19, 1, 7068, 0},
+    {0x786e2d2d, 3206, 17, 1, 7068, 0},
+    {0x786e2d2d, 12091, 12, 1, 7068, 0},
+    {0x786e2d2d, 7423, 14, 1, 7068, 0},
+    {0x786e2d2d, 12103, 12, 1, 7068, 0},
+    {0x786e2d2d, 1783, 19, 1, 7068, 0},
+    {0x786e2d2d, 4268, 16, 1, 7068, 0},
+    {0x786e2d2d, 12115, 12, 1, 7068, 0},
+    {0x786e2d2d, 12127, 12, 1, 7068, 0},
+    {0x786e2d2d, 15382, 11, 1, 7068, 0},
+    {0x786e2d2d, 7437, 14, 1, 7068, 0},
+    {0x786e2d2d, 15393, 11, 1, 7068, 0},
+    {0x786e2d2d, 15404, 11, 1, 7068, 0},
+    {0x786e2d2d, 12139, 12, 1, 7068, 0},
+    {0x786e2d2d, 19152, 10, 1, 7068, 0},
+    {0x786e2d2d, 12163, 12, 1, 7068, 0},
+    {0x786e2d2d, 12175, 12, 1, 7068, 0},
+    {0x786e2d2d, 23449, 9, 1, 7068, 0},
+    {0x786e2d2d, 15459, 11, 1, 7068, 0},
+    {0x786e2d2d, 28879, 8, 1, 7068, 0},
+    {0x786e2d2d, 5712, 9, 1, 7068, 0},
+    {0x786e2d2d, 5712, 15, 1, 7068, 0},
+    {0x786e2d2d, 15481, 11, 1, 7068, 0},
+    {0x786e2d2d, 19162, 10, 1, 7068, 6},
+    {0x786e2d2d, 12187, 12, 1, 7074, 0},
+    {0x786e2d2d, 15514, 11, 1, 7074, 0},
+    {0x786e2d2d, 23467, 9, 1, 7074, 10},
+    {0x786e2d2d, 28887, 8, 1, 7084, 0},
+    {0x786e2d2d, 15525, 11, 1, 7084, 0},
+    {0x786e2d2d, 19182, 10, 1, 7084, 0},
+    {0x786e2d2d, 19192, 10, 1, 7084, 0},
+    {0x786e2d2d, 15547, 11, 1, 7084, 0},
+    {0x786e2d2d, 12199, 12, 1, 7084, 0},
+    {0x786e2d2d, 23476, 9, 1, 7084, 0},
+    {0x786e2d2d, 28895, 8, 1, 7084, 0},
+    {0x786e2d2d, 15580, 11, 1, 7084, 0},
+    {0x786e2d2d, 15591, 11, 1, 7084, 0},
+    {0x786e2d2d, 7535, 14, 1, 7084, 0},
+    {0x786e2d2d, 15613, 11, 1, 7084, 0},
+    {0x786e2d2d, 15624, 11, 1, 7084, 0},
+    {0x786e2d2d, 15635, 11, 1, 7084, 0},
+    {0x786e2d2d, 23503, 9, 1, 7084, 0},
+    {0x786e2d2d, 9624, 13, 1, 7084, 0},
+    {0x786e2d2d, 19252, 10, 1, 7084, 0},
+    {0x786e2d2d, 432, 23, 1, 7084, 0},
+    {0x786e2d2d, 316, 24, 1, 7084, 0},
+    {0x786e2d2d, 23521, 9, 1, 7084, 0},
+    {0x786e2d2d, 15712, 11, 1, 7084, 0},
+    {0x786e2d2d, 1287, 20, 1, 7084, 0},
+    {0x786e2d2d, 15723, 11, 1, 7084, 0},
+    {0x786e2d2d, 19262, 10, 1, 7084, 0},
+    {0x786e2d2d, 19272, 10, 1, 7084, 0},
+    {0x786e2d2d, 15745, 11, 1, 7084, 0},
+    {0x786e2d2d, 4316, 16, 1, 7084, 0},
+    {0x786e2d2d, 3291, 17, 1, 7084, 0},
+    {0x786e2d2d, 19282, 10, 1, 7084, 0},
+    {0x786e2d2d, 9689, 13, 1, 7084, 0},
+    {0x786e2d2d, 9702, 13, 1, 7084, 0},
+    {0x786e2d2d, 15778, 11, 1, 7084, 0},
+    {0x78787800, 42459, 3, 1, 7084, 0},
+    {0x78797a00, 42462, 3, 1, 7084, 5},
+    {0x79616368, 38189, 6, 1, 7089, 0},
+    {0x7961686f, 40860, 5, 1, 7089, 0},
+    {0x79616d61, 34088, 7, 1, 7089, 0},
+    {0x79616e64, 15789, 6, 1, 7089, 0},
+    {0x79650000, 4328, 2, 1, 7089, 6},
+    {0x796f646f, 23575, 9, 1, 7095, 0},
+    {0x796f6761, 11475, 4, 1, 7095, 0},
+    {0x796f6b6f, 28943, 8, 1, 7095, 0},
+    {0x796f7500, 3785, 3, 1, 7095, 0},
+    {0x796f7574, 14792, 7, 1, 7095, 0},
+    {0x79740000, 5254, 2, 1, 7095, 1},
+    {0x79756e00, 31226, 3, 1, 7096, 0},
+    {0x7a610000, 739, 2, 0, 7096, 18},
+    {0x7a617070, 38303, 6, 1, 7114, 0},
+    {0x7a617261, 32854, 4, 1, 7114, 0},
+    {0x7a65726f, 42014, 4, 1, 7114, 0},
+    {0x7a697000, 42471, 3, 1, 7114, 0},
+    {0x7a6d0000, 18848, 2, 1, 7114, 11},
+    {0x7a6f6e65, 9126, 4, 1, 7125, 4},
+    {0x7a756572, 34144, 7, 1, 7129, 0},
+    {0x7a770000, 42485, 2, 1, 7129, 5},
+    {0x636f6d00, 19, 3, 1, 7134, 0},
+    {0x64727200, 42123, 3, 1, 7134, 0},
+    {0x65647500, 9778, 3, 1, 7134, 0},
+    {0x676f7600, 810, 3, 1, 7134, 0},
+    {0x6d696c00, 6019, 3, 1, 7134, 0},
+    {0x6e657400, 2944, 3, 1, 7134, 0},
+    {0x6f726700, 6352, 3, 1, 7134, 0},
+    {0x6f666669, 27111, 8, 1, 7134, 0},
+    {0x6e6f6d00, 5080, 3, 1, 7134, 0},
+    {0x61630000, 35, 2, 1, 7134, 0},
+    {0x626c6f67, 23967, 8, 1, 7134, 0},
+    {0x636f0000, 4, 2, 1, 7134, 0},
+    {0x676f7600, 810, 3, 1, 7134, 0},
+    {0x6d696c00, 6019, 3, 1, 7134, 0},
+    {0x6e657400, 2944, 3, 1, 7134, 0},
+    {0x6f726700, 6352, 3, 1, 7134, 0},
+    {0x73636800, 1512, 3, 1, 7134, 0},
+    {0x61636369, 455, 22, 1, 7134, 0},
+    {0x61636369, 1327, 19, 1, 7134, 0},
+    {0x6165726f, 19390, 9, 1, 7134, 0},
+    {0x6165726f, 23695, 8, 1, 7134, 0},
+    {0x6165726f, 19399, 9, 1, 7134, 0},
+    {0x6167656e, 34199, 6, 1, 7134, 0},
+    {0x6169722d, 3308, 16, 1, 7134, 0},
+    {0x6169722d, 1346, 19, 1, 7134, 0},
+    {0x61697263, 23719, 8, 1, 7134, 0},
+    {0x6169726c, 29111, 7, 1, 7134, 0},
+    {0x61697270, 29118, 7, 1, 7134, 0},
+    {0x61697274, 15872, 10, 1, 7134, 0},
+    {0x616d6275, 19480, 9, 1, 7134, 0},
+    {0x616d7573, 19498, 9, 1, 7134, 0},
+    {0x6173736f, 788, 11, 1, 7134, 0},
+    {0x61757468, 34367, 6, 1, 7134, 0},
+    {0x62616c6c, 16022, 10, 1, 7134, 0},
+    {0x62726f6b, 34529, 6, 1, 7134, 0},
+    {0x63616100, 29291, 3, 1, 7134, 0},
+    {0x63617267, 38610, 5, 1, 7134, 0},
+    {0x63617465, 24159, 8, 1, 7134, 0},
+    {0x63657274, 7856, 13, 1, 7134, 0},
+    {0x6368616d, 9907, 12, 1, 7134, 0},
+    {0x63686172, 29657, 7, 1, 7134, 0},
+    {0x63697669, 7882, 13, 1, 7134, 0},
+    {0x636c7562, 23699, 4, 1, 7134, 0},
+    {0x636f6e66, 16352, 10, 1, 7134, 0},
+    {0x636f6e73, 16362, 10, 1, 7134, 0},
+    {0x636f6e73, 16372, 10, 1, 7134, 0},
+    {0x636f6e74, 1358, 7, 1, 7134, 0},
+    {0x636f756e, 29881, 7, 1, 7134, 0},
+    {0x63726577, 41102, 4, 1, 7134, 0},
+    {0x64657369, 6703, 6, 1, 7134, 0},
+    {0x64676361, 41126, 4, 1, 7134, 0},
+    {0x65647563, 24575, 8, 1, 7134, 0},
+    {0x656d6572, 20191, 9, 1, 7134, 0},
+    {0x656e6769, 5429, 6, 1, 7134, 0},
+    {0x656e6769, 6645, 8, 1, 7134, 0},
+    {0x656e7465, 8051, 13, 1, 7134, 0},
+    {0x65717569, 8094, 9, 1, 7134, 0},
+    {0x65786368, 8836, 8, 1, 7134, 0},
+    {0x65787072, 4355, 7, 1, 7134, 0},
+    {0x66656465, 16652, 10, 1, 7134, 0},
+    {0x666c6967, 4896, 6, 1, 7134, 0},
+    {0x6675656c, 41230, 4, 1, 7134, 0},
+    {0x676c6964, 13439, 7, 1, 7134, 0},
+    {0x676f7665, 16772, 10, 1, 7134, 0},
+    {0x67726f75, 6443, 14, 1, 7134, 0},
+    {0x67726f75, 11702, 5, 1, 7134, 0},
+    {0x68616e67, 13435, 11, 1, 7134, 0},
+    {0x686f6d65, 20650, 9, 1, 7134, 0},
+    {0x696e7375, 235, 9, 1, 7134, 0},
+    {0x6a6f7572, 17042, 7, 1, 7134, 0},
+    {0x6a6f7572, 17052, 10, 1, 7134, 0},
+    {0x6c656173, 31911, 7, 1, 7134, 0},
+    {0x6c6f6769, 6672, 9, 1, 7134, 0},
+    {0x6d616761, 26319, 8, 1, 7134, 0},
+    {0x6d61696e, 13809, 11, 1, 7134, 0},
+    {0x6d656469, 21595, 5, 1, 7134, 0},
+    {0x6d696372, 17542, 10, 1, 7134, 0},
+    {0x6d6f6465, 21721, 9, 1, 7134, 0},
+    {0x6e617669, 17742, 10, 1, 7134, 0},
+    {0x70617261, 14172, 11, 1, 7134, 0},
+    {0x70617261, 14183, 11, 1, 7134, 0},
+    {0x70617373, 778, 21, 1, 7134, 0},
+    {0x70696c6f, 36959, 5, 1, 7134, 0},
+    {0x70726573, 4357, 5, 1, 7134, 0},
+    {0x70726f64, 14249, 10, 1, 7134, 0},
+    {0x72656372, 18052, 10, 1, 7134, 0},
+    {0x72657062, 32919, 7, 1, 7134, 0},
+    {0x72657300, 4358, 3, 1, 7134, 0},
+    {0x72657365, 27503, 8, 1, 7134, 0},
+    {0x726f746f, 18092, 10, 1, 7134, 0},
+    {0x73616665, 2584, 6, 1, 7134, 0},
+    {0x73636965, 22387, 9, 1, 7134, 0},
+    {0x73657276, 27735, 8, 1, 7134, 0},
+    {0x73686f77, 27871, 4, 1, 7134, 0},
+    {0x736b7964, 22666, 9, 1, 7134, 0},
+    {0x736f6674, 27935, 8, 1, 7134, 0},
+    {0x73747564, 10428, 7, 1, 7134, 0},
+    {0x74726164, 37829, 6, 1, 7134, 0},
+    {0x74726164, 33668, 7, 1, 7134, 0},
+    {0x74726169, 1100, 7, 1, 7134, 0},
+    {0x756e696f, 12946, 5, 1, 7134, 0},
+    {0x776f726b, 11695, 12, 1, 7134, 0},
+    {0x776f726b, 28847, 5, 1, 7134, 0},
+    {0x636f6d00, 19, 3, 1, 7134, 0},
+    {0x65647500, 9778, 3, 1, 7134, 0},
+    {0x676f7600, 810, 3, 1, 7134, 0},
+    {0x6e657400, 2944, 3, 1, 7134, 0},
+    {0x6f726700, 6352, 3, 1, 7134, 0},
+    {0x636f0000, 4, 2, 1, 7134, 0},
+    {0x636f6d00, 19, 3, 1, 7134, 0},
+    {0x6e657400, 2944, 3, 1, 7134, 0},
+    {0x6e6f6d00, 5080, 3, 1, 7134, 0},
+    {0x6f726700, 6352, 3, 1, 7134, 0},
+    {0x636f6d00, 19, 3, 1, 7134, 0},
+    {0x6e657400, 2944, 3, 1, 7134, 0},
+    {0x6f666600, 7993, 3, 1, 7134, 0},
+    {0x6f726700, 6352, 3, 1, 7134, 0},
+    {0x75777500, 15684, 3, 1, 7134, 0},
+    {0x626c6f67, 23967, 8, 1, 7134, 0},
+    {0x636f6d00, 19, 3, 1, 7134, 0},
+    {0x65647500, 9778, 3, 1, 7134, 0},
+    {0x676f7600, 810, 3, 1, 7134, 0},
+    {0x6d696c00, 6019, 3, 1, 7134, 0},
+    {0x6e657400, 2944, 3, 1, 7134, 0},
+    {0x6f726700, 6352, 3, 1, 7134, 0},
+    {0x626c6f67, 23967, 8, 1, 7134, 0},
+    {0x636f0000, 4, 2, 1, 7134, 0},
+    {0x636f6d00, 19, 3, 1, 7134, 0},
+    {0x636f6d6d, 29818, 7, 1, 7134, 0},
+    {0x6e656b6f, 25965, 4, 1, 7134, 0},
+    {0x6e657400, 2944, 3, 1, 7134, 0},
+    {0x6e796161, 41618, 4, 1, 7134, 0},
+    {0x6f726700, 6352, 3, 1, 7134, 0},
+    {0x72616469, 10151, 5, 1, 7134, 0},
+    {0x636f0000, 4, 2, 1, 7134, 0},
+    {0x65640000, 1023, 2, 1, 7134, 0},
+    {0x67760000, 11610, 2, 1, 7134, 0},
+    {0x69740000, 127, 2, 1, 7134, 0},
+    {0x6f670000, 573, 2, 1, 7134, 0},
+    {0x70620000, 9846, 2, 1, 7134, 0},
+    {0x62656765, 38495, 5, 2, 7134, 0},
+    {0x626f6f6b, 16122, 10, 1, 7134, 0},
+    {0x636c6572, 16282, 5, 1, 7134, 0},
+    {0x636c6572, 16282, 10, 1, 7134, 0},
+    {0x64657461, 41122, 4, 1, 7134, 0},
+    {0x64657665, 20047, 9, 2, 7134, 0},
+    {0x65617379, 20137, 9, 1, 7134, 0},
+    {0x65646765, 13127, 11, 1, 7134, 0},
+    {0x656e6372, 16390, 4, 1, 7134, 0},
+    {0x66697265, 30301, 7, 1, 7134, 0},
+    {0x6672616d, 10111, 6, 1, 7134, 0},
+    {0x68617375, 16832, 6, 1, 7134, 0},
+    {0x6c6f6769, 21487, 9, 1, 7134, 0},
+    {0x6d657373, 26479, 8, 1, 7134, 0},
+    {0x6e65746c, 32387, 7, 1, 7134, 0},
+    {0x6e6f6f70, 41606, 4, 1, 7134, 0},
+    {0x6e6f7274, 17792, 10, 2, 7134, 0},
+    {0x6f6e6469, 6807, 14, 1, 7134, 0},
+    {0x6f6e666c, 10975, 12, 1, 7134, 0},
+    {0x706c6174, 22144, 9, 1, 7134, 0},
+    {0x72756e00, 5988, 3, 1, 7134, 1},
+    {0x736e6f77, 22684, 9, 1, 7135, 1},
+    {0x73747265, 11431, 9, 1, 7136, 0},
+    {0x74656c65, 33486, 7, 1, 7136, 0},
+    {0x74797065, 23107, 9, 1, 7136, 0},
+    {0x76657263, 28703, 6, 1, 7136, 0},
+    {0x77656200, 123, 3, 1, 7136, 0},
+    {0x776e6578, 40835, 5, 1, 7136, 0},
+    {0x62657400, 10166, 3, 1, 7136, 0},
+    {0x636f6d00, 19, 3, 1, 7136, 1},
+    {0x636f6f70, 12918, 4, 1, 7137, 0},
+    {0x65647500, 9778, 3, 1, 7137, 0},
+    {0x676f6200, 38533, 3, 1, 7137, 0},
+    {0x676f7600, 810, 3, 1, 7137, 0},
+    {0x696e7400, 2022, 3, 1, 7137, 0},
+    {0x6d696c00, 6019, 3, 1, 7137, 0},
+    {0x6d757369, 36485, 6, 1, 7137, 0},
+    {0x6d757475, 2088, 6, 1, 7137, 0},
+    {0x6e657400, 2944, 3, 1, 7137, 0},
+    {0x6f726700, 6352, 3, 1, 7137, 0},
+    {0x73656e61, 37301, 6, 1, 7137, 0},
+    {0x74757200, 1109, 3, 1, 7137, 0},
+    {0x65313634, 41150, 4, 1, 7137, 0},
+    {0x696e2d61, 31295, 7, 1, 7137, 0},
+    {0x69703600, 42207, 3, 1, 7137, 0},
+    {0x69726973, 27836, 4, 1, 7137, 0},
+    {0x75726900, 3809, 3, 1, 7137, 0},
+    {0x75726e00, 17044, 3, 1, 7137, 0},
+    {0x676f7600, 810, 3, 1, 7137, 0},
+    {0x636c6f75, 29776, 7, 1, 7137, 0},
+    {0x31323377, 12533, 11, 1, 7137, 0},
+    {0x31326870, 40934, 4, 1, 7137, 0},
+    {0x32697800, 42018, 3, 1, 7137, 0},
+    {0x346c696d, 38320, 5, 1, 7137, 0},
+    {0x61630000, 35, 2, 1, 7137, 1},
+    {0x62697a00, 38535, 3, 1, 7138, 0},
+    {0x636f0000, 4, 2, 1, 7138, 1},
+    {0x66756e6b, 20398, 9, 0, 7139, 1},
+    {0x66757475, 20416, 9, 2, 7140, 2},
+    {0x66757475, 8129, 13, 1, 7142, 0},
+    {0x66757475, 8142, 13, 1, 7142, 0},
+    {0x67760000, 11610, 2, 1, 7142, 0},
+    {0x696e666f, 21606, 4, 1, 7142, 0},
+    {0x6c696d61, 21442, 9, 1, 7142, 0},
+    {0x6d797370, 10819, 12, 1, 7142, 0},
+    {0x6f720000, 5, 2, 1, 7142, 0},
+    {0x6f727473, 27199, 8, 0, 7142, 2},
+    {0x70726976, 220, 4, 1, 7144, 0},
+    {0x61637400, 2800, 3, 1, 7144, 0},
+    {0x61736e00, 4746, 3, 1, 7144, 0},
+    {0x636f6d00, 19, 3, 1, 7144, 3},
+    {0x636f6e66, 13922, 4, 1, 7147, 0},
+    {0x65647500, 9778, 3, 1, 7147, 9},
+    {0x676f7600, 810, 3, 1, 7156, 5},
+    {0x69640000, 458, 2, 1, 7161, 0},
+    {0x696e666f, 21606, 4, 1, 7161, 0},
+    {0x6e657400, 2944, 3, 1, 7161, 0},
+    {0x6e737700, 42285, 3, 1, 7161, 0},
+    {0x6e740000, 50, 2, 1, 7161, 0},
+    {0x6f726700, 6352, 3, 1, 7161, 0},
+    {0x6f7a0000, 888, 2, 1, 7161, 0},
+    {0x716c6400, 42339, 3, 1, 7161, 0},
+    {0x73610000, 506, 2, 1, 7161, 0},
+    {0x74617300, 7977, 3, 1, 7161, 0},
+    {0x76696300, 6102, 3, 1, 7161, 0},
+    {0x77610000, 1758, 2, 1, 7161, 0},
+    {0x636f6d00, 19, 3, 1, 7161, 0},
+    {0x62650000, 328, 2, 1, 7161, 0},
+    {0x63617400, 88, 3, 1, 7161, 0},
+    {0x65730000, 27, 2, 1, 7161, 0},
+    {0x65750000, 766, 2, 1, 7161, 0},
+    {0x67670000, 1673, 2, 1, 7161, 0},
+    {0x6d630000, 1647, 2, 1, 7161, 0},
+    {0x75730000, 767, 2, 1, 7161, 0},
+    {0x78790000, 11069, 2, 1, 7161, 0},
+    {0x62697a00, 38535, 3, 1, 7161, 0},
+    {0x636f6d00, 19, 3, 1, 7161, 0},
+    {0x65647500, 9778, 3, 1, 7161, 0},
+    {0x676f7600, 810, 3, 1, 7161, 0},
+    {0x696e666f, 21606, 4, 1, 7161, 0},
+    {0x696e7400, 2022, 3, 1, 7161, 0},
+    {0x6d696c00, 6019, 3, 1, 7161, 0},
+    {0x6e616d65, 17722, 4, 1, 7161, 0},
+    {0x6e657400, 2944, 3, 1, 7161, 0},
+    {0x6f726700, 6352, 3, 1, 7161, 0},
+    {0x70700000, 1404, 2, 1, 7161, 0},
+    {0x70726f00, 5042, 3, 1, 7161, 0},
+    {0x626c6f67, 23967, 8, 1, 7161, 0},
+    {0x636f6d00, 19, 3, 1, 7161, 0},
+    {0x65647500, 9778, 3, 1, 7161, 0},
+    {0x676f7600, 810, 3, 1, 7161, 0},
+    {0x6d696c00, 6019, 3, 1, 7161, 0},
+    {0x6e657400, 2944, 3, 1, 7161, 0},
+    {0x6f726700, 6352, 3, 1, 7161, 0},
+    {0x72730000, 868, 2, 1, 7161, 0},
+    {0x61757300, 19660, 3, 1, 7161, 0},
+    {0x6e7a0000, 738, 2, 1, 7161, 0},
+    {0x62697a00, 38535, 3, 1, 7161, 0},
+    {0x636f0000, 4, 2, 1, 7161, 0},
+    {0x636f6d00, 19, 3, 1, 7161, 0},
+    {0x65647500, 9778, 3, 1, 7161, 0},
+    {0x676f7600, 810, 3, 1, 7161, 0},
+    {0x696e666f, 21606, 4, 1, 7161, 0},
+    {0x6e657400, 2944, 3, 1, 7161, 0},
+    {0x6f726700, 6352, 3, 1, 7161, 0},
+    {0x73746f72, 10046, 5, 1, 7161, 0},
+    {0x74760000, 2443, 2, 1, 7161, 0},
+    {0x31323377, 15842, 10, 1, 7161, 0},
+    {0x61630000, 35, 2, 1, 7161, 0},
+    {0x626c6f67, 23967, 8, 1, 7161, 0},
+    {0x696e7465, 2022, 18, 0, 7161, 1},
+    {0x6b756c65, 26039, 8, 0, 7162, 1},
+    {0x6d797370, 10819, 12, 1, 7163, 0},
+    {0x7472616e, 28495, 8, 2, 7163, 0},
+    {0x77656268, 18742, 10, 1, 7163, 0},
+    {0x676f7600, 810, 3, 1, 7163, 0},
+    {0x30000000, 552, 1, 1, 7163, 0},
+    {0x31000000, 144, 1, 1, 7163, 0},
+    {0x32000000, 33, 1, 1, 7163, 0},
+    {0x33000000, 121, 1, 1, 7163, 0},
+    {0x34000000, 1292, 1, 1, 7163, 0},
+    {0x35000000, 1295, 1, 1, 7163, 0},
+    {0x36000000, 429, 1, 1, 7163, 0},
+    {0x37000000, 383, 1, 1, 7163, 0},
+    {0x38000000, 1294, 1, 1, 7163, 0},
+    {0x39000000, 34, 1, 1, 7163, 0},
+    {0x61000000, 26, 1, 1, 7163, 0},
+    {0x62000000, 125, 1, 1, 7163, 0},
+    {0x62617273, 12676, 5, 1, 7163, 0},
+    {0x626c6f67, 23967, 8, 1, 7163, 0},
+    {0x63000000, 4, 1, 1, 7163, 0},
+    {0x64000000, 48, 1, 1, 7163, 0},
+    {0x65000000, 8, 1, 1, 7163, 0},
+    {0x66000000, 61, 1, 1, 7163, 0},
+    {0x67000000, 30, 1, 1, 7163, 0},
+    {0x68000000, 31, 1, 1, 7163, 0},
+    {0x69000000, 9, 1, 1, 7163, 0},
+    {0x6a000000, 593, 1, 1, 7163, 0},
+    {0x6b000000, 870, 1, 1, 7163, 0},
+    {0x6c000000, 17, 1, 1, 7163, 0},
+    {0x6d000000, 21, 1, 1, 7163, 0},
+    {0x6e000000, 1, 1, 1, 7163, 0},
+    {0x6f000000, 5, 1, 1, 7163, 0},
+    {0x70000000, 67, 1, 1, 7163, 0},
+    {0x71000000, 584, 1, 1, 7163, 0},
+    {0x72000000, 6, 1, 1, 7163, 0},
+    {0x73000000, 11, 1, 1, 7163, 0},
+    {0x74000000, 15, 1, 1, 7163, 0},
+    {0x75000000, 22, 1, 1, 7163, 0},
+    {0x76000000, 97, 1, 1, 7163, 0},
+    {0x77000000, 123, 1, 1, 7163, 0},
+    {0x78000000, 0, 1, 1, 7163, 0},
+    {0x79000000, 1120, 1, 1, 7163, 0},
+    {0x7a000000, 227, 1, 1, 7163, 0},
+    {0x636f6d00, 19, 3, 1, 7163, 0},
+    {0x65647500, 9778, 3, 1, 7163, 0},
+    {0x676f7600, 810, 3, 1, 7163, 0},
+    {0x6e657400, 2944, 3, 1, 7163, 0},
+    {0x6f726700, 6352, 3, 1, 7163, 0},
+    {0x636f0000, 4, 2, 1, 7163, 0},
+    {0x636f6d00, 19, 3, 1, 7163, 0},
+    {0x65647500, 9778, 3, 1, 7163, 0},
+    {0x6f720000, 5, 2, 1, 7163, 0},
+    {0x6f726700, 6352, 3, 1, 7163, 0},
+    {0x61637469, 12555, 11, 1, 7163, 0},
+    {0x636c6f75, 29776, 7, 1, 7163, 0},
+    {0x6473636c, 27672, 7, 1, 7163, 0},
+    {0x64796e64, 6317, 6, 1, 7163, 0},
+    {0x666f722d, 16662, 10, 1, 7163, 0},
+    {0x666f722d, 8199, 8, 1, 7163, 0},
+    {0x666f722d, 24791, 8, 1, 7163, 0},
+    {0x666f722d, 30371, 7, 1, 7163, 0},
+    {0x6a6f7a69, 41378, 4, 1, 7163, 0},
+    {0x6d6d6166, 36383, 6, 1, 7163, 0},
+    {0x6d796674, 39680, 5, 1, 7163, 0},
+    {0x6e6f2d69, 39820, 5, 1, 7163, 0},
+    {0x6f727800, 18867, 3, 1, 7163, 0},
+    {0x73656c66, 37283, 6, 1, 7163, 0},
+    {0x77656268, 38147, 6, 1, 7163, 0},
+    {0x61667269, 16546, 6, 1, 7163, 0},
+    {0x6167726f, 6442, 4, 1, 7163, 0},
+    {0x61726368, 12621, 11, 1, 7163, 0},
+    {0x61737375, 38425, 5, 1, 7163, 0},
+    {0x61766f63, 29293, 7, 1, 7163, 0},
+    {0x626c6f67, 23967, 8, 1, 7163, 0},
+    {0x636f0000, 4, 2, 1, 7163, 0},
+    {0x636f6d00, 19, 3, 1, 7163, 0},
+    {0x65636f00, 18, 3, 1, 7163, 0},
+    {0x65636f6e, 24567, 5, 1, 7163, 0},
+    {0x65647500, 9778, 3, 1, 7163, 0},
+    {0x696e666f, 21606, 4, 1, 7163, 0},
+    {0x6c6f6973, 31995, 7, 1, 7163, 0},
+    {0x6d6f6e65, 39665, 5, 1, 7163, 0},
+    {0x6e657400, 2944, 3, 1, 7163, 0},
+    {0x6f726700, 6352, 3, 1, 7163, 0},
+    {0x6f746500, 2500, 3, 1, 7163, 0},
+    {0x72657374, 18082, 10, 1, 7163, 0},
+    {0x72657374, 20247, 5, 1, 7163, 0},
+    {0x746f7572, 33633, 7, 1, 7163, 0},
+    {0x756e6976, 18602, 4, 1, 7163, 0},
+    {0x636f6d00, 19, 3, 1, 7163, 0},
+    {0x65647500, 9778, 3, 1, 7163, 0},
+    {0x676f7600, 810, 3, 1, 7163, 0},
+    {0x6e657400, 2944, 3, 1, 7163, 0},
+    {0x6f726700, 6352, 3, 1, 7163, 0},
+    {0x636f0000, 4, 2, 1, 7163, 0},
+    {0x636f6d00, 19, 3, 1, 7163, 0},
+    {0x65647500, 9778, 3, 1, 7163, 0},
+    {0x676f7600, 810, 3, 1, 7163, 0},
+    {0x6e657400, 2944, 3, 1, 7163, 0},
+    {0x6f726700, 6352, 3, 1, 7163, 0},
+    {0x61636164, 23687, 8, 1, 7163, 0},
+    {0x6167726f, 6442, 4, 1, 7163, 0},
+    {0x61727465, 3776, 4, 1, 7163, 0},
+    {0x626c6f67, 3492, 4, 1, 7163, 0},
+    {0x626f6c69, 29461, 7, 1, 7163, 0},
+    {0x6369656e, 29727, 7, 1, 7163, 0},
+    {0x636f6d00, 19, 3, 1, 7163, 0},
+    {0x636f6f70, 12918, 11, 1, 7163, 0},
+    {0x64656d6f, 16472, 10, 1, 7163, 0},
+    {0x6465706f, 29972, 7, 1, 7163, 0},
+    {0x65636f6c, 24559, 8, 1, 7163, 0},
+    {0x65636f6e, 24567, 8, 1, 7163, 0},
+    {0x65647500, 9778, 3, 1, 7163, 0},
+    {0x656d7072, 30140, 7, 1, 7163, 0},
+    {0x676f6200, 38533, 3, 1, 7163, 0},
+    {0x696e6469, 25351, 8, 1, 7163, 0},
+    {0x696e6475, 20785, 9, 1, 7163, 0},
+    {0x696e666f, 21606, 4, 1, 7163, 0},
+    {0x696e7400, 2022, 3, 1, 7163, 0},
+    {0x6d656469, 26447, 8, 1, 7163, 0},
+    {0x6d696c00, 6019, 3, 1, 7163, 0},
+    {0x6d6f7669, 17642, 10, 1, 7163, 0},
+    {0x6d757369, 36485, 6, 1, 7163, 0},
+    {0x6e617475, 1107, 7, 1, 7163, 0},
+    {0x6e657400, 2944, 3, 1, 7163, 0},
+    {0x6e6f6d62, 36701, 6, 1, 7163, 0},
+    {0x6e6f7469, 27055, 8, 1, 7163, 0},
+    {0x6f726700, 6352, 3, 1, 7163, 0},
+    {0x70617472, 36917, 6, 1, 7163, 0},
+    {0x706c7572, 8727, 13, 1, 7163, 0},
+    {0x706f6c69, 27335, 8, 1, 7163, 0},
+    {0x70726f66, 14260, 11, 1, 7163, 0},
+    {0x70756562, 37025, 6, 1, 7163, 0},
+    {0x72657669, 32940, 7, 1, 7163, 0},
+    {0x73616c75, 40270, 5, 1, 7163, 0},
+    {0x7465636e, 18502, 10, 1, 7163, 0},
+    {0x746b7361, 40600, 5, 1, 7163, 0},
+    {0x7472616e, 18572, 10, 1, 7163, 0},
+    {0x74760000, 2443, 2, 1, 7163, 0},
+    {0x77656200, 123, 3, 1, 7163, 0},
+    {0x77696b69, 13112, 4, 1, 7163, 0},
+    {0x39677561, 34157, 6, 1, 7163, 0},
+    {0x61626300, 42024, 3, 1, 7163, 0},
+    {0x61646d00, 18034, 3, 1, 7163, 0},
+    {0x61647600, 729, 3, 1, 7163, 0},
+    {0x61677200, 6442, 3, 1, 7163, 0},
+    {0x616a7500, 31497, 3, 1, 7163, 0},
+    {0x616d0000, 969, 2, 1, 7163, 0},
+    {0x616e616e, 38390, 5, 1, 7163, 0},
+    {0x61706172, 19561, 9, 1, 7163, 0},
+    {0x61707000, 1403, 3, 1, 7163, 0},
+    {0x61727100, 42027, 3, 1, 7163, 0},
+    {0x61727400, 3749, 3, 1, 7163, 0},
+    {0x61746f00, 1003, 3, 1, 7163, 0},
+    {0x62000000, 125, 1, 1, 7163, 0},
+    {0x62617275, 29370, 7, 1, 7163, 0},
+    {0x62656c65, 38505, 5, 1, 7163, 0},
+    {0x62687a00, 42042, 3, 1, 7163, 0},
+    {0x62696200, 16718, 3, 1, 7163, 0},
+    {0x62696f00, 41341, 3, 1, 7163, 0},
+    {0x626c6f67, 3492, 4, 1, 7163, 0},
+    {0x626d6400, 42048, 3, 1, 7163, 0},
+    {0x626f6176, 23991, 8, 1, 7163, 0},
+    {0x62736200, 38856, 3, 1, 7163, 0},
+    {0x63616d70, 7830, 13, 1, 7163, 0},
+    {0x63616d70, 24135, 8, 1, 7163, 0},
+    {0x63617869, 34577, 6, 1, 7163, 0},
+    {0x63696d00, 42084, 3, 1, 7163, 0},
+    {0x636e6700, 42087, 3, 1, 7163, 0},
+    {0x636e7400, 42093, 3, 1, 7163, 0},
+    {0x636f6d00, 19, 3, 1, 7163, 3},
+    {0x636f6e74, 24327, 8, 1, 7166, 0},
+    {0x636f6f70, 12918, 4, 1, 7166, 0},
+    {0x636f7a00, 42099, 3, 1, 7166, 0},
+    {0x63726900, 29909, 3, 1, 7166, 0},
+    {0x63756961, 34703, 6, 1, 7166, 0},
+    {0x63757269, 24359, 8, 1, 7166, 0},
+    {0x64656600, 6240, 3, 1, 7166, 0},
+    {0x64657300, 4115, 3, 1, 7166, 0},
+    {0x64657400, 4149, 3, 1, 7166, 0},
+    {0x64657600, 4572, 3, 1, 7166, 0},
+    {0x65636e00, 18503, 3, 1, 7166, 0},
+    {0x65636f00, 18, 3, 1, 7166, 0},
+    {0x65647500, 9778, 3, 1, 7166, 0},
+    {0x656d7000, 4561, 3, 1, 7166, 0},
+    {0x656e6600, 42129, 3, 1, 7166, 0},
+    {0x656e6700, 782, 3, 1, 7166, 0},
+    {0x65737000, 2097, 3, 1, 7166, 0},
+    {0x65746300, 9960, 3, 1, 7166, 0},
+    {0x65746900, 8400, 3, 1, 7166, 0},
+    {0x66617200, 8090, 3, 1, 7166, 0},
+    {0x66656972, 38875, 5, 1, 7166, 0},
+    {0x666c6f67, 41214, 4, 1, 7166, 0},
+    {0x666c6f72, 30336, 7, 1, 7166, 0},
+    {0x666d0000, 20844, 2, 1, 7166, 0},
+    {0x666e6400, 42147, 3, 1, 7166, 0},
+    {0x666f7274, 34991, 6, 1, 7166, 0},
+    {0x666f7400, 42150, 3, 1, 7166, 0},
+    {0x666f7a00, 42156, 3, 1, 7166, 0},
+    {0x66737400, 42162, 3, 1, 7166, 0},
+    {0x67313200, 42174, 3, 1, 7166, 0},
+    {0x67656f00, 4767, 3, 1, 7166, 0},
+    {0x67676600, 42180, 3, 1, 7166, 0},
+    {0x676f6961, 30952, 7, 1, 7166, 0},
+    {0x676f7600, 810, 3, 1, 7166, 27},
+    {0x67727500, 11121, 3, 1, 7193, 0},
+    {0x696d6200, 19685, 3, 1, 7193, 0},
+    {0x696e6400, 477, 3, 1, 7193, 0},
+    {0x696e6600, 3522, 3, 1, 7193, 0},
+    {0x6a616200, 23877, 3, 1, 7193, 0},
+    {0x6a616d70, 39290, 5, 1, 7193, 0},
+    {0x6a646600, 42216, 3, 1, 7193, 0},
+    {0x6a6f696e, 20965, 9, 1, 7193, 0},
+    {0x6a6f7200, 4084, 3, 1, 7193, 0},
+    {0x6a757300, 3669, 3, 1, 7193, 0},
+    {0x6c656700, 10287, 3, 1, 7193, 27},
+    {0x6c656c00, 13763, 3, 1, 7220, 0},
+    {0x6c6f6700, 1231, 3, 1, 7220, 0},
+    {0x6c6f6e64, 26263, 8, 1, 7220, 0},
+    {0x6d616361, 36077, 6, 1, 7220, 0},
+    {0x6d616365, 36083, 6, 1, 7220, 0},
+    {0x6d616e61, 36113, 6, 1, 7220, 0},
+    {0x6d617269, 32086, 7, 1, 7220, 0},
+    {0x6d617400, 2669, 3, 1, 7220, 0},
+    {0x6d656400, 1498, 3, 1, 7220, 0},
+    {0x6d696c00, 6019, 3, 1, 7220, 0},
+    {0x6d6f7265, 36419, 6, 1, 7220, 0},
+    {0x6d700000, 1960, 2, 1, 7220, 0},
+    {0x6d757300, 1121, 3, 1, 7220, 0},
+    {0x6e617461, 39765, 5, 1, 7220, 0},
+    {0x6e657400, 2944, 3, 1, 7220, 0},
+    {0x6e697465, 32457, 7, 1, 7220, 0},
+    {0x6e6f6d00, 5080, 3, 2, 7220, 0},
+    {0x6e6f7400, 3759, 3, 1, 7220, 0},
+    {0x6e747200, 1360, 3, 1, 7220, 0},
+    {0x6f646f00, 4850, 3, 1, 7220, 0},
+    {0x6f6e6700, 13400, 3, 1, 7220, 0},
+    {0x6f726700, 6352, 3, 1, 7220, 0},
+    {0x6f736173, 36857, 6, 1, 7220, 0},
+    {0x70616c6d, 36899, 6, 1, 7220, 0},
+    {0x706f6100, 9412, 3, 1, 7220, 0},
+    {0x70706700, 35115, 3, 1, 7220, 0},
+    {0x70726f00, 5042, 3, 1, 7220, 0},
+    {0x70736300, 16190, 3, 1, 7220, 0},
+    {0x70736900, 18694, 3, 1, 7220, 0},
+    {0x70766800, 42321, 3, 1, 7220, 0},
+    {0x71736c00, 42342, 3, 1, 7220, 0},
+    {0x72616469, 10151, 5, 1, 7220, 0},
+    {0x72656300, 2808, 3, 1, 7220, 0},
+    {0x72656369, 37085, 6, 1, 7220, 0},
+    {0x72657000, 3558, 3, 1, 7220, 0},
+    {0x72696265, 27511, 8, 1, 7220, 0},
+    {0x72696f00, 11143, 3, 1, 7220, 0},
+    {0x72696f62, 22297, 9, 1, 7220, 0},
+    {0x72696f70, 27519, 8, 1, 7220, 0},
+    {0x73616c76, 11239, 8, 1, 7220, 0},
+    {0x73616d70, 40275, 5, 1, 7220, 0},
+    {0x73616e74, 18142, 10, 1, 7220, 0},
+    {0x73616e74, 18152, 10, 1, 7220, 0},
+    {0x73616f62, 14370, 11, 1, 7220, 0},
+    {0x73616f67, 27615, 8, 1, 7220, 0},
+    {0x73656700, 27041, 3, 1, 7220, 0},
+    {0x736a6300, 42363, 3, 1, 7220, 0},
+    {0x736c6700, 42369, 3, 1, 7220, 0},
+    {0x736c7a00, 42372, 3, 1, 7220, 0},
+    {0x736f726f, 27959, 8, 1, 7220, 0},
+    {0x73727600, 42384, 3, 1, 7220, 0},
+    {0x74617869, 41838, 4, 1, 7220, 0},
+    {0x74630000, 942, 2, 1, 7220, 0},
+    {0x74656300, 9756, 3, 1, 7220, 0},
+    {0x74656f00, 5265, 3, 1, 7220, 0},
+    {0x74686500, 137, 3, 1, 7220, 0},
+    {0x746d7000, 42402, 3, 1, 7220, 0},
+    {0x74726400, 42405, 3, 1, 7220, 0},
+    {0x74757200, 1109, 3, 1, 7220, 0},
+    {0x74760000, 2443, 2, 1, 7220, 0},
+    {0x75646900, 10337, 3, 1, 7220, 0},
+    {0x76657400, 12559, 3, 1, 7220, 0},
+    {0x76697800, 42429, 3, 1, 7220, 0},
+    {0x766c6f67, 41950, 4, 1, 7220, 0},
+    {0x77696b69, 13112, 4, 1, 7220, 0},
+    {0x7a6c6700, 42474, 3, 1, 7220, 0},
+    {0x636f6d00, 19, 3, 1, 7220, 0},
+    {0x65647500, 9778, 3, 1, 7220, 0},
+    {0x676f7600, 810, 3, 1, 7220, 0},
+    {0x6e657400, 2944, 3, 1, 7220, 0},
+    {0x6f726700, 6352, 3, 1, 7220, 0},
+    {0x77650000, 123, 2, 1, 7220, 0},
+    {0x636f6d00, 19, 3, 1, 7220, 0},
+    {0x65647500, 9778, 3, 1, 7220, 0},
+    {0x676f7600, 810, 3, 1, 7220, 0},
+    {0x6e657400, 2944, 3, 1, 7220, 0},
+    {0x6f726700, 6352, 3, 1, 7220, 0},
+    {0x636c6f75, 20011, 9, 1, 7220, 0},
+    {0x636f0000, 4, 2, 1, 7220, 0},
+    {0x636f0000, 4, 2, 1, 7220, 0},
+    {0x6f726700, 6352, 3, 1, 7220, 0},
+    {0x636f6d00, 19, 3, 1, 7220, 1},
+    {0x676f7600, 810, 3, 1, 7221, 0},
+    {0x6d656469, 21595, 9, 1, 7221, 0},
+    {0x6d696c00, 6019, 3, 1, 7221, 0},
+    {0x6d79636c, 32268, 7, 1, 7221, 0},
+    {0x6f660000, 1015, 2, 1, 7221, 0},
+    {0x636f6d00, 19, 3, 1, 7221, 0},
+    {0x65647500, 9778, 3, 1, 7221, 0},
+    {0x676f7600, 810, 3, 1, 7221, 0},
+    {0x67736a00, 42189, 3, 1, 7221, 0},
+    {0x6e657400, 2944, 3, 1, 7221, 0},
+    {0x6f726700, 6352, 3, 1, 7221, 0},
+    {0x7a610000, 739, 2, 1, 7221, 0},
+    {0x61620000, 672, 2, 1, 7221, 0},
+    {0x61776465, 38450, 5, 2, 7221, 0},
+    {0x62617273, 12676, 5, 1, 7221, 0},
+    {0x62630000, 1800, 2, 1, 7221, 0},
+    {0x626c6f67, 23967, 8, 1, 7221, 0},
+    {0x636f0000, 4, 2, 1, 7221, 0},
+    {0x67630000, 562, 2, 1, 7221, 0},
+    {0x6d620000, 4433, 2, 1, 7221, 0},
+    {0x6d797370, 10819, 12, 1, 7221, 0},
+    {0x6e620000, 881, 2, 1, 7221, 0},
+    {0x6e660000, 3523, 2, 1, 7221, 0},
+    {0x6e6c0000, 5838, 2, 1, 7221, 0},
+    {0x6e6f2d69, 39820, 5, 1, 7221, 0},
+    {0x6e730000, 45, 2, 1, 7221, 0},
+    {0x6e740000, 50, 2, 1, 7221, 0},
+    {0x6e750000, 4954, 2, 1, 7221, 0},
+    {0x6f6e0000, 92, 2, 1, 7221, 0},
+    {0x70650000, 481, 2, 1, 7221, 0},
+    {0x71630000, 12203, 2, 1, 7221, 0},
+    {0x736b0000, 869, 2, 1, 7221, 0},
+    {0x796b0000, 5036, 2, 1, 7221, 0},
+    {0x6e616275, 41582, 4, 0, 7221, 1},
+    {0x636c6f75, 29776, 7, 1, 7222, 0},
+    {0x63737800, 42108, 3, 1, 7222, 0},
+    {0x66616e74, 8077, 13, 1, 7222, 0},
+    {0x66747061, 20344, 9, 1, 7222, 0},
+    {0x67616d65, 13369, 11, 1, 7222, 0},
+    {0x6d797068, 26751, 8, 1, 7222, 0},
+    {0x73637261, 22396, 9, 1, 7222, 0},
+    {0x73706177, 40460, 5, 0, 7222, 1},
+    {0x74776d61, 37895, 6, 1, 7223, 0},
+    {0x676f7600, 810, 3, 1, 7223, 0},
+    {0x626c6f67, 23967, 8, 1, 7223, 0},
+    {0x31323377, 15842, 10, 1, 7223, 0},
+    {0x31326870, 40934, 4, 1, 7223, 0},
+    {0x32697800, 42018, 3, 1, 7223, 0},
+    {0x346c696d, 38320, 5, 1, 7223, 0},
+    {0x626c6f67, 23967, 8, 1, 7223, 0},
+    {0x646e736b, 24424, 7, 1, 7223, 0},
+    {0x66697265, 30287, 7, 2, 7223, 1},
+    {0x666c6f77, 30350, 4, 0, 7224, 2},
+    {0x676f7464, 35177, 6, 1, 7226, 0},
+    {0x6c696d61, 21442, 9, 1, 7226, 0},
+    {0x6c696e6b, 6709, 14, 1, 7226, 0},
+    {0x6d797370, 10819, 12, 1, 7226, 0},
+    {0x73717561, 33332, 7, 1, 7226, 0},
+    {0x61630000, 35, 2, 1, 7226, 0},
+    {0x6173736f, 788, 4, 1, 7226, 0},
+    {0x636f0000, 4, 2, 1, 7226, 0},
+    {0x636f6d00, 19, 3, 1, 7226, 0},
+    {0x65640000, 1023, 2, 1, 7226, 0},
+    {0x65647500, 9778, 3, 1, 7226, 0},
+    {0x66696e00, 720, 3, 1, 7226, 0},
+    {0x676f0000, 810, 2, 1, 7226, 0},
+    {0x676f7576, 41266, 4, 1, 7226, 0},
+    {0x696e7400, 2022, 3, 1, 7226, 0},
+    {0x6d640000, 17714, 2, 1, 7226, 0},
+    {0x6e657400, 2944, 3, 1, 7226, 0},
+    {0x6e6c0000, 5838, 2, 1, 7226, 0},
+    {0x6f720000, 5, 2, 1, 7226, 0},
+    {0x6f726700, 6352, 3, 1, 7226, 0},
+    {0x70726573, 37013, 6, 1, 7226, 0},
+    {0x786e2d2d, 5457, 15, 1, 7226, 0},
+    {0x77777700, 34154, 3, 4, 7226, 0},
+    {0x626c6f67, 23967, 8, 1, 7226, 0},
+    {0x636f0000, 4, 2, 1, 7226, 0},
+    {0x676f6200, 38533, 3, 1, 7226, 0},
+    {0x676f7600, 810, 3, 1, 7226, 0},
+    {0x6d696c00, 6019, 3, 1, 7226, 0},
+    {0x61786172, 29307, 7, 0, 7226, 1},
+    {0x62616e7a, 12654, 6, 2, 7227, 0},
+    {0x64696164, 34781, 6, 1, 7227, 0},
+    {0x656c656d, 20173, 9, 1, 7227, 0},
+    {0x656e636f, 30154, 7, 0, 7227, 1},
+    {0x6a656c61, 25487, 8, 0, 7228, 1},
+    {0x6a656c65, 10531, 4, 1, 7229, 0},
+    {0x6a656e76, 17032, 10, 0, 7229, 2},
+    {0x6a6f7465, 25535, 8, 1, 7231, 0},
+    {0x6b656c69, 31645, 7, 1, 7231, 1},
+    {0x6b756c65, 26039, 8, 1, 7232, 0},
+    {0x6c696e6b, 6709, 8, 1, 7232, 0},
+    {0x6d616765, 13798, 11, 2, 7232, 0},
+    {0x6f6e2d72, 17842, 10, 2, 7232, 0},
+    {0x6f786100, 42297, 3, 1, 7232, 2},
+    {0x70657273, 22126, 9, 1, 7234, 0},
+    {0x7072696d, 27367, 8, 1, 7234, 1},
+    {0x72617665, 32863, 7, 1, 7235, 0},
+    {0x7265636c, 32898, 7, 0, 7235, 3},
+    {0x73637700, 42354, 3, 0, 7238, 8},
+    {0x73656e73, 18232, 10, 2, 7246, 0},
+    {0x73746174, 33346, 7, 2, 7246, 0},
+    {0x74726166, 14634, 11, 1, 7246, 0},
+    {0x7472656e, 11503, 12, 0, 7246, 2},
+    {0x75726f77, 40740, 5, 1, 7248, 0},
+    {0x7661706f, 18662, 5, 1, 7248, 0},
+    {0x766f6f72, 23215, 9, 1, 7248, 0},
+    {0x62617273, 12676, 5, 1, 7248, 0},
+    {0x636c6f75, 29776, 7, 1, 7248, 0},
+    {0x6a656c65, 10531, 4, 1, 7248, 0},
+    {0x636f0000, 4, 2, 1, 7248, 0},
+    {0x636f6d00, 19, 3, 1, 7248, 0},
+    {0x676f7600, 810, 3, 1, 7248, 0},
+    {0x6e657400, 2944, 3, 1, 7248, 0},
+    {0x61630000, 35, 2, 1, 7248, 0},
+    {0x61680000, 2678, 2, 1, 7248, 0},
+    {0x626a0000, 7133, 2, 1, 7248, 0},
+    {0x63616e76, 16182, 10, 1, 7248, 0},
+    {0x636f6d00, 19, 3, 1, 7248, 1},
+    {0x63710000, 42329, 2, 1, 7249, 0},
+    {0x65647500, 9778, 3, 1, 7249, 0},
+    {0x666a0000, 4083, 2, 1, 7249, 0},
+    {0x67640000, 4787, 2, 1, 7249, 0},
+    {0x676f7600, 810, 3, 1, 7249, 0},
+    {0x67730000, 3101, 2, 1, 7249, 0},
+    {0x67780000, 1782, 2, 1, 7249, 0},
+    {0x677a0000, 9125, 2, 1, 7249, 0},
+    {0x68610000, 599, 2, 1, 7249, 0},
+    {0x68620000, 965, 2, 1, 7249, 0},
+    {0x68650000, 138, 2, 1, 7249, 0},
+    {0x68690000, 37, 2, 1, 7249, 0},
+    {0x686b0000, 1753, 2, 1, 7249, 0},
+    {0x686c0000, 874, 2, 1, 7249, 0},
+    {0x686e0000, 5521, 2, 1, 7249, 0},
+    {0x696e7374, 10327, 12, 1, 7249, 0},
+    {0x6a6c0000, 7245, 2, 1, 7249, 0},
+    {0x6a730000, 14563, 2, 1, 7249, 0},
+    {0x6a780000, 1763, 2, 1, 7249, 0},
+    {0x6c6e0000, 5034, 2, 1, 7249, 0},
+    {0x6d696c00, 6019, 3, 1, 7249, 0},
+    {0x6d6f0000, 736, 2, 1, 7249, 0},
+    {0x6e657400, 2944, 3, 1, 7249, 0},
+    {0x6e6d0000, 101, 2, 1, 7249, 0},
+    {0x6e780000, 498, 2, 1, 7249, 0},
+    {0x6f726700, 6352, 3, 1, 7249, 0},
+    {0x71680000, 42479, 2, 1, 7249, 0},
+    {0x71756963, 11071, 12, 0, 7249, 1},
+    {0x73630000, 1512, 2, 1, 7250, 0},
+    {0x73640000, 208, 2, 1, 7250, 0},
+    {0x73680000, 598, 2, 1, 7250, 0},
+    {0x736e0000, 1516, 2, 1, 7250, 0},
+    {0x73780000, 4059, 2, 1, 7250, 0},
+    {0x746a0000, 592, 2, 1, 7250, 0},
+    {0x74770000, 2946, 2, 1, 7250, 0},
+    {0x786a0000, 42481, 2, 1, 7250, 0},
+    {0x786e2d2d, 18832, 10, 1, 7250, 0},
+    {0x786e2d2d, 19082, 10, 1, 7250, 0},
+    {0x786e2d2d, 19172, 10, 1, 7250, 0},
+    {0x787a0000, 42483, 2, 1, 7250, 0},
+    {0x796e0000, 1228, 2, 1, 7250, 0},
+    {0x7a6a0000, 35584, 2, 1, 7250, 0},
+    {0x61727473, 4056, 4, 1, 7250, 0},
+    {0x63617272, 38615, 5, 1, 7250, 0},
+    {0x636f6d00, 19, 3, 1, 7250, 1},
+    {0x63726400, 42102, 3, 1, 7251, 0},
+    {0x65647500, 9778, 3, 1, 7251, 0},
+    {0x66697265, 3548, 16, 1, 7251, 1},
+    {0x6669726d, 24743, 4, 1, 7252, 0},
+    {0x676f7600, 810, 3, 1, 7252, 0},
+    {0x696e666f, 21606, 4, 1, 7252, 0},
+    {0x696e7400, 2022, 3, 1, 7252, 0},
+    {0x6c656164, 21388, 9, 1, 7252, 0},
+    {0x6c706167, 2093, 6, 1, 7252, 0},
+    {0x6d696c00, 6019, 3, 1, 7252, 0},
+    {0x6d797069, 41574, 4, 1, 7252, 0},
+    {0x6e347400, 42264, 3, 1, 7252, 0},
+    {0x6e657400, 2944, 3, 1, 7252, 0},
+    {0x6e6f6d00, 5080, 3, 1, 7252, 0},
+    {0x6f726700, 6352, 3, 1, 7252, 0},
+    {0x6f746170, 41658, 4, 2, 7252, 0},
+    {0x72656300, 2808, 3, 1, 7252, 0},
+    {0x7265706c, 3558, 4, 1, 7252, 1},
+    {0x73757061, 28063, 8, 1, 7253, 0},
+    {0x77656200, 123, 3, 1, 7253, 0},
+    {0x6f776f00, 11694, 3, 2, 7253, 0},
+    {0x30303177, 34151, 6, 1, 7253, 0},
+    {0x30656d6d, 40930, 4, 2, 7253, 0},
+    {0x316b6170, 38315, 5, 1, 7253, 0},
+    {0x33757469, 15852, 10, 1, 7253, 0},
+    {0x34750000, 18900, 2, 1, 7253, 0},
+    {0x61646f62, 7674, 13, 1, 7253, 1},
+    {0x61667269, 16546, 6, 1, 7254, 0},
+    {0x6169726b, 7687, 10, 1, 7254, 0},
+    {0x6169726b, 7687, 13, 1, 7254, 0},
+    {0x61697665, 15882, 10, 1, 7254, 0},
+    {0x616c7068, 2543, 17, 1, 7254, 0},
+    {0x616d617a, 19471, 9, 0, 7254, 50},
+    {0x616d7363, 15942, 10, 1, 7304, 0},
+    {0x61707063, 23767, 8, 1, 7304, 0},
+    {0x6170706c, 23775, 8, 1, 7304, 0},
+    {0x61707073, 6037, 14, 1, 7304, 0},
+    {0x61707073, 1403, 19, 1, 7304, 0},
+    {0x61707073, 29188, 7, 1, 7304, 1},
+    {0x61720000, 639, 2, 1, 7305, 0},
+    {0x61757468, 3356, 16, 1, 7305, 0},
+    {0x61757468, 9811, 12, 1, 7305, 0},
+    {0x61777367, 987, 20, 1, 7305, 0},
+    {0x6177736d, 29300, 7, 1, 7305, 0},
+    {0x62616c65, 6093, 14, 1, 7305, 0},
+    {0x62617273, 12676, 11, 1, 7305, 0},
+    {0x62617273, 12687, 11, 1, 7305, 0},
+    {0x62657461, 16062, 10, 1, 7305, 0},
+    {0x626c6f67, 29447, 7, 1, 7305, 0},
+    {0x626c6f67, 23967, 8, 1, 7305, 0},
+    {0x626c6f67, 23975, 8, 1, 7305, 0},
+    {0x626c6f78, 29454, 7, 1, 7305, 0},
+    {0x626f756e, 12775, 11, 1, 7305, 2},
+    {0x626f7574, 34523, 6, 1, 7307, 0},
+    {0x62706c61, 29489, 7, 1, 7307, 0},
+    {0x62720000, 750, 2, 1, 7307, 0},
+    {0x6275696c, 7804, 13, 1, 7307, 0},
+    {0x6361666a, 38590, 5, 1, 7307, 0},
+    {0x63616e76, 16182, 10, 1, 7307, 0},
+    {0x63656368, 29629, 7, 1, 7307, 0},
+    {0x63662d69, 29643, 7, 1, 7307, 0},
+    {0x63697363, 16272, 10, 1, 7307, 0},
+    {0x636c6963, 9955, 12, 1, 7307, 0},
+    {0x636c6f75, 4482, 15, 1, 7307, 0},
+    {0x636c6f75, 4497, 15, 1, 7307, 0},
+    {0x636c6f75, 4512, 15, 1, 7307, 0},
+    {0x636e0000, 6219, 2, 1, 7307, 0},
+    {0x636f0000, 4, 2, 1, 7307, 0},
+    {0x636f6465, 16768, 4, 0, 7307, 3},
+    {0x636f6465, 24303, 8, 1, 7310, 0},
+    {0x63757374, 9979, 12, 2, 7310, 3},
+    {0x64616d6e, 16412, 10, 1, 7313, 0},
+    {0x64617461, 16432, 10, 0, 7313, 2},
+    {0x64617474, 16442, 10, 1, 7315, 0},
+    {0x64617474, 16452, 10, 1, 7315, 0},
+    {0x64617474, 24399, 8, 1, 7315, 0},
+    {0x64646e73, 38715, 5, 1, 7315, 0},
+    {0x64646e73, 24407, 8, 1, 7315, 0},
+    {0x64646e73, 24415, 8, 1, 7315, 0},
+    {0x64646e73, 24423, 8, 1, 7315, 0},
+    {0x64646e73, 24431, 8, 1, 7315, 0},
+    {0x64650000, 48, 2, 1, 7315, 0},
+    {0x6465762d, 4572, 15, 1, 7315, 0},
+    {0x64657663, 7947, 13, 2, 7315, 0},
+    {0x64696769, 1914, 18, 2, 7315, 0},
+    {0x64697363, 13006, 11, 1, 7315, 0},
+    {0x64697363, 16482, 10, 1, 7315, 0},
+    {0x64697463, 13017, 11, 1, 7315, 0},
+    {0x646e7361, 24487, 8, 1, 7315, 0},
+    {0x646e7364, 29986, 7, 1, 7315, 0},
+    {0x646e7369, 16492, 10, 1, 7315, 0},
+    {0x646f6573, 13028, 11, 1, 7315, 0},
+    {0x646f6e74, 20083, 9, 1, 7315, 0},
+    {0x646f6f6d, 30021, 7, 1, 7315, 0},
+    {0x646f7061, 34811, 6, 1, 7315, 0},
+    {0x64726179, 24527, 8, 1, 7315, 0},
+    {0x64726561, 10015, 12, 1, 7315, 0},
+    {0x64736d79, 30042, 7, 1, 7315, 0},
+    {0x64796e2d, 16522, 10, 1, 7315, 0},
+    {0x64796e61, 24543, 8, 1, 7315, 0},
+    {0x64796e64, 6317, 14, 1, 7315, 0},
+    {0x64796e64, 6331, 14, 1, 7315, 0},
+    {0x64796e64, 13050, 11, 1, 7315, 0},
+    {0x64796e64, 13061, 11, 1, 7315, 0},
+    {0x64796e64, 13072, 11, 1, 7315, 0},
+    {0x64796e64, 20119, 9, 1, 7315, 0},
+    {0x64796e64, 13083, 11, 1, 7315, 0},
+    {0x64796e64, 7986, 13, 1, 7315, 0},
+    {0x64796e64, 13094, 11, 1, 7315, 0},
+    {0x64796e64, 7999, 13, 1, 7315, 0},
+    {0x64796e64, 8012, 13, 1, 7315, 0},
+    {0x64796e64, 16532, 10, 1, 7315, 0},
+    {0x64796e64, 13105, 11, 1, 7315, 0},
+    {0x64796e64, 13116, 11, 1, 7315, 0},
+    {0x64796e6e, 38785, 5, 1, 7315, 0},
+    {0x656c6173, 3452, 16, 1, 7315, 17},
+    {0x656e636f, 20200, 9, 1, 7332, 0},
+    {0x6573742d, 4647, 15, 1, 7332, 0},
+    {0x6573742d, 4662, 15, 1, 7332, 0},
+    {0x6573742d, 8064, 13, 1, 7332, 0},
+    {0x6573742d, 3484, 16, 1, 7332, 0},
+    {0x65750000, 766, 2, 1, 7332, 0},
+    {0x6576656e, 24671, 8, 0, 7332, 8},
+    {0x66616d69, 24679, 8, 1, 7340, 0},
+    {0x66617374, 13171, 11, 1, 7340, 0},
+    {0x66617374, 3500, 16, 1, 7340, 0},
+    {0x66617374, 6387, 14, 1, 7340, 0},
+    {0x66627362, 38855, 5, 0, 7340, 1},
+    {0x66697265, 13259, 11, 1, 7341, 0},
+    {0x66697265, 3532, 16, 1, 7341, 0},
+    {0x666c6472, 38895, 5, 1, 7341, 0},
+    {0x666f7267, 13292, 11, 1, 7341, 0},
+    {0x6672616d, 10111, 12, 1, 7341, 0},
+    {0x66726565, 16682, 10, 1, 7341, 0},
+    {0x66726565, 20308, 9, 1, 7341, 0},
+    {0x66726565, 24815, 8, 1, 7341, 0},
+    {0x66726f6d, 30420, 7, 1, 7341, 0},
+    {0x66726f6d, 30427, 7, 1, 7341, 0},
+    {0x66726f6d, 30434, 7, 1, 7341, 0},
+    {0x66726f6d, 30448, 7, 1, 7341, 0},
+    {0x66726f6d, 30462, 7, 1, 7341, 0},
+    {0x66726f6d, 30469, 7, 1, 7341, 0},
+    {0x66726f6d, 30476, 7, 1, 7341, 0},
+    {0x66726f6d, 30483, 7, 1, 7341, 0},
+    {0x66726f6d, 30490, 7, 1, 7341, 0},
+    {0x66726f6d, 30497, 7, 1, 7341, 0},
+    {0x66726f6d, 30504, 7, 1, 7341, 0},
+    {0x66726f6d, 30511, 7, 1, 7341, 0},
+    {0x66726f6d, 30518, 7, 1, 7341, 0},
+    {0x66726f6d, 30525, 7, 1, 7341, 0},
+    {0x66726f6d, 30532, 7, 1, 7341, 0},
+    {0x66726f6d, 30539, 7, 1, 7341, 0},
+    {0x66726f6d, 30553, 7, 1, 7341, 0},
+    {0x66726f6d, 30560, 7, 1, 7341, 0},
+    {0x66726f6d, 30574, 7, 1, 7341, 0},
+    {0x66726f6d, 30581, 7, 1, 7341, 0},
+    {0x66726f6d, 30588, 7, 1, 7341, 0},
+    {0x66726f6d, 30595, 7, 1, 7341, 0},
+    {0x66726f6d, 30602, 7, 1, 7341, 0},
+    {0x66726f6d, 30609, 7, 1, 7341, 0},
+    {0x66726f6d, 30616, 7, 1, 7341, 0},
+    {0x66726f6d, 30623, 7, 1, 7341, 0},
+    {0x66726f6d, 30630, 7, 1, 7341, 0},
+    {0x66726f6d, 30637, 7, 1, 7341, 0},
+    {0x66726f6d, 30644, 7, 1, 7341, 0},
+    {0x66726f6d, 30651, 7, 1, 7341, 0},
+    {0x66726f6d, 30665, 7, 1, 7341, 0},
+    {0x66726f6d, 30672, 7, 1, 7341, 0},
+    {0x66726f6d, 30679, 7, 1, 7341, 0},
+    {0x66726f6d, 30686, 7, 1, 7341, 0},
+    {0x66726f6d, 30693, 7, 1, 7341, 0},
+    {0x66726f6d, 30700, 7, 1, 7341, 0},
+    {0x66726f6d, 30707, 7, 1, 7341, 0},
+    {0x66726f6d, 30714, 7, 1, 7341, 0},
+    {0x66726f6d, 30721, 7, 1, 7341, 0},
+    {0x66726f6d, 30728, 7, 1, 7341, 0},
+    {0x66726f6d, 30735, 7, 1, 7341, 0},
+    {0x66726f6d, 30742, 7, 1, 7341, 0},
+    {0x66726f6d, 30749, 7, 1, 7341, 0},
+    {0x66726f6d, 30756, 7, 1, 7341, 0},
+    {0x66726f6d, 30763, 7, 1, 7341, 0},
+    {0x66726f6d, 30770, 7, 1, 7341, 0},
+    {0x66726f6d, 30777, 7, 1, 7341, 0},
+    {0x6765656b, 16732, 10, 1, 7341, 0},
+    {0x67656e74, 24967, 8, 1, 7341, 0},
+    {0x67656e74, 10135, 12, 1, 7341, 0},
+    {0x6765746d, 30875, 7, 1, 7341, 0},
+    {0x6769697a, 38985, 5, 1, 7341, 0},
+    {0x67697468, 2628, 17, 1, 7341, 0},
+    {0x676c6565, 35135, 6, 1, 7341, 0},
+    {0x676f6f67, 16752, 10, 1, 7341, 0},
+    {0x676f6f67, 16762, 10, 1, 7341, 0},
+    {0x676f7464, 35177, 6, 1, 7341, 0},
+    {0x676f7470, 13391, 11, 1, 7341, 0},
+    {0x67720000, 2757, 2, 1, 7341, 0},
+    {0x6865616c, 2645, 17, 1, 7341, 0},
+    {0x6865726f, 20587, 9, 1, 7341, 0},
+    {0x6865726f, 20596, 9, 1, 7341, 0},
+    {0x6869646f, 35357, 6, 1, 7341, 0},
+    {0x686b0000, 1753, 2, 1, 7341, 0},
+    {0x686f6262, 16892, 10, 1, 7341, 0},
+    {0x686f6d65, 20677, 9, 1, 7341, 0},
+    {0x686f6d65, 4857, 15, 1, 7341, 0},
+    {0x686f6d65, 6513, 14, 1, 7341, 0},
+    {0x686f6d65, 25263, 8, 1, 7341, 0},
+    {0x686f7374, 1986, 18, 0, 7341, 1},
+    {0x686f7374, 25311, 8, 1, 7342, 0},
+    {0x686f7374, 31197, 7, 0, 7342, 2},
+    {0x686f7465, 4887, 15, 1, 7344, 0},
+    {0x68750000, 1300, 2, 1, 7344, 0},
+    {0x69616d61, 20749, 9, 1, 7344, 0},
+    {0x696b2d73, 20758, 9, 0, 7344, 2},
+    {0x696d7065, 10291, 9, 1, 7346, 0},
+    {0x696d7065, 10291, 12, 1, 7346, 0},
+    {0x69732d61, 6541, 14, 1, 7346, 0},
+    {0x69732d61, 10363, 12, 1, 7346, 0},
+    {0x69732d61, 4902, 15, 1, 7346, 0},
+    {0x69732d61, 6569, 14, 1, 7346, 0},
+    {0x69732d61, 10375, 12, 1, 7346, 0},
+    {0x69732d61, 20812, 9, 1, 7346, 0},
+    {0x69732d61, 2730, 17, 1, 7346, 0},
+    {0x69732d61, 25383, 8, 1, 7346, 0},
+    {0x69732d61, 2040, 18, 1, 7346, 0},
+    {0x69732d61, 8298, 13, 1, 7346, 0},
+    {0x69732d61, 8311, 13, 1, 7346, 0},
+    {0x69732d61, 13523, 11, 1, 7346, 0},
+    {0x69732d61, 715, 21, 1, 7346, 0},
+    {0x69732d61, 20821, 9, 1, 7346, 0},
+    {0x69732d61, 16982, 10, 1, 7346, 0},
+    {0x69732d61, 20830, 9, 1, 7346, 0},
+    {0x69732d61, 3692, 16, 1, 7346, 0},
+    {0x69732d61, 13534, 11, 1, 7346, 0},
+    {0x69732d61, 4932, 15, 1, 7346, 0},
+    {0x69732d61, 13556, 11, 1, 7346, 0},
+    {0x69732d61, 10387, 12, 1, 7346, 0},
+    {0x69732d61, 3708, 16, 1, 7346, 0},
+    {0x69732d61, 16992, 10, 1, 7346, 0},
+    {0x69732d61, 8324, 13, 1, 7346, 0},
+    {0x69732d61, 6597, 14, 1, 7346, 0},
+    {0x69732d61, 17002, 10, 1, 7346, 0},
+    {0x69732d61, 10399, 12, 1, 7346, 0},
+    {0x69732d61, 1087, 20, 1, 7346, 0},
+    {0x69732d61, 2747, 17, 1, 7346, 0},
+    {0x69732d61, 13567, 11, 1, 7346, 0},
+    {0x69732d61, 4962, 15, 1, 7346, 0},
+    {0x69732d61, 8337, 13, 1, 7346, 0},
+    {0x69732d61, 6611, 14, 1, 7346, 0},
+    {0x69732d61, 10423, 12, 1, 7346, 0},
+    {0x69732d61, 10435, 12, 1, 7346, 0},
+    {0x69732d61, 13589, 11, 1, 7346, 0},
+    {0x69732d61, 6625, 14, 1, 7346, 0},
+    {0x69732d61, 3724, 16, 1, 7346, 0},
+    {0x69732d61, 13600, 11, 1, 7346, 0},
+    {0x69732d61, 8350, 13, 1, 7346, 0},
+    {0x69732d61, 4977, 15, 1, 7346, 0},
+    {0x69732d61, 10447, 12, 1, 7346, 0},
+    {0x69732d61, 6639, 14, 1, 7346, 0},
+    {0x69732d61, 2764, 17, 1, 7346, 0},
+    {0x69732d63, 10459, 12, 1, 7346, 0},
+    {0x69732d67, 31337, 7, 1, 7346, 0},
+    {0x69732d69, 8363, 13, 1, 7346, 0},
+    {0x69732d69, 10471, 12, 1, 7346, 0},
+    {0x69732d69, 3740, 16, 1, 7346, 0},
+    {0x69732d69, 8376, 13, 1, 7346, 0},
+    {0x69732d6c, 31344, 7, 1, 7346, 0},
+    {0x69732d6e, 3756, 16, 1, 7346, 0},
+    {0x69732d73, 25407, 8, 1, 7346, 0},
+    {0x69732d75, 13611, 11, 1, 7346, 0},
+    {0x69732d77, 4992, 15, 1, 7346, 0},
+    {0x6973612d, 25415, 8, 1, 7346, 0},
+    {0x6973612d, 8402, 13, 1, 7346, 0},
+    {0x6973736d, 3772, 16, 1, 7346, 0},
+    {0x69740000, 127, 2, 1, 7346, 0},
+    {0x6a646576, 20920, 9, 1, 7346, 0},
+    {0x6a656c61, 25487, 8, 0, 7346, 1},
+    {0x6a6f7965, 35591, 6, 0, 7347, 1},
+    {0x6a706e00, 42234, 3, 1, 7348, 0},
+    {0x6b617373, 21073, 9, 1, 7348, 0},
+    {0x6b696c61, 21145, 9, 1, 7348, 0},
+    {0x6b6f7a6f, 39415, 5, 1, 7348, 0},
+    {0x6b720000, 1749, 2, 1, 7348, 0},
+    {0x6b746973, 26015, 8, 1, 7348, 0},
+    {0x6c696b65, 21424, 9, 1, 7348, 0},
+    {0x6c696b65, 17342, 10, 1, 7348, 0},
+    {0x6c696e6f, 2781, 6, 0, 7348, 2},
+    {0x6c696e6f, 8480, 13, 2, 7350, 0},
+    {0x6c696e6f, 2781, 17, 0, 7350, 1},
+    {0x6c6d706d, 41498, 4, 0, 7351, 1},
+    {0x6c6f676f, 36017, 6, 1, 7352, 0},
+    {0x6c6f7365, 17382, 10, 1, 7352, 0},
+    {0x6c707573, 8493, 13, 1, 7352, 0},
+    {0x6d617373, 13831, 11, 0, 7352, 1},
+    {0x6d617a65, 26423, 8, 1, 7353, 0},
+    {0x6d657373, 13842, 11, 1, 7353, 0},
+    {0x6d657465, 21631, 9, 1, 7353, 1},
+    {0x6d657800, 21886, 3, 1, 7354, 0},
+    {0x6d696e69, 17592, 10, 1, 7354, 0},
+    {0x6d796163, 2798, 17, 1, 7354, 0},
+    {0x6d796173, 21811, 9, 1, 7354, 0},
+    {0x6d796461, 32275, 7, 1, 7354, 0},
+    {0x6d79646f, 26711, 8, 1, 7354, 0},
+    {0x6d796472, 32282, 7, 1, 7354, 0},
+    {0x6d796970, 26727, 8, 1, 7354, 0},
+    {0x6d79716e, 2549, 11, 1, 7354, 0},
+    {0x6d797365, 3804, 16, 1, 7354, 0},
+    {0x6d797368, 10807, 12, 1, 7354, 0},
+    {0x6d797368, 21838, 9, 1, 7354, 0},
+    {0x6d797370, 10819, 12, 1, 7354, 0},
+    {0x6d797461, 32303, 7, 1, 7354, 0},
+    {0x6d797468, 8597, 13, 0, 7354, 11},
+    {0x6d797475, 26759, 8, 1, 7365, 0},
+    {0x6d79766e, 39705, 5, 1, 7365, 0},
+    {0x6e656174, 26911, 8, 1, 7365, 0},
+    {0x6e65742d, 17752, 10, 1, 7365, 0},
+    {0x6e667368, 32415, 7, 1, 7365, 0},
+    {0x6e6f0000, 134, 2, 1, 7365, 0},
+    {0x6e6f7370, 14051, 11, 0, 7365, 1},
+    {0x6f627365, 757, 21, 0, 7366, 1},
+    {0x6f6e2d61, 17832, 10, 1, 7367, 0},
+    {0x6f6e6661, 22027, 9, 1, 7367, 0},
+    {0x6f6e7265, 27167, 8, 1, 7367, 0},
+    {0x6f6e7468, 22036, 9, 1, 7367, 0},
+    {0x6f6f6775, 39935, 5, 1, 7367, 0},
+    {0x6f706572, 17872, 10, 1, 7367, 0},
+    {0x6f727369, 32681, 7, 1, 7367, 0},
+    {0x6f757473, 5157, 15, 1, 7367, 0},
+    {0x6f776e70, 14150, 11, 1, 7367, 0},
+    {0x70616765, 10987, 12, 1, 7367, 0},
+    {0x70616765, 2094, 18, 1, 7367, 0},
+    {0x70616765, 36887, 6, 1, 7367, 0},
+    {0x70617977, 27239, 8, 2, 7367, 0},
+    {0x7067666f, 40055, 5, 1, 7367, 0},
+    {0x7069786f, 27295, 8, 1, 7367, 0},
+    {0x706c6174, 14227, 11, 1, 7367, 0},
+    {0x706c6179, 2832, 17, 1, 7367, 0},
+    {0x706c6573, 32786, 7, 1, 7367, 0},
+    {0x706f696e, 17952, 10, 1, 7367, 0},
+    {0x706f7374, 11023, 12, 1, 7367, 0},
+    {0x7072676d, 40095, 5, 0, 7367, 1},
+    {0x7075626c, 11059, 12, 1, 7368, 0},
+    {0x70797468, 6835, 14, 1, 7368, 1},
+    {0x71613200, 42333, 3, 1, 7369, 0},
+    {0x71627573, 37043, 6, 1, 7369, 0},
+    {0x71630000, 12203, 2, 1, 7369, 0},
+    {0x7175616c, 14282, 11, 1, 7369, 0},
+    {0x71756963, 18012, 10, 1, 7369, 0},
+    {0x71756970, 11083, 12, 2, 7369, 0},
+    {0x7261636b, 27415, 8, 1, 7369, 0},
+    {0x72656d6f, 27479, 8, 1, 7369, 0},
+    {0x72656e64, 27169, 6, 0, 7369, 1},
+    {0x72657365, 32926, 7, 1, 7370, 0},
+    {0x72657365, 6863, 14, 1, 7370, 0},
+    {0x7268636c, 32954, 7, 1, 7370, 0},
+    {0x72750000, 39, 2, 1, 7370, 0},
+    {0x73610000, 506, 2, 1, 7370, 0},
+    {0x73617665, 3916, 16, 1, 7370, 0},
+    {0x73637279, 33115, 7, 1, 7370, 0},
+    {0x73656375, 5247, 15, 1, 7370, 0},
+    {0x73656c66, 37283, 6, 1, 7370, 0},
+    {0x73656c6c, 6919, 14, 1, 7370, 0},
+    {0x73656c6c, 14425, 11, 1, 7370, 0},
+    {0x73657276, 27695, 8, 1, 7370, 0},
+    {0x73657276, 22414, 9, 1, 7370, 0},
+    {0x73657276, 2148, 18, 1, 7370, 0},
+    {0x73657276, 8831, 13, 1, 7370, 0},
+    {0x73657276, 27703, 8, 1, 7370, 0},
+    {0x73657276, 22432, 9, 1, 7370, 0},
+    {0x73657276, 8844, 13, 1, 7370, 0},
+    {0x73657276, 22441, 9, 1, 7370, 0},
+    {0x73657276, 14436, 11, 1, 7370, 0},
+    {0x73657276, 27711, 8, 1, 7370, 0},
+    {0x73657276, 27719, 8, 1, 7370, 0},
+    {0x73657276, 27727, 8, 1, 7370, 0},
+    {0x73657276, 22450, 9, 1, 7370, 0},
+    {0x73657276, 18242, 10, 1, 7370, 0},
+    {0x73657276, 11323, 12, 1, 7370, 0},
+    {0x73686f70, 18312, 10, 1, 7370, 0},
+    {0x73696969, 33255, 7, 1, 7370, 0},
+    {0x73696d70, 18332, 10, 1, 7370, 0},
+    {0x73696d70, 18342, 10, 1, 7370, 0},
+    {0x73696e61, 18695, 7, 1, 7370, 0},
+    {0x736b7967, 18352, 10, 1, 7370, 0},
+    {0x736d7573, 27919, 8, 1, 7370, 0},
+    {0x73706163, 8935, 13, 1, 7370, 0},
+    {0x73746163, 2934, 17, 1, 7370, 0},
+    {0x7374646c, 37451, 6, 0, 7370, 1},
+    {0x73747265, 11431, 12, 1, 7371, 0},
+    {0x73747566, 14535, 11, 1, 7371, 0},
+    {0x74622d68, 18482, 10, 0, 7371, 1},
+    {0x74656163, 11467, 12, 1, 7372, 0},
+    {0x74656d70, 28351, 8, 1, 7372, 0},
+    {0x74686577, 22954, 9, 1, 7372, 0},
+    {0x7468696e, 8961, 13, 1, 7372, 0},
+    {0x746f776e, 3932, 16, 1, 7372, 0},
+    {0x7472792d, 11515, 12, 1, 7372, 0},
+    {0x74727963, 9000, 13, 1, 7372, 0},
+    {0x74756c65, 5367, 15, 1, 7372, 0},
+    {0x74797065, 28551, 8, 0, 7372, 1},
+    {0x756b0000, 6692, 2, 1, 7373, 0},
+    {0x756e7573, 9013, 13, 1, 7373, 0},
+    {0x75730000, 767, 2, 1, 7373, 0},
+    {0x75790000, 3607, 2, 1, 7373, 0},
+    {0x76697073, 18692, 10, 1, 7373, 0},
+    {0x76756c74, 11659, 12, 2, 7373, 0},
+    {0x77616661, 18722, 10, 0, 7373, 3},
+    {0x77616666, 18732, 10, 1, 7376, 0},
+    {0x77696172, 28815, 8, 0, 7376, 1},
+    {0x77697468, 18762, 10, 1, 7377, 0},
+    {0x77697468, 14788, 11, 1, 7377, 0},
+    {0x77697873, 34011, 7, 1, 7377, 0},
+    {0x776f6c74, 11683, 12, 1, 7377, 0},
+    {0x776f726b, 11707, 12, 1, 7377, 0},
+    {0x77706465, 18782, 10, 1, 7377, 0},
+    {0x7770656e, 5427, 15, 1, 7377, 1},
+    {0x7770686f, 11719, 12, 1, 7378, 0},
+    {0x77706d75, 34046, 7, 1, 7378, 0},
+    {0x77726974, 7031, 14, 1, 7378, 0},
+    {0x786e6261, 40850, 5, 1, 7378, 2},
+    {0x796f6c61, 28959, 8, 1, 7380, 0},
+    {0x7a610000, 739, 2, 1, 7380, 0},
+    {0x6d79666f, 32289, 7, 1, 7380, 0},
+    {0x6e6f6700, 5146, 3, 1, 7380, 0},
+    {0x72617665, 32863, 7, 1, 7380, 0},
+    {0x64650000, 48, 2, 1, 7380, 0},
+    {0x656c656d, 20173, 9, 1, 7380, 0},
+    {0x61630000, 35, 2, 1, 7380, 0},
+    {0x636f0000, 4, 2, 1, 7380, 0},
+    {0x65640000, 1023, 2, 1, 7380, 0},
+    {0x66690000, 720, 2, 1, 7380, 0},
+    {0x676f0000, 810, 2, 1, 7380, 0},
+    {0x6f720000, 5, 2, 1, 7380, 0},
+    {0x73610000, 506, 2, 1, 7380, 0},
+    {0x636f6d00, 19, 3, 1, 7380, 0},
+    {0x65647500, 9778, 3, 1, 7380, 0},
+    {0x676f7600, 810, 3, 1, 7380, 0},
+    {0x696e6600, 3522, 3, 1, 7380, 0},
+    {0x6e657400, 2944, 3, 1, 7380, 0},
+    {0x6f726700, 6352, 3, 1, 7380, 0},
+    {0x626c6f67, 23967, 8, 1, 7380, 0},
+    {0x636f6d00, 19, 3, 1, 7380, 0},
+    {0x65647500, 9778, 3, 1, 7380, 0},
+    {0x696e7400, 2022, 3, 1, 7380, 0},
+    {0x6e6f6d65, 6156, 4, 1, 7380, 0},
+    {0x6f726700, 6352, 3, 1, 7380, 0},
+    {0x636f6d00, 19, 3, 1, 7380, 0},
+    {0x65647500, 9778, 3, 1, 7380, 0},
+    {0x6e657400, 2944, 3, 1, 7380, 0},
+    {0x6f726700, 6352, 3, 1, 7380, 0},
+    {0x61746800, 7005, 3, 1, 7380, 0},
+    {0x676f7600, 810, 3, 1, 7380, 0},
+    {0x696e666f, 21606, 4, 1, 7380, 0},
+    {0x61630000, 35, 2, 1, 7380, 0},
+    {0x62697a00, 38535, 3, 1, 7380, 0},
+    {0x636f6d00, 19, 3, 1, 7380, 2},
+    {0x656b6c6f, 30119, 7, 1, 7382, 0},
+    {0x676f7600, 810, 3, 1, 7382, 0},
+    {0x6c746400, 33033, 3, 1, 7382, 0},
+    {0x6d696c00, 6019, 3, 1, 7382, 0},
+    {0x6e657400, 2944, 3, 1, 7382, 0},
+    {0x6f726700, 6352, 3, 1, 7382, 0},
+    {0x70726573, 4357, 5, 1, 7382, 0},
+    {0x70726f00, 5042, 3, 1, 7382, 0},
+    {0x746d0000, 2797, 2, 1, 7382, 0},
+    {0x626c6f67, 23967, 8, 1, 7382, 0},
+    {0x636f0000, 4, 2, 1, 7382, 0},
+    {0x65340000, 3118, 2, 1, 7382, 0},
+    {0x6d657461, 13853, 11, 0, 7382, 2},
+    {0x6d756e69, 21, 4, 0, 7384, 1},
+    {0x7265616c, 26603, 5, 1, 7385, 0},
+    {0x31323377, 12533, 11, 1, 7385, 0},
+    {0x31326870, 40934, 4, 1, 7385, 0},
+    {0x32697800, 42018, 3, 1, 7385, 0},
+    {0x346c696d, 38320, 5, 1, 7385, 0},
+    {0x62617273, 12676, 5, 1, 7385, 0},
+    {0x626c6f67, 23967, 8, 1, 7385, 0},
+    {0x62706c61, 29489, 7, 1, 7385, 0},
+    {0x636f6d00, 19, 3, 1, 7385, 0},
+    {0x636f6d6d, 7921, 13, 1, 7385, 0},
+    {0x636f7369, 29867, 7, 0, 7385, 1},
+    {0x64642d64, 34745, 6, 1, 7386, 0},
+    {0x64646e73, 38720, 5, 1, 7386, 2},
+    {0x6469736b, 1932, 18, 1, 7388, 0},
+    {0x646e7368, 29993, 7, 1, 7388, 0},
+    {0x646e7375, 16502, 10, 1, 7388, 0},
+    {0x64726179, 24519, 8, 1, 7388, 0},
+    {0x64726179, 30035, 7, 1, 7388, 0},
+    {0x64796e2d, 16512, 10, 1, 7388, 0},
+    {0x64796e2d, 24535, 8, 1, 7388, 0},
+    {0x64796e2d, 30056, 7, 1, 7388, 0},
+    {0x64796e61, 4587, 15, 1, 7388, 0},
+    {0x64796e64, 30063, 7, 1, 7388, 0},
+    {0x64796e76, 34859, 6, 1, 7388, 0},
+    {0x66697265, 3532, 16, 1, 7388, 0},
+    {0x66727573, 35015, 6, 2, 7388, 0},
+    {0x66756574, 4737, 15, 1, 7388, 0},
+    {0x6769742d, 20470, 9, 1, 7388, 0},
+    {0x676f6970, 36019, 4, 1, 7388, 0},
+    {0x686f6d65, 6499, 14, 1, 7388, 1},
+    {0x68732d68, 10255, 12, 0, 7389, 1},
+    {0x696e2d62, 20767, 9, 1, 7390, 0},
+    {0x696e2d62, 35501, 6, 1, 7390, 0},
+    {0x696e2d62, 20776, 9, 1, 7390, 0},
+    {0x696e2d64, 35507, 6, 1, 7390, 0},
+    {0x696e2d76, 35513, 6, 1, 7390, 0},
+    {0x696e7465, 10351, 12, 1, 7390, 0},
+    {0x69736572, 13633, 11, 1, 7390, 0},
+    {0x69737465, 17022, 10, 1, 7390, 0},
+    {0x6973746d, 31400, 7, 1, 7390, 0},
+    {0x6b65796d, 17182, 10, 1, 7390, 0},
+    {0x6c2d6f2d, 21352, 9, 1, 7390, 0},
+    {0x6c637562, 10699, 12, 1, 7390, 0},
+    {0x6c656274, 17322, 10, 1, 7390, 0},
+    {0x6c656974, 17332, 10, 1, 7390, 0},
+    {0x6c696d61, 21442, 9, 1, 7390, 0},
+    {0x6c6f676f, 36017, 6, 1, 7390, 0},
+    {0x6d65696e, 17522, 10, 1, 7390, 0},
+    {0x6d65696e, 17532, 10, 1, 7390, 0},
+    {0x6d792d67, 17652, 10, 1, 7390, 0},
+    {0x6d792d72, 21802, 9, 1, 7390, 0},
+    {0x6d792d76, 26703, 8, 1, 7390, 0},
+    {0x6d792d77, 36491, 6, 1, 7390, 0},
+    {0x6d79686f, 8584, 13, 1, 7390, 0},
+    {0x6d797370, 10819, 12, 1, 7390, 0},
+    {0x73636875, 6877, 14, 1, 7390, 0},
+    {0x73636875, 14414, 11, 1, 7390, 0},
+    {0x7370646e, 40465, 5, 1, 7390, 0},
+    {0x73706565, 11383, 12, 0, 7390, 1},
+    {0x73717561, 33332, 7, 1, 7391, 0},
+    {0x73766e2d, 22855, 9, 1, 7391, 0},
+    {0x73796e6f, 33430, 7, 1, 7391, 0},
+    {0x73796e6f, 1227, 20, 1, 7391, 0},
+    {0x73796e6f, 14568, 11, 1, 7391, 0},
+    {0x74616966, 18422, 10, 1, 7391, 0},
+    {0x74657374, 18522, 10, 1, 7391, 0},
+    {0x74726165, 8974, 13, 1, 7391, 0},
+    {0x75626572, 23116, 9, 2, 7391, 0},
+    {0x76697274, 11635, 12, 1, 7391, 0},
+    {0x76697274, 14722, 11, 1, 7391, 0},
+    {0x786e2d2d, 340, 23, 1, 7391, 0},
+    {0x786e2d2d, 904, 21, 1, 7391, 0},
+    {0x62737300, 27701, 3, 1, 7391, 0},
+    {0x6175746f, 23831, 8, 1, 7391, 0},
+    {0x63757276, 41106, 4, 1, 7391, 0},
+    {0x64656e6f, 9991, 4, 1, 7391, 0},
+    {0x64656e6f, 9991, 12, 1, 7391, 0},
+    {0x64657461, 41122, 4, 1, 7391, 0},
+    {0x666c7900, 10063, 3, 1, 7391, 0},
+    {0x67617465, 3541, 7, 2, 7391, 0},
+    {0x67697468, 8168, 13, 1, 7391, 0},
+    {0x69736572, 13633, 5, 1, 7391, 0},
+    {0x6c636c00, 11653, 3, 2, 7391, 0},
+    {0x6c636c73, 26215, 8, 2, 7391, 0},
+    {0x6c6f6361, 21460, 9, 0, 7391, 1},
+    {0x6c6f6769, 21487, 9, 1, 7392, 0},
+    {0x6d656469, 21595, 9, 1, 7392, 0},
+    {0x70616765, 2094, 5, 1, 7392, 0},
+    {0x706c6174, 14227, 11, 1, 7392, 0},
+    {0x72320000, 41008, 2, 1, 7392, 0},
+    {0x73686966, 14447, 11, 1, 7392, 0},
+    {0x73746700, 14513, 3, 2, 7392, 0},
+    {0x73746773, 28023, 8, 2, 7392, 0},
+    {0x76657263, 28703, 6, 1, 7392, 0},
+    {0x77656268, 33948, 7, 2, 7392, 0},
+    {0x776f726b, 34039, 7, 1, 7392, 0},
+    {0x636c6f75, 19993, 9, 1, 7392, 1},
+    {0x31323368, 7661, 13, 1, 7393, 0},
+    {0x62697a00, 38535, 3, 1, 7393, 0},
+    {0x626c6f67, 23967, 8, 1, 7393, 0},
+    {0x636f0000, 4, 2, 1, 7393, 0},
+    {0x6669726d, 24743, 4, 1, 7393, 0},
+    {0x6d797370, 10819, 12, 1, 7393, 0},
+    {0x72656700, 5172, 3, 1, 7393, 0},
+    {0x73746f72, 10046, 5, 1, 7393, 0},
+    {0x636f6d00, 19, 3, 1, 7393, 0},
+    {0x65647500, 9778, 3, 1, 7393, 0},
+    {0x676f7600, 810, 3, 1, 7393, 0},
+    {0x6e657400, 2944, 3, 1, 7393, 0},
+    {0x6f726700, 6352, 3, 1, 7393, 0},
+    {0x61727400, 3749, 3, 1, 7393, 0},
+    {0x636f6d00, 19, 3, 1, 7393, 0},
+    {0x65647500, 9778, 3, 1, 7393, 0},
+    {0x676f6200, 38533, 3, 1, 7393, 0},
+    {0x676f7600, 810, 3, 1, 7393, 0},
+    {0x6d696c00, 6019, 3, 1, 7393, 0},
+    {0x6e657400, 2944, 3, 1, 7393, 0},
+    {0x6f726700, 6352, 3, 1, 7393, 0},
+    {0x736c6400, 42366, 3, 1, 7393, 0},
+    {0x77656200, 123, 3, 1, 7393, 0},
+    {0x61727400, 3749, 3, 1, 7393, 0},
+    {0x6173736f, 788, 4, 1, 7393, 0},
+    {0x636f6d00, 19, 3, 1, 7393, 0},
+    {0x65647500, 9778, 3, 1, 7393, 0},
+    {0x676f7600, 810, 3, 1, 7393, 0},
+    {0x6e657400, 2944, 3, 1, 7393, 0},
+    {0x6f726700, 6352, 3, 1, 7393, 0},
+    {0x706f6c00, 9733, 3, 1, 7393, 0},
+    {0x736f6300, 790, 3, 1, 7393, 0},
+    {0x746d0000, 2797, 2, 1, 7393, 0},
+    {0x64617070, 19997, 5, 2, 7393, 1},
+    {0x62617365, 13263, 4, 1, 7394, 0},
+    {0x636f6d00, 19, 3, 1, 7394, 0},
+    {0x65647500, 9778, 3, 1, 7394, 0},
+    {0x66696e00, 720, 3, 1, 7394, 0},
+    {0x676f6200, 38533, 3, 1, 7394, 0},
+    {0x676f7600, 810, 3, 1, 7394, 0},
+    {0x696e666f, 21606, 4, 1, 7394, 0},
+    {0x6b313200, 42237, 3, 1, 7394, 0},
+    {0x6d656400, 1498, 3, 1, 7394, 0},
+    {0x6d696c00, 6019, 3, 1, 7394, 0},
+    {0x6e657400, 2944, 3, 1, 7394, 0},
+    {0x6f666669, 27111, 8, 1, 7394, 0},
+    {0x6f726700, 6352, 3, 1, 7394, 0},
+    {0x70726f00, 5042, 3, 1, 7394, 0},
+    {0x72697400, 3810, 3, 0, 7394, 1},
+    {0x636f0000, 4, 2, 1, 7395, 0},
+    {0x61697000, 31329, 3, 1, 7395, 0},
+    {0x636f6d00, 19, 3, 1, 7395, 1},
+    {0x65647500, 9778, 3, 1, 7396, 0},
+    {0x66696500, 3768, 3, 1, 7396, 0},
+    {0x676f7600, 810, 3, 1, 7396, 0},
+    {0x6c696200, 3713, 3, 1, 7396, 0},
+    {0x6d656400, 1498, 3, 1, 7396, 0},
+    {0x6f726700, 6352, 3, 1, 7396, 0},
+    {0x70726900, 220, 3, 1, 7396, 0},
+    {0x7269696b, 41714, 4, 1, 7396, 0},
+    {0x636f6d00, 19, 3, 1, 7396, 1},
+    {0x65647500, 9778, 3, 1, 7397, 0},
+    {0x65756e00, 9012, 3, 1, 7397, 0},
+    {0x676f7600, 810, 3, 1, 7397, 0},
+    {0x6d696c00, 6019, 3, 1, 7397, 0},
+    {0x6e616d65, 17722, 4, 1, 7397, 0},
+    {0x6e657400, 2944, 3, 1, 7397, 0},
+    {0x6f726700, 6352, 3, 1, 7397, 0},
+    {0x73636900, 2112, 3, 1, 7397, 0},
+    {0x3132336d, 23647, 8, 1, 7397, 0},
+    {0x636f6d00, 19, 3, 1, 7397, 1},
+    {0x65647500, 9778, 3, 1, 7398, 0},
+    {0x676f6200, 38533, 3, 1, 7398, 0},
+    {0x6d797370, 10819, 12, 1, 7398, 0},
+    {0x6e6f6d00, 5080, 3, 1, 7398, 0},
+    {0x6f726700, 6352, 3, 1, 7398, 0},
+    {0x636f6d70, 4542, 7, 2, 7398, 0},
+    {0x62697a00, 38535, 3, 1, 7398, 0},
+    {0x636f6d00, 19, 3, 1, 7398, 0},
+    {0x65647500, 9778, 3, 1, 7398, 0},
+    {0x676f7600, 810, 3, 1, 7398, 0},
+    {0x696e666f, 21606, 4, 1, 7398, 0},
+    {0x6e616d65, 17722, 4, 1, 7398, 0},
+    {0x6e657400, 2944, 3, 1, 7398, 0},
+    {0x6f726700, 6352, 3, 1, 7398, 0},
+    {0x6169726b, 7687, 10, 1, 7398, 0},
+    {0x62617273, 12676, 5, 1, 7398, 0},
+    {0x636c6f75, 29776, 7, 1, 7398, 0},
+    {0x6469736b, 1236, 11, 1, 7398, 0},
+    {0x646f6761, 34805, 6, 0, 7398, 1},
+    {0x6d796364, 41566, 4, 1, 7399, 0},
+    {0x7370646e, 40465, 5, 1, 7399, 0},
+    {0x7472616e, 28495, 8, 2, 7399, 0},
+    {0x77656c6c, 9117, 13, 1, 7399, 0},
+    {0x70617274, 40030, 5, 0, 7399, 1},
+    {0x636f0000, 4, 2, 1, 7400, 0},
+    {0x6b6f6f62, 35819, 6, 1, 7400, 0},
+    {0x79626f00, 34522, 3, 1, 7400, 0},
+    {0x73746f72, 40480, 5, 1, 7400, 0},
+    {0x3132336b, 12522, 11, 1, 7400, 0},
+    {0x616c616e, 20708, 5, 1, 7400, 0},
+    {0x626c6f67, 23967, 8, 1, 7400, 0},
+    {0x636c6f75, 7895, 13, 0, 7400, 1},
+    {0x64617461, 16422, 10, 0, 7401, 2},
+    {0x64790000, 3392, 2, 1, 7403, 0},
+    {0x696b6900, 10570, 3, 1, 7403, 0},
+    {0x6b617073, 39325, 5, 1, 7403, 0},
+    {0x6d797370, 10819, 12, 1, 7403, 0},
+    {0x786e2d2d, 5502, 15, 1, 7403, 0},
+    {0x636f0000, 4, 2, 1, 7403, 0},
+    {0x61630000, 35, 2, 1, 7403, 0},
+    {0x62697a00, 38535, 3, 1, 7403, 0},
+    {0x636f6d00, 19, 3, 1, 7403, 0},
+    {0x676f7600, 810, 3, 1, 7403, 0},
+    {0x696e666f, 21606, 4, 1, 7403, 0},
+    {0x6d696c00, 6019, 3, 1, 7403, 0},
+    {0x6e616d65, 17722, 4, 1, 7403, 0},
+    {0x6e657400, 2944, 3, 1, 7403, 0},
+    {0x6f726700, 6352, 3, 1, 7403, 0},
+    {0x70726f00, 5042, 3, 1, 7403, 0},
+    {0x636f6d00, 19, 3, 1, 7403, 0},
+    {0x65647500, 9778, 3, 1, 7403, 0},
+    {0x6e657400, 2944, 3, 1, 7403, 0},
+    {0x6f726700, 6352, 3, 1, 7403, 0},
+    {0x72616469, 10151, 5, 1, 7403, 0},
+    {0x75736572, 767, 4, 2, 7403, 0},
+    {0x31323373, 15832, 10, 1, 7403, 0},
+    {0x6165726f, 23703, 8, 1, 7403, 0},
+    {0x6173736f, 788, 4, 1, 7403, 0},
+    {0x61766f63, 29293, 6, 1, 7403, 0},
+    {0x61766f75, 34379, 6, 1, 7403, 0},
+    {0x626c6f67, 23967, 8, 1, 7403, 0},
+    {0x63636900, 456, 3, 1, 7403, 0},
+    {0x6368616d, 19912, 9, 1, 7403, 0},
+    {0x63686972, 36, 21, 1, 7403, 0},
+    {0x63686972, 36, 31, 1, 7403, 0},
+    {0x636f6d00, 19, 3, 1, 7403, 0},
+    {0x64656469, 29958, 7, 1, 7403, 0},
+    {0x656e2d72, 30147, 7, 1, 7403, 0},
+    {0x65787065, 1950, 18, 1, 7403, 0},
+    {0x6662782d, 34943, 6, 1, 7403, 0},
+    {0x6662786f, 38860, 5, 1, 7403, 0},
+    {0x66726565, 16682, 10, 1, 7403, 0},
+    {0x66726565, 20308, 9, 1, 7403, 0},
+    {0x67656f6d, 4767, 15, 1, 7403, 0},
+    {0x676f7570, 30994, 7, 1, 7403, 0},
+    {0x676f7576, 41266, 4, 1, 7403, 0},
+    {0x67726574, 39055, 5, 1, 7403, 0},
+    {0x68756973, 3660, 16, 1, 7403, 0},
+    {0x6d656465, 32142, 7, 1, 7403, 0},
+    {0x6d797370, 10819, 12, 1, 7403, 0},
+    {0x6e6f6d00, 5080, 3, 1, 7403, 0},
+    {0x6e6f7461, 27047, 8, 1, 7403, 0},
+    {0x6f6e2d77, 36809, 6, 1, 7403, 0},
+    {0x70686172, 14194, 10, 1, 7403, 0},
+    {0x706f7274, 5464, 4, 1, 7403, 0},
+    {0x70726400, 42318, 3, 1, 7403, 0},
+    {0x746d0000, 2797, 2, 1, 7403, 0},
+    {0x76657465, 14711, 11, 1, 7403, 0},
+    {0x796e6800, 42465, 3, 1, 7403, 0},
+    {0x65647500, 9778, 3, 1, 7403, 0},
+    {0x676f7600, 810, 3, 1, 7403, 0},
+    {0x636e7079, 41086, 4, 1, 7403, 0},
+    {0x636f6d00, 19, 3, 1, 7403, 0},
+    {0x65647500, 9778, 3, 1, 7403, 0},
+    {0x676f7600, 810, 3, 1, 7403, 0},
+    {0x6d696c00, 6019, 3, 1, 7403, 0},
+    {0x6e657400, 2944, 3, 1, 7403, 0},
+    {0x6f726700, 6352, 3, 1, 7403, 0},
+    {0x70767400, 42324, 3, 1, 7403, 0},
+    {0x636f0000, 4, 2, 1, 7403, 0},
+    {0x63796100, 34197, 3, 1, 7403, 0},
+    {0x6b616173, 41390, 4, 1, 7403, 0},
+    {0x6e657400, 2944, 3, 1, 7403, 0},
+    {0x6f726700, 6352, 3, 1, 7403, 0},
+    {0x70616e65, 2725, 5, 1, 7403, 1},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x676f7600, 810, 3, 1, 7404, 0},
+    {0x6d696c00, 6019, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x676f7600, 810, 3, 1, 7404, 0},
+    {0x6c746400, 33033, 3, 1, 7404, 0},
+    {0x6d6f6400, 12825, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x62697a00, 38535, 3, 1, 7404, 0},
+    {0x636f0000, 4, 2, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x78780000, 15201, 2, 1, 7404, 0},
+    {0x61630000, 35, 2, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x676f7600, 810, 3, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x636c6f75, 2555, 5, 1, 7404, 0},
+    {0x7472616e, 18562, 9, 1, 7404, 0},
+    {0x75736572, 767, 11, 2, 7404, 0},
+    {0x61707000, 1403, 3, 1, 7404, 0},
+    {0x6173736f, 788, 4, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x6d6f6269, 2103, 4, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x626c6f67, 23967, 8, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x676f7600, 810, 3, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x73696d70, 18342, 10, 1, 7404, 0},
+    {0x64697363, 20056, 9, 1, 7404, 0},
+    {0x626c6f67, 3492, 4, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x64650000, 48, 2, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x676f6200, 38533, 3, 1, 7404, 0},
+    {0x696e6400, 477, 3, 1, 7404, 0},
+    {0x6d696c00, 6019, 3, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x746f0000, 1004, 2, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x676f7600, 810, 3, 1, 7404, 0},
+    {0x6775616d, 41286, 4, 1, 7404, 0},
+    {0x696e666f, 21606, 4, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x77656200, 123, 3, 1, 7404, 0},
+    {0x62650000, 328, 2, 1, 7404, 0},
+    {0x636f0000, 4, 2, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x676f7600, 810, 3, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x68726100, 11944, 3, 1, 7404, 0},
+    {0x626c6f67, 23967, 8, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x676f7600, 810, 3, 1, 7404, 0},
+    {0x69647600, 42204, 3, 1, 7404, 0},
+    {0x696e6300, 12839, 3, 1, 7404, 0},
+    {0x6c746400, 33033, 3, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x73656361, 37259, 6, 1, 7404, 0},
+    {0x786e2d2d, 18832, 10, 1, 7404, 0},
+    {0x786e2d2d, 23350, 9, 1, 7404, 0},
+    {0x786e2d2d, 15228, 11, 1, 7404, 0},
+    {0x786e2d2d, 19052, 10, 1, 7404, 0},
+    {0x786e2d2d, 19082, 10, 1, 7404, 0},
+    {0x786e2d2d, 15349, 11, 1, 7404, 0},
+    {0x786e2d2d, 19142, 10, 1, 7404, 0},
+    {0x786e2d2d, 19152, 10, 1, 7404, 0},
+    {0x786e2d2d, 19172, 10, 1, 7404, 0},
+    {0x786e2d2d, 15503, 11, 1, 7404, 0},
+    {0x786e2d2d, 23512, 9, 1, 7404, 0},
+    {0x786e2d2d, 19232, 10, 1, 7404, 0},
+    {0x786e2d2d, 15657, 11, 1, 7404, 0},
+    {0x786e2d2d, 15734, 11, 1, 7404, 0},
+    {0x786e2d2d, 19292, 10, 1, 7404, 0},
+    {0x63630000, 456, 2, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x676f6200, 38533, 3, 1, 7404, 0},
+    {0x6d696c00, 6019, 3, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x636c6f75, 12896, 11, 1, 7404, 0},
+    {0x65617379, 20137, 9, 1, 7404, 0},
+    {0x66617374, 6387, 7, 1, 7404, 0},
+    {0x66726565, 24823, 8, 1, 7404, 0},
+    {0x68616c66, 8849, 4, 1, 7404, 0},
+    {0x6a656c65, 10531, 4, 1, 7404, 0},
+    {0x6d697263, 26535, 8, 1, 7404, 0},
+    {0x6d796661, 36503, 6, 1, 7404, 0},
+    {0x70636c6f, 2554, 6, 1, 7404, 0},
+    {0x74656d70, 33500, 7, 1, 7404, 0},
+    {0x77706d75, 34053, 7, 1, 7404, 0},
+    {0x6f70656e, 22045, 9, 1, 7404, 0},
+    {0x626c6f67, 23967, 8, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x66726565, 13068, 4, 1, 7404, 0},
+    {0x66726f6d, 30420, 4, 1, 7404, 0},
+    {0x697a0000, 226, 2, 1, 7404, 0},
+    {0x6e616d65, 17722, 4, 1, 7404, 0},
+    {0x6164756c, 38340, 5, 1, 7404, 0},
+    {0x61727400, 3749, 3, 1, 7404, 0},
+    {0x6173736f, 788, 4, 1, 7404, 0},
+    {0x636f6d00, 19, 3, 1, 7404, 0},
+    {0x636f6f70, 12918, 4, 1, 7404, 0},
+    {0x65647500, 9778, 3, 1, 7404, 0},
+    {0x6669726d, 24743, 4, 1, 7404, 0},
+    {0x676f7576, 41266, 4, 1, 7404, 0},
+    {0x696e666f, 21606, 4, 1, 7404, 0},
+    {0x6d656400, 1498, 3, 1, 7404, 0},
+    {0x6e657400, 2944, 3, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x70657273, 1092, 5, 1, 7404, 0},
+    {0x706f6c00, 9733, 3, 1, 7404, 0},
+    {0x70726f00, 5042, 3, 1, 7404, 0},
+    {0x72656c00, 1010, 3, 1, 7404, 0},
+    {0x73686f70, 6369, 4, 1, 7404, 0},
+    {0x32303030, 40946, 4, 1, 7404, 0},
+    {0x61677261, 38350, 5, 1, 7404, 0},
+    {0x626c6f67, 23967, 8, 1, 7404, 0},
+    {0x626f6c74, 41046, 4, 1, 7404, 0},
+    {0x63617369, 34565, 6, 1, 7404, 0},
+    {0x63697479, 21447, 4, 1, 7404, 0},
+    {0x636f0000, 4, 2, 1, 7404, 0},
+    {0x65726f74, 30175, 7, 1, 7404, 0},
+    {0x65726f74, 30182, 7, 1, 7404, 0},
+    {0x66696c6d, 41202, 4, 1, 7404, 0},
+    {0x666f7275, 21608, 5, 1, 7404, 0},
+    {0x67616d65, 8384, 5, 1, 7404, 0},
+    {0x686f7465, 4887, 5, 1, 7404, 0},
+    {0x696e666f, 21606, 4, 1, 7404, 0},
+    {0x696e6761, 25367, 8, 1, 7404, 0},
+    {0x6a6f6761, 35579, 6, 1, 7404, 0},
+    {0x6b6f6e79, 25975, 8, 1, 7404, 0},
+    {0x6c616b61, 39455, 5, 1, 7404, 0},
+    {0x6d656469, 21595, 5, 1, 7404, 0},
+    {0x6e657773, 3936, 4, 1, 7404, 0},
+    {0x6f726700, 6352, 3, 1, 7404, 0},
+    {0x70726976, 220, 4, 1, 7404, 0},
+    {0x72656b6c, 37097, 6, 1, 7404, 0},
+    {0x73657800, 34930, 3, 1, 7404, 0},
+    {0x73686f70, 6369, 4, 1, 7404, 0},
+    {0x73706f72, 17961, 5, 1, 7404, 0},
+    {0x73756c69, 41818, 4, 1, 7404, 0},
+    {0x737a6578, 41830, 4, 1, 7404, 0},
+    {0x746d0000, 2797, 2, 1, 7404, 0},
+    {0x746f7a73, 37823, 6, 1, 7404, 0},
+    {0x7574617a, 37961, 6, 1, 7404, 0},
+    {0x76696465, 40795, 5, 1, 7404, 0},
+    {0x61630000, 35, 2, 1, 7404, 0},
+    {0x62697a00, 38535, 3, 1, 7404, 0},
+    {0x636f0000, 4, 2, 1, 7404, 1},
+    {0x64657361, 39871, 4, 1, 7405, 0},
+    {0x666c6170, 41206, 4, 1, 7405, 0},
+    {0x666f7274, 38925, 5, 1, 7405, 0},
+    {0x676f0000, 810, 2, 1, 7405, 0},
+    {0x6d696c00, 6019, 3, 1, 7405, 0},
+    {0x6d790000, 2549, 2, 1, 7405, 1},
+    {0x6e657400, 2944, 3, 1, 7406, 0},
+    {0x6f720000, 5, 2, 1, 7406, 0},
+    {0x706f6e70, 36989, 6, 1, 7406, 0},
+    {0x73636800, 1512, 3, 1, 7406, 0},
+    {0x77656200, 123, 3, 1, 7406, 0},
+    {0x626c6f67, 23967, 8, 1, 7406, 0},
+    {0x676f7600, 810, 3, 1, 7406, 0},
+    {0x6d797370, 10819, 12, 1, 7406, 0},
+    {0x61630000, 35, 2, 1, 7406, 0},
+    {0x636f0000, 4, 2, 1, 7406, 4},
+    {0x676f7600, 810, 3, 1, 7410, 0},
+    {0x69646600, 24600, 3, 1, 7410, 0},
+    {0x6b313200, 42237, 3, 1, 7410, 0},
+    {0x6d756e69, 21, 4, 1, 7410, 0},
+    {0x6e657400, 2944, 3, 1, 7410, 0},
+    {0x6f726700, 6352, 3, 1, 7410, 0},
+    {0x61630000, 35, 2, 1, 7410, 0},
+    {0x636f0000, 4, 2, 1, 7410, 2},
+    {0x636f6d00, 19, 3, 1, 7412, 0},
+    {0x6e657400, 2944, 3, 1, 7412, 0},
+    {0x6f726700, 6352, 3, 1, 7412, 0},
+    {0x726f0000, 99, 2, 1, 7412, 0},
+    {0x74740000, 643, 2, 1, 7412, 0},
+    {0x74760000, 2443, 2, 1, 7412, 0},
+    {0x35670000, 9505, 2, 1, 7412, 0},
+    {0x36670000, 4262, 2, 1, 7412, 0},
+    {0x61630000, 35, 2, 1, 7412, 0},
+    {0x61690000, 714, 2, 1, 7412, 0},
+    {0x616d0000, 969, 2, 1, 7412, 0},
+    {0x62617273, 12676, 5, 1, 7412, 0},
+    {0x62696861, 38525, 5, 1, 7412, 0},
+    {0x62697a00, 38535, 3, 1, 7412, 0},
+    {0x626c6f67, 23967, 8, 1, 7412, 0},
+    {0x62757369, 24079, 8, 1, 7412, 0},
+    {0x63610000, 25, 2, 1, 7412, 0},
+    {0x636c6f75, 29776, 7, 1, 7412, 0},
+    {0x636e0000, 6219, 2, 1, 7412, 0},
+    {0x636f0000, 4, 2, 1, 7412, 0},
+    {0x636f6d00, 19, 3, 1, 7412, 0},
+    {0x636f6f70, 12918, 4, 1, 7412, 0},
+    {0x63730000, 4927, 2, 1, 7412, 0},
+    {0x64656c68, 38735, 5, 1, 7412, 0},
+    {0x64720000, 633, 2, 1, 7412, 0},
+    {0x65647500, 9778, 3, 1, 7412, 0},
+    {0x65720000, 112, 2, 1, 7412, 0},
+    {0x6669726d, 24743, 4, 1, 7412, 0},
+    {0x67656e00, 324, 3, 1, 7412, 0},
+    {0x676f7600, 810, 3, 1, 7412, 0},
+    {0x67756a61, 31050, 7, 1, 7412, 0},
+    {0x696e6400, 477, 3, 1, 7412, 0},
+    {0x696e666f, 21606, 4, 1, 7412, 0},
+    {0x696e7400, 2022, 3, 1, 7412, 0},
+    {0x696e7465, 3476, 8, 1, 7412, 0},
+    {0x696f0000, 9, 2, 1, 7412, 0},
+    {0x6d650000, 102, 2, 1, 7412, 0},
+    {0x6d696c00, 6019, 3, 1, 7412, 0},
+    {0x6e657400, 2944, 3, 1, 7412, 0},
+    {0x6e696300, 23, 3, 1, 7412, 0},
+    {0x6f726700, 6352, 3, 1, 7412, 0},
+    {0x70670000, 15529, 2, 1, 7412, 0},
+    {0x706f7374, 67, 4, 1, 7412, 0},
+    {0x70726f00, 5042, 3, 1, 7412, 0},
+    {0x72657300, 4358, 3, 1, 7412, 0},
+    {0x73757061, 28063, 8, 1, 7412, 0},
+    {0x74726176, 2166, 6, 1, 7412, 0},
+    {0x74760000, 2443, 2, 1, 7412, 0},
+    {0x756b0000, 6692, 2, 1, 7412, 0},
+    {0x75700000, 11705, 2, 1, 7412, 0},
+    {0x75730000, 767, 2, 1, 7412, 0},
+    {0x77656200, 123, 3, 1, 7412, 0},
+    {0x62617272, 1422, 19, 1, 7412, 0},
+    {0x62617272, 1007, 20, 1, 7412, 0},
+    {0x62617273, 12676, 5, 1, 7412, 0},
+    {0x636c6f75, 29776, 7, 1, 7412, 0},
+    {0x646e7375, 16502, 9, 1, 7412, 0},
+    {0x64767263, 34847, 6, 1, 7412, 0},
+    {0x64796e61, 13039, 11, 1, 7412, 0},
+    {0x64796e64, 6317, 6, 1, 7412, 0},
+    {0x666f722d, 30364, 7, 1, 7412, 0},
+    {0x666f7275, 34997, 6, 1, 7412, 0},
+    {0x67726f6b, 20497, 9, 1, 7412, 0},
+    {0x67726f6b, 16782, 10, 1, 7412, 0},
+    {0x68657265, 8194, 13, 1, 7412, 0},
+    {0x696c6f76, 10279, 12, 1, 7412, 0},
+    {0x6b6e6f77, 17212, 10, 1, 7412, 0},
+    {0x6d617966, 26415, 8, 1, 7412, 0},
+    {0x6e6f2d69, 39820, 5, 1, 7412, 0},
+    {0x6e737570, 16503, 8, 1, 7412, 0},
+    {0x73656c66, 37283, 6, 1, 7412, 0},
+    {0x762d696e, 37973, 6, 1, 7412, 0},
+    {0x77656268, 38147, 6, 1, 7412, 0},
+    {0x65750000, 766, 2, 1, 7412, 0},
+    {0x32303338, 40950, 4, 1, 7412, 0},
+    {0x61706967, 34301, 6, 1, 7412, 0},
+    {0x617a7572, 6079, 14, 2, 7412, 0},
+    {0x622d6461, 34385, 6, 1, 7412, 0},
+    {0x6261636b, 9835, 12, 1, 7412, 0},
+    {0x62616e7a, 12654, 11, 0, 7412, 2},
+    {0x62617273, 12676, 5, 1, 7414, 0},
+    {0x62617369, 12698, 11, 1, 7414, 0},
+    {0x62656167, 12709, 11, 1, 7414, 0},
+    {0x62656562, 16052, 7, 0, 7414, 1},
+    {0x62656562, 16052, 10, 0, 7415, 1},
+    {0x62696776, 41022, 4, 0, 7416, 1},
+    {0x62697462, 19795, 9, 1, 7417, 0},
+    {0x626c7565, 23983, 8, 1, 7417, 0},
+    {0x626f7866, 29482, 7, 1, 7417, 0},
+    {0x62726f77, 2577, 17, 1, 7417, 0},
+    {0x636c6576, 16292, 10, 1, 7417, 0},
+    {0x636f6d00, 19, 3, 1, 7417, 0},
+    {0x64617070, 24383, 8, 0, 7417, 1},
+    {0x64656479, 38730, 5, 1, 7418, 0},
+    {0x64656669, 24439, 8, 1, 7418, 0},
+    {0x64727564, 41138, 4, 1, 7418, 0},
+    {0x64796e35, 38780, 5, 1, 7418, 0},
+    {0x65646974, 30091, 7, 1, 7418, 0},
+    {0x65647567, 34871, 6, 1, 7418, 0},
+    {0x66682d6d, 13182, 11, 1, 7418, 0},
+    {0x666f7267, 20272, 9, 0, 7418, 1},
+    {0x67686f73, 25850, 5, 1, 7419, 0},
+    {0x67697468, 2628, 6, 1, 7419, 0},
+    {0x6769746c, 35117, 6, 1, 7419, 0},
+    {0x68617375, 16832, 10, 1, 7419, 0},
+    {0x686f7374, 10243, 12, 1, 7419, 0},
+    {0x687a6300, 42198, 3, 1, 7419, 0},
+    {0x6a656c65, 10531, 4, 1, 7419, 0},
+    {0x6c616972, 41470, 4, 0, 7419, 1},
+    {0x6c6f6769, 21487, 9, 1, 7420, 0},
+    {0x6c6f6c69, 21496, 7, 1, 7420, 0},
+    {0x6d6f2d73, 17622, 10, 1, 7420, 0},
+    {0x6d6f6f6e, 21739, 9, 2, 7420, 0},
+    {0x6d757369, 8329, 8, 1, 7420, 0},
+    {0x6e67726f, 20496, 5, 1, 7420, 0},
+    {0x6e696400, 42273, 3, 1, 7420, 0},
+    {0x6e6f6465, 32478, 7, 0, 7420, 1},
+    {0x6f6e2d61, 27143, 8, 2, 7421, 0},
+    {0x6f6e2d6b, 36797, 6, 2, 7421, 0},
+    {0x6f6e2d72, 36803, 6, 2, 7421, 0},
+    {0x70616e74, 10999, 12, 1, 7421, 0},
+    {0x70726f74, 27391, 8, 1, 7421, 0},
+    {0x7073746d, 40110, 5, 1, 7421, 1},
+    {0x71637800, 42336, 3, 1, 7422, 1},
+    {0x716f746f, 41702, 4, 1, 7423, 0},
+    {0x72656164, 14315, 11, 1, 7423, 0},
+    {0x72657369, 14337, 11, 1, 7423, 0},
+    {0x72657369, 11131, 12, 0, 7423, 1},
+    {0x73357900, 42345, 3, 2, 7424, 0},
+    {0x73616e64, 27599, 8, 1, 7424, 0},
+    {0x73686966, 14447, 11, 1, 7424, 0},
+    {0x73686966, 22477, 9, 1, 7424, 0},
+    {0x73687700, 42360, 3, 1, 7424, 0},
+    {0x73706163, 27983, 8, 1, 7424, 0},
+    {0x73746f6c, 37469, 6, 2, 7424, 0},
+    {0x74656c65, 33486, 7, 1, 7424, 0},
+    {0x7468696e, 8961, 9, 0, 7424, 4},
+    {0x7469636b, 33549, 7, 1, 7428, 0},
+    {0x756e6973, 28623, 8, 0, 7428, 1},
+    {0x75706c69, 41906, 4, 1, 7429, 0},
+    {0x75747765, 33822, 7, 1, 7429, 0},
+    {0x7661706f, 18662, 10, 1, 7429, 0},
+    {0x76627270, 28671, 8, 0, 7429, 1},
+    {0x76697274, 9078, 13, 1, 7430, 0},
+    {0x77656274, 23242, 9, 1, 7430, 0},
+    {0x77656465, 28799, 8, 1, 7430, 0},
+    {0x636f6d00, 19, 3, 1, 7430, 0},
+    {0x65647500, 9778, 3, 1, 7430, 0},
+    {0x676f7600, 810, 3, 1, 7430, 0},
+    {0x6d696c00, 6019, 3, 1, 7430, 0},
+    {0x6e657400, 2944, 3, 1, 7430, 0},
+    {0x6f726700, 6352, 3, 1, 7430, 0},
+    {0x61630000, 35, 2, 1, 7430, 0},
+    {0x636f0000, 4, 2, 1, 7430, 0},
+    {0x676f7600, 810, 3, 1, 7430, 0},
+    {0x69640000, 458, 2, 1, 7430, 0},
+    {0x6e657400, 2944, 3, 1, 7430, 0},
+    {0x6f726700, 6352, 3, 1, 7430, 0},
+    {0x73636800, 1512, 3, 1, 7430, 0},
+    {0x786e2d2d, 5667, 15, 1, 7430, 0},
+    {0x786e2d2d, 7353, 14, 1, 7430, 0},
+    {0x626c6f67, 23967, 8, 1, 7430, 0},
+    {0x636f6d00, 19, 3, 1, 7430, 0},
+    {0x63757063, 29930, 7, 1, 7430, 0},
+    {0x65647500, 9778, 3, 1, 7430, 0},
+    {0x676f7600, 810, 3, 1, 7430, 0},
+    {0x696e7400, 2022, 3, 1, 7430, 0},
+    {0x6e657400, 2944, 3, 1, 7430, 0},
+    {0x6f726700, 6352, 3, 1, 7430, 0},
+    {0x31323368, 12511, 11, 1, 7430, 0},
+    {0x31362d62, 40942, 4, 1, 7430, 0},
+    {0x33322d62, 40954, 4, 1, 7430, 0},
+    {0x36342d62, 40958, 4, 1, 7430, 0},
+    {0x61627200, 2068, 3, 1, 7430, 0},
+    {0x61627275, 29069, 7, 1, 7430, 0},
+    {0x61670000, 982, 2, 1, 7430, 0},
+    {0x61677269, 19408, 9, 1, 7430, 0},
+    {0x616c0000, 106, 2, 1, 7430, 0},
+    {0x616c6573, 12577, 11, 1, 7430, 0},
+    {0x616c746f, 1583, 10, 1, 7430, 0},
+    {0x616c746f, 2211, 9, 1, 7430, 0},
+    {0x616e0000, 63, 2, 1, 7430, 0},
+    {0x616e636f, 34265, 6, 1, 7430, 0},
+    {0x616e6472, 631, 21, 1, 7430, 0},
+    {0x616e6472, 652, 21, 1, 7430, 0},
+    {0x616e6472, 1365, 19, 1, 7430, 0},
+    {0x616e6472, 1384, 19, 1, 7430, 0},
+    {0x616f0000, 756, 2, 1, 7430, 0},
+    {0x616f7374, 9047, 5, 1, 7430, 0},
+    {0x616f7374, 9739, 12, 1, 7430, 0},
+    {0x616f7374, 12599, 11, 1, 7430, 0},
+    {0x616f7374, 958, 5, 1, 7430, 0},
+    {0x61700000, 131, 2, 1, 7430, 0},
+    {0x61710000, 7093, 2, 1, 7430, 0},
+    {0x61717569, 31877, 6, 1, 7430, 0},
+    {0x61720000, 639, 2, 1, 7430, 0},
+    {0x6172657a, 34319, 6, 1, 7430, 0},
+    {0x6173636f, 7726, 13, 1, 7430, 0},
+    {0x6173636f, 9787, 12, 1, 7430, 0},
+    {0x61737469, 3454, 4, 1, 7430, 0},
+    {0x61740000, 89, 2, 1, 7430, 0},
+    {0x61760000, 1620, 2, 1, 7430, 0},
+    {0x6176656c, 23839, 8, 1, 7430, 0},
+    {0x62610000, 454, 2, 1, 7430, 0},
+    {0x62616c73, 503, 6, 1, 7430, 0},
+    {0x62616c73, 4377, 15, 1, 7430, 0},
+    {0x62616c73, 3372, 16, 1, 7430, 0},
+    {0x62617269, 31277, 4, 1, 7430, 0},
+    {0x6261726c, 673, 21, 1, 7430, 0},
+    {0x6261726c, 1371, 19, 1, 7430, 0},
+    {0x62617300, 12698, 3, 1, 7430, 0},
+    {0x62617369, 16032, 10, 1, 7430, 0},
+    {0x62656c6c, 29384, 7, 1, 7430, 0},
+    {0x62656e65, 19768, 9, 1, 7430, 0},
+    {0x62657267, 29398, 7, 1, 7430, 0},
+    {0x62670000, 3100, 2, 1, 7430, 0},
+    {0x62690000, 2047, 2, 1, 7430, 0},
+    {0x6269656c, 34457, 6, 1, 7430, 0},
+    {0x626c0000, 764, 2, 1, 7430, 0},
+    {0x626c6f67, 23967, 8, 1, 7430, 0},
+    {0x626e0000, 4248, 2, 1, 7430, 0},
+    {0x626f0000, 887, 2, 1, 7430, 0},
+    {0x626f6c6f, 29468, 7, 1, 7430, 0},
+    {0x626f6c7a, 2560, 7, 1, 7430, 0},
+    {0x626f6c7a, 2560, 17, 1, 7430, 0},
+    {0x626f7a65, 887, 5, 1, 7430, 0},
+    {0x626f7a65, 6135, 14, 1, 7430, 0},
+    {0x626f7a65, 4407, 15, 1, 7430, 0},
+    {0x62720000, 750, 2, 1, 7430, 0},
+    {0x62726573, 29503, 7, 1, 7430, 0},
+    {0x6272696e, 24031, 8, 1, 7430, 0},
+    {0x62730000, 125, 2, 1, 7430, 0},
+    {0x62740000, 4080, 2, 1, 7430, 0},
+    {0x62756c73, 525, 6, 1, 7430, 0},
+    {0x62756c73, 4437, 15, 1, 7430, 0},
+    {0x62756c73, 3404, 16, 1, 7430, 0},
+    {0x627a0000, 42060, 2, 1, 7430, 0},
+    {0x63610000, 25, 2, 1, 7430, 0},
+    {0x6361676c, 24111, 8, 1, 7430, 0},
+    {0x63616c00, 2686, 3, 1, 7430, 0},
+    {0x63616c61, 5179, 8, 1, 7430, 0},
+    {0x63616c74, 7817, 13, 1, 7430, 0},
+    {0x63616d00, 3814, 3, 1, 7430, 0},
+    {0x63616d70, 24127, 8, 1, 7430, 0},
+    {0x63616d70, 4452, 15, 1, 7430, 0},
+    {0x63616d70, 6149, 14, 1, 7430, 0},
+    {0x63616d70, 16172, 10, 1, 7430, 0},
+    {0x63617262, 2594, 17, 1, 7430, 0},
+    {0x63617262, 3420, 16, 1, 7430, 0},
+    {0x63617272, 7843, 13, 1, 7430, 0},
+    {0x63617272, 9871, 12, 1, 7430, 0},
+    {0x63617365, 29601, 7, 1, 7430, 0},
+    {0x63617461, 29615, 7, 1, 7430, 0},
+    {0x63617461, 19876, 9, 1, 7430, 0},
+    {0x63620000, 943, 2, 1, 7430, 0},
+    {0x63650000, 65, 2, 1, 7430, 0},
+    {0x63657365, 9895, 12, 1, 7430, 0},
+    {0x63657365, 12841, 11, 1, 7430, 0},
+    {0x63680000, 36, 2, 1, 7430, 0},
+    {0x63686965, 34589, 6, 1, 7430, 0},
+    {0x63690000, 457, 2, 1, 7430, 0},
+    {0x636c0000, 547, 2, 1, 7430, 0},
+    {0x636e0000, 6219, 2, 1, 7430, 0},
+    {0x636f0000, 4, 2, 1, 7430, 0},
+    {0x636f6d6f, 41098, 4, 1, 7430, 0},
+    {0x636f7365, 29860, 7, 1, 7430, 0},
+    {0x63720000, 5582, 2, 1, 7430, 0},
+    {0x6372656d, 29902, 7, 1, 7430, 0},
+    {0x63726f74, 29916, 7, 1, 7430, 0},
+    {0x63730000, 4927, 2, 1, 7430, 0},
+    {0x63740000, 452, 2, 1, 7430, 0},
+    {0x63756e65, 38670, 5, 1, 7430, 0},
+    {0x637a0000, 15089, 2, 1, 7430, 0},
+    {0x64656c6c, 6275, 14, 1, 7430, 0},
+    {0x64656c6c, 7934, 13, 1, 7430, 0},
+    {0x65647500, 9778, 3, 1, 7430, 0},
+    {0x656d696c, 6373, 14, 1, 7430, 0},
+    {0x656d696c, 8025, 13, 1, 7430, 0},
+    {0x656d7200, 42126, 3, 1, 7430, 0},
+    {0x656e0000, 44, 2, 1, 7430, 0},
+    {0x656e6e61, 32873, 4, 1, 7430, 0},
+    {0x66630000, 1666, 2, 1, 7430, 0},
+    {0x66650000, 917, 2, 1, 7430, 0},
+    {0x6665726d, 38880, 5, 1, 7430, 0},
+    {0x66657272, 30245, 7, 1, 7430, 0},
+    {0x66670000, 42182, 2, 1, 7430, 0},
+    {0x66690000, 720, 2, 1, 7430, 0},
+    {0x66697265, 30294, 7, 1, 7430, 0},
+    {0x666c6f72, 24775, 8, 1, 7430, 0},
+    {0x666d0000, 20844, 2, 1, 7430, 0},
+    {0x666f6767, 34979, 6, 1, 7430, 0},
+    {0x666f726c, 10087, 12, 1, 7430, 0},
+    {0x666f726c, 13303, 11, 1, 7430, 0},
+    {0x66720000, 61, 2, 1, 7430, 0},
+    {0x66726975, 4692, 15, 1, 7430, 0},
+    {0x66726975, 3564, 16, 1, 7430, 0},
+    {0x66726975, 4707, 15, 1, 7430, 0},
+    {0x66726975, 694, 21, 1, 7430, 0},
+    {0x66726975, 1047, 20, 1, 7430, 0},
+    {0x66726975, 6401, 14, 1, 7430, 0},
+    {0x66726975, 6415, 14, 1, 7430, 0},
+    {0x66726975, 4722, 15, 1, 7430, 0},
+    {0x66726975, 6429, 14, 1, 7430, 0},
+    {0x66726975, 1067, 20, 1, 7430, 0},
+    {0x66726975, 1441, 19, 1, 7430, 0},
+    {0x66726975, 8116, 13, 1, 7430, 0},
+    {0x66726f73, 20335, 9, 1, 7430, 0},
+    {0x66766700, 42168, 3, 1, 7430, 0},
+    {0x67650000, 324, 2, 1, 7430, 0},
+    {0x67656e6f, 38975, 5, 1, 7430, 0},
+    {0x67656e6f, 35093, 6, 1, 7430, 0},
+    {0x676f0000, 810, 2, 1, 7430, 0},
+    {0x676f7269, 30966, 7, 1, 7430, 0},
+    {0x676f7600, 810, 3, 1, 7430, 0},
+    {0x67720000, 2757, 2, 1, 7430, 0},
+    {0x67726f73, 25023, 8, 1, 7430, 0},
+    {0x6962786f, 39195, 5, 1, 7430, 0},
+    {0x69676c65, 2696, 17, 1, 7430, 0},
+    {0x69676c65, 3676, 16, 1, 7430, 0},
+    {0x696c6961, 16942, 10, 1, 7430, 0},
+    {0x696d0000, 2668, 2, 1, 7430, 0},
+    {0x696d7065, 31288, 7, 1, 7430, 0},
+    {0x69730000, 52, 2, 1, 7430, 0},
+    {0x69736572, 31372, 7, 1, 7430, 0},
+    {0x6b720000, 1749, 2, 1, 7430, 0},
+    {0x6c612d73, 21361, 9, 1, 7430, 0},
+    {0x6c617175, 31876, 7, 1, 7430, 0},
+    {0x6c617370, 26199, 8, 1, 7430, 0},
+    {0x6c617469, 35951, 6, 1, 7430, 0},
+    {0x6c617a00, 39465, 3, 1, 7430, 0},
+    {0x6c617a69, 39465, 5, 1, 7430, 0},
+    {0x6c630000, 107, 2, 1, 7430, 0},
+    {0x6c650000, 17, 2, 1, 7430, 0},
+    {0x6c656363, 39475, 5, 1, 7430, 0},
+    {0x6c656363, 39480, 5, 1, 7430, 0},
+    {0x6c690000, 698, 2, 1, 7430, 0},
+    {0x6c696700, 4897, 3, 1, 7430, 0},
+    {0x6c696775, 31960, 7, 1, 7430, 0},
+    {0x6c69766f, 31981, 7, 1, 7430, 0},
+    {0x6c6f0000, 991, 2, 1, 7430, 0},
+    {0x6c6f6469, 26247, 4, 1, 7430, 0},
+    {0x6c6f6d00, 17640, 3, 1, 7430, 0},
+    {0x6c6f6d62, 21505, 9, 1, 7430, 0},
+    {0x6c6f6d62, 26255, 8, 1, 7430, 0},
+    {0x6c740000, 232, 2, 1, 7430, 0},
+    {0x6c750000, 1732, 2, 1, 7430, 0},
+    {0x6c756361, 32009, 7, 1, 7430, 0},
+    {0x6c756363, 39565, 5, 1, 7430, 0},
+    {0x6d616365, 26303, 8, 1, 7430, 0},
+    {0x6d616e74, 32072, 7, 1, 7430, 0},
+    {0x6d617200, 2590, 3, 1, 7430, 0},
+    {0x6d617263, 36125, 6, 1, 7430, 0},
+    {0x6d617373, 8506, 13, 1, 7430, 0},
+    {0x6d617373, 10735, 12, 1, 7430, 0},
+    {0x6d617465, 36155, 6, 1, 7430, 0},
+    {0x6d620000, 4433, 2, 1, 7430, 0},
+    {0x6d630000, 1647, 2, 1, 7430, 0},
+    {0x6d650000, 102, 2, 1, 7430, 0},
+    {0x6d656469, 5067, 15, 1, 7430, 0},
+    {0x6d656469, 6723, 14, 1, 7430, 0},
+    {0x6d657373, 32170, 7, 1, 7430, 0},
+    {0x6d690000, 492, 2, 1, 7430, 0},
+    {0x6d696c61, 36257, 5, 1, 7430, 0},
+    {0x6d696c61, 36257, 6, 1, 7430, 0},
+    {0x6d6e0000, 5601, 2, 1, 7430, 0},
+    {0x6d6f0000, 736, 2, 1, 7430, 0},
+    {0x6d6f6465, 36395, 6, 1, 7430, 0},
+    {0x6d6f6c00, 13382, 3, 1, 7430, 0},
+    {0x6d6f6c69, 36407, 6, 1, 7430, 0},
+    {0x6d6f6e7a, 736, 5, 1, 7430, 0},
+    {0x6d6f6e7a, 8558, 13, 1, 7430, 0},
+    {0x6d6f6e7a, 736, 21, 1, 7430, 0},
+    {0x6d6f6e7a, 10783, 12, 1, 7430, 0},
+    {0x6d6f6e7a, 8571, 13, 1, 7430, 0},
+    {0x6d6f6e7a, 2058, 18, 1, 7430, 0},
+    {0x6d730000, 578, 2, 1, 7430, 0},
+    {0x6d740000, 1271, 2, 1, 7430, 0},
+    {0x6d797370, 10819, 12, 1, 7430, 0},
+    {0x6e610000, 722, 2, 1, 7430, 0},
+    {0x6e61706c, 36581, 6, 1, 7430, 0},
+    {0x6e61706f, 10308, 6, 1, 7430, 0},
+    {0x6e65656e, 41590, 4, 0, 7430, 1},
+    {0x6e6f0000, 134, 2, 1, 7431, 0},
+    {0x6e6f7661, 36713, 6, 1, 7431, 0},
+    {0x6e750000, 4954, 2, 1, 7431, 0},
+    {0x6e756f72, 39845, 5, 1, 7431, 0},
+    {0x6f670000, 573, 2, 1, 7431, 0},
+    {0x6f676c69, 6280, 9, 1, 7431, 0},
+    {0x6f6c6269, 10963, 12, 1, 7431, 0},
+    {0x6f6c6269, 14084, 11, 1, 7431, 0},
+    {0x6f720000, 5, 2, 1, 7431, 0},
+    {0x6f726973, 27183, 8, 1, 7431, 0},
+    {0x6f740000, 1623, 2, 1, 7431, 0},
+    {0x70610000, 778, 2, 1, 7431, 0},
+    {0x7061646f, 36881, 6, 1, 7431, 0},
+    {0x70616475, 40000, 5, 1, 7431, 0},
+    {0x70616c65, 32730, 7, 1, 7431, 0},
+    {0x7061726d, 40015, 5, 1, 7431, 0},
+    {0x70617669, 40035, 5, 1, 7431, 0},
+    {0x70630000, 2554, 2, 1, 7431, 0},
+    {0x70640000, 13027, 2, 1, 7431, 0},
+    {0x70650000, 481, 2, 1, 7431, 0},
+    {0x70657275, 32737, 7, 1, 7431, 0},
+    {0x70657361, 8714, 13, 1, 7431, 0},
+    {0x70657361, 11011, 12, 1, 7431, 0},
+    {0x70657363, 32744, 7, 1, 7431, 0},
+    {0x70670000, 15529, 2, 1, 7431, 0},
+    {0x70690000, 4455, 2, 1, 7431, 0},
+    {0x70696163, 27255, 8, 1, 7431, 0},
+    {0x70696564, 27271, 8, 1, 7431, 0},
+    {0x7069656d, 27279, 8, 1, 7431, 0},
+    {0x70697361, 41682, 4, 1, 7431, 0},
+    {0x70697374, 32779, 7, 1, 7431, 0},
+    {0x706d6e00, 42312, 3, 1, 7431, 0},
+    {0x706e0000, 10830, 2, 1, 7431, 0},
+    {0x706f0000, 67, 2, 1, 7431, 0},
+    {0x706f7264, 22180, 9, 1, 7431, 0},
+    {0x706f7465, 32849, 7, 1, 7431, 0},
+    {0x70720000, 220, 2, 1, 7431, 0},
+    {0x70726174, 40085, 5, 1, 7431, 0},
+    {0x70740000, 1961, 2, 1, 7431, 0},
+    {0x70750000, 4545, 2, 1, 7431, 0},
+    {0x70756700, 37031, 3, 1, 7431, 0},
+    {0x7075676c, 37031, 6, 1, 7431, 0},
+    {0x70760000, 18701, 2, 1, 7431, 0},
+    {0x707a0000, 42473, 2, 1, 7431, 0},
+    {0x72610000, 62, 2, 1, 7431, 0},
+    {0x72616775, 37061, 6, 1, 7431, 0},
+    {0x72617665, 32870, 7, 1, 7431, 0},
+    {0x72630000, 770, 2, 1, 7431, 0},
+    {0x72650000, 7, 2, 1, 7431, 0},
+    {0x72656767, 5172, 15, 1, 7431, 0},
+    {0x72656767, 8740, 13, 1, 7431, 0},
+    {0x72656767, 6849, 14, 1, 7431, 0},
+    {0x72656767, 11107, 12, 1, 7431, 0},
+    {0x72670000, 41, 2, 1, 7431, 0},
+    {0x72690000, 221, 2, 1, 7431, 0},
+    {0x72696574, 40165, 5, 1, 7431, 0},
+    {0x72696d69, 37115, 6, 1, 7431, 0},
+    {0x726d0000, 322, 2, 1, 7431, 0},
+    {0x726e0000, 919, 2, 1, 7431, 0},
+    {0x726f0000, 99, 2, 1, 7431, 0},
+    {0x726f6d61, 5226, 4, 1, 7431, 0},
+    {0x726f6d65, 19404, 4, 1, 7431, 0},
+    {0x726f7669, 37145, 6, 1, 7431, 0},
+    {0x73610000, 506, 2, 1, 7431, 0},
+    {0x73616c65, 33024, 7, 1, 7431, 0},
+    {0x73617200, 8716, 3, 1, 7431, 0},
+    {0x73617264, 27623, 8, 1, 7431, 0},
+    {0x73617264, 27631, 8, 1, 7431, 0},
+    {0x73617373, 33073, 7, 1, 7431, 0},
+    {0x7361766f, 37253, 6, 1, 7431, 0},
+    {0x73690000, 126, 2, 1, 7431, 0},
+    {0x73696300, 8331, 3, 1, 7431, 0},
+    {0x73696369, 33241, 7, 1, 7431, 0},
+    {0x73696369, 37373, 6, 1, 7431, 0},
+    {0x7369656e, 40370, 5, 1, 7431, 0},
+    {0x73697261, 27879, 8, 1, 7431, 0},
+    {0x736f0000, 159, 2, 1, 7431, 0},
+    {0x736f6e64, 33318, 7, 1, 7431, 0},
+    {0x73700000, 1406, 2, 1, 7431, 0},
+    {0x73720000, 1825, 2, 1, 7431, 0},
+    {0x73730000, 494, 2, 1, 7431, 0},
+    {0x73756564, 2247, 9, 1, 7431, 0},
+    {0x73760000, 7979, 2, 1, 7431, 0},
+    {0x73796e63, 28111, 8, 1, 7431, 0},
+    {0x74610000, 105, 2, 1, 7431, 0},
+    {0x74616100, 1401, 3, 1, 7431, 0},
+    {0x74617261, 33465, 7, 1, 7431, 0},
+    {0x74650000, 15, 2, 1, 7431, 0},
+    {0x74656d70, 11479, 12, 1, 7431, 0},
+    {0x74656d70, 14601, 11, 1, 7431, 0},
+    {0x74657261, 37691, 6, 1, 7431, 0},
+    {0x7465726e, 40570, 5, 1, 7431, 0},
+    {0x74696d00, 5991, 3, 0, 7431, 1},
+    {0x746e0000, 1624, 2, 1, 7432, 0},
+    {0x746f0000, 1004, 2, 1, 7432, 0},
+    {0x746f7269, 37781, 6, 1, 7432, 0},
+    {0x746f7300, 11357, 3, 1, 7432, 0},
+    {0x746f7363, 33605, 7, 1, 7432, 0},
+    {0x74700000, 777, 2, 1, 7432, 0},
+    {0x74720000, 199, 2, 1, 7432, 0},
+    {0x7472616e, 820, 21, 1, 7432, 0},
+    {0x7472616e, 841, 21, 1, 7432, 0},
+    {0x7472616e, 1536, 19, 1, 7432, 0},
+    {0x7472616e, 1555, 19, 1, 7432, 0},
+    {0x74726170, 33682, 7, 1, 7432, 0},
+    {0x7472656e, 2968, 17, 1, 7432, 0},
+    {0x7472656e, 3948, 16, 1, 7432, 0},
+    {0x7472656e, 2184, 18, 1, 7432, 0},
+    {0x7472656e, 2985, 17, 1, 7432, 0},
+    {0x7472656e, 199, 8, 1, 7432, 0},
+    {0x7472656e, 3964, 16, 1, 7432, 0},
+    {0x7472656e, 5292, 15, 1, 7432, 0},
+    {0x7472656e, 1574, 19, 1, 7432, 0},
+    {0x7472656e, 2202, 18, 1, 7432, 0},
+    {0x7472656e, 3980, 16, 1, 7432, 0},
+    {0x7472656e, 5307, 15, 1, 7432, 0},
+    {0x7472656e, 2220, 18, 1, 7432, 0},
+    {0x7472656e, 3002, 17, 1, 7432, 0},
+    {0x7472656e, 1593, 19, 1, 7432, 0},
+    {0x7472656e, 2238, 18, 1, 7432, 0},
+    {0x7472656e, 5322, 15, 1, 7432, 0},
+    {0x7472656e, 6961, 14, 1, 7432, 0},
+    {0x7472656e, 2256, 18, 1, 7432, 0},
+    {0x7472656e, 3019, 17, 1, 7432, 0},
+    {0x7472656e, 5337, 15, 1, 7432, 0},
+    {0x7472656e, 6975, 14, 1, 7432, 0},
+    {0x7472656e, 3036, 17, 1, 7432, 0},
+    {0x7472656e, 3996, 16, 1, 7432, 0},
+    {0x7472656e, 2274, 18, 1, 7432, 0},
+    {0x7472656e, 3053, 17, 1, 7432, 0},
+    {0x7472656e, 4012, 16, 1, 7432, 0},
+    {0x7472656e, 5352, 15, 1, 7432, 0},
+    {0x7472656e, 3070, 17, 1, 7432, 0},
+    {0x7472656e, 4028, 16, 1, 7432, 0},
+    {0x7472656e, 37847, 6, 1, 7432, 0},
+    {0x74726576, 33689, 7, 1, 7432, 0},
+    {0x74726965, 33696, 7, 1, 7432, 0},
+    {0x74730000, 70, 2, 1, 7432, 0},
+    {0x74757269, 40665, 5, 1, 7432, 0},
+    {0x74757363, 33780, 7, 1, 7432, 0},
+    {0x74760000, 2443, 2, 1, 7432, 0},
+    {0x75640000, 2230, 2, 1, 7432, 0},
+    {0x7564696e, 40690, 5, 1, 7432, 0},
+    {0x756d6200, 4432, 3, 1, 7432, 0},
+    {0x756d6272, 37925, 6, 1, 7432, 0},
+    {0x75726269, 9026, 13, 1, 7432, 0},
+    {0x75726269, 11539, 12, 1, 7432, 0},
+    {0x76610000, 114, 2, 1, 7432, 0},
+    {0x76616c2d, 14667, 11, 1, 7432, 0},
+    {0x76616c2d, 18632, 10, 1, 7432, 0},
+    {0x76616c64, 18642, 10, 1, 7432, 0},
+    {0x76616c64, 23170, 9, 1, 7432, 0},
+    {0x76616c6c, 14678, 11, 1, 7432, 0},
+    {0x76616c6c, 9039, 13, 1, 7432, 0},
+    {0x76616c6c, 11551, 12, 1, 7432, 0},
+    {0x76616c6c, 18652, 10, 1, 7432, 0},
+    {0x76616c6c, 11563, 12, 1, 7432, 0},
+    {0x76616c6c, 14689, 11, 1, 7432, 0},
+    {0x76616c6c, 11575, 12, 1, 7432, 0},
+    {0x76616c6c, 6989, 14, 1, 7432, 0},
+    {0x76616c6c, 14700, 11, 1, 7432, 0},
+    {0x76616c6c, 11587, 12, 1, 7432, 0},
+    {0x76616f00, 42423, 3, 1, 7432, 0},
+    {0x76617265, 37991, 6, 1, 7432, 0},
+    {0x76620000, 361, 2, 1, 7432, 0},
+    {0x76630000, 7540, 2, 1, 7432, 0},
+    {0x76646100, 8184, 3, 1, 7432, 0},
+    {0x76650000, 320, 2, 1, 7432, 0},
+    {0x76656e00, 701, 3, 1, 7432, 0},
+    {0x76656e65, 38003, 6, 1, 7432, 0},
+    {0x76656e65, 701, 7, 1, 7432, 0},
+    {0x76656e69, 38009, 6, 1, 7432, 0},
+    {0x76657262, 28695, 8, 1, 7432, 0},
+    {0x76657263, 28703, 8, 1, 7432, 0},
+    {0x7665726f, 38021, 6, 1, 7432, 0},
+    {0x76690000, 97, 2, 1, 7432, 0},
+    {0x7669626f, 9065, 13, 1, 7432, 0},
+    {0x7669626f, 11623, 12, 1, 7432, 0},
+    {0x76696365, 33864, 7, 1, 7432, 0},
+    {0x76697465, 33892, 7, 1, 7432, 0},
+    {0x76720000, 1276, 2, 1, 7432, 0},
+    {0x76730000, 5019, 2, 1, 7432, 0},
+    {0x76740000, 7975, 2, 1, 7432, 0},
+    {0x76760000, 2370, 2, 1, 7432, 0},
+    {0x786e2d2d, 499, 22, 1, 7432, 0},
+    {0x786e2d2d, 883, 21, 1, 7432, 0},
+    {0x786e2d2d, 521, 22, 1, 7432, 0},
+    {0x786e2d2d, 1631, 19, 1, 7432, 0},
+    {0x786e2d2d, 2346, 18, 1, 7432, 0},
+    {0x786e2d2d, 1650, 19, 1, 7432, 0},
+    {0x786e2d2d, 2382, 18, 1, 7432, 0},
+    {0x786e2d2d, 5802, 15, 1, 7432, 0},
+    {0x786e2d2d, 244, 24, 1, 7432, 0},
+    {0x786e2d2d, 363, 23, 1, 7432, 0},
+    {0x786e2d2d, 195, 25, 1, 7432, 0},
+    {0x786e2d2d, 268, 24, 1, 7432, 0},
+    {0x786e2d2d, 292, 24, 1, 7432, 0},
+    {0x786e2d2d, 386, 23, 1, 7432, 0},
+    {0x786e2d2d, 409, 23, 1, 7432, 0},
+    {0x786e2d2d, 609, 22, 1, 7432, 0},
+    {0x786e2d2d, 1840, 19, 1, 7432, 0},
+    {0x786e2d2d, 946, 21, 1, 7432, 0},
+    {0x786e2d2d, 2508, 18, 1, 7432, 0},
+    {0x786e2d2d, 1859, 19, 1, 7432, 0},
+    {0x636f0000, 4, 2, 1, 7432, 0},
+    {0x6e657400, 2944, 3, 1, 7432, 0},
+    {0x6f660000, 1015, 2, 1, 7432, 0},
+    {0x6f726700, 6352, 3, 1, 7432, 0},
+    {0x636f6d00, 19, 3, 1, 7432, 0},
+    {0x65647500, 9778, 3, 1, 7432, 0},
+    {0x676f7600, 810, 3, 1, 7432, 0},
+    {0x6d696c00, 6019, 3, 1, 7432, 0},
+    {0x6e616d65, 17722, 4, 1, 7432, 0},
+    {0x6e657400, 2944, 3, 1, 7432, 0},
+    {0x6f726700, 6352, 3, 1, 7432, 0},
+    {0x73636800, 1512, 3, 1, 7432, 0},
+    {0x61630000, 35, 2, 1, 7432, 0},
+    {0x61640000, 729, 2, 1, 7432, 0},
+    {0x61696368, 13452, 5, 1, 7432, 52},
+    {0x616b6974, 8440, 5, 1, 7484, 28},
+    {0x616e6772, 38395, 5, 1, 7512, 0},
+    {0x616f6d6f, 34295, 6, 1, 7512, 22},
+    {0x62616279, 23847, 8, 1, 7534, 0},
+    {0x62616279, 23855, 8, 1, 7534, 0},
+    {0x6261636b, 23863, 8, 1, 7534, 0},
+    {0x62616d62, 29356, 7, 1, 7534, 0},
+    {0x62697474, 34493, 6, 1, 7534, 0},
+    {0x626c6f67, 23967, 8, 1, 7534, 0},
+    {0x626c7573, 38545, 5, 1, 7534, 0},
+    {0x626f6f00, 4907, 3, 1, 7534, 0},
+    {0x626f7900, 19822, 3, 1, 7534, 0},
+    {0x626f7966, 19822, 9, 1, 7534, 0},
+    {0x62757400, 20779, 3, 1, 7534, 0},
+    {0x62757973, 29552, 7, 1, 7534, 0},
+    {0x63616e64, 24143, 8, 1, 7534, 0},
+    {0x6361706f, 38600, 5, 1, 7534, 0},
+    {0x63617466, 29622, 7, 1, 7534, 0},
+    {0x63686561, 38625, 5, 1, 7534, 0},
+    {0x63686962, 19347, 5, 1, 7534, 58},
+    {0x63686963, 24183, 8, 1, 7592, 0},
+    {0x6368696c, 24207, 8, 1, 7592, 0},
+    {0x63686970, 38630, 5, 1, 7592, 0},
+    {0x63686f77, 29720, 7, 1, 7592, 0},
+    {0x63687500, 6878, 3, 1, 7592, 0},
+    {0x6369616f, 41078, 4, 1, 7592, 0},
+    {0x636f0000, 4, 2, 1, 7592, 0},
+    {0x636f636f, 29790, 7, 1, 7592, 0},
+    {0x636f6f6c, 24335, 8, 1, 7592, 0},
+    {0x6372616e, 34691, 6, 1, 7592, 0},
+    {0x63757465, 24367, 8, 1, 7592, 0},
+    {0x64616100, 19568, 3, 1, 7592, 0},
+    {0x64656361, 7841, 4, 1, 7592, 0},
+    {0x64656369, 32144, 4, 1, 7592, 0},
+    {0x64696769, 34787, 6, 1, 7592, 0},
+    {0x65640000, 1023, 2, 1, 7592, 0},
+    {0x65676f69, 34877, 6, 1, 7592, 0},
+    {0x6568696d, 20613, 5, 1, 7592, 22},
+    {0x66616b65, 30224, 7, 1, 7614, 0},
+    {0x66617368, 10039, 12, 1, 7614, 0},
+    {0x66656d00, 42135, 3, 1, 7614, 0},
+    {0x666c6965, 38900, 5, 1, 7614, 0},
+    {0x666c6f70, 34973, 6, 1, 7614, 0},
+    {0x666f6f6c, 41222, 4, 1, 7614, 0},
+    {0x6672656e, 16692, 10, 1, 7614, 0},
+    {0x66756b75, 38955, 5, 1, 7614, 15},
+    {0x66756b75, 30812, 7, 1, 7629, 63},
+    {0x66756b75, 8432, 9, 1, 7692, 51},
+    {0x67696675, 41246, 4, 1, 7743, 38},
+    {0x6769726c, 16742, 10, 1, 7781, 0},
+    {0x6769726c, 38995, 5, 1, 7781, 0},
+    {0x676c6f6f, 35153, 6, 1, 7781, 0},
+    {0x676f0000, 810, 2, 1, 7781, 0},
+    {0x676f6e6e, 39030, 5, 1, 7781, 0},
+    {0x67720000, 2757, 2, 1, 7781, 0},
+    {0x67726561, 31022, 7, 1, 7781, 0},
+    {0x67756e6d, 39085, 5, 1, 7781, 36},
+    {0x68616363, 39090, 5, 1, 7817, 0},
+    {0x68616e64, 13424, 11, 1, 7817, 0},
+    {0x68656176, 39120, 5, 1, 7817, 0},
+    {0x68657200, 1910, 3, 1, 7817, 0},
+    {0x6869686f, 13671, 4, 1, 7817, 0},
+    {0x68697070, 39140, 5, 1, 7817, 0},
+    {0x6869726f, 3587, 9, 1, 7817, 25},
+    {0x686f6b6b, 25223, 8, 1, 7842, 142},
+    {0x686f6c79, 41318, 4, 1, 7984, 0},
+    {0x68756e67, 35435, 6, 1, 7984, 0},
+    {0x68796f67, 39185, 5, 1, 7984, 46},
+    {0x69626172, 31232, 7, 1, 8030, 51},
+    {0x69637572, 35453, 6, 1, 8081, 0},
+    {0x69736869, 21938, 8, 1, 8081, 19},
+    {0x69746967, 39260, 5, 1, 8100, 0},
+    {0x69776174, 39280, 5, 1, 8100, 34},
+    {0x6a656c6c, 20938, 9, 1, 8134, 0},
+    {0x6b616761, 8214, 6, 1, 8134, 15},
+    {0x6b61676f, 20983, 9, 1, 8149, 20},
+    {0x6b616e61, 25695, 8, 1, 8169, 30},
+    {0x6b617761, 17162, 10, 1, 8199, 0},
+    {0x6b617761, 25799, 8, 2, 8199, 1},
+    {0x6b696b69, 25831, 8, 1, 8200, 0},
+    {0x6b696c6c, 41410, 4, 1, 8200, 0},
+    {0x6b696c6f, 41414, 4, 1, 8200, 0},
+    {0x6b697461, 17202, 10, 2, 8200, 1},
+    {0x6b6f6265, 41426, 4, 2, 8201, 1},
+    {0x6b6f6368, 39365, 5, 1, 8202, 31},
+    {0x6b756d61, 26055, 8, 1, 8233, 23},
+    {0x6b75726f, 39425, 5, 1, 8256, 0},
+    {0x6b796f74, 39440, 5, 1, 8256, 31},
+    {0x6c670000, 4400, 2, 1, 8287, 0},
+    {0x6c697474, 17352, 10, 1, 8287, 0},
+    {0x6c6f6c69, 21496, 9, 1, 8287, 0},
+    {0x6c6f6c69, 17362, 10, 1, 8287, 0},
+    {0x6c6f6d6f, 17640, 4, 1, 8287, 0},
+    {0x6c6f7665, 32002, 7, 1, 8287, 0},
+    {0x6c6f7665, 26271, 8, 1, 8287, 0},
+    {0x6d61696e, 13809, 4, 1, 8287, 0},
+    {0x6d696500, 938, 3, 1, 8287, 30},
+    {0x6d697961, 36347, 6, 1, 8317, 32},
+    {0x6d697961, 26551, 8, 1, 8349, 27},
+    {0x6d6f6473, 41550, 4, 1, 8376, 0},
+    {0x6d6f6e64, 24466, 4, 1, 8376, 0},
+    {0x6d6f6e67, 21730, 9, 1, 8376, 0},
+    {0x6d6f6f00, 21739, 3, 1, 8376, 0},
+    {0x6e616761, 8422, 6, 1, 8376, 75},
+    {0x6e616761, 26775, 8, 1, 8451, 22},
+    {0x6e61676f, 36551, 6, 2, 8473, 1},
+    {0x6e616d61, 32331, 7, 1, 8474, 0},
+    {0x6e617261, 21865, 4, 1, 8474, 38},
+    {0x6e650000, 703, 2, 1, 8512, 2},
+    {0x6e696967, 32429, 7, 1, 8514, 34},
+    {0x6e696b69, 36659, 6, 1, 8548, 0},
+    {0x6e6f6275, 32471, 7, 1, 8548, 0},
+    {0x6e6f6f72, 27189, 4, 1, 8548, 0},
+    {0x6f697461, 39254, 4, 1, 8548, 19},
+    {0x6f6b6179, 32562, 7, 1, 8567, 26},
+    {0x6f6b696e, 32583, 7, 1, 8593, 42},
+    {0x6f6f7073, 41650, 4, 1, 8635, 0},
+    {0x6f720000, 5, 2, 1, 8635, 0},
+    {0x6f73616b, 10214, 5, 1, 8635, 50},
+    {0x70617261, 27215, 8, 1, 8685, 0},
+    {0x70617261, 27223, 8, 1, 8685, 0},
+    {0x7065636f, 36923, 6, 1, 8685, 0},
+    {0x70656577, 36929, 6, 1, 8685, 0},
+    {0x70656e6e, 40040, 5, 1, 8685, 0},
+    {0x70657070, 14551, 6, 1, 8685, 0},
+    {0x7065726d, 40050, 5, 1, 8685, 0},
+    {0x70696762, 32765, 7, 1, 8685, 0},
+    {0x70696e6f, 36965, 6, 1, 8685, 0},
+    {0x70756e79, 40120, 5, 1, 8685, 0},
+    {0x70757075, 41698, 4, 1, 8685, 0},
+    {0x70757373, 27407, 8, 1, 8685, 0},
+    {0x70796100, 18002, 3, 1, 8685, 0},
+    {0x7261696e, 27431, 8, 1, 8685, 0},
+    {0x72656164, 22243, 9, 1, 8685, 0},
+    {0x73616469, 37181, 6, 1, 8685, 0},
+    {0x73616761, 18102, 4, 1, 8685, 26},
+    {0x73616974, 33010, 7, 1, 8711, 69},
+    {0x73617070, 33066, 7, 2, 8780, 1},
+    {0x7363686f, 22378, 9, 1, 8781, 0},
+    {0x73656372, 37265, 6, 1, 8781, 0},
+    {0x73656e64, 8799, 6, 2, 8781, 1},
+    {0x73686967, 6758, 5, 1, 8782, 23},
+    {0x7368696d, 33185, 7, 1, 8805, 23},
+    {0x7368697a, 27847, 8, 1, 8828, 36},
+    {0x73746162, 40470, 5, 1, 8864, 0},
+    {0x73747269, 28031, 8, 1, 8864, 0},
+    {0x73756200, 17495, 3, 1, 8864, 0},
+    {0x73756e6e, 28055, 8, 1, 8864, 0},
+    {0x73757065, 22846, 9, 1, 8864, 0},
+    {0x74686573, 33542, 7, 1, 8864, 0},
+    {0x74686963, 40585, 5, 1, 8864, 0},
+    {0x746f6368, 33570, 7, 1, 8864, 31},
+    {0x746f6b75, 23017, 9, 1, 8895, 17},
+    {0x746f6b79, 39443, 5, 1, 8912, 57},
+    {0x746f6e6b, 28423, 8, 1, 8969, 0},
+    {0x746f7474, 33626, 7, 1, 8969, 13},
+    {0x746f7961, 25113, 6, 1, 8982, 24},
+    {0x756e6465, 28607, 5, 1, 9006, 0},
+    {0x75707065, 40730, 5, 1, 9006, 0},
+    {0x75736572, 767, 11, 1, 9006, 0},
+    {0x76656c76, 37997, 6, 1, 9006, 0},
+    {0x76657273, 14422, 5, 1, 9006, 0},
+    {0x76657273, 38033, 6, 1, 9006, 0},
+    {0x76697669, 38063, 6, 1, 9006, 0},
+    {0x77616b61, 28751, 8, 1, 9006, 29},
+    {0x77617473, 38135, 6, 1, 9035, 0},
+    {0x7765626c, 33955, 7, 1, 9035, 0},
+    {0x77686974, 23260, 9, 1, 9035, 0},
+    {0x786e2d2d, 9143, 13, 1, 9035, 0},
+    {0x786e2d2d, 23287, 9, 1, 9035, 0},
+    {0x786e2d2d, 14821, 11, 1, 9035, 0},
+    {0x786e2d2d, 14832, 11, 1, 9035, 0},
+    {0x786e2d2d, 14854, 11, 1, 9035, 0},
+    {0x786e2d2d, 14876, 11, 1, 9035, 0},
+    {0x786e2d2d, 14942, 11, 1, 9035, 0},
+    {0x786e2d2d, 14953, 11, 1, 9035, 0},
+    {0x786e2d2d, 23296, 9, 1, 9035, 0},
+    {0x786e2d2d, 14986, 11, 1, 9035, 0},
+    {0x786e2d2d, 14997, 11, 1, 9035, 0},
+    {0x786e2d2d, 15008, 11, 1, 9035, 0},
+    {0x786e2d2d, 18852, 10, 1, 9035, 0},
+    {0x786e2d2d, 18862, 10, 1, 9035, 0},
+    {0x786e2d2d, 11767, 12, 1, 9035, 0},
+    {0x786e2d2d, 15041, 11, 1, 9035, 0},
+    {0x786e2d2d, 18892, 10, 1, 9035, 0},
+    {0x786e2d2d, 18952, 10, 1, 9035, 0},
+    {0x786e2d2d, 7171, 14, 1, 9035, 0},
+    {0x786e2d2d, 7185, 14, 1, 9035, 0},
+    {0x786e2d2d, 18992, 10, 1, 9035, 0},
+    {0x786e2d2d, 19002, 10, 1, 9035, 0},
+    {0x786e2d2d, 15129, 11, 1, 9035, 0},
+    {0x786e2d2d, 15140, 11, 1, 9035, 0},
+    {0x786e2d2d, 15151, 11, 1, 9035, 0},
+    {0x786e2d2d, 15305, 11, 1, 9035, 0},
+    {0x786e2d2d, 19092, 10, 1, 9035, 0},
+    {0x786e2d2d, 15316, 11, 1, 9035, 0},
+    {0x786e2d2d, 19102, 10, 1, 9035, 0},
+    {0x786e2d2d, 19112, 10, 1, 9035, 0},
+    {0x786e2d2d, 19122, 10, 1, 9035, 0},
+    {0x786e2d2d, 15415, 11, 1, 9035, 0},
+    {0x786e2d2d, 15448, 11, 1, 9035, 0},
+    {0x786e2d2d, 7493, 14, 1, 9035, 0},
+    {0x786e2d2d, 15470, 11, 1, 9035, 0},
+    {0x786e2d2d, 15536, 11, 1, 9035, 0},
+    {0x786e2d2d, 15558, 11, 1, 9035, 0},
+    {0x786e2d2d, 19202, 10, 1, 9035, 0},
+    {0x786e2d2d, 23485, 9, 1, 9035, 0},
+    {0x786e2d2d, 19212, 10, 1, 9035, 0},
+    {0x786e2d2d, 19222, 10, 1, 9035, 0},
+    {0x786e2d2d, 15646, 11, 1, 9035, 0},
+    {0x786e2d2d, 15668, 11, 1, 9035, 0},
+    {0x786e2d2d, 19242, 10, 1, 9035, 0},
+    {0x786e2d2d, 15679, 11, 1, 9035, 0},
+    {0x786e2d2d, 15701, 11, 1, 9035, 0},
+    {0x786e2d2d, 15767, 11, 1, 9035, 0},
+    {0x79616d61, 28903, 8, 1, 9035, 34},
+    {0x79616d61, 23539, 9, 1, 9069, 16},
+    {0x79616d61, 23548, 9, 1, 9085, 28},
+    {0x796f6b6f, 28943, 8, 2, 9113, 1},
+    {0x7a6f6d62, 38309, 6, 1, 9114, 0},
+    {0x61630000, 35, 2, 1, 9114, 0},
+    {0x636f0000, 4, 2, 1, 9114, 1},
+    {0x676f0000, 810, 2, 1, 9115, 0},
+    {0x696e666f, 21606, 4, 1, 9115, 0},
+    {0x6d650000, 102, 2, 1, 9115, 0},
+    {0x6d6f6269, 2103, 4, 1, 9115, 0},
+    {0x6e650000, 703, 2, 1, 9115, 0},
+    {0x6f720000, 5, 2, 1, 9115, 0},
+    {0x73630000, 1512, 2, 1, 9115, 0},
+    {0x626c6f67, 3492, 4, 1, 9115, 0},
+    {0x636f6d00, 19, 3, 1, 9115, 0},
+    {0x65647500, 9778, 3, 1, 9115, 0},
+    {0x676f7600, 810, 3, 1, 9115, 0},
+    {0x696f0000, 9, 2, 1, 9115, 0},
+    {0x6a700000, 6664, 2, 1, 9115, 0},
+    {0x6d696c00, 6019, 3, 1, 9115, 0},
+    {0x6e657400, 2944, 3, 1, 9115, 0},
+    {0x6f726700, 6352, 3, 1, 9115, 0},
+    {0x74760000, 2443, 2, 1, 9115, 0},
+    {0x756b0000, 6692, 2, 1, 9115, 0},
+    {0x75730000, 767, 2, 1, 9115, 0},
+    {0x62697a00, 38535, 3, 1, 9115, 0},
+    {0x636f6d00, 19, 3, 1, 9115, 0},
+    {0x65647500, 9778, 3, 1, 9115, 0},
+    {0x676f7600, 810, 3, 1, 9115, 0},
+    {0x696e666f, 21606, 4, 1, 9115, 0},
+    {0x6e657400, 2944, 3, 1, 9115, 0},
+    {0x6f726700, 6352, 3, 1, 9115, 0},
+    {0x61737300, 779, 3, 1, 9115, 0},
+    {0x6173736f, 788, 4, 1, 9115, 0},
+    {0x636f6d00, 19, 3, 1, 9115, 0},
+    {0x636f6f70, 12918, 4, 1, 9115, 0},
+    {0x65647500, 9778, 3, 1, 9115, 0},
+    {0x676f7576, 41266, 4, 1, 9115, 0},
+    {0x676f7600, 810, 3, 1, 9115, 0},
+    {0x6d656465, 32142, 7, 1, 9115, 0},
+    {0x6d696c00, 6019, 3, 1, 9115, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9115, 0},
+    {0x6e6f7461, 27047, 8, 1, 9115, 0},
+    {0x6f726700, 6352, 3, 1, 9115, 0},
+    {0x70686172, 14194, 11, 1, 9115, 0},
+    {0x70726400, 42318, 3, 1, 9115, 0},
+    {0x70726573, 37013, 6, 1, 9115, 0},
+    {0x746d0000, 2797, 2, 1, 9115, 0},
+    {0x76657465, 14711, 11, 1, 9115, 0},
+    {0x65647500, 9778, 3, 1, 9115, 0},
+    {0x676f7600, 810, 3, 1, 9115, 0},
+    {0x6e657400, 2944, 3, 1, 9115, 0},
+    {0x6f726700, 6352, 3, 1, 9115, 0},
+    {0x636f6d00, 19, 3, 1, 9115, 0},
+    {0x65647500, 9778, 3, 1, 9115, 0},
+    {0x676f7600, 810, 3, 1, 9115, 0},
+    {0x6f726700, 6352, 3, 1, 9115, 0},
+    {0x72657000, 3558, 3, 1, 9115, 0},
+    {0x74726100, 647, 3, 1, 9115, 0},
+    {0x61630000, 35, 2, 1, 9115, 0},
+    {0x626c6f67, 23967, 8, 1, 9115, 0},
+    {0x62757361, 38570, 5, 1, 9115, 0},
+    {0x6368756e, 24223, 8, 1, 9115, 0},
+    {0x6368756e, 24231, 8, 1, 9115, 0},
+    {0x636f0000, 4, 2, 1, 9115, 0},
+    {0x64616567, 38695, 5, 1, 9115, 0},
+    {0x6461656a, 29944, 7, 1, 9115, 0},
+    {0x65730000, 27, 2, 1, 9115, 0},
+    {0x67616e67, 30840, 7, 1, 9115, 0},
+    {0x676f0000, 810, 2, 1, 9115, 0},
+    {0x6777616e, 31057, 7, 1, 9115, 0},
+    {0x6779656f, 20515, 9, 1, 9115, 0},
+    {0x6779656f, 25047, 8, 1, 9115, 0},
+    {0x6779656f, 20524, 9, 1, 9115, 0},
+    {0x68730000, 3863, 2, 1, 9115, 0},
+    {0x696e6368, 31309, 7, 1, 9115, 0},
+    {0x6a656a75, 41362, 4, 1, 9115, 0},
+    {0x6a656f6e, 31463, 7, 1, 9115, 0},
+    {0x6a656f6e, 31470, 7, 1, 9115, 0},
+    {0x6b670000, 16735, 2, 1, 9115, 0},
+    {0x6d696c00, 6019, 3, 1, 9115, 0},
+    {0x6d730000, 578, 2, 1, 9115, 0},
+    {0x6e650000, 703, 2, 1, 9115, 0},
+    {0x6f720000, 5, 2, 1, 9115, 0},
+    {0x70650000, 481, 2, 1, 9115, 0},
+    {0x72650000, 7, 2, 1, 9115, 0},
+    {0x73630000, 1512, 2, 1, 9115, 0},
+    {0x73656f75, 40340, 5, 1, 9115, 0},
+    {0x756c7361, 526, 5, 1, 9115, 0},
+    {0x636f0000, 4, 2, 1, 9115, 0},
+    {0x65647500, 9778, 3, 1, 9115, 0},
+    {0x636f6d00, 19, 3, 1, 9115, 0},
+    {0x65647500, 9778, 3, 1, 9115, 0},
+    {0x656d6200, 4783, 3, 1, 9115, 0},
+    {0x676f7600, 810, 3, 1, 9115, 0},
+    {0x696e6400, 477, 3, 1, 9115, 0},
+    {0x6e657400, 2944, 3, 1, 9115, 0},
+    {0x6f726700, 6352, 3, 1, 9115, 0},
+    {0x636f6d00, 19, 3, 1, 9115, 0},
+    {0x65647500, 9778, 3, 1, 9115, 0},
+    {0x6e657400, 2944, 3, 1, 9115, 0},
+    {0x6f726700, 6352, 3, 1, 9115, 0},
+    {0x636f6d00, 19, 3, 1, 9115, 0},
+    {0x65647500, 9778, 3, 1, 9115, 0},
+    {0x676f7600, 810, 3, 1, 9115, 0},
+    {0x6a636c6f, 6653, 6, 1, 9115, 0},
+    {0x6b617a74, 13699, 11, 0, 9115, 1},
+    {0x6d696c00, 6019, 3, 1, 9116, 0},
+    {0x6e657400, 2944, 3, 1, 9116, 0},
+    {0x6f726700, 6352, 3, 1, 9116, 0},
+    {0x626e7200, 42057, 3, 1, 9116, 0},
+    {0x63000000, 4, 1, 1, 9116, 0},
+    {0x636f6d00, 19, 3, 1, 9116, 0},
+    {0x65647500, 9778, 3, 1, 9116, 0},
+    {0x676f7600, 810, 3, 1, 9116, 0},
+    {0x696e666f, 21606, 4, 1, 9116, 0},
+    {0x696e7400, 2022, 3, 1, 9116, 0},
+    {0x6e657400, 2944, 3, 1, 9116, 0},
+    {0x6f726700, 6352, 3, 1, 9116, 0},
+    {0x70657200, 1092, 3, 1, 9116, 0},
+    {0x73746174, 4367, 6, 1, 9116, 2},
+    {0x636f6d00, 19, 3, 1, 9118, 0},
+    {0x65647500, 9778, 3, 1, 9118, 0},
+    {0x676f7600, 810, 3, 1, 9118, 0},
+    {0x6e657400, 2944, 3, 1, 9118, 0},
+    {0x6f726700, 6352, 3, 1, 9118, 0},
+    {0x636f0000, 4, 2, 1, 9118, 0},
+    {0x636f6d00, 19, 3, 1, 9118, 0},
+    {0x65647500, 9778, 3, 1, 9118, 0},
+    {0x676f7600, 810, 3, 1, 9118, 0},
+    {0x6e657400, 2944, 3, 1, 9118, 0},
+    {0x6f726700, 6352, 3, 1, 9118, 0},
+    {0x6f790000, 3885, 2, 1, 9118, 0},
+    {0x626c6f67, 23967, 8, 1, 9118, 0},
+    {0x63616100, 29291, 3, 1, 9118, 0},
+    {0x63796f6e, 41110, 4, 1, 9118, 0},
+    {0x64776562, 28819, 4, 2, 9118, 0},
+    {0x6d797065, 39690, 5, 1, 9118, 0},
+    {0x686c7800, 41310, 3, 1, 9118, 0},
+    {0x61630000, 35, 2, 1, 9118, 0},
+    {0x6173736e, 40986, 4, 1, 9118, 0},
+    {0x636f6d00, 19, 3, 1, 9118, 0},
+    {0x65647500, 9778, 3, 1, 9118, 0},
+    {0x676f7600, 810, 3, 1, 9118, 0},
+    {0x67727000, 42186, 3, 1, 9118, 0},
+    {0x686f7465, 4887, 5, 1, 9118, 0},
+    {0x696e7400, 2022, 3, 1, 9118, 0},
+    {0x6c746400, 33033, 3, 1, 9118, 0},
+    {0x6e657400, 2944, 3, 1, 9118, 0},
+    {0x6e676f00, 12810, 3, 1, 9118, 0},
+    {0x6f726700, 6352, 3, 1, 9118, 0},
+    {0x73636800, 1512, 3, 1, 9118, 0},
+    {0x736f6300, 790, 3, 1, 9118, 0},
+    {0x77656200, 123, 3, 1, 9118, 0},
+    {0x6f6d6700, 42291, 3, 1, 9118, 0},
+    {0x636f6d00, 19, 3, 1, 9118, 0},
+    {0x65647500, 9778, 3, 1, 9118, 0},
+    {0x676f7600, 810, 3, 1, 9118, 0},
+    {0x6e657400, 2944, 3, 1, 9118, 0},
+    {0x6f726700, 6352, 3, 1, 9118, 0},
+    {0x61630000, 35, 2, 1, 9118, 0},
+    {0x62697a00, 38535, 3, 1, 9118, 0},
+    {0x636f0000, 4, 2, 1, 9118, 0},
+    {0x64650000, 48, 2, 1, 9118, 0},
+    {0x65647500, 9778, 3, 1, 9118, 0},
+    {0x676f7600, 810, 3, 1, 9118, 0},
+    {0x696e666f, 21606, 4, 1, 9118, 0},
+    {0x6e657400, 2944, 3, 1, 9118, 0},
+    {0x6f726700, 6352, 3, 1, 9118, 0},
+    {0x73630000, 1512, 2, 1, 9118, 0},
+    {0x626c6f67, 23967, 8, 1, 9118, 0},
+    {0x676f7600, 810, 3, 1, 9118, 0},
+    {0x31323377, 15842, 10, 1, 9118, 0},
+    {0x626c6f67, 23967, 8, 1, 9118, 0},
+    {0x61736e00, 4746, 3, 1, 9118, 0},
+    {0x636f6d00, 19, 3, 1, 9118, 0},
+    {0x636f6e66, 13922, 4, 1, 9118, 0},
+    {0x65647500, 9778, 3, 1, 9118, 0},
+    {0x676f7600, 810, 3, 1, 9118, 0},
+    {0x69640000, 458, 2, 1, 9118, 0},
+    {0x6d696c00, 6019, 3, 1, 9118, 0},
+    {0x6e657400, 2944, 3, 1, 9118, 0},
+    {0x6f726700, 6352, 3, 1, 9118, 0},
+    {0x636f6d00, 19, 3, 1, 9118, 0},
+    {0x65647500, 9778, 3, 1, 9118, 0},
+    {0x676f7600, 810, 3, 1, 9118, 0},
+    {0x69640000, 458, 2, 1, 9118, 0},
+    {0x6d656400, 1498, 3, 1, 9118, 0},
+    {0x6e657400, 2944, 3, 1, 9118, 0},
+    {0x6f726700, 6352, 3, 1, 9118, 0},
+    {0x706c6300, 42309, 3, 1, 9118, 0},
+    {0x73636800, 1512, 3, 1, 9118, 0},
+    {0x61630000, 35, 2, 1, 9118, 0},
+    {0x636f0000, 4, 2, 1, 9118, 0},
+    {0x676f7600, 810, 3, 1, 9118, 0},
+    {0x6e657400, 2944, 3, 1, 9118, 0},
+    {0x6f726700, 6352, 3, 1, 9118, 0},
+    {0x70726573, 4357, 5, 1, 9118, 0},
+    {0x726f7574, 21805, 6, 1, 9118, 0},
+    {0x6173736f, 788, 4, 1, 9118, 0},
+    {0x746d0000, 2797, 2, 1, 9118, 0},
+    {0x61740000, 89, 2, 1, 9118, 0},
+    {0x626c6f67, 23967, 8, 1, 9118, 0},
+    {0x64650000, 48, 2, 1, 9118, 0},
+    {0x6a700000, 6664, 2, 1, 9118, 0},
+    {0x746f0000, 1004, 2, 1, 9118, 0},
+    {0x61630000, 35, 2, 1, 9118, 0},
+    {0x62617273, 12676, 5, 1, 9118, 0},
+    {0x62726173, 24023, 8, 1, 9118, 0},
+    {0x63363600, 42066, 3, 1, 9118, 0},
+    {0x636f0000, 4, 2, 1, 9118, 0},
+    {0x6461706c, 34727, 6, 1, 9118, 1},
+    {0x64646e73, 24407, 4, 1, 9119, 0},
+    {0x6469736b, 1236, 11, 1, 9119, 0},
+    {0x646e7366, 34799, 6, 1, 9119, 0},
+    {0x6473636c, 27672, 7, 1, 9119, 0},
+    {0x65646765, 20146, 9, 1, 9119, 0},
+    {0x65647500, 9778, 3, 1, 9119, 0},
+    {0x66696c65, 13193, 8, 1, 9119, 0},
+    {0x66696c65, 13193, 11, 1, 9119, 0},
+    {0x66696c65, 13204, 11, 1, 9119, 0},
+    {0x66696c65, 13215, 11, 1, 9119, 0},
+    {0x66696c65, 13226, 11, 1, 9119, 0},
+    {0x66696c65, 13237, 11, 1, 9119, 0},
+    {0x66696c65, 13248, 11, 1, 9119, 0},
+    {0x676c6974, 35141, 6, 1, 9119, 0},
+    {0x676f7600, 810, 3, 1, 9119, 0},
+    {0x686f7074, 39165, 5, 1, 9119, 0},
+    {0x69323334, 41326, 4, 1, 9119, 0},
+    {0x69747300, 7303, 3, 1, 9119, 0},
+    {0x6c6f6769, 31988, 7, 1, 9119, 0},
+    {0x6c6f686d, 36023, 6, 1, 9119, 0},
+    {0x6d636469, 39610, 5, 1, 9119, 0},
+    {0x6d637065, 41522, 4, 1, 9119, 0},
+    {0x6d796473, 41570, 4, 1, 9119, 0},
+    {0x6e657400, 2944, 3, 1, 9119, 0},
+    {0x6e6f686f, 36695, 6, 1, 9119, 0},
+    {0x6e6f6970, 41602, 4, 1, 9119, 0},
+    {0x6f726700, 6352, 3, 1, 9119, 0},
+    {0x70726976, 220, 4, 1, 9119, 0},
+    {0x72617665, 32863, 7, 1, 9119, 0},
+    {0x736f756e, 22720, 9, 1, 9119, 0},
+    {0x73796e6f, 1227, 8, 1, 9119, 0},
+    {0x74637034, 41842, 4, 1, 9119, 0},
+    {0x7472616e, 33675, 7, 0, 9119, 1},
+    {0x76703400, 42432, 3, 1, 9120, 0},
+    {0x77656268, 38147, 6, 1, 9120, 0},
+    {0x77656465, 28799, 8, 1, 9120, 0},
+    {0x796f6d62, 40885, 5, 1, 9120, 0},
+    {0x6672616d, 10111, 6, 1, 9120, 0},
+    {0x62617273, 12676, 5, 1, 9120, 0},
+    {0x636f0000, 4, 2, 1, 9120, 0},
+    {0x636f6d00, 19, 3, 1, 9120, 0},
+    {0x65647500, 9778, 3, 1, 9120, 0},
+    {0x676f7600, 810, 3, 1, 9120, 0},
+    {0x6d696c00, 6019, 3, 1, 9120, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9120, 0},
+    {0x6f726700, 6352, 3, 1, 9120, 0},
+    {0x70726400, 42318, 3, 1, 9120, 0},
+    {0x746d0000, 2797, 2, 1, 9120, 0},
+    {0x626c6f67, 23967, 8, 1, 9120, 0},
+    {0x636f6d00, 19, 3, 1, 9120, 0},
+    {0x65647500, 9778, 3, 1, 9120, 0},
+    {0x676f7600, 810, 3, 1, 9120, 0},
+    {0x696e6600, 3522, 3, 1, 9120, 0},
+    {0x6e616d65, 17722, 4, 1, 9120, 0},
+    {0x6e657400, 2944, 3, 1, 9120, 0},
+    {0x6f726700, 6352, 3, 1, 9120, 0},
+    {0x636f6d00, 19, 3, 1, 9120, 0},
+    {0x65647500, 9778, 3, 1, 9120, 0},
+    {0x676f7576, 41266, 4, 1, 9120, 0},
+    {0x676f7600, 810, 3, 1, 9120, 0},
+    {0x6e657400, 2944, 3, 1, 9120, 0},
+    {0x6f726700, 6352, 3, 1, 9120, 0},
+    {0x70726573, 37013, 6, 1, 9120, 0},
+    {0x65647500, 9778, 3, 1, 9120, 0},
+    {0x676f7600, 810, 3, 1, 9120, 0},
+    {0x6e796300, 29830, 3, 1, 9120, 0},
+    {0x6f726700, 6352, 3, 1, 9120, 0},
+    {0x636f6d00, 19, 3, 1, 9120, 0},
+    {0x65647500, 9778, 3, 1, 9120, 0},
+    {0x676f7600, 810, 3, 1, 9120, 0},
+    {0x6e657400, 2944, 3, 1, 9120, 0},
+    {0x6f726700, 6352, 3, 1, 9120, 0},
+    {0x62617273, 12676, 5, 1, 9120, 0},
+    {0x6473636c, 27672, 7, 1, 9120, 0},
+    {0x6a750000, 2465, 2, 1, 9120, 0},
+    {0x626c6f67, 23967, 8, 1, 9120, 0},
+    {0x676f7600, 810, 3, 1, 9120, 0},
+    {0x636f6d00, 19, 3, 1, 9120, 0},
+    {0x65647500, 9778, 3, 1, 9120, 0},
+    {0x676f7600, 810, 3, 1, 9120, 0},
+    {0x6c616200, 2067, 3, 1, 9120, 0},
+    {0x6d696e69, 26519, 8, 1, 9120, 0},
+    {0x6e657400, 2944, 3, 1, 9120, 0},
+    {0x6f726700, 6352, 3, 1, 9120, 0},
+    {0x636f6d00, 19, 3, 1, 9120, 1},
+    {0x65647500, 9778, 3, 1, 9121, 0},
+    {0x6e657400, 2944, 3, 1, 9121, 0},
+    {0x6f726700, 6352, 3, 1, 9121, 0},
+    {0x61630000, 35, 2, 1, 9121, 0},
+    {0x636f0000, 4, 2, 1, 9121, 0},
+    {0x636f6d00, 19, 3, 1, 9121, 0},
+    {0x676f7600, 810, 3, 1, 9121, 0},
+    {0x6e657400, 2944, 3, 1, 9121, 0},
+    {0x6f720000, 5, 2, 1, 9121, 0},
+    {0x6f726700, 6352, 3, 1, 9121, 0},
+    {0x61636164, 29076, 7, 1, 9121, 0},
+    {0x61677269, 12566, 11, 1, 9121, 0},
+    {0x61697200, 1346, 3, 1, 9121, 0},
+    {0x61697267, 23735, 8, 1, 9121, 0},
+    {0x616c6162, 29146, 7, 1, 9121, 0},
+    {0x616c6173, 34235, 6, 1, 9121, 0},
+    {0x616d6265, 38370, 5, 1, 9121, 0},
+    {0x616d6275, 19480, 9, 1, 9121, 0},
+    {0x616d6572, 3340, 8, 1, 9121, 0},
+    {0x616d6572, 3340, 9, 1, 9121, 0},
+    {0x616d6572, 3340, 16, 1, 9121, 0},
+    {0x616d6572, 12588, 11, 1, 9121, 0},
+    {0x616d7374, 19489, 9, 1, 9121, 0},
+    {0x616e6400, 73, 3, 1, 9121, 0},
+    {0x616e6e65, 19534, 9, 1, 9121, 0},
+    {0x616e7468, 9727, 6, 1, 9121, 0},
+    {0x616e7468, 9727, 12, 1, 9121, 0},
+    {0x616e7469, 3348, 8, 1, 9121, 0},
+    {0x61717561, 23783, 8, 1, 9121, 0},
+    {0x6172626f, 19588, 9, 1, 9121, 0},
+    {0x61726368, 6051, 14, 1, 9121, 0},
+    {0x61726368, 12610, 11, 1, 9121, 0},
+    {0x61726368, 9751, 12, 1, 9121, 0},
+    {0x61727400, 3749, 3, 1, 9121, 0},
+    {0x61727461, 9763, 12, 1, 9121, 0},
+    {0x61727463, 19606, 9, 1, 9121, 0},
+    {0x61727464, 29216, 7, 1, 9121, 0},
+    {0x61727465, 9775, 12, 1, 9121, 0},
+    {0x61727467, 15962, 10, 1, 9121, 0},
+    {0x61727473, 4056, 4, 1, 9121, 0},
+    {0x61727473, 7713, 13, 1, 9121, 0},
+    {0x61736d61, 23807, 8, 1, 9121, 0},
+    {0x61737361, 7739, 13, 1, 9121, 0},
+    {0x61737369, 34349, 6, 1, 9121, 0},
+    {0x6173736f, 788, 11, 1, 9121, 0},
+    {0x61737472, 19642, 9, 1, 9121, 0},
+    {0x61746c61, 29251, 7, 1, 9121, 0},
+    {0x61757374, 34361, 6, 1, 9121, 0},
+    {0x61757374, 19669, 9, 1, 9121, 0},
+    {0x6175746f, 15982, 10, 1, 9121, 0},
+    {0x61766961, 7887, 8, 1, 9121, 0},
+    {0x61786973, 40994, 4, 1, 9121, 0},
+    {0x62616461, 29335, 7, 1, 9121, 0},
+    {0x62616768, 29342, 7, 1, 9121, 0},
+    {0x6261686e, 20169, 4, 1, 9121, 0},
+    {0x62616c65, 6093, 4, 1, 9121, 0},
+    {0x62616c74, 19714, 9, 1, 9121, 0},
+    {0x62617263, 19723, 9, 1, 9121, 0},
+    {0x62617365, 23911, 8, 1, 9121, 0},
+    {0x62617365, 38480, 5, 1, 9121, 0},
+    {0x62617468, 38485, 5, 1, 9121, 0},
+    {0x62617565, 34409, 6, 1, 9121, 0},
+    {0x62656175, 19759, 9, 1, 9121, 0},
+    {0x6265656c, 7778, 13, 1, 9121, 0},
+    {0x62656c6c, 23919, 8, 1, 9121, 0},
+    {0x62657267, 29405, 7, 1, 9121, 0},
+    {0x6265726b, 23927, 8, 1, 9121, 0},
+    {0x6265726c, 16516, 6, 1, 9121, 0},
+    {0x6265726e, 14373, 4, 1, 9121, 0},
+    {0x6269626c, 38520, 5, 1, 9121, 0},
+    {0x62696c62, 34481, 6, 1, 9121, 0},
+    {0x62696c6c, 41030, 4, 1, 9121, 0},
+    {0x62697264, 29433, 7, 1, 9121, 0},
+    {0x62697274, 16092, 10, 1, 9121, 0},
+    {0x626f6e6e, 41054, 4, 1, 9121, 0},
+    {0x626f7374, 34511, 6, 1, 9121, 0},
+    {0x626f7461, 4392, 9, 1, 9121, 0},
+    {0x626f7461, 4392, 15, 1, 9121, 0},
+    {0x626f7461, 7791, 13, 1, 9121, 0},
+    {0x626f7461, 34517, 6, 1, 9121, 0},
+    {0x6272616e, 3388, 16, 1, 9121, 0},
+    {0x62726173, 24023, 6, 1, 9121, 0},
+    {0x62726973, 29510, 7, 1, 9121, 0},
+    {0x62726974, 4422, 7, 1, 9121, 0},
+    {0x62726974, 4422, 15, 1, 9121, 0},
+    {0x62726f61, 19840, 9, 1, 9121, 0},
+    {0x6272756e, 34535, 6, 1, 9121, 0},
+    {0x62727573, 24055, 7, 1, 9121, 0},
+    {0x62727573, 24055, 8, 1, 9121, 0},
+    {0x62727578, 19849, 9, 1, 9121, 0},
+    {0x6275696c, 24063, 8, 1, 9121, 0},
+    {0x62757267, 29545, 7, 1, 9121, 0},
+    {0x62757300, 2633, 3, 1, 9121, 0},
+    {0x62757368, 34547, 6, 1, 9121, 0},
+    {0x63616461, 24103, 8, 1, 9121, 0},
+    {0x63616c69, 16162, 10, 1, 9121, 0},
+    {0x63616d62, 19867, 9, 1, 9121, 0},
+    {0x63616e00, 3345, 3, 1, 9121, 0},
+    {0x63616e61, 34559, 6, 1, 9121, 0},
+    {0x63617065, 16192, 10, 1, 9121, 0},
+    {0x63617272, 29587, 7, 1, 9121, 0},
+    {0x63617274, 16212, 10, 1, 9121, 0},
+    {0x63617361, 6163, 14, 1, 9121, 0},
+    {0x63617374, 34571, 6, 1, 9121, 0},
+    {0x63617374, 29608, 7, 1, 9121, 0},
+    {0x63656c74, 4922, 6, 1, 9121, 0},
+    {0x63656e74, 6269, 6, 1, 9121, 0},
+    {0x63686174, 12863, 11, 1, 9121, 0},
+    {0x6368656c, 16222, 10, 1, 9121, 0},
+    {0x63686573, 7869, 13, 1, 9121, 0},
+    {0x63686963, 29664, 7, 1, 9121, 0},
+    {0x6368696c, 4467, 8, 1, 9121, 0},
+    {0x6368696c, 4467, 9, 1, 9121, 0},
+    {0x6368696c, 4467, 15, 1, 9121, 0},
+    {0x63686972, 9919, 12, 1, 9121, 0},
+    {0x63686f63, 19966, 9, 1, 9121, 0},
+    {0x63687269, 6191, 14, 1, 9121, 0},
+    {0x63696e63, 16262, 10, 1, 9121, 0},
+    {0x63696e65, 34631, 6, 1, 9121, 0},
+    {0x63697263, 34643, 6, 1, 9121, 0},
+    {0x63697669, 9931, 12, 1, 9121, 0},
+    {0x63697669, 9943, 12, 1, 9121, 0},
+    {0x63697669, 24255, 8, 1, 9121, 0},
+    {0x636c696e, 29762, 7, 1, 9121, 0},
+    {0x636c6f63, 5422, 5, 1, 9121, 0},
+    {0x636f616c, 41090, 4, 1, 9121, 0},
+    {0x636f6173, 6233, 14, 1, 9121, 0},
+    {0x636f6479, 41094, 4, 1, 9121, 0},
+    {0x636f6c64, 29797, 7, 1, 9121, 0},
+    {0x636f6c6c, 16332, 10, 1, 9121, 0},
+    {0x636f6c6f, 1027, 20, 1, 9121, 0},
+    {0x636f6c6f, 4527, 15, 1, 9121, 0},
+    {0x636f6c75, 4429, 8, 1, 9121, 0},
+    {0x636f6c75, 24311, 8, 1, 9121, 0},
+    {0x636f6d6d, 81, 13, 1, 9121, 0},
+    {0x636f6d6d, 81, 14, 1, 9121, 0},
+    {0x636f6d6d, 7921, 9, 1, 9121, 0},
+    {0x636f6d70, 4542, 8, 1, 9121, 0},
+    {0x636f6d70, 4542, 15, 1, 9121, 0},
+    {0x636f6e74, 4557, 12, 1, 9121, 0},
+    {0x636f6e74, 4557, 15, 1, 9121, 0},
+    {0x636f6e76, 29846, 7, 1, 9121, 0},
+    {0x636f7065, 16382, 10, 1, 9121, 0},
+    {0x636f7270, 12929, 11, 1, 9121, 0},
+    {0x636f7276, 24343, 8, 1, 9121, 0},
+    {0x636f7374, 29874, 7, 1, 9121, 0},
+    {0x636f756e, 5384, 13, 1, 9121, 0},
+    {0x636f756e, 34685, 6, 1, 9121, 0},
+    {0x63726166, 6942, 6, 1, 9121, 0},
+    {0x6372616e, 20038, 9, 1, 9121, 0},
+    {0x63726561, 18054, 8, 1, 9121, 0},
+    {0x63756c74, 6261, 8, 1, 9121, 0},
+    {0x63756c74, 6261, 14, 1, 9121, 0},
+    {0x63756c74, 12570, 7, 1, 9121, 0},
+    {0x63796265, 38675, 5, 1, 9121, 0},
+    {0x63796d72, 38680, 5, 1, 9121, 0},
+    {0x64616c69, 11247, 4, 1, 9121, 0},
+    {0x64616c6c, 34721, 6, 1, 9121, 0},
+    {0x64617461, 24391, 8, 1, 9121, 0},
+    {0x64647200, 24518, 3, 1, 9121, 0},
+    {0x6465636f, 4046, 14, 1, 9121, 0},
+    {0x64656c61, 5269, 8, 1, 9121, 0},
+    {0x64656c6d, 12973, 11, 1, 9121, 0},
+    {0x64656e6d, 29965, 7, 1, 9121, 0},
+    {0x6465706f, 20663, 5, 1, 9121, 0},
+    {0x64657369, 6703, 6, 1, 9121, 0},
+    {0x64657472, 29979, 7, 1, 9121, 0},
+    {0x64696e6f, 24471, 8, 1, 9121, 0},
+    {0x64697363, 20065, 9, 1, 9121, 0},
+    {0x646f6c6c, 38755, 5, 1, 9121, 0},
+    {0x646f6e6f, 24503, 8, 1, 9121, 0},
+    {0x64757268, 34841, 6, 1, 9121, 0},
+    {0x65617374, 16542, 10, 1, 9121, 0},
+    {0x65617374, 20128, 9, 1, 9121, 0},
+    {0x65647563, 9778, 9, 1, 9121, 0},
+    {0x65647563, 13138, 11, 1, 9121, 0},
+    {0x65677970, 24591, 8, 1, 9121, 0},
+    {0x65697365, 20164, 9, 1, 9121, 0},
+    {0x656c6275, 34895, 6, 1, 9121, 0},
+    {0x656c7665, 16562, 10, 1, 9121, 0},
+    {0x656d6272, 16572, 10, 1, 9121, 0},
+    {0x656e6379, 10027, 12, 1, 9121, 0},
+    {0x656e676c, 30168, 7, 1, 9121, 0},
+    {0x656e746f, 16582, 10, 1, 9121, 0},
+    {0x656e7669, 95, 11, 1, 9121, 0},
+    {0x656e7669, 95, 25, 1, 9121, 0},
+    {0x6570696c, 24639, 8, 1, 9121, 0},
+    {0x65737365, 38840, 5, 1, 9121, 0},
+    {0x65737461, 5391, 6, 1, 9121, 0},
+    {0x6574686e, 20209, 9, 1, 9121, 0},
+    {0x65786574, 34931, 6, 1, 9121, 0},
+    {0x65786869, 16622, 10, 1, 9121, 0},
+    {0x66616d69, 6017, 6, 1, 9121, 0},
+    {0x6661726d, 8090, 4, 1, 9121, 0},
+    {0x6661726d, 8090, 13, 1, 9121, 0},
+    {0x6661726d, 30231, 7, 1, 9121, 0},
+    {0x6661726d, 20227, 9, 1, 9121, 0},
+    {0x6669656c, 38885, 5, 1, 9121, 0},
+    {0x66696775, 24727, 8, 1, 9121, 0},
+    {0x66696c61, 20236, 9, 1, 9121, 0},
+    {0x66696c6d, 41202, 4, 1, 9121, 0},
+    {0x66696e65, 24735, 7, 1, 9121, 0},
+    {0x66696e65, 24735, 8, 1, 9121, 0},
+    {0x66696e6c, 30280, 7, 1, 9121, 0},
+    {0x666c616e, 24759, 8, 1, 9121, 0},
+    {0x666c6f72, 30329, 7, 1, 9121, 0},
+    {0x666f7263, 18177, 5, 1, 9121, 0},
+    {0x666f7274, 10099, 12, 1, 9121, 0},
+    {0x666f7274, 20281, 9, 1, 9121, 0},
+    {0x666f756e, 16672, 10, 1, 9121, 0},
+    {0x6672616e, 20290, 9, 1, 9121, 0},
+    {0x6672616e, 20299, 9, 1, 9121, 0},
+    {0x6672616e, 10123, 12, 1, 9121, 0},
+    {0x66726565, 13336, 11, 1, 9121, 0},
+    {0x66726569, 24831, 8, 1, 9121, 0},
+    {0x66726962, 24839, 8, 1, 9121, 0},
+    {0x66726f67, 30406, 4, 1, 9121, 0},
+    {0x66756e64, 24919, 8, 1, 9121, 0},
+    {0x6675726e, 20407, 9, 1, 9121, 0},
+    {0x67616c6c, 15965, 7, 1, 9121, 0},
+    {0x67617264, 4401, 6, 1, 9121, 0},
+    {0x67617465, 3541, 7, 1, 9121, 0},
+    {0x6765656c, 20443, 9, 1, 9121, 0},
+    {0x67656d6f, 13380, 11, 1, 9121, 0},
+    {0x67656f6c, 30861, 7, 1, 9121, 0},
+    {0x67656f72, 30868, 7, 1, 9121, 0},
+    {0x67696573, 30889, 7, 1, 9121, 0},
+    {0x676c6173, 26198, 4, 1, 9121, 0},
+    {0x676c6173, 39010, 5, 1, 9121, 0},
+    {0x676f7267, 39035, 5, 1, 9121, 0},
+    {0x6772616e, 13402, 11, 1, 9121, 0},
+    {0x6772617a, 41274, 4, 1, 9121, 0},
+    {0x67756572, 25039, 8, 1, 9121, 0},
+    {0x68616c6c, 16802, 10, 1, 9121, 0},
+    {0x68616d62, 31106, 7, 1, 9121, 0},
+    {0x68616e64, 31113, 7, 1, 9121, 0},
+    {0x68617276, 1968, 18, 1, 9121, 0},
+    {0x68617761, 35315, 6, 1, 9121, 0},
+    {0x6865616c, 229, 6, 1, 9121, 0},
+    {0x6865696d, 6457, 14, 1, 9121, 0},
+    {0x68656c6c, 35327, 6, 1, 9121, 0},
+    {0x68656c73, 25135, 8, 1, 9121, 0},
+    {0x68656d62, 4782, 15, 1, 9121, 0},
+    {0x68657269, 3844, 8, 1, 9121, 0},
+    {0x68697374, 25207, 8, 1, 9121, 0},
+    {0x68697374, 2679, 10, 1, 9121, 0},
+    {0x68697374, 2679, 17, 1, 9121, 0},
+    {0x68697374, 6485, 14, 1, 9121, 0},
+    {0x68697374, 1505, 10, 1, 9121, 0},
+    {0x68697374, 1505, 12, 1, 9121, 0},
+    {0x68697374, 1114, 7, 1, 9121, 0},
+    {0x68697374, 3644, 16, 1, 9121, 0},
+    {0x686f726f, 25287, 8, 1, 9121, 0},
+    {0x686f7573, 6493, 5, 1, 9121, 0},
+    {0x68756d61, 16912, 10, 1, 9121, 0},
+    {0x696c6c75, 10267, 12, 1, 9121, 0},
+    {0x696d6167, 8272, 13, 1, 9121, 0},
+    {0x696e6469, 10303, 6, 1, 9121, 0},
+    {0x696e6469, 10303, 7, 1, 9121, 0},
+    {0x696e6469, 10303, 12, 1, 9121, 0},
+    {0x696e6469, 10315, 12, 1, 9121, 0},
+    {0x696e7465, 10339, 12, 1, 9121, 0},
+    {0x696e7465, 13501, 11, 1, 9121, 0},
+    {0x69726171, 41346, 4, 1, 9121, 0},
+    {0x69726f6e, 98, 4, 1, 9121, 0},
+    {0x69736c65, 20839, 9, 1, 9121, 0},
+    {0x6a616d69, 31456, 7, 1, 9121, 0},
+    {0x6a656666, 20929, 9, 1, 9121, 0},
+    {0x6a657275, 20947, 9, 1, 9121, 0},
+    {0x6a657765, 31477, 7, 1, 9121, 0},
+    {0x6a657769, 20956, 6, 1, 9121, 0},
+    {0x6a657769, 20956, 9, 1, 9121, 0},
+    {0x6a666b00, 42222, 3, 1, 9121, 0},
+    {0x6a6f7572, 17042, 10, 1, 9121, 0},
+    {0x6a756461, 31491, 7, 1, 9121, 0},
+    {0x6a756479, 13644, 11, 1, 9121, 0},
+    {0x6a756564, 17062, 10, 1, 9121, 0},
+    {0x6a756966, 41386, 4, 1, 9121, 0},
+    {0x6b617261, 35657, 6, 1, 9121, 0},
+    {0x6b617269, 21028, 9, 1, 9121, 0},
+    {0x6b696473, 33482, 4, 1, 9121, 0},
+    {0x6b6f6562, 17242, 10, 1, 9121, 0},
+    {0x6b6f656c, 39370, 5, 1, 9121, 0},
+    {0x6b756e73, 6695, 5, 1, 9121, 0},
+    {0x6b756e73, 8454, 13, 1, 9121, 0},
+    {0x6b756e73, 6695, 14, 1, 9121, 0},
+    {0x6c61626f, 39450, 5, 1, 9121, 0},
+    {0x6c61626f, 35909, 6, 1, 9121, 0},
+    {0x6c616a6f, 31855, 7, 1, 9121, 0},
+    {0x6c616e63, 17302, 10, 1, 9121, 0},
+    {0x6c616e64, 35933, 6, 1, 9121, 0},
+    {0x6c616e73, 41474, 4, 1, 9121, 0},
+    {0x6c617273, 31883, 7, 1, 9121, 0},
+    {0x6c657769, 13776, 11, 1, 9121, 0},
+    {0x6c696e63, 31974, 7, 1, 9121, 0},
+    {0x6c696e7a, 23778, 4, 1, 9121, 0},
+    {0x6c697669, 5399, 6, 1, 9121, 0},
+    {0x6c697669, 5399, 13, 1, 9121, 0},
+    {0x6c6f6361, 10711, 12, 1, 9121, 0},
+    {0x6c6f6e64, 36029, 6, 1, 9121, 0},
+    {0x6c6f7361, 17372, 10, 1, 9121, 0},
+    {0x6c6f7576, 36035, 6, 1, 9121, 0},
+    {0x6c6f7961, 26279, 8, 1, 9121, 0},
+    {0x6c756365, 32016, 7, 1, 9121, 0},
+    {0x6c757865, 17392, 10, 1, 9121, 0},
+    {0x6c757a65, 36065, 6, 1, 9121, 0},
+    {0x6d616400, 22248, 3, 1, 9121, 0},
+    {0x6d616472, 36089, 6, 1, 9121, 0},
+    {0x6d616c6c, 26327, 8, 1, 9121, 0},
+    {0x6d616e63, 17452, 10, 1, 9121, 0},
+    {0x6d616e73, 26335, 7, 1, 9121, 0},
+    {0x6d616e73, 26335, 8, 1, 9121, 0},
+    {0x6d616e78, 41518, 4, 1, 9121, 0},
+    {0x6d617262, 32079, 7, 1, 9121, 0},
+    {0x6d617269, 26343, 8, 1, 9121, 0},
+    {0x6d617269, 26351, 8, 1, 9121, 0},
+    {0x6d617279, 26383, 8, 1, 9121, 0},
+    {0x6d617279, 17472, 10, 1, 9121, 0},
+    {0x6d656469, 21595, 5, 1, 9121, 0},
+    {0x6d656469, 32149, 7, 1, 9121, 0},
+    {0x6d656469, 1498, 19, 1, 9121, 0},
+    {0x6d656572, 36179, 6, 1, 9121, 0},
+    {0x6d656d6f, 26455, 8, 1, 9121, 0},
+    {0x6d657361, 21622, 9, 1, 9121, 0},
+    {0x6d696368, 26487, 8, 1, 9121, 0},
+    {0x6d696461, 13864, 11, 1, 9121, 0},
+    {0x6d696c69, 26495, 8, 1, 9121, 0},
+    {0x6d696c6c, 13781, 4, 1, 9121, 0},
+    {0x6d696e65, 36281, 6, 1, 9121, 0},
+    {0x6d696e69, 36287, 6, 1, 9121, 0},
+    {0x6d696e6e, 21676, 9, 1, 9121, 0},
+    {0x6d697373, 32198, 7, 1, 9121, 0},
+    {0x6d697373, 10103, 8, 1, 9121, 0},
+    {0x6d6f6465, 36401, 6, 1, 9121, 0},
+    {0x6d6f6d61, 26357, 4, 1, 9121, 0},
+    {0x6d6f6e65, 39665, 5, 1, 9121, 0},
+    {0x6d6f6e6d, 26591, 8, 1, 9121, 0},
+    {0x6d6f6e74, 17632, 10, 1, 9121, 0},
+    {0x6d6f6e74, 26599, 8, 1, 9121, 0},
+    {0x6d6f7363, 36431, 6, 1, 9121, 0},
+    {0x6d6f746f, 13930, 10, 1, 9121, 0},
+    {0x6d75656e, 26663, 8, 1, 9121, 0},
+    {0x6d75656e, 13185, 8, 1, 9121, 0},
+    {0x6d756c68, 26671, 8, 1, 9121, 0},
+    {0x6d756e63, 36461, 6, 1, 9121, 0},
+    {0x6d757365, 36479, 6, 1, 9121, 0},
+    {0x6d757365, 10795, 12, 1, 9121, 0},
+    {0x6d757365, 3788, 16, 1, 9121, 0},
+    {0x6d757369, 8329, 5, 1, 9121, 0},
+    {0x6e617469, 3820, 8, 1, 9121, 0},
+    {0x6e617469, 3820, 16, 1, 9121, 0},
+    {0x6e617469, 3836, 16, 1, 9121, 0},
+    {0x6e617469, 6779, 14, 1, 9121, 0},
+    {0x6e617475, 1107, 14, 1, 9121, 0},
+    {0x6e617475, 1107, 20, 1, 9121, 0},
+    {0x6e617475, 5127, 15, 1, 9121, 0},
+    {0x6e617475, 2138, 6, 1, 9121, 0},
+    {0x6e617475, 2815, 17, 1, 9121, 0},
+    {0x6e617475, 1517, 19, 1, 9121, 0},
+    {0x6e61756d, 26887, 8, 1, 9121, 0},
+    {0x6e617661, 39770, 5, 1, 9121, 0},
+    {0x6e656272, 26919, 8, 1, 9121, 0},
+    {0x6e657565, 39785, 5, 1, 9121, 0},
+    {0x6e657768, 10879, 12, 1, 9121, 0},
+    {0x6e65776a, 21874, 9, 1, 9121, 0},
+    {0x6e65776d, 21883, 9, 1, 9121, 0},
+    {0x6e657770, 32401, 7, 1, 9121, 0},
+    {0x6e657773, 21892, 9, 1, 9121, 0},
+    {0x6e657779, 32408, 7, 1, 9121, 0},
+    {0x6e696570, 36647, 6, 1, 9121, 0},
+    {0x6e6f7266, 32492, 7, 1, 9121, 0},
+    {0x6e6f7274, 134, 5, 1, 9121, 0},
+    {0x6e727700, 42279, 3, 1, 9121, 0},
+    {0x6e796300, 29830, 3, 1, 9121, 0},
+    {0x6e796e79, 41626, 4, 1, 9121, 0},
+    {0x6f636561, 8662, 13, 1, 9121, 0},
+    {0x6f636561, 5142, 15, 1, 9121, 0},
+    {0x6f6d6168, 39915, 5, 1, 9121, 0},
+    {0x6f6e6c69, 6871, 6, 1, 9121, 0},
+    {0x6f6e7461, 32646, 7, 1, 9121, 0},
+    {0x6f70656e, 32660, 7, 1, 9121, 0},
+    {0x6f726567, 14117, 6, 1, 9121, 0},
+    {0x6f726567, 14117, 11, 1, 9121, 0},
+    {0x6f746167, 39950, 5, 1, 9121, 0},
+    {0x6f78666f, 36875, 6, 1, 9121, 0},
+    {0x70616369, 32723, 7, 1, 9121, 0},
+    {0x70616465, 22099, 9, 1, 9121, 0},
+    {0x70616c61, 36893, 6, 1, 9121, 0},
+    {0x70616c65, 40005, 5, 1, 9121, 0},
+    {0x70616c6d, 14161, 11, 1, 9121, 0},
+    {0x70616e61, 36905, 6, 1, 9121, 0},
+    {0x70617269, 40010, 5, 1, 9121, 0},
+    {0x70617361, 27231, 8, 1, 9121, 0},
+    {0x70686172, 27247, 8, 1, 9121, 0},
+    {0x7068696c, 3868, 12, 1, 9121, 0},
+    {0x7068696c, 3868, 16, 1, 9121, 0},
+    {0x7068696c, 22135, 9, 1, 9121, 0},
+    {0x70686f65, 32758, 7, 1, 9121, 0},
+    {0x70686f74, 14205, 11, 1, 9121, 0},
+    {0x70696c6f, 36959, 6, 1, 9121, 0},
+    {0x70697474, 17922, 10, 1, 9121, 0},
+    {0x706c616e, 14216, 11, 1, 9121, 0},
+    {0x706c616e, 17932, 10, 1, 9121, 0},
+    {0x706c616e, 36977, 6, 1, 9121, 0},
+    {0x706c617a, 40075, 5, 1, 9121, 0},
+    {0x706f7274, 36995, 6, 1, 9121, 0},
+    {0x706f7274, 27351, 8, 1, 9121, 0},
+    {0x706f7274, 17962, 10, 1, 9121, 0},
+    {0x706f7374, 67, 28, 1, 9121, 0},
+    {0x70726573, 11047, 12, 1, 9121, 0},
+    {0x70726573, 27359, 8, 1, 9121, 0},
+    {0x70726573, 4357, 5, 1, 9121, 0},
+    {0x70726f6a, 8109, 7, 1, 9121, 0},
+    {0x7075626c, 4969, 6, 1, 9121, 0},
+    {0x7075626f, 40115, 5, 1, 9121, 0},
+    {0x71756562, 37049, 6, 1, 9121, 0},
+    {0x7261696c, 27423, 8, 1, 9121, 0},
+    {0x7261696c, 32856, 7, 1, 9121, 0},
+    {0x72657365, 27503, 8, 1, 9121, 0},
+    {0x72657369, 18072, 10, 1, 9121, 0},
+    {0x72696f64, 11143, 12, 1, 9121, 0},
+    {0x726f6368, 22306, 9, 1, 9121, 0},
+    {0x726f636b, 32968, 7, 1, 9121, 0},
+    {0x726f6d61, 5226, 4, 1, 9121, 0},
+    {0x72757373, 37163, 6, 1, 9121, 0},
+    {0x7361696e, 18112, 10, 1, 9121, 0},
+    {0x73616c65, 20951, 5, 1, 9121, 0},
+    {0x73616c76, 11239, 12, 1, 9121, 0},
+    {0x73616c7a, 27567, 8, 1, 9121, 0},
+    {0x73616e64, 27607, 8, 1, 9121, 0},
+    {0x73616e66, 11263, 12, 1, 9121, 0},
+    {0x73616e74, 11275, 12, 1, 9121, 0},
+    {0x73616e74, 22342, 9, 1, 9121, 0},
+    {0x73616e74, 33052, 7, 1, 9121, 0},
+    {0x7361736b, 11287, 12, 1, 9121, 0},
+    {0x73617478, 41742, 4, 1, 9121, 0},
+    {0x73617661, 18162, 10, 1, 9121, 0},
+    {0x7363686c, 11299, 12, 1, 9121, 0},
+    {0x7363686f, 14392, 11, 1, 9121, 0},
+    {0x7363686f, 14403, 11, 1, 9121, 0},
+    {0x7363686f, 22378, 6, 1, 9121, 0},
+    {0x73636877, 33108, 7, 1, 9121, 0},
+    {0x73636965, 2112, 7, 1, 9121, 0},
+    {0x73636965, 5232, 15, 1, 9121, 0},
+    {0x73636965, 2917, 17, 1, 9121, 0},
+    {0x73636965, 2112, 18, 1, 9121, 0},
+    {0x73636965, 6891, 13, 1, 9121, 0},
+    {0x73636965, 6891, 14, 1, 9121, 0},
+    {0x73636965, 6905, 14, 1, 9121, 0},
+    {0x73636965, 2130, 8, 1, 9121, 0},
+    {0x73636965, 2130, 18, 1, 9121, 0},
+    {0x73636f74, 27663, 8, 1, 9121, 0},
+    {0x73656170, 33122, 7, 1, 9121, 0},
+    {0x73657474, 18252, 10, 1, 9121, 0},
+    {0x73657474, 27759, 8, 1, 9121, 0},
+    {0x7368656c, 40355, 5, 1, 9121, 0},
+    {0x73686572, 18272, 10, 1, 9121, 0},
+    {0x73696265, 33234, 7, 1, 9121, 0},
+    {0x73696c6b, 41778, 4, 1, 9121, 0},
+    {0x736b6900, 6680, 3, 1, 9121, 0},
+    {0x736b6f6c, 40390, 5, 1, 9121, 0},
+    {0x736f6369, 2689, 7, 1, 9121, 0},
+    {0x736f6c6f, 33311, 7, 1, 9121, 0},
+    {0x736f756e, 6947, 14, 1, 9121, 0},
+    {0x736f7574, 8922, 13, 1, 9121, 0},
+    {0x736f7574, 22729, 9, 1, 9121, 0},
+    {0x73706163, 1406, 5, 1, 9121, 0},
+    {0x73707900, 22738, 3, 1, 9121, 0},
+    {0x73717561, 33332, 6, 1, 9121, 0},
+    {0x73746164, 28515, 5, 1, 9121, 0},
+    {0x7374616c, 27999, 8, 1, 9121, 0},
+    {0x73746172, 22747, 9, 1, 9121, 0},
+    {0x73746174, 5262, 5, 1, 9121, 0},
+    {0x73746174, 5262, 15, 1, 9121, 0},
+    {0x73746174, 1240, 7, 1, 9121, 0},
+    {0x73746561, 40475, 5, 1, 9121, 0},
+    {0x73746569, 18392, 10, 1, 9121, 0},
+    {0x73746a6f, 37457, 6, 1, 9121, 0},
+    {0x73746f63, 22810, 9, 1, 9121, 0},
+    {0x73747065, 11419, 12, 1, 9121, 0},
+    {0x73747574, 22837, 9, 1, 9121, 0},
+    {0x73756973, 37487, 6, 1, 9121, 0},
+    {0x73757267, 11455, 12, 1, 9121, 0},
+    {0x73757272, 37523, 6, 1, 9121, 0},
+    {0x7376697a, 28095, 8, 1, 9121, 0},
+    {0x73776564, 37565, 6, 1, 9121, 0},
+    {0x7379646e, 37571, 6, 1, 9121, 0},
+    {0x74616e6b, 41834, 4, 1, 9121, 0},
+    {0x74636d00, 42393, 3, 1, 9121, 0},
+    {0x74656368, 18492, 10, 1, 9121, 0},
+    {0x74656c65, 2951, 17, 1, 9121, 0},
+    {0x74656c65, 18512, 10, 1, 9121, 0},
+    {0x74657861, 40575, 5, 1, 9121, 0},
+    {0x74657874, 33521, 7, 1, 9121, 0},
+    {0x74686561, 33528, 7, 1, 9121, 0},
+    {0x74696d65, 5991, 4, 1, 9121, 0},
+    {0x74696d65, 14612, 11, 1, 9121, 0},
+    {0x746f706f, 28439, 8, 1, 9121, 0},
+    {0x746f7269, 37781, 6, 1, 9121, 0},
+    {0x746f7563, 27753, 5, 1, 9121, 0},
+    {0x746f776e, 3932, 4, 1, 9121, 0},
+    {0x7472616e, 18572, 9, 1, 9121, 0},
+    {0x74726565, 41878, 4, 1, 9121, 0},
+    {0x74726f6c, 33710, 7, 1, 9121, 0},
+    {0x74727573, 33717, 5, 1, 9121, 0},
+    {0x74727573, 33717, 7, 1, 9121, 0},
+    {0x75687265, 6466, 5, 1, 9121, 0},
+    {0x756c6d00, 42417, 3, 1, 9121, 0},
+    {0x756e6465, 28607, 8, 1, 9121, 0},
+    {0x756e6976, 18602, 10, 1, 9121, 0},
+    {0x75736100, 5113, 3, 1, 9121, 0},
+    {0x7573616e, 18612, 10, 1, 9121, 0},
+    {0x75736172, 37949, 6, 1, 9121, 0},
+    {0x7573636f, 5382, 15, 1, 9121, 0},
+    {0x75736375, 23134, 9, 1, 9121, 0},
+    {0x75736465, 4044, 16, 1, 9121, 0},
+    {0x75736761, 28639, 8, 1, 9121, 0},
+    {0x75736869, 23143, 9, 1, 9121, 0},
+    {0x75736875, 33815, 7, 1, 9121, 0},
+    {0x75736c69, 5397, 15, 1, 9121, 0},
+    {0x75746168, 41930, 4, 1, 9121, 0},
+    {0x75766963, 41934, 4, 1, 9121, 0},
+    {0x76616c6c, 3398, 6, 1, 9121, 0},
+    {0x76616e74, 37985, 6, 1, 9121, 0},
+    {0x76657273, 18672, 10, 1, 9121, 0},
+    {0x76696b69, 38051, 6, 1, 9121, 0},
+    {0x76696c6c, 33871, 7, 1, 9121, 0},
+    {0x76697267, 28727, 8, 1, 9121, 0},
+    {0x76697274, 9078, 7, 1, 9121, 0},
+    {0x76697274, 33885, 7, 1, 9121, 0},
+    {0x766c6161, 18702, 10, 1, 9121, 0},
+    {0x766f6c6b, 14744, 11, 1, 9121, 0},
+    {0x77616c65, 40820, 5, 1, 9121, 0},
+    {0x77616c6c, 28767, 8, 1, 9121, 0},
+    {0x77617200, 5273, 3, 1, 9121, 0},
+    {0x77617368, 11671, 12, 1, 9121, 0},
+    {0x77617463, 5412, 15, 1, 9121, 0},
+    {0x77617463, 9091, 13, 1, 9121, 0},
+    {0x77657374, 2081, 7, 1, 9121, 0},
+    {0x77657374, 23251, 9, 1, 9121, 0},
+    {0x7768616c, 33983, 7, 1, 9121, 0},
+    {0x77696c64, 28823, 8, 1, 9121, 0},
+    {0x77696c6c, 1035, 12, 1, 9121, 0},
+    {0x77696e64, 28831, 8, 1, 9121, 0},
+    {0x776f726b, 28847, 8, 1, 9121, 0},
+    {0x786e2d2d, 7101, 14, 1, 9121, 0},
+    {0x786e2d2d, 1247, 20, 1, 9121, 0},
+    {0x786e2d2d, 0, 36, 1, 9121, 0},
+    {0x786e2d2d, 19062, 10, 1, 9121, 0},
+    {0x786e2d2d, 15360, 11, 1, 9121, 0},
+    {0x796f726b, 23593, 4, 1, 9121, 0},
+    {0x796f726b, 23593, 9, 1, 9121, 0},
+    {0x796f7365, 28991, 8, 1, 9121, 0},
+    {0x796f7574, 40895, 5, 1, 9121, 0},
+    {0x7a6f6f6c, 19362, 10, 1, 9121, 0},
+    {0x7a6f6f6c, 34137, 7, 1, 9121, 0},
+    {0x6165726f, 19390, 4, 1, 9121, 0},
+    {0x62697a00, 38535, 3, 1, 9121, 0},
+    {0x636f6d00, 19, 3, 1, 9121, 0},
+    {0x636f6f70, 12918, 4, 1, 9121, 0},
+    {0x65647500, 9778, 3, 1, 9121, 0},
+    {0x676f7600, 810, 3, 1, 9121, 0},
+    {0x696e666f, 21606, 4, 1, 9121, 0},
+    {0x696e7400, 2022, 3, 1, 9121, 0},
+    {0x6d696c00, 6019, 3, 1, 9121, 0},
+    {0x6d757365, 1121, 6, 1, 9121, 0},
+    {0x6e616d65, 17722, 4, 1, 9121, 0},
+    {0x6e657400, 2944, 3, 1, 9121, 0},
+    {0x6f726700, 6352, 3, 1, 9121, 0},
+    {0x70726f00, 5042, 3, 1, 9121, 0},
+    {0x61630000, 35, 2, 1, 9121, 0},
+    {0x62697a00, 38535, 3, 1, 9121, 0},
+    {0x636f0000, 4, 2, 1, 9121, 0},
+    {0x636f6d00, 19, 3, 1, 9121, 0},
+    {0x636f6f70, 12918, 4, 1, 9121, 0},
+    {0x65647500, 9778, 3, 1, 9121, 0},
+    {0x676f7600, 810, 3, 1, 9121, 0},
+    {0x696e7400, 2022, 3, 1, 9121, 0},
+    {0x6d757365, 1121, 6, 1, 9121, 0},
+    {0x6e657400, 2944, 3, 1, 9121, 0},
+    {0x6f726700, 6352, 3, 1, 9121, 0},
+    {0x626c6f67, 23967, 8, 1, 9121, 0},
+    {0x636f6d00, 19, 3, 1, 9121, 0},
+    {0x65647500, 9778, 3, 1, 9121, 0},
+    {0x676f6200, 38533, 3, 1, 9121, 0},
+    {0x6e657400, 2944, 3, 1, 9121, 0},
+    {0x6f726700, 6352, 3, 1, 9121, 0},
+    {0x62697a00, 38535, 3, 1, 9121, 0},
+    {0x626c6f67, 23967, 8, 1, 9121, 0},
+    {0x636f6d00, 19, 3, 1, 9121, 0},
+    {0x65647500, 9778, 3, 1, 9121, 0},
+    {0x676f7600, 810, 3, 1, 9121, 0},
+    {0x6d696c00, 6019, 3, 1, 9121, 0},
+    {0x6e616d65, 17722, 4, 1, 9121, 0},
+    {0x6e657400, 2944, 3, 1, 9121, 0},
+    {0x6f726700, 6352, 3, 1, 9121, 0},
+    {0x61630000, 35, 2, 1, 9121, 0},
+    {0x61647600, 729, 3, 1, 9121, 0},
+    {0x636f0000, 4, 2, 1, 9121, 0},
+    {0x65647500, 9778, 3, 1, 9121, 0},
+    {0x676f7600, 810, 3, 1, 9121, 0},
+    {0x6d696c00, 6019, 3, 1, 9121, 0},
+    {0x6e657400, 2944, 3, 1, 9121, 0},
+    {0x6f726700, 6352, 3, 1, 9121, 0},
+    {0x63610000, 25, 2, 1, 9121, 0},
+    {0x63630000, 456, 2, 1, 9121, 0},
+    {0x636f0000, 4, 2, 1, 9121, 0},
+    {0x636f6d00, 19, 3, 1, 9121, 0},
+    {0x64720000, 633, 2, 1, 9121, 0},
+    {0x696e0000, 204, 2, 1, 9121, 0},
+    {0x696e666f, 21606, 4, 1, 9121, 0},
+    {0x6d6f6269, 2103, 4, 1, 9121, 0},
+    {0x6d780000, 4107, 2, 1, 9121, 0},
+    {0x6e616d65, 17722, 4, 1, 9121, 0},
+    {0x6f720000, 5, 2, 1, 9121, 0},
+    {0x6f726700, 6352, 3, 1, 9121, 0},
+    {0x70726f00, 5042, 3, 1, 9121, 0},
+    {0x7363686f, 22378, 6, 1, 9121, 0},
+    {0x74760000, 2443, 2, 1, 9121, 0},
+    {0x75730000, 767, 2, 1, 9121, 0},
+    {0x77730000, 988, 2, 1, 9121, 0},
+    {0x68657200, 1910, 3, 0, 9121, 1},
+    {0x68697300, 1114, 3, 0, 9122, 1},
+    {0x6173736f, 788, 4, 1, 9123, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9123, 0},
+    {0x61646f62, 7674, 13, 1, 9123, 0},
+    {0x61646f62, 5967, 14, 1, 9123, 0},
+    {0x61646f62, 5981, 14, 1, 9123, 0},
+    {0x616b6164, 34223, 6, 1, 9123, 0},
+    {0x616b616d, 967, 6, 1, 9123, 0},
+    {0x616b616d, 5995, 14, 1, 9123, 0},
+    {0x616b616d, 1878, 10, 1, 9123, 0},
+    {0x616b616d, 1878, 18, 1, 9123, 0},
+    {0x616b616d, 3324, 8, 1, 9123, 0},
+    {0x616b616d, 3324, 16, 1, 9123, 0},
+    {0x616b616d, 967, 12, 1, 9123, 0},
+    {0x616b616d, 967, 20, 1, 9123, 0},
+    {0x616b616d, 2526, 9, 1, 9123, 0},
+    {0x616b616d, 2526, 17, 1, 9123, 0},
+    {0x616c7761, 15932, 10, 1, 9123, 0},
+    {0x61707075, 34307, 6, 1, 9123, 0},
+    {0x61742d62, 9799, 12, 1, 9123, 0},
+    {0x61746c61, 7752, 13, 0, 9123, 1},
+    {0x617a7572, 9823, 12, 1, 9124, 0},
+    {0x617a7572, 4362, 15, 1, 9124, 7},
+    {0x617a7572, 7765, 13, 1, 9131, 0},
+    {0x62617230, 40998, 4, 1, 9131, 0},
+    {0x62617231, 41002, 4, 1, 9131, 0},
+    {0x62617232, 41006, 4, 1, 9131, 0},
+    {0x62617273, 12676, 5, 1, 9131, 0},
+    {0x62697462, 19786, 9, 1, 9131, 0},
+    {0x626c6163, 9859, 12, 1, 9131, 0},
+    {0x626c6f67, 29447, 7, 1, 9131, 0},
+    {0x626f6f6d, 34499, 6, 1, 9131, 0},
+    {0x626f756e, 23999, 8, 1, 9131, 0},
+    {0x62706c61, 29489, 7, 1, 9131, 0},
+    {0x62726f6b, 24047, 8, 1, 9131, 0},
+    {0x62757973, 16142, 10, 1, 9131, 0},
+    {0x63617361, 29594, 7, 1, 9131, 0},
+    {0x63646e2d, 19885, 9, 1, 9131, 0},
+    {0x63646e37, 9883, 5, 0, 9131, 1},
+    {0x63646e37, 19894, 9, 1, 9132, 0},
+    {0x6368616e, 12852, 11, 1, 9132, 1},
+    {0x636c6963, 12885, 11, 1, 9133, 0},
+    {0x636c6f75, 12896, 11, 1, 9133, 0},
+    {0x636c6f75, 19993, 8, 1, 9133, 0},
+    {0x636c6f75, 16302, 10, 1, 9133, 0},
+    {0x636c6f75, 6205, 14, 1, 9133, 0},
+    {0x636c6f75, 16312, 10, 1, 9133, 2},
+    {0x636c6f75, 7908, 13, 1, 9135, 0},
+    {0x636f6d6d, 7921, 13, 1, 9135, 0},
+    {0x63727970, 12951, 11, 2, 9135, 0},
+    {0x64617474, 16442, 10, 1, 9135, 0},
+    {0x64646e73, 24407, 4, 1, 9135, 0},
+    {0x64656269, 34763, 6, 1, 9135, 0},
+    {0x64656669, 24439, 8, 1, 9135, 0},
+    {0x646e7361, 24487, 8, 1, 9135, 0},
+    {0x646e7364, 29986, 7, 1, 9135, 0},
+    {0x646e7375, 16502, 5, 1, 9135, 0},
+    {0x646f6573, 30000, 7, 1, 9135, 0},
+    {0x646f6e74, 20083, 9, 1, 9135, 0},
+    {0x64736d79, 30042, 7, 1, 9135, 0},
+    {0x64796e61, 24543, 8, 1, 9135, 0},
+    {0x64796e61, 20110, 9, 1, 9135, 0},
+    {0x64796e75, 41146, 4, 1, 9135, 0},
+    {0x64796e76, 38790, 5, 1, 9135, 0},
+    {0x65617469, 6345, 14, 1, 9135, 0},
+    {0x65646765, 30084, 7, 1, 9135, 0},
+    {0x65646765, 4617, 7, 1, 9135, 0},
+    {0x65646765, 4617, 15, 1, 9135, 0},
+    {0x65646765, 2611, 9, 1, 9135, 0},
+    {0x65646765, 2611, 17, 1, 9135, 0},
+    {0x656c6173, 34883, 6, 0, 9135, 3},
+    {0x656e646f, 8038, 13, 1, 9138, 0},
+    {0x66616d69, 24679, 8, 1, 9138, 0},
+    {0x66617374, 3500, 6, 0, 9138, 4},
+    {0x66617374, 24687, 8, 1, 9142, 1},
+    {0x66617374, 16642, 10, 1, 9143, 0},
+    {0x66657374, 24711, 8, 1, 9143, 0},
+    {0x66697265, 3532, 16, 1, 9143, 0},
+    {0x666c796e, 10063, 12, 1, 9143, 0},
+    {0x66726f6d, 30441, 7, 1, 9143, 0},
+    {0x66726f6d, 30455, 7, 1, 9143, 0},
+    {0x66726f6d, 30546, 7, 1, 9143, 0},
+    {0x66726f6d, 30658, 7, 1, 9143, 0},
+    {0x67620000, 349, 2, 1, 9143, 0},
+    {0x67657473, 30882, 7, 1, 9143, 0},
+    {0x68616d2d, 10147, 12, 1, 9143, 0},
+    {0x68657465, 35345, 6, 1, 9143, 0},
+    {0x68696361, 39130, 5, 1, 9143, 0},
+    {0x686f6d65, 31190, 7, 1, 9143, 0},
+    {0x686f6d65, 35405, 6, 1, 9143, 0},
+    {0x686f6d65, 20677, 9, 1, 9143, 0},
+    {0x686f6d65, 25263, 8, 1, 9143, 0},
+    {0x68750000, 1300, 2, 1, 9143, 0},
+    {0x696e0000, 204, 2, 1, 9143, 0},
+    {0x696e2d64, 35507, 6, 1, 9143, 0},
+    {0x696e2d74, 13490, 11, 1, 9143, 0},
+    {0x696e2d76, 35513, 6, 1, 9143, 0},
+    {0x696f6262, 41342, 4, 1, 9143, 0},
+    {0x69706966, 31330, 7, 1, 9143, 0},
+    {0x69732d61, 20812, 9, 1, 9143, 0},
+    {0x69732d61, 20821, 9, 1, 9143, 0},
+    {0x6973612d, 25415, 8, 1, 9143, 0},
+    {0x6a700000, 6664, 2, 1, 9143, 0},
+    {0x6b69636b, 21136, 9, 1, 9143, 0},
+    {0x6b696e67, 25847, 8, 1, 9143, 0},
+    {0x6b6e782d, 17222, 10, 1, 9143, 0},
+    {0x6b72656c, 26007, 8, 1, 9143, 0},
+    {0x6d617373, 13831, 11, 0, 9143, 1},
+    {0x6d65696e, 21604, 9, 1, 9144, 0},
+    {0x6d656d73, 36203, 6, 1, 9144, 0},
+    {0x6d6f6f6e, 21739, 9, 1, 9144, 0},
+    {0x6d79616d, 32261, 7, 1, 9144, 0},
+    {0x6d796461, 32275, 7, 1, 9144, 0},
+    {0x6d796469, 21820, 9, 1, 9144, 0},
+    {0x6d796566, 26719, 8, 1, 9144, 0},
+    {0x6d796672, 32296, 7, 1, 9144, 0},
+    {0x6d796d65, 21829, 9, 1, 9144, 0},
+    {0x6d797073, 39695, 5, 1, 9144, 0},
+    {0x6d797365, 3804, 16, 1, 9144, 0},
+    {0x6d797370, 10819, 12, 1, 9144, 0},
+    {0x6e686c66, 36641, 6, 1, 9144, 0},
+    {0x6e6f2d69, 39820, 5, 1, 9144, 0},
+    {0x6e6f772d, 32506, 7, 1, 9144, 0},
+    {0x6f666669, 8675, 13, 1, 9144, 0},
+    {0x6f6e6176, 22018, 9, 1, 9144, 0},
+    {0x6f766800, 42294, 3, 0, 9144, 2},
+    {0x6f776e69, 39980, 5, 1, 9146, 0},
+    {0x70676166, 36941, 6, 1, 9146, 0},
+    {0x706f647a, 32800, 7, 1, 9146, 0},
+    {0x70726976, 220, 24, 1, 9146, 0},
+    {0x7261636b, 27415, 8, 1, 9146, 0},
+    {0x72656469, 18062, 10, 1, 9146, 0},
+    {0x72657365, 6863, 14, 1, 9146, 0},
+    {0x72750000, 39, 2, 1, 9146, 0},
+    {0x73617665, 14381, 11, 0, 9146, 2},
+    {0x7363616c, 18172, 10, 0, 9148, 1},
+    {0x7363686f, 18192, 10, 1, 9149, 0},
+    {0x73637261, 8805, 13, 1, 9149, 0},
+    {0x73650000, 94, 2, 1, 9149, 0},
+    {0x73656964, 37271, 6, 1, 9149, 0},
+    {0x73656c66, 37283, 6, 1, 9149, 0},
+    {0x73656c6c, 27687, 8, 1, 9149, 0},
+    {0x73656e73, 18222, 10, 1, 9149, 0},
+    {0x73657276, 27695, 8, 1, 9149, 0},
+    {0x73657276, 22423, 9, 1, 9149, 0},
+    {0x73657276, 27703, 8, 1, 9149, 0},
+    {0x73657276, 6933, 14, 1, 9149, 0},
+    {0x73686f70, 18322, 10, 1, 9149, 0},
+    {0x73697465, 27887, 8, 1, 9149, 0},
+    {0x73717561, 33332, 7, 1, 9149, 0},
+    {0x73726366, 41810, 4, 0, 9149, 2},
+    {0x73746174, 8948, 13, 1, 9151, 0},
+    {0x73757061, 28063, 8, 1, 9151, 0},
+    {0x73797465, 18017, 5, 1, 9151, 0},
+    {0x74336c33, 28135, 8, 1, 9151, 0},
+    {0x7461696c, 22891, 9, 0, 9151, 1},
+    {0x74687275, 28367, 8, 1, 9152, 0},
+    {0x746f7270, 18552, 10, 1, 9152, 1},
+    {0x74730000, 70, 2, 1, 9153, 0},
+    {0x7473756b, 28527, 8, 0, 9153, 1},
+    {0x74776d61, 37895, 6, 1, 9154, 0},
+    {0x756b0000, 6692, 2, 1, 9154, 0},
+    {0x756e6935, 41898, 4, 1, 9154, 0},
+    {0x76706e64, 38087, 6, 1, 9154, 0},
+    {0x7670732d, 28743, 8, 1, 9154, 1},
+    {0x77656268, 38147, 6, 1, 9155, 0},
+    {0x79616e64, 15789, 11, 1, 9155, 2},
+    {0x7a610000, 739, 2, 1, 9157, 0},
+    {0x616c6365, 38365, 5, 2, 9157, 0},
+    {0x6172766f, 40982, 4, 1, 9157, 0},
+    {0x617a696d, 29321, 7, 1, 9157, 0},
+    {0x636f0000, 4, 2, 1, 9157, 0},
+    {0x746c6f6e, 41858, 4, 1, 9157, 0},
+    {0x6e6f7469, 17802, 10, 1, 9157, 0},
+    {0x61727473, 4056, 4, 1, 9157, 0},
+    {0x636f6d00, 19, 3, 1, 9157, 0},
+    {0x6669726d, 24743, 4, 1, 9157, 0},
+    {0x696e666f, 21606, 4, 1, 9157, 0},
+    {0x6e657400, 2944, 3, 1, 9157, 0},
+    {0x6f746865, 29519, 5, 1, 9157, 0},
+    {0x70657200, 1092, 3, 1, 9157, 0},
+    {0x72656300, 2808, 3, 1, 9157, 0},
+    {0x73746f72, 10046, 5, 1, 9157, 0},
+    {0x77656200, 123, 3, 1, 9157, 0},
+    {0x636f6c00, 1027, 3, 1, 9157, 0},
+    {0x636f6d00, 19, 3, 1, 9157, 1},
+    {0x65647500, 9778, 3, 1, 9158, 0},
+    {0x6669726d, 24743, 4, 1, 9158, 0},
+    {0x67656e00, 324, 3, 1, 9158, 0},
+    {0x676f7600, 810, 3, 1, 9158, 0},
+    {0x69000000, 9, 1, 1, 9158, 0},
+    {0x6c746400, 33033, 3, 1, 9158, 0},
+    {0x6d696c00, 6019, 3, 1, 9158, 0},
+    {0x6d6f6269, 2103, 4, 1, 9158, 0},
+    {0x6e616d65, 17722, 4, 1, 9158, 0},
+    {0x6e657400, 2944, 3, 1, 9158, 0},
+    {0x6e676f00, 12810, 3, 1, 9158, 0},
+    {0x6f726700, 6352, 3, 1, 9158, 0},
+    {0x73636800, 1512, 3, 1, 9158, 0},
+    {0x61630000, 35, 2, 1, 9158, 0},
+    {0x62697a00, 38535, 3, 1, 9158, 0},
+    {0x636f0000, 4, 2, 1, 9158, 0},
+    {0x636f6d00, 19, 3, 1, 9158, 0},
+    {0x65647500, 9778, 3, 1, 9158, 0},
+    {0x676f6200, 38533, 3, 1, 9158, 0},
+    {0x696e0000, 204, 2, 1, 9158, 0},
+    {0x696e666f, 21606, 4, 1, 9158, 0},
+    {0x696e7400, 2022, 3, 1, 9158, 0},
+    {0x6d696c00, 6019, 3, 1, 9158, 0},
+    {0x6e657400, 2944, 3, 1, 9158, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9158, 0},
+    {0x6f726700, 6352, 3, 1, 9158, 0},
+    {0x77656200, 123, 3, 1, 9158, 0},
+    {0x31323377, 15842, 10, 1, 9158, 0},
+    {0x626c6f67, 23967, 8, 1, 9158, 0},
+    {0x63697374, 29741, 7, 1, 9158, 0},
+    {0x636f0000, 4, 2, 1, 9158, 0},
+    {0x64656d6f, 38745, 5, 1, 9158, 0},
+    {0x676f7600, 810, 3, 1, 9158, 0},
+    {0x686f7374, 4872, 15, 1, 9158, 0},
+    {0x6b68706c, 35741, 6, 1, 9158, 0},
+    {0x6d797370, 10819, 12, 1, 9158, 0},
+    {0x7472616e, 28495, 8, 2, 9158, 0},
+    {0x31323368, 7661, 13, 1, 9158, 0},
+    {0x61610000, 1402, 2, 1, 9158, 1},
+    {0x61617262, 23655, 8, 1, 9159, 0},
+    {0x61656a72, 34187, 6, 1, 9159, 0},
+    {0x61666a6f, 18686, 6, 1, 9159, 0},
+    {0x61676465, 29097, 7, 1, 9159, 0},
+    {0x61680000, 2678, 2, 1, 9159, 1},
+    {0x616b6572, 23743, 8, 0, 9160, 1},
+    {0x616b6e6f, 15902, 10, 1, 9161, 0},
+    {0x616b7265, 23751, 8, 1, 9161, 0},
+    {0x616c0000, 106, 2, 1, 9161, 0},
+    {0x616c6168, 19426, 9, 1, 9161, 0},
+    {0x616c6573, 29153, 7, 1, 9161, 0},
+    {0x616c6761, 4399, 6, 1, 9161, 0},
+    {0x616c7374, 19453, 9, 1, 9161, 0},
+    {0x616c7461, 7818, 4, 1, 9161, 0},
+    {0x616c7664, 34259, 6, 1, 9161, 0},
+    {0x616d6c69, 11435, 4, 1, 9161, 0},
+    {0x616d6f74, 18465, 4, 1, 9161, 0},
+    {0x616e6461, 19516, 9, 1, 9161, 0},
+    {0x616e6465, 34271, 6, 1, 9161, 0},
+    {0x616e646f, 37218, 5, 1, 9161, 0},
+    {0x61726461, 21536, 5, 1, 9161, 0},
+    {0x6172656d, 29195, 7, 1, 9161, 0},
+    {0x6172656e, 29202, 7, 1, 9161, 0},
+    {0x61726e61, 21533, 4, 1, 9161, 0},
+    {0x61736572, 34331, 6, 1, 9161, 0},
+    {0x61736b65, 38405, 5, 1, 9161, 0},
+    {0x61736b69, 38410, 5, 1, 9161, 0},
+    {0x61736b6f, 38415, 5, 1, 9161, 0},
+    {0x61736b76, 29237, 7, 1, 9161, 0},
+    {0x61736e65, 38420, 5, 1, 9161, 0},
+    {0x6175646e, 19651, 9, 1, 9161, 0},
+    {0x61756b72, 38440, 5, 1, 9161, 0},
+    {0x61757265, 40990, 4, 1, 9161, 0},
+    {0x6175726c, 29272, 7, 1, 9161, 0},
+    {0x61757273, 6065, 14, 1, 9161, 0},
+    {0x61757374, 19660, 9, 1, 9161, 0},
+    {0x61757374, 19678, 9, 1, 9161, 0},
+    {0x61766572, 34373, 6, 1, 9161, 0},
+    {0x62616461, 23871, 8, 1, 9161, 0},
+    {0x62616863, 12643, 11, 1, 9161, 0},
+    {0x62616863, 9847, 12, 1, 9161, 0},
+    {0x62616964, 34391, 6, 1, 9161, 0},
+    {0x62616a64, 29349, 7, 1, 9161, 0},
+    {0x62616c61, 38460, 5, 1, 9161, 0},
+    {0x62616c65, 16012, 10, 1, 9161, 0},
+    {0x62616c6c, 19696, 9, 1, 9161, 0},
+    {0x62616c73, 19705, 9, 1, 9161, 0},
+    {0x62616d62, 34397, 6, 1, 9161, 0},
+    {0x62617264, 38470, 5, 1, 9161, 0},
+    {0x62617275, 38475, 5, 1, 9161, 0},
+    {0x62617473, 19750, 9, 1, 9161, 0},
+    {0x62656172, 12720, 11, 1, 9161, 0},
+    {0x62656172, 34421, 6, 1, 9161, 0},
+    {0x62656961, 34439, 6, 1, 9161, 0},
+    {0x62657267, 5914, 4, 1, 9161, 0},
+    {0x62657267, 34445, 6, 1, 9161, 0},
+    {0x6265726c, 23935, 8, 1, 9161, 0},
+    {0x62696576, 34463, 6, 1, 9161, 0},
+    {0x62696e64, 34487, 6, 1, 9161, 0},
+    {0x6269726b, 23951, 8, 1, 9161, 0},
+    {0x626a6172, 29440, 7, 1, 9161, 0},
+    {0x626a6572, 19804, 9, 1, 9161, 0},
+    {0x626a7567, 38540, 5, 1, 9161, 0},
+    {0x626c6f67, 23967, 8, 1, 9161, 0},
+    {0x626f646f, 41034, 4, 1, 9161, 0},
+    {0x626f6b6e, 41042, 4, 1, 9161, 0},
+    {0x626f6d6c, 38555, 5, 1, 9161, 0},
+    {0x6272656d, 19831, 9, 1, 9161, 0},
+    {0x62726f6e, 12797, 7, 1, 9161, 0},
+    {0x62726f6e, 12797, 11, 1, 9161, 0},
+    {0x6272756d, 16132, 10, 1, 9161, 0},
+    {0x6272796e, 38565, 5, 1, 9161, 0},
+    {0x62750000, 525, 2, 1, 9161, 1},
+    {0x62756465, 29531, 7, 1, 9162, 0},
+    {0x6275736b, 24087, 8, 0, 9162, 1},
+    {0x6279676c, 29559, 7, 1, 9163, 0},
+    {0x62796b6c, 38580, 5, 1, 9163, 0},
+    {0x63616863, 16152, 10, 1, 9163, 0},
+    {0x636f0000, 4, 2, 1, 9163, 0},
+    {0x64617676, 12962, 11, 1, 9163, 0},
+    {0x64617676, 16462, 10, 1, 9163, 0},
+    {0x64656174, 34757, 6, 1, 9163, 0},
+    {0x64657000, 479, 3, 1, 9163, 0},
+    {0x6469656c, 7960, 13, 1, 9163, 0},
+    {0x64697674, 10003, 12, 1, 9163, 0},
+    {0x64697674, 7973, 13, 1, 9163, 0},
+    {0x646f6e6e, 38760, 5, 1, 9163, 0},
+    {0x646f7672, 38770, 5, 1, 9163, 0},
+    {0x6472616d, 30028, 7, 1, 9163, 0},
+    {0x6472616e, 20092, 9, 1, 9163, 0},
+    {0x64726f62, 34817, 6, 1, 9163, 0},
+    {0x6479726f, 38795, 5, 1, 9163, 0},
+    {0x65676572, 24583, 8, 1, 9163, 0},
+    {0x65696400, 17719, 3, 1, 9163, 0},
+    {0x65696466, 24599, 8, 1, 9163, 0},
+    {0x65696473, 24607, 8, 1, 9163, 0},
+    {0x65696473, 30105, 7, 1, 9163, 0},
+    {0x65696473, 24615, 8, 1, 9163, 0},
+    {0x65696765, 20155, 9, 1, 9163, 0},
+    {0x656c7665, 30126, 7, 1, 9163, 0},
+    {0x656e6562, 30161, 7, 1, 9163, 0},
+    {0x656e6765, 24623, 8, 1, 9163, 0},
+    {0x65746e65, 30196, 4, 1, 9163, 0},
+    {0x65746e65, 30196, 7, 1, 9163, 0},
+    {0x6576656e, 24663, 8, 1, 9163, 0},
+    {0x6576656e, 34919, 6, 1, 9163, 0},
+    {0x65766a65, 4677, 15, 1, 9163, 0},
+    {0x66617273, 30238, 7, 1, 9163, 0},
+    {0x66617573, 34937, 6, 1, 9163, 0},
+    {0x6665646a, 38870, 5, 1, 9163, 0},
+    {0x66657400, 2586, 3, 1, 9163, 0},
+    {0x66657473, 30266, 7, 1, 9163, 0},
+    {0x66687300, 41190, 3, 1, 9163, 0},
+    {0x66696e6e, 34949, 6, 1, 9163, 0},
+    {0x6669746a, 34955, 6, 1, 9163, 0},
+    {0x666a616c, 34961, 6, 1, 9163, 0},
+    {0x666a656c, 10187, 5, 1, 9163, 0},
+    {0x666c6100, 4517, 3, 1, 9163, 0},
+    {0x666c616b, 24751, 8, 1, 9163, 0},
+    {0x666c6174, 20254, 9, 1, 9163, 0},
+    {0x666c656b, 13270, 11, 1, 9163, 0},
+    {0x666c6573, 24767, 8, 1, 9163, 0},
+    {0x666c6f72, 38905, 5, 1, 9163, 0},
+    {0x666c6f72, 38910, 5, 1, 9163, 0},
+    {0x666d0000, 20844, 2, 1, 9163, 1},
+    {0x666f6c6b, 20263, 9, 1, 9164, 0},
+    {0x666f6c6c, 30357, 7, 1, 9164, 0},
+    {0x666f7264, 38915, 5, 1, 9164, 0},
+    {0x666f7273, 30385, 7, 1, 9164, 0},
+    {0x666f736e, 35003, 6, 1, 9164, 0},
+    {0x6672616e, 38930, 5, 1, 9164, 0},
+    {0x66726564, 13314, 11, 1, 9164, 0},
+    {0x66726569, 24831, 4, 1, 9164, 0},
+    {0x66726f67, 38935, 5, 1, 9164, 0},
+    {0x66726f6c, 30413, 7, 1, 9164, 0},
+    {0x66726f73, 35009, 6, 1, 9164, 0},
+    {0x66726f79, 38940, 5, 1, 9164, 0},
+    {0x66756f69, 30826, 7, 1, 9164, 0},
+    {0x66756f73, 30833, 7, 1, 9164, 0},
+    {0x66757361, 22527, 4, 1, 9164, 0},
+    {0x66796c6b, 16712, 10, 1, 9164, 0},
+    {0x66797265, 24951, 8, 1, 9164, 0},
+    {0x67616976, 20425, 9, 1, 9164, 0},
+    {0x67616c73, 38970, 5, 1, 9164, 0},
+    {0x67616d76, 35051, 6, 1, 9164, 0},
+    {0x67616e67, 16722, 10, 1, 9164, 0},
+    {0x6761756c, 35057, 6, 1, 9164, 0},
+    {0x67617573, 30847, 7, 1, 9164, 0},
+    {0x67696568, 8155, 13, 1, 9164, 0},
+    {0x67696c64, 20452, 9, 1, 9164, 0},
+    {0x6769736b, 39000, 5, 1, 9164, 0},
+    {0x676a656d, 30910, 7, 1, 9164, 0},
+    {0x676a6572, 24975, 8, 1, 9164, 0},
+    {0x676a6572, 24983, 8, 1, 9164, 0},
+    {0x676a6573, 30917, 7, 1, 9164, 0},
+    {0x676a6f76, 35129, 6, 1, 9164, 0},
+    {0x676c6f70, 30931, 7, 1, 9164, 0},
+    {0x676f6c00, 20077, 3, 1, 9164, 0},
+    {0x6772616e, 7837, 4, 1, 9164, 0},
+    {0x6772616e, 39050, 5, 1, 9164, 0},
+    {0x6772616e, 31008, 7, 1, 9164, 0},
+    {0x67726174, 20488, 9, 1, 9164, 0},
+    {0x6772696d, 25015, 8, 1, 9164, 0},
+    {0x67726f6e, 39065, 5, 1, 9164, 0},
+    {0x67727565, 41282, 4, 1, 9164, 0},
+    {0x67756c65, 39080, 5, 1, 9164, 0},
+    {0x67756f76, 8181, 13, 1, 9164, 0},
+    {0x68610000, 599, 2, 1, 9164, 0},
+    {0x6861626d, 35195, 6, 1, 9164, 0},
+    {0x68616473, 35213, 6, 1, 9164, 0},
+    {0x68616765, 16792, 10, 1, 9164, 0},
+    {0x68616c64, 35237, 6, 1, 9164, 0},
+    {0x68616c73, 39100, 5, 1, 9164, 0},
+    {0x68616d61, 31099, 5, 1, 9164, 0},
+    {0x68616d61, 31099, 7, 1, 9164, 0},
+    {0x68616d6d, 10171, 12, 1, 9164, 0},
+    {0x68616d6d, 16812, 10, 1, 9164, 0},
+    {0x6861706d, 35267, 6, 1, 9164, 0},
+    {0x68617261, 17408, 5, 1, 9164, 0},
+    {0x68617265, 35279, 6, 1, 9164, 0},
+    {0x68617273, 31127, 7, 1, 9164, 0},
+    {0x68617376, 35309, 6, 1, 9164, 0},
+    {0x68617474, 10183, 12, 1, 9164, 0},
+    {0x68617567, 20569, 9, 1, 9164, 0},
+    {0x6865646d, 31141, 7, 0, 9164, 3},
+    {0x68656d6e, 35333, 5, 1, 9167, 0},
+    {0x68656d6e, 35333, 6, 1, 9167, 0},
+    {0x68656d73, 25143, 8, 1, 9167, 0},
+    {0x68657261, 3163, 5, 1, 9167, 0},
+    {0x68697472, 39145, 5, 1, 9167, 0},
+    {0x686a6172, 25215, 8, 1, 9167, 0},
+    {0x686a656c, 16882, 10, 1, 9167, 0},
+    {0x686c0000, 874, 2, 1, 9167, 1},
+    {0x686d0000, 1711, 2, 1, 9168, 1},
+    {0x686f626f, 39150, 5, 1, 9169, 0},
+    {0x686f6600, 29549, 3, 1, 9169, 0},
+    {0x686f6b6b, 25231, 8, 1, 9169, 0},
+    {0x686f6c00, 5536, 3, 1, 9169, 0},
+    {0x686f6c65, 41314, 4, 1, 9169, 0},
+    {0x686f6c6d, 13479, 11, 1, 9169, 0},
+    {0x686f6c74, 25247, 8, 1, 9169, 0},
+    {0x686f6e65, 25279, 8, 1, 9169, 0},
+    {0x686f7264, 20704, 9, 0, 9169, 1},
+    {0x686f726e, 20713, 9, 1, 9170, 0},
+    {0x686f7274, 35423, 6, 1, 9170, 0},
+    {0x686f7961, 25319, 8, 1, 9170, 0},
+    {0x686f796c, 20731, 9, 1, 9170, 0},
+    {0x68757264, 35441, 6, 1, 9170, 0},
+    {0x68757275, 39175, 5, 1, 9170, 0},
+    {0x6876616c, 35447, 6, 1, 9170, 0},
+    {0x68796c6c, 20740, 9, 1, 9170, 0},
+    {0x69626573, 31239, 7, 1, 9170, 0},
+    {0x69647265, 35459, 6, 1, 9170, 0},
+    {0x696e6465, 31316, 7, 1, 9170, 0},
+    {0x6976656c, 31421, 7, 1, 9170, 0},
+    {0x69766775, 41350, 4, 1, 9170, 0},
+    {0x6a616e2d, 20911, 9, 1, 9170, 1},
+    {0x6a657373, 25495, 8, 1, 9171, 0},
+    {0x6a65766e, 25503, 8, 1, 9171, 0},
+    {0x6a6f6c73, 31484, 7, 1, 9171, 0},
+    {0x6a6f6e64, 21695, 6, 1, 9171, 0},
+    {0x6a6f7270, 20974, 9, 1, 9171, 0},
+    {0x6b61666a, 31505, 7, 1, 9171, 0},
+    {0x6b617261, 17122, 10, 1, 9171, 0},
+    {0x6b617261, 25719, 8, 1, 9171, 0},
+    {0x6b61726c, 31582, 7, 1, 9171, 0},
+    {0x6b61726d, 35675, 6, 1, 9171, 0},
+    {0x6b617574, 17152, 10, 1, 9171, 0},
+    {0x6b69726b, 25863, 8, 1, 9171, 0},
+    {0x6b6c6162, 39350, 5, 1, 9171, 0},
+    {0x6b6c6570, 39355, 5, 1, 9171, 0},
+    {0x6b6f6d6d, 31750, 7, 1, 9171, 0},
+    {0x6b6f6e67, 21217, 9, 1, 9171, 0},
+    {0x6b6f6e67, 13732, 11, 1, 9171, 0},
+    {0x6b6f7065, 25983, 8, 1, 9171, 0},
+    {0x6b726161, 21244, 9, 1, 9171, 0},
+    {0x6b726167, 31785, 7, 1, 9171, 0},
+    {0x6b726973, 10639, 12, 1, 9171, 0},
+    {0x6b726973, 10651, 12, 1, 9171, 0},
+    {0x6b726f64, 17272, 10, 1, 9171, 0},
+    {0x6b726f6b, 10663, 12, 1, 9171, 0},
+    {0x6b766166, 26159, 8, 1, 9171, 0},
+    {0x6b76616c, 26167, 8, 1, 9171, 0},
+    {0x6b76616d, 41462, 4, 1, 9171, 0},
+    {0x6b76616e, 21316, 9, 1, 9171, 0},
+    {0x6b76696e, 21325, 9, 1, 9171, 0},
+    {0x6b76696e, 17292, 10, 1, 9171, 0},
+    {0x6b766974, 21334, 9, 1, 9171, 0},
+    {0x6b766974, 31834, 7, 1, 9171, 0},
+    {0x6c61616b, 10687, 12, 1, 9171, 0},
+    {0x6c616870, 35915, 6, 1, 9171, 0},
+    {0x6c616e67, 26191, 8, 1, 9171, 0},
+    {0x6c617264, 35939, 6, 1, 9171, 0},
+    {0x6c617276, 35945, 6, 1, 9171, 0},
+    {0x6c617661, 31904, 7, 1, 9171, 0},
+    {0x6c617661, 26207, 8, 1, 9171, 0},
+    {0x6c65616e, 13765, 11, 1, 9171, 0},
+    {0x6c656265, 31918, 7, 1, 9171, 0},
+    {0x6c65696b, 21397, 9, 1, 9171, 0},
+    {0x6c656972, 21406, 9, 1, 9171, 0},
+    {0x6c656972, 31939, 7, 1, 9171, 0},
+    {0x6c656b61, 20079, 4, 1, 9171, 0},
+    {0x6c656b73, 31946, 7, 1, 9171, 0},
+    {0x6c656e76, 35981, 6, 1, 9171, 0},
+    {0x6c657264, 35987, 6, 1, 9171, 0},
+    {0x6c65736a, 39500, 5, 1, 9171, 0},
+    {0x6c657661, 26223, 8, 1, 9171, 0},
+    {0x6c696572, 35993, 4, 1, 9171, 0},
+    {0x6c696572, 35993, 6, 1, 9171, 0},
+    {0x6c696c6c, 13787, 11, 1, 9171, 0},
+    {0x6c696c6c, 21433, 9, 1, 9171, 0},
+    {0x6c696e64, 35999, 6, 1, 9171, 0},
+    {0x6c696e64, 21451, 9, 1, 9171, 0},
+    {0x6c6f6162, 36005, 6, 1, 9171, 0},
+    {0x6c6f6469, 26247, 8, 1, 9171, 0},
+    {0x6c6f6d00, 17640, 3, 1, 9171, 0},
+    {0x6c6f7070, 39545, 5, 1, 9171, 0},
+    {0x6c6f7265, 21514, 9, 1, 9171, 0},
+    {0x6c6f7465, 39550, 5, 1, 9171, 0},
+    {0x6c756e64, 26295, 4, 1, 9171, 0},
+    {0x6c756e6e, 36053, 6, 1, 9171, 0},
+    {0x6c75726f, 39575, 5, 1, 9171, 0},
+    {0x6c757374, 4881, 6, 1, 9171, 0},
+    {0x6c796e67, 32030, 7, 1, 9171, 0},
+    {0x6c796e67, 36071, 6, 1, 9171, 0},
+    {0x6d616c61, 13820, 11, 1, 9171, 0},
+    {0x6d616c73, 32065, 7, 1, 9171, 0},
+    {0x6d616c76, 36107, 6, 1, 9171, 0},
+    {0x6d616e64, 36119, 6, 1, 9171, 0},
+    {0x6d61726b, 36137, 6, 1, 9171, 0},
+    {0x6d61726e, 21532, 9, 1, 9171, 0},
+    {0x6d617366, 17482, 10, 1, 9171, 0},
+    {0x6d61736f, 39605, 5, 1, 9171, 0},
+    {0x6d617474, 8519, 13, 1, 9171, 0},
+    {0x6d656c61, 16886, 6, 1, 9171, 0},
+    {0x6d656c64, 36191, 6, 1, 9171, 0},
+    {0x6d656c68, 36197, 6, 1, 9171, 0},
+    {0x6d656c6f, 39625, 5, 1, 9171, 0},
+    {0x6d657261, 32163, 7, 1, 9171, 0},
+    {0x6d696473, 32177, 7, 1, 9171, 0},
+    {0x6d696474, 6737, 14, 1, 9171, 0},
+    {0x6d696c00, 6019, 3, 1, 9171, 0},
+    {0x6d6a6f6e, 21694, 9, 1, 9171, 0},
+    {0x6d6f2d69, 21703, 9, 1, 9171, 0},
+    {0x6d6f6172, 32212, 7, 1, 9171, 0},
+    {0x6d6f6461, 32219, 7, 1, 9171, 0},
+    {0x6d6f6475, 39655, 5, 1, 9171, 0},
+    {0x6d6f6c64, 39660, 5, 1, 9171, 0},
+    {0x6d6f7265, 5097, 15, 0, 9171, 2},
+    {0x6d6f736a, 32240, 7, 1, 9173, 0},
+    {0x6d6f736b, 26647, 8, 1, 9173, 0},
+    {0x6d6f7373, 41554, 4, 1, 9173, 0},
+    {0x6d6f7376, 36437, 6, 1, 9173, 0},
+    {0x6d720000, 569, 2, 1, 9173, 1},
+    {0x6d756f73, 36467, 6, 1, 9174, 0},
+    {0x6d757365, 1121, 6, 1, 9174, 0},
+    {0x6d797370, 10819, 12, 1, 9174, 0},
+    {0x6e61616d, 6765, 14, 1, 9174, 0},
+    {0x6e616d64, 17712, 10, 1, 9174, 0},
+    {0x6e616d73, 36569, 6, 1, 9174, 0},
+    {0x6e616d73, 17732, 10, 1, 9174, 0},
+    {0x6e616e6e, 21856, 9, 1, 9174, 0},
+    {0x6e61726f, 39760, 5, 1, 9174, 0},
+    {0x6e617276, 26879, 8, 1, 9174, 0},
+    {0x6e617276, 36599, 6, 1, 9174, 0},
+    {0x6e617573, 26895, 8, 1, 9174, 0},
+    {0x6e617675, 26903, 8, 1, 9174, 0},
+    {0x6e656472, 13985, 11, 1, 9174, 0},
+    {0x6e65736e, 39780, 5, 1, 9174, 0},
+    {0x6e65736f, 26927, 8, 1, 9174, 0},
+    {0x6e65736f, 10867, 12, 1, 9174, 0},
+    {0x6e657373, 32366, 7, 1, 9174, 0},
+    {0x6e657373, 36629, 6, 1, 9174, 0},
+    {0x6e697373, 26991, 8, 1, 9174, 0},
+    {0x6e697474, 26999, 8, 1, 9174, 0},
+    {0x6e6c0000, 5838, 2, 1, 9174, 1},
+    {0x6e6f7264, 14029, 11, 1, 9175, 0},
+    {0x6e6f7264, 21973, 9, 1, 9175, 0},
+    {0x6e6f7264, 21982, 9, 1, 9175, 0},
+    {0x6e6f7264, 32485, 7, 1, 9175, 0},
+    {0x6e6f7264, 27023, 8, 1, 9175, 0},
+    {0x6e6f7264, 27031, 8, 0, 9175, 4},
+    {0x6e6f7264, 14040, 11, 1, 9179, 0},
+    {0x6e6f7264, 21991, 9, 1, 9179, 0},
+    {0x6e6f7265, 8636, 13, 1, 9179, 0},
+    {0x6e6f746f, 27063, 8, 1, 9179, 0},
+    {0x6e6f7474, 27079, 8, 1, 9179, 0},
+    {0x6e740000, 50, 2, 1, 9179, 1},
+    {0x6f646461, 41634, 4, 1, 9180, 0},
+    {0x6f660000, 1015, 2, 1, 9180, 1},
+    {0x6f6b736e, 36773, 6, 1, 9181, 0},
+    {0x6f6c0000, 214, 2, 1, 9181, 1},
+    {0x6f6d6173, 17822, 10, 1, 9182, 0},
+    {0x6f707064, 36827, 6, 1, 9182, 0},
+    {0x6f707065, 27175, 8, 1, 9182, 0},
+    {0x6f726b61, 27191, 8, 1, 9182, 0},
+    {0x6f726b64, 36839, 6, 1, 9182, 0},
+    {0x6f726c61, 36845, 6, 1, 9182, 0},
+    {0x6f72736b, 36851, 6, 1, 9182, 0},
+    {0x6f727374, 18469, 5, 1, 9182, 0},
+    {0x6f73656e, 29861, 4, 1, 9182, 0},
+    {0x6f736c6f, 41654, 4, 1, 9182, 1},
+    {0x6f736f79, 36863, 6, 1, 9183, 0},
+    {0x6f737465, 32688, 7, 1, 9183, 0},
+    {0x6f737466, 32695, 7, 0, 9183, 1},
+    {0x6f737472, 14139, 11, 1, 9184, 0},
+    {0x6f766572, 22081, 9, 1, 9184, 0},
+    {0x6f767265, 17892, 10, 1, 9184, 0},
+    {0x6f796572, 41662, 4, 1, 9184, 0},
+    {0x6f796761, 27207, 8, 1, 9184, 0},
+    {0x6f797374, 8701, 13, 1, 9184, 0},
+    {0x706f7273, 22189, 9, 1, 9184, 0},
+    {0x706f7273, 27343, 8, 1, 9184, 0},
+    {0x706f7273, 22198, 9, 1, 9184, 0},
+    {0x70726976, 220, 4, 1, 9184, 0},
+    {0x72616465, 7945, 4, 1, 9184, 0},
+    {0x7261646f, 40135, 5, 1, 9184, 0},
+    {0x7261686b, 14304, 11, 1, 9184, 0},
+    {0x7261686f, 37067, 6, 1, 9184, 0},
+    {0x72616973, 33021, 5, 1, 9184, 0},
+    {0x72616b6b, 22225, 9, 1, 9184, 0},
+    {0x72616c69, 27439, 8, 1, 9184, 0},
+    {0x72616e61, 3818, 4, 1, 9184, 0},
+    {0x72616e64, 22234, 9, 1, 9184, 0},
+    {0x7261756d, 40140, 5, 1, 9184, 0},
+    {0x72656e64, 27487, 8, 1, 9184, 0},
+    {0x72656e6e, 32905, 7, 1, 9184, 0},
+    {0x72656e6e, 27495, 8, 1, 9184, 0},
+    {0x72696e64, 37121, 6, 1, 9184, 0},
+    {0x72696e67, 32961, 7, 1, 9184, 0},
+    {0x72696e67, 22279, 9, 1, 9184, 0},
+    {0x72696e67, 22288, 9, 1, 9184, 0},
+    {0x7269736f, 40170, 5, 1, 9184, 0},
+    {0x72697373, 40175, 5, 1, 9184, 0},
+    {0x726c0000, 640, 2, 1, 9184, 1},
+    {0x726f616e, 28504, 4, 1, 9185, 0},
+    {0x726f646f, 40200, 5, 1, 9185, 0},
+    {0x726f6c6c, 37139, 6, 1, 9185, 0},
+    {0x726f6d73, 37860, 5, 1, 9185, 0},
+    {0x726f6d73, 32975, 7, 1, 9185, 0},
+    {0x726f726f, 40205, 5, 1, 9185, 0},
+    {0x726f7374, 22759, 4, 1, 9185, 0},
+    {0x726f796b, 37151, 6, 1, 9185, 0},
+    {0x726f7972, 32982, 7, 1, 9185, 0},
+    {0x72756f76, 37157, 6, 1, 9185, 0},
+    {0x72796767, 40220, 5, 1, 9185, 0},
+    {0x73616c61, 27559, 8, 1, 9185, 0},
+    {0x73616c61, 24658, 5, 1, 9185, 0},
+    {0x73616c74, 33031, 7, 1, 9185, 0},
+    {0x73616d6e, 22324, 9, 1, 9185, 0},
+    {0x73616e64, 18132, 10, 1, 9185, 0},
+    {0x73616e64, 1806, 7, 1, 9185, 0},
+    {0x73616e64, 11251, 12, 1, 9185, 0},
+    {0x73616e64, 37217, 6, 1, 9185, 0},
+    {0x73617270, 22351, 9, 1, 9185, 0},
+    {0x73617564, 40300, 5, 1, 9185, 0},
+    {0x73617568, 27655, 8, 1, 9185, 0},
+    {0x73656c00, 3451, 3, 1, 9185, 0},
+    {0x73656c62, 40325, 5, 1, 9185, 0},
+    {0x73656c6a, 40330, 5, 1, 9185, 0},
+    {0x73656c6a, 33129, 7, 1, 9185, 0},
+    {0x73660000, 4082, 2, 1, 9185, 1},
+    {0x7369656c, 33248, 7, 1, 9186, 0},
+    {0x73696764, 37379, 6, 1, 9186, 0},
+    {0x73696c6a, 37385, 6, 1, 9186, 0},
+    {0x73697264, 37391, 6, 1, 9186, 0},
+    {0x736b616e, 37397, 6, 1, 9186, 0},
+    {0x736b616e, 27895, 8, 1, 9186, 0},
+    {0x736b6175, 40375, 5, 1, 9186, 0},
+    {0x736b6564, 8896, 7, 1, 9186, 0},
+    {0x736b6564, 8896, 13, 1, 9186, 0},
+    {0x736b6900, 6680, 3, 1, 9186, 0},
+    {0x736b6965, 40380, 5, 1, 9186, 0},
+    {0x736b6965, 33269, 7, 1, 9186, 0},
+    {0x736b6970, 27903, 8, 1, 9186, 0},
+    {0x736b6a61, 40385, 5, 1, 9186, 0},
+    {0x736b6a65, 27911, 8, 1, 9186, 0},
+    {0x736b6f64, 37403, 6, 1, 9186, 0},
+    {0x736c6174, 33283, 7, 1, 9186, 0},
+    {0x736d6f6c, 40415, 5, 1, 9186, 0},
+    {0x736e6161, 37415, 6, 1, 9186, 0},
+    {0x736e6173, 40420, 5, 1, 9186, 0},
+    {0x736e696c, 18362, 10, 1, 9186, 0},
+    {0x736e6f61, 37421, 6, 1, 9186, 0},
+    {0x736f676e, 33297, 7, 1, 9186, 0},
+    {0x736f676e, 40435, 5, 1, 9186, 0},
+    {0x736f6b6e, 33304, 7, 1, 9186, 0},
+    {0x736f6c61, 40440, 4, 1, 9186, 0},
+    {0x736f6c75, 37433, 6, 1, 9186, 0},
+    {0x736f6d6e, 40445, 5, 1, 9186, 0},
+    {0x736f6e64, 14502, 11, 1, 9186, 0},
+    {0x736f6e67, 22702, 9, 1, 9186, 0},
+    {0x736f722d, 18372, 10, 1, 9186, 0},
+    {0x736f722d, 27943, 8, 1, 9186, 0},
+    {0x736f722d, 27951, 8, 1, 9186, 0},
+    {0x736f722d, 11371, 12, 1, 9186, 0},
+    {0x736f7266, 33325, 7, 1, 9186, 0},
+    {0x736f7272, 27967, 8, 1, 9186, 0},
+    {0x736f7274, 27975, 8, 1, 9186, 0},
+    {0x736f7275, 40455, 5, 1, 9186, 0},
+    {0x73706a65, 18382, 10, 1, 9186, 0},
+    {0x73707964, 22738, 9, 1, 9186, 0},
+    {0x73740000, 53, 2, 1, 9186, 1},
+    {0x7374616e, 37445, 6, 1, 9187, 0},
+    {0x73746174, 1240, 4, 1, 9187, 0},
+    {0x73746174, 22783, 9, 1, 9187, 0},
+    {0x73746176, 22792, 9, 1, 9187, 0},
+    {0x73746176, 33353, 7, 1, 9187, 0},
+    {0x73746569, 33360, 7, 1, 9187, 0},
+    {0x73746569, 22801, 9, 1, 9187, 0},
+    {0x73746a6f, 5277, 8, 1, 9187, 0},
+    {0x73746a6f, 5277, 15, 1, 9187, 0},
+    {0x73746f6b, 37463, 6, 1, 9187, 0},
+    {0x73746f72, 14524, 11, 1, 9187, 0},
+    {0x73746f72, 33374, 5, 1, 9187, 0},
+    {0x73746f72, 33374, 7, 1, 9187, 0},
+    {0x73746f72, 22828, 9, 1, 9187, 0},
+    {0x73747261, 13484, 6, 1, 9187, 0},
+    {0x73747261, 33381, 7, 1, 9187, 0},
+    {0x73747279, 40485, 5, 1, 9187, 0},
+    {0x73756c61, 20032, 4, 1, 9187, 0},
+    {0x73756c64, 37499, 6, 1, 9187, 0},
+    {0x73756e64, 2337, 4, 1, 9187, 0},
+    {0x73756e6e, 33388, 7, 1, 9187, 0},
+    {0x7375726e, 28079, 8, 1, 9187, 0},
+    {0x7376616c, 28087, 8, 1, 9187, 1},
+    {0x73766569, 40510, 5, 1, 9188, 0},
+    {0x7376656c, 33416, 7, 1, 9188, 0},
+    {0x73796b6b, 22864, 9, 1, 9188, 0},
+    {0x74616e61, 6683, 4, 1, 9188, 0},
+    {0x74616e61, 28303, 8, 1, 9188, 0},
+    {0x74656c65, 28343, 8, 0, 9188, 2},
+    {0x74696d65, 5991, 4, 1, 9190, 0},
+    {0x74696e67, 28375, 8, 1, 9190, 0},
+    {0x74696e6e, 41850, 4, 1, 9190, 0},
+    {0x746a656c, 22963, 9, 1, 9190, 0},
+    {0x746a6f6d, 40595, 5, 1, 9190, 0},
+    {0x746d0000, 2797, 2, 1, 9190, 1},
+    {0x746f6b6b, 37464, 5, 1, 9191, 0},
+    {0x746f6c67, 40625, 5, 1, 9191, 0},
+    {0x746f6e73, 28431, 8, 1, 9191, 0},
+    {0x746f7273, 33598, 7, 1, 9191, 0},
+    {0x74720000, 199, 2, 1, 9191, 1},
+    {0x7472616e, 40650, 5, 1, 9192, 0},
+    {0x7472616e, 37835, 6, 1, 9192, 0},
+    {0x7472616e, 37841, 6, 1, 9192, 0},
+    {0x74726f61, 28503, 8, 1, 9192, 0},
+    {0x74726f67, 28511, 8, 1, 9192, 0},
+    {0x74726f6d, 37859, 6, 1, 9192, 0},
+    {0x74726f6d, 37865, 6, 1, 9192, 0},
+    {0x74726f6e, 23053, 9, 1, 9192, 0},
+    {0x74727973, 37871, 6, 1, 9192, 0},
+    {0x74766564, 14656, 11, 1, 9192, 0},
+    {0x74796461, 40680, 5, 1, 9192, 0},
+    {0x74796e73, 37901, 6, 1, 9192, 0},
+    {0x74797366, 28559, 8, 1, 9192, 0},
+    {0x7479736e, 37907, 6, 1, 9192, 0},
+    {0x74797376, 37913, 6, 1, 9192, 0},
+    {0x756c6c65, 18582, 10, 1, 9192, 0},
+    {0x756c6c65, 18592, 10, 1, 9192, 0},
+    {0x756c7669, 40705, 5, 1, 9192, 0},
+    {0x756e6a61, 33794, 7, 1, 9192, 0},
+    {0x75747369, 37967, 6, 1, 9192, 0},
+    {0x76610000, 114, 2, 1, 9192, 1},
+    {0x76616170, 33836, 7, 1, 9193, 0},
+    {0x76616473, 40765, 5, 1, 9193, 0},
+    {0x76616761, 40770, 4, 1, 9193, 0},
+    {0x76616761, 40770, 5, 1, 9193, 0},
+    {0x76616773, 37979, 6, 1, 9193, 0},
+    {0x76616b73, 33843, 7, 1, 9193, 0},
+    {0x76616c6c, 950, 5, 1, 9193, 0},
+    {0x76616e67, 14760, 4, 1, 9193, 0},
+    {0x76616e79, 28663, 8, 1, 9193, 0},
+    {0x76617264, 40775, 5, 1, 9193, 0},
+    {0x76617267, 33850, 7, 1, 9193, 0},
+    {0x7661726f, 40780, 5, 1, 9193, 0},
+    {0x76656673, 40785, 5, 1, 9193, 0},
+    {0x76656761, 22435, 4, 1, 9193, 0},
+    {0x76656761, 23179, 9, 1, 9193, 0},
+    {0x76656e6e, 28679, 8, 1, 9193, 0},
+    {0x76657264, 38015, 6, 1, 9193, 0},
+    {0x76657272, 38027, 6, 1, 9193, 0},
+    {0x76657374, 38039, 6, 1, 9193, 0},
+    {0x76657374, 28719, 8, 0, 9193, 1},
+    {0x76657374, 33857, 7, 1, 9194, 0},
+    {0x76657374, 9052, 13, 1, 9194, 0},
+    {0x76657374, 11611, 12, 1, 9194, 0},
+    {0x76657374, 23188, 9, 1, 9194, 0},
+    {0x76657665, 23197, 9, 1, 9194, 0},
+    {0x76660000, 5612, 2, 1, 9194, 1},
+    {0x76677300, 7623, 3, 1, 9195, 0},
+    {0x76696b00, 5221, 3, 1, 9195, 0},
+    {0x76696b6e, 36602, 5, 1, 9195, 0},
+    {0x76696e64, 18682, 10, 1, 9195, 0},
+    {0x766f6167, 38069, 6, 1, 9195, 0},
+    {0x766f6c64, 40805, 5, 1, 9195, 0},
+    {0x766f7373, 14755, 4, 1, 9195, 0},
+    {0x766f7373, 14755, 11, 1, 9195, 0},
+    {0x786e2d2d, 11815, 12, 1, 9195, 0},
+    {0x786e2d2d, 11827, 12, 1, 9195, 0},
+    {0x786e2d2d, 862, 21, 1, 9195, 0},
+    {0x786e2d2d, 9182, 13, 1, 9195, 0},
+    {0x786e2d2d, 5472, 15, 1, 9195, 0},
+    {0x786e2d2d, 2292, 18, 1, 9195, 0},
+    {0x786e2d2d, 5487, 15, 1, 9195, 0},
+    {0x786e2d2d, 2310, 18, 1, 9195, 0},
+    {0x786e2d2d, 1612, 19, 1, 9195, 0},
+    {0x786e2d2d, 9195, 13, 1, 9195, 0},
+    {0x786e2d2d, 9208, 13, 1, 9195, 0},
+    {0x786e2d2d, 7129, 14, 1, 9195, 0},
+    {0x786e2d2d, 7143, 14, 1, 9195, 0},
+    {0x786e2d2d, 11839, 12, 1, 9195, 0},
+    {0x786e2d2d, 11851, 12, 1, 9195, 0},
+    {0x786e2d2d, 15063, 11, 1, 9195, 0},
+    {0x786e2d2d, 7157, 14, 1, 9195, 0},
+    {0x786e2d2d, 2328, 18, 1, 9195, 0},
+    {0x786e2d2d, 11863, 12, 1, 9195, 0},
+    {0x786e2d2d, 4076, 16, 1, 9195, 0},
+    {0x786e2d2d, 2364, 18, 1, 9195, 0},
+    {0x786e2d2d, 11875, 12, 1, 9195, 0},
+    {0x786e2d2d, 9234, 13, 1, 9195, 0},
+    {0x786e2d2d, 11887, 12, 1, 9195, 0},
+    {0x786e2d2d, 3121, 17, 1, 9195, 0},
+    {0x786e2d2d, 9260, 13, 1, 9195, 0},
+    {0x786e2d2d, 9273, 13, 1, 9195, 0},
+    {0x786e2d2d, 19042, 10, 1, 9195, 0},
+    {0x786e2d2d, 11899, 12, 1, 9195, 0},
+    {0x786e2d2d, 11911, 12, 1, 9195, 0},
+    {0x786e2d2d, 11923, 12, 1, 9195, 0},
+    {0x786e2d2d, 11935, 12, 1, 9195, 0},
+    {0x786e2d2d, 1669, 19, 1, 9195, 0},
+    {0x786e2d2d, 4108, 16, 1, 9195, 0},
+    {0x786e2d2d, 4124, 16, 1, 9195, 0},
+    {0x786e2d2d, 9312, 13, 1, 9195, 0},
+    {0x786e2d2d, 11959, 12, 1, 9195, 0},
+    {0x786e2d2d, 23386, 9, 1, 9195, 0},
+    {0x786e2d2d, 9351, 13, 1, 9195, 0},
+    {0x786e2d2d, 1688, 19, 1, 9195, 0},
+    {0x786e2d2d, 3138, 17, 1, 9195, 0},
+    {0x786e2d2d, 1707, 19, 1, 9195, 0},
+    {0x786e2d2d, 5517, 15, 1, 9195, 0},
+    {0x786e2d2d, 11983, 12, 1, 9195, 0},
+    {0x786e2d2d, 5532, 15, 1, 9195, 0},
+    {0x786e2d2d, 9364, 13, 1, 9195, 0},
+    {0x786e2d2d, 5547, 15, 1, 9195, 0},
+    {0x786e2d2d, 4140, 16, 1, 9195, 0},
+    {0x786e2d2d, 7227, 14, 1, 9195, 0},
+    {0x786e2d2d, 7255, 14, 1, 9195, 0},
+    {0x786e2d2d, 4156, 16, 1, 9195, 0},
+    {0x786e2d2d, 9377, 13, 1, 9195, 0},
+    {0x786e2d2d, 7269, 14, 1, 9195, 0},
+    {0x786e2d2d, 11995, 12, 1, 9195, 0},
+    {0x786e2d2d, 1726, 19, 1, 9195, 0},
+    {0x786e2d2d, 7283, 14, 1, 9195, 0},
+    {0x786e2d2d, 4172, 16, 1, 9195, 0},
+    {0x786e2d2d, 3155, 17, 1, 9195, 0},
+    {0x786e2d2d, 5592, 15, 1, 9195, 0},
+    {0x786e2d2d, 1745, 19, 1, 9195, 0},
+    {0x786e2d2d, 9390, 13, 1, 9195, 0},
+    {0x786e2d2d, 5607, 15, 1, 9195, 0},
+    {0x786e2d2d, 7297, 14, 1, 9195, 0},
+    {0x786e2d2d, 4188, 16, 1, 9195, 0},
+    {0x786e2d2d, 23431, 9, 1, 9195, 0},
+    {0x786e2d2d, 4204, 16, 1, 9195, 0},
+    {0x786e2d2d, 5622, 15, 1, 9195, 0},
+    {0x786e2d2d, 5637, 15, 1, 9195, 0},
+    {0x786e2d2d, 2400, 18, 1, 9195, 0},
+    {0x786e2d2d, 7311, 14, 1, 9195, 0},
+    {0x786e2d2d, 9403, 13, 1, 9195, 0},
+    {0x786e2d2d, 9416, 13, 1, 9195, 0},
+    {0x786e2d2d, 9429, 13, 1, 9195, 0},
+    {0x786e2d2d, 9442, 13, 1, 9195, 0},
+    {0x786e2d2d, 9455, 13, 1, 9195, 0},
+    {0x786e2d2d, 4220, 16, 1, 9195, 0},
+    {0x786e2d2d, 15371, 11, 1, 9195, 0},
+    {0x786e2d2d, 12007, 12, 1, 9195, 0},
+    {0x786e2d2d, 12019, 12, 1, 9195, 0},
+    {0x786e2d2d, 12043, 12, 1, 9195, 0},
+    {0x786e2d2d, 7325, 14, 1, 9195, 0},
+    {0x786e2d2d, 4284, 16, 1, 9195, 0},
+    {0x786e2d2d, 2436, 18, 1, 9195, 0},
+    {0x786e2d2d, 15426, 11, 1, 9195, 0},
+    {0x786e2d2d, 7451, 14, 1, 9195, 0},
+    {0x786e2d2d, 7465, 14, 1, 9195, 0},
+    {0x786e2d2d, 7479, 14, 1, 9195, 0},
+    {0x786e2d2d, 15437, 11, 1, 9195, 0},
+    {0x786e2d2d, 565, 22, 0, 9195, 2},
+    {0x786e2d2d, 9468, 13, 1, 9197, 0},
+    {0x786e2d2d, 1267, 20, 1, 9197, 0},
+    {0x786e2d2d, 9481, 13, 1, 9197, 0},
+    {0x786e2d2d, 925, 21, 1, 9197, 0},
+    {0x786e2d2d, 9494, 13, 1, 9197, 0},
+    {0x786e2d2d, 5727, 15, 1, 9197, 0},
+    {0x786e2d2d, 5742, 15, 1, 9197, 0},
+    {0x786e2d2d, 5757, 15, 1, 9197, 0},
+    {0x786e2d2d, 7507, 14, 1, 9197, 0},
+    {0x786e2d2d, 9507, 13, 1, 9197, 0},
+    {0x786e2d2d, 3223, 17, 1, 9197, 0},
+    {0x786e2d2d, 12211, 12, 1, 9197, 0},
+    {0x786e2d2d, 12223, 12, 1, 9197, 0},
+    {0x786e2d2d, 15569, 11, 1, 9197, 0},
+    {0x786e2d2d, 12235, 12, 1, 9197, 0},
+    {0x786e2d2d, 5772, 15, 1, 9197, 0},
+    {0x786e2d2d, 2454, 18, 1, 9197, 0},
+    {0x786e2d2d, 9520, 13, 1, 9197, 0},
+    {0x786e2d2d, 12247, 12, 1, 9197, 0},
+    {0x786e2d2d, 12259, 12, 1, 9197, 0},
+    {0x786e2d2d, 9533, 13, 1, 9197, 0},
+    {0x786e2d2d, 5787, 15, 1, 9197, 0},
+    {0x786e2d2d, 7521, 14, 1, 9197, 0},
+    {0x786e2d2d, 12271, 12, 1, 9197, 0},
+    {0x786e2d2d, 9546, 13, 1, 9197, 0},
+    {0x786e2d2d, 15602, 11, 1, 9197, 0},
+    {0x786e2d2d, 12283, 12, 1, 9197, 0},
+    {0x786e2d2d, 9559, 13, 1, 9197, 0},
+    {0x786e2d2d, 7549, 14, 1, 9197, 0},
+    {0x786e2d2d, 23494, 9, 1, 9197, 0},
+    {0x786e2d2d, 1802, 19, 1, 9197, 0},
+    {0x786e2d2d, 9572, 13, 1, 9197, 0},
+    {0x786e2d2d, 9585, 13, 1, 9197, 0},
+    {0x786e2d2d, 12295, 12, 1, 9197, 0},
+    {0x786e2d2d, 7563, 14, 1, 9197, 0},
+    {0x786e2d2d, 5817, 15, 1, 9197, 0},
+    {0x786e2d2d, 12307, 12, 1, 9197, 0},
+    {0x786e2d2d, 9598, 13, 1, 9197, 0},
+    {0x786e2d2d, 5832, 15, 1, 9197, 0},
+    {0x786e2d2d, 12319, 12, 1, 9197, 0},
+    {0x786e2d2d, 12331, 12, 1, 9197, 0},
+    {0x786e2d2d, 12343, 12, 1, 9197, 0},
+    {0x786e2d2d, 12355, 12, 1, 9197, 0},
+    {0x786e2d2d, 9611, 13, 1, 9197, 0},
+    {0x786e2d2d, 2472, 18, 1, 9197, 0},
+    {0x786e2d2d, 12367, 12, 1, 9197, 0},
+    {0x786e2d2d, 12379, 12, 1, 9197, 0},
+    {0x786e2d2d, 3240, 17, 1, 9197, 0},
+    {0x786e2d2d, 5847, 15, 1, 9197, 0},
+    {0x786e2d2d, 5862, 15, 1, 9197, 0},
+    {0x786e2d2d, 1821, 19, 1, 9197, 0},
+    {0x786e2d2d, 7577, 14, 1, 9197, 0},
+    {0x786e2d2d, 5877, 15, 1, 9197, 0},
+    {0x786e2d2d, 12391, 12, 1, 9197, 0},
+    {0x786e2d2d, 7591, 14, 0, 9197, 1},
+    {0x786e2d2d, 5892, 15, 1, 9198, 0},
+    {0x786e2d2d, 587, 22, 1, 9198, 0},
+    {0x786e2d2d, 2490, 18, 1, 9198, 0},
+    {0x786e2d2d, 12403, 12, 1, 9198, 0},
+    {0x786e2d2d, 5907, 15, 1, 9198, 0},
+    {0x786e2d2d, 9637, 13, 1, 9198, 0},
+    {0x786e2d2d, 5922, 15, 1, 9198, 0},
+    {0x786e2d2d, 12415, 12, 1, 9198, 0},
+    {0x786e2d2d, 9650, 13, 1, 9198, 0},
+    {0x786e2d2d, 9663, 13, 1, 9198, 0},
+    {0x786e2d2d, 7605, 14, 1, 9198, 0},
+    {0x786e2d2d, 12427, 12, 1, 9198, 0},
+    {0x786e2d2d, 12439, 12, 1, 9198, 0},
+    {0x786e2d2d, 4300, 16, 1, 9198, 0},
+    {0x786e2d2d, 3257, 17, 1, 9198, 0},
+    {0x786e2d2d, 15690, 11, 1, 9198, 0},
+    {0x786e2d2d, 12451, 12, 1, 9198, 0},
+    {0x786e2d2d, 7619, 14, 1, 9198, 0},
+    {0x786e2d2d, 3274, 17, 1, 9198, 0},
+    {0x786e2d2d, 7633, 14, 1, 9198, 0},
+    {0x786e2d2d, 9676, 13, 1, 9198, 0},
+    {0x786e2d2d, 15756, 11, 1, 9198, 0},
+    {0x786e2d2d, 5937, 15, 1, 9198, 0},
+    {0x786e2d2d, 1307, 20, 1, 9198, 0},
+    {0x62697a00, 38535, 3, 1, 9198, 0},
+    {0x636f6d00, 19, 3, 1, 9198, 0},
+    {0x65647500, 9778, 3, 1, 9198, 0},
+    {0x676f7600, 810, 3, 1, 9198, 0},
+    {0x696e666f, 21606, 4, 1, 9198, 0},
+    {0x6e657400, 2944, 3, 1, 9198, 0},
+    {0x6f726700, 6352, 3, 1, 9198, 0},
+    {0x656e7465, 4632, 15, 1, 9198, 0},
+    {0x6d657273, 26471, 8, 1, 9198, 0},
+    {0x6d696e65, 6938, 4, 1, 9198, 0},
+    {0x73686163, 27767, 8, 1, 9198, 0},
+    {0x61630000, 35, 2, 1, 9198, 0},
+    {0x636f0000, 4, 2, 1, 9198, 1},
+    {0x63726900, 29909, 3, 1, 9199, 0},
+    {0x6765656b, 16732, 4, 1, 9199, 0},
+    {0x67656e00, 324, 3, 1, 9199, 0},
+    {0x676f7674, 41270, 4, 1, 9199, 0},
+    {0x6865616c, 229, 6, 1, 9199, 0},
+    {0x69776900, 30926, 3, 1, 9199, 0},
+    {0x6b697769, 41418, 4, 1, 9199, 0},
+    {0x6d616f72, 39600, 5, 1, 9199, 0},
+    {0x6d696c00, 6019, 3, 1, 9199, 0},
+    {0x6e657400, 2944, 3, 1, 9199, 0},
+    {0x6f726700, 6352, 3, 1, 9199, 0},
+    {0x7061726c, 17912, 10, 1, 9199, 0},
+    {0x7363686f, 22378, 6, 1, 9199, 0},
+    {0x786e2d2d, 12151, 12, 1, 9199, 0},
+    {0x636f0000, 4, 2, 1, 9199, 0},
+    {0x636f6d00, 19, 3, 1, 9199, 0},
+    {0x65647500, 9778, 3, 1, 9199, 0},
+    {0x676f7600, 810, 3, 1, 9199, 0},
+    {0x6d656400, 1498, 3, 1, 9199, 0},
+    {0x6d757365, 1121, 6, 1, 9199, 0},
+    {0x6e657400, 2944, 3, 1, 9199, 0},
+    {0x6f726700, 6352, 3, 1, 9199, 0},
+    {0x70726f00, 5042, 3, 1, 9199, 0},
+    {0x686f6d65, 25255, 8, 1, 9199, 0},
+    {0x6f6e7265, 18060, 5, 1, 9199, 1},
+    {0x73657276, 27735, 7, 1, 9200, 0},
+    {0x62617273, 12676, 5, 1, 9200, 0},
+    {0x6565726f, 16552, 4, 1, 9200, 0},
+    {0x6565726f, 16552, 10, 1, 9200, 0},
+    {0x74656368, 13594, 4, 1, 9200, 0},
+    {0x61636365, 19381, 9, 1, 9200, 0},
+    {0x61650000, 26, 2, 1, 9200, 0},
+    {0x616c7465, 15922, 10, 1, 9200, 0},
+    {0x616d756e, 38385, 5, 0, 9200, 1},
+    {0x62617273, 12676, 5, 1, 9201, 0},
+    {0x626c6f67, 29447, 7, 1, 9201, 0},
+    {0x626c6f67, 23959, 8, 1, 9201, 0},
+    {0x626d6f61, 6121, 14, 1, 9201, 0},
+    {0x626f6c64, 1896, 18, 1, 9201, 0},
+    {0x6361626c, 12819, 11, 1, 9201, 0},
+    {0x63616d64, 34553, 6, 1, 9201, 0},
+    {0x63646e37, 9883, 5, 0, 9201, 2},
+    {0x63646e37, 9883, 12, 0, 9203, 1},
+    {0x63657274, 29636, 7, 1, 9204, 0},
+    {0x636c6f75, 29776, 7, 1, 9204, 0},
+    {0x636f6c6c, 16342, 10, 1, 9204, 0},
+    {0x636f7563, 3436, 16, 1, 9204, 0},
+    {0x64646e73, 38720, 5, 1, 9204, 0},
+    {0x6469736b, 1236, 11, 1, 9204, 0},
+    {0x646e7361, 24487, 8, 1, 9204, 0},
+    {0x646e7364, 29986, 7, 1, 9204, 0},
+    {0x646f6573, 13028, 11, 1, 9204, 0},
+    {0x646f6e74, 20083, 9, 1, 9204, 0},
+    {0x646f6f6d, 30021, 7, 1, 9204, 0},
+    {0x64736d79, 30042, 7, 1, 9204, 0},
+    {0x6475636b, 30049, 7, 1, 9204, 0},
+    {0x64767264, 34853, 6, 1, 9204, 0},
+    {0x64796e61, 24543, 8, 1, 9204, 0},
+    {0x64796e64, 6317, 6, 1, 9204, 2},
+    {0x64796e73, 30070, 7, 1, 9206, 0},
+    {0x656e646f, 8038, 13, 1, 9206, 0},
+    {0x656e646f, 3468, 16, 1, 9206, 0},
+    {0x65750000, 766, 2, 1, 9206, 55},
+    {0x66616d69, 24679, 8, 1, 9261, 0},
+    {0x6665646f, 3516, 16, 1, 9261, 0},
+    {0x6665646f, 10051, 12, 1, 9261, 0},
+    {0x6665646f, 8103, 13, 0, 9261, 3},
+    {0x66726565, 24411, 8, 1, 9264, 0},
+    {0x66726565, 13325, 11, 1, 9264, 0},
+    {0x66726f6d, 30567, 7, 1, 9264, 0},
+    {0x67616d65, 20434, 9, 1, 9264, 0},
+    {0x676f7464, 35177, 6, 1, 9264, 0},
+    {0x68657066, 25151, 8, 1, 9264, 0},
+    {0x686b0000, 1753, 2, 1, 9264, 0},
+    {0x686f6262, 16892, 10, 1, 9264, 0},
+    {0x686f6d65, 31183, 7, 1, 9264, 0},
+    {0x686f6d65, 31190, 7, 1, 9264, 0},
+    {0x686f6d65, 20677, 9, 1, 9264, 0},
+    {0x686f6d65, 25263, 8, 1, 9264, 0},
+    {0x686f7074, 39165, 5, 1, 9264, 0},
+    {0x68747470, 31218, 7, 1, 9264, 0},
+    {0x696e2d64, 35507, 6, 1, 9264, 0},
+    {0x696e2d76, 35513, 6, 1, 9264, 0},
+    {0x69732d61, 6555, 14, 1, 9264, 0},
+    {0x69732d61, 6583, 14, 1, 9264, 0},
+    {0x69732d61, 4917, 15, 1, 9264, 0},
+    {0x69732d61, 20812, 9, 1, 9264, 0},
+    {0x69732d61, 20821, 9, 1, 9264, 0},
+    {0x69732d61, 13545, 11, 1, 9264, 0},
+    {0x69732d61, 4947, 15, 1, 9264, 0},
+    {0x69732d61, 10411, 12, 1, 9264, 0},
+    {0x69732d61, 13578, 11, 1, 9264, 0},
+    {0x69732d66, 25391, 8, 1, 9264, 0},
+    {0x69732d6c, 31351, 7, 1, 9264, 0},
+    {0x69732d73, 25399, 8, 1, 9264, 0},
+    {0x69732d76, 13622, 11, 1, 9264, 0},
+    {0x69732d76, 10483, 12, 1, 9264, 0},
+    {0x69732d76, 10495, 12, 1, 9264, 0},
+    {0x69732d76, 10507, 12, 1, 9264, 0},
+    {0x69732d76, 8389, 13, 1, 9264, 0},
+    {0x6973612d, 25415, 8, 1, 9264, 0},
+    {0x6a730000, 14563, 2, 1, 9264, 0},
+    {0x6b69636b, 21136, 9, 1, 9264, 0},
+    {0x6d617966, 26415, 8, 1, 9264, 0},
+    {0x6d697363, 13919, 11, 1, 9264, 0},
+    {0x6d6c6266, 36377, 6, 1, 9264, 0},
+    {0x6d6f7a69, 13941, 11, 1, 9264, 0},
+    {0x6d792d66, 13952, 11, 1, 9264, 0},
+    {0x6d796669, 17662, 10, 1, 9264, 0},
+    {0x6d796674, 39680, 5, 1, 9264, 0},
+    {0x6d797365, 3804, 16, 1, 9264, 0},
+    {0x6d797769, 36521, 6, 1, 9264, 0},
+    {0x6e666c66, 36635, 6, 1, 9264, 0},
+    {0x6e6f2d69, 39820, 5, 1, 9264, 0},
+    {0x6e6f772d, 32506, 7, 1, 9264, 0},
+    {0x70696d69, 27287, 8, 1, 9264, 0},
+    {0x706f647a, 32800, 7, 1, 9264, 0},
+    {0x706f6976, 32814, 7, 1, 9264, 0},
+    {0x706f7461, 32842, 7, 1, 9264, 0},
+    {0x70756274, 37019, 6, 1, 9264, 0},
+    {0x72656164, 18022, 10, 1, 9264, 0},
+    {0x72656164, 18032, 10, 1, 9264, 0},
+    {0x73656c66, 37283, 6, 1, 9264, 0},
+    {0x73656c6c, 8818, 13, 1, 9264, 0},
+    {0x73657276, 27695, 8, 1, 9264, 0},
+    {0x73657276, 27703, 8, 1, 9264, 0},
+    {0x73657276, 22432, 9, 1, 9264, 0},
+    {0x736d616c, 22675, 9, 1, 9264, 0},
+    {0x7370646e, 40465, 5, 1, 9264, 0},
+    {0x73747566, 11443, 12, 1, 9264, 0},
+    {0x73776565, 14546, 11, 1, 9264, 0},
+    {0x7465636b, 33479, 7, 0, 9264, 1},
+    {0x746f6f6c, 23035, 9, 1, 9265, 0},
+    {0x74756e6b, 41886, 4, 1, 9265, 0},
+    {0x74757866, 23098, 9, 1, 9265, 0},
+    {0x74776d61, 37895, 6, 1, 9265, 0},
+    {0x75666366, 37919, 6, 1, 9265, 0},
+    {0x75730000, 767, 2, 1, 9265, 0},
+    {0x77656268, 38147, 6, 1, 9265, 0},
+    {0x77656272, 14766, 11, 1, 9265, 0},
+    {0x776d636c, 34018, 7, 1, 9265, 0},
+    {0x776d666c, 34025, 7, 1, 9265, 0},
+    {0x7a610000, 739, 2, 1, 9265, 0},
+    {0x7a617074, 40915, 5, 1, 9265, 0},
+    {0x6e657264, 32359, 7, 1, 9265, 0},
+    {0x61626f00, 16068, 3, 1, 9265, 0},
+    {0x61630000, 35, 2, 1, 9265, 0},
+    {0x636f6d00, 19, 3, 1, 9265, 0},
+    {0x65647500, 9778, 3, 1, 9265, 0},
+    {0x676f6200, 38533, 3, 1, 9265, 0},
+    {0x696e6700, 984, 3, 1, 9265, 0},
+    {0x6d656400, 1498, 3, 1, 9265, 0},
+    {0x6e657400, 2944, 3, 1, 9265, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9265, 0},
+    {0x6f726700, 6352, 3, 1, 9265, 0},
+    {0x736c6400, 42366, 3, 1, 9265, 0},
+    {0x636f6465, 24295, 8, 1, 9265, 0},
+    {0x686c7800, 41310, 3, 1, 9265, 0},
+    {0x686c7833, 41310, 4, 1, 9265, 0},
+    {0x6d61676e, 36095, 6, 1, 9265, 0},
+    {0x70646e73, 40466, 4, 1, 9265, 0},
+    {0x706c6573, 32786, 5, 1, 9265, 0},
+    {0x70727663, 40105, 5, 1, 9265, 0},
+    {0x726f636b, 40190, 5, 1, 9265, 0},
+    {0x7472616e, 18562, 10, 1, 9265, 0},
+    {0x79626f00, 34522, 3, 1, 9265, 0},
+    {0x626c6f67, 23967, 8, 1, 9265, 0},
+    {0x636f6d00, 19, 3, 1, 9265, 0},
+    {0x65647500, 9778, 3, 1, 9265, 0},
+    {0x676f6200, 38533, 3, 1, 9265, 0},
+    {0x6d696c00, 6019, 3, 1, 9265, 0},
+    {0x6e657400, 2944, 3, 1, 9265, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9265, 0},
+    {0x6f726700, 6352, 3, 1, 9265, 0},
+    {0x636f6d00, 19, 3, 1, 9265, 0},
+    {0x65647500, 9778, 3, 1, 9265, 0},
+    {0x6f726700, 6352, 3, 1, 9265, 0},
+    {0x636f6d00, 19, 3, 1, 9265, 0},
+    {0x65647500, 9778, 3, 1, 9265, 0},
+    {0x676f7600, 810, 3, 1, 9265, 0},
+    {0x69000000, 9, 1, 1, 9265, 0},
+    {0x6d696c00, 6019, 3, 1, 9265, 0},
+    {0x6e657400, 2944, 3, 1, 9265, 0},
+    {0x6e676f00, 12810, 3, 1, 9265, 0},
+    {0x6f726700, 6352, 3, 1, 9265, 0},
+    {0x6672616d, 10111, 6, 1, 9265, 0},
+    {0x31333337, 40938, 4, 1, 9265, 0},
+    {0x62697a00, 38535, 3, 1, 9265, 0},
+    {0x636f6d00, 19, 3, 1, 9265, 0},
+    {0x65647500, 9778, 3, 1, 9265, 0},
+    {0x66616d00, 6017, 3, 1, 9265, 0},
+    {0x676f6200, 38533, 3, 1, 9265, 0},
+    {0x676f6b00, 35165, 3, 1, 9265, 0},
+    {0x676f6e00, 14120, 3, 1, 9265, 0},
+    {0x676f7000, 42183, 3, 1, 9265, 0},
+    {0x676f7300, 19861, 3, 1, 9265, 0},
+    {0x676f7600, 810, 3, 1, 9265, 0},
+    {0x696e666f, 21606, 4, 1, 9265, 0},
+    {0x6e657400, 2944, 3, 1, 9265, 0},
+    {0x6f726700, 6352, 3, 1, 9265, 0},
+    {0x77656200, 123, 3, 1, 9265, 0},
+    {0x6167726f, 6442, 4, 1, 9265, 0},
+    {0x61696400, 8189, 3, 1, 9265, 0},
+    {0x61727400, 3749, 3, 1, 9265, 0},
+    {0x61746d00, 8530, 3, 1, 9265, 0},
+    {0x61756775, 23823, 8, 1, 9265, 0},
+    {0x6175746f, 15982, 4, 1, 9265, 0},
+    {0x62616269, 16002, 10, 1, 9265, 0},
+    {0x6265647a, 34433, 6, 1, 9265, 0},
+    {0x62656570, 41014, 4, 1, 9265, 0},
+    {0x6265736b, 29412, 7, 1, 9265, 0},
+    {0x6269616c, 16072, 10, 1, 9265, 0},
+    {0x6269616c, 19777, 9, 1, 9265, 0},
+    {0x6269656c, 29426, 7, 1, 9265, 0},
+    {0x62696573, 16082, 10, 1, 9265, 0},
+    {0x62697a00, 38535, 3, 1, 9265, 0},
+    {0x626f6c65, 12764, 11, 1, 9265, 0},
+    {0x62796467, 19858, 9, 1, 9265, 0},
+    {0x6279746f, 38585, 5, 1, 9265, 0},
+    {0x63696573, 29734, 7, 1, 9265, 0},
+    {0x636f0000, 4, 2, 1, 9265, 0},
+    {0x636f6d00, 19, 3, 1, 9265, 0},
+    {0x637a656c, 29937, 7, 1, 9265, 0},
+    {0x637a6573, 38685, 5, 1, 9265, 0},
+    {0x646c7567, 20074, 9, 1, 9265, 0},
+    {0x65636f6d, 6359, 14, 1, 9265, 0},
+    {0x65647500, 9778, 3, 1, 9265, 0},
+    {0x656c626c, 34889, 6, 1, 9265, 0},
+    {0x656c6b00, 18385, 3, 1, 9265, 0},
+    {0x67646100, 22705, 3, 1, 9265, 0},
+    {0x6764616e, 35063, 6, 1, 9265, 0},
+    {0x6764796e, 35069, 6, 1, 9265, 0},
+    {0x676c6977, 30924, 7, 1, 9265, 0},
+    {0x676c6f67, 35147, 6, 1, 9265, 0},
+    {0x676d696e, 39025, 5, 1, 9265, 0},
+    {0x676e6965, 30938, 7, 1, 9265, 0},
+    {0x676f726c, 30973, 7, 1, 9265, 0},
+    {0x676f7600, 810, 3, 1, 9265, 47},
+    {0x6772616a, 31001, 7, 1, 9312, 0},
+    {0x67736d00, 22674, 3, 1, 9312, 0},
+    {0x686f6d65, 20695, 9, 1, 9312, 0},
+    {0x696c6177, 39210, 5, 1, 9312, 0},
+    {0x696e666f, 21606, 4, 1, 9312, 0},
+    {0x6a61776f, 25479, 8, 1, 9312, 0},
+    {0x6a656c65, 10531, 12, 1, 9312, 0},
+    {0x6a676f72, 39300, 5, 1, 9312, 0},
+    {0x6b616c69, 35633, 6, 1, 9312, 0},
+    {0x6b617270, 31589, 7, 1, 9312, 0},
+    {0x6b617274, 31596, 7, 1, 9312, 0},
+    {0x6b61737a, 31631, 7, 1, 9312, 0},
+    {0x6b61746f, 25751, 8, 1, 9312, 0},
+    {0x6b617a69, 5022, 15, 1, 9312, 0},
+    {0x6b65706e, 39335, 5, 1, 9312, 0},
+    {0x6b657472, 31652, 7, 1, 9312, 0},
+    {0x6b6c6f64, 31715, 7, 1, 9312, 0},
+    {0x6b6f6269, 17232, 10, 1, 9312, 0},
+    {0x6b6f6c6f, 21208, 9, 1, 9312, 0},
+    {0x6b6f6e69, 39385, 5, 1, 9312, 0},
+    {0x6b6f6e73, 17252, 10, 1, 9312, 0},
+    {0x6b72616b, 35849, 6, 1, 9312, 0},
+    {0x6b726173, 31792, 7, 1, 9312, 0},
+    {0x6b75746e, 39430, 5, 1, 9312, 0},
+    {0x6c617079, 41478, 4, 1, 9312, 0},
+    {0x6c65626f, 35963, 6, 1, 9312, 0},
+    {0x6c65637a, 35969, 6, 1, 9312, 0},
+    {0x6c65676e, 31932, 7, 1, 9312, 0},
+    {0x6c657a61, 31953, 7, 1, 9312, 0},
+    {0x6c696d61, 26239, 8, 1, 9312, 0},
+    {0x6c6f6d7a, 39530, 5, 1, 9312, 0},
+    {0x6c6f7769, 36041, 6, 1, 9312, 0},
+    {0x6c756261, 26287, 8, 1, 9312, 0},
+    {0x6c756269, 39560, 5, 1, 9312, 0},
+    {0x6c75626c, 36047, 6, 1, 9312, 0},
+    {0x6c756b6f, 39570, 5, 1, 9312, 0},
+    {0x6d61696c, 8148, 4, 1, 9312, 0},
+    {0x6d616c62, 32058, 7, 1, 9312, 0},
+    {0x6d616c6f, 17422, 10, 1, 9312, 0},
+    {0x6d617a6f, 26431, 8, 1, 9312, 0},
+    {0x6d617a75, 36173, 6, 1, 9312, 0},
+    {0x6d656400, 1498, 3, 1, 9312, 0},
+    {0x6d656469, 21595, 5, 1, 9312, 0},
+    {0x6d696173, 36209, 6, 1, 9312, 0},
+    {0x6d69656c, 36221, 6, 1, 9312, 0},
+    {0x6d69656c, 36227, 6, 1, 9312, 0},
+    {0x6d696c00, 6019, 3, 1, 9312, 0},
+    {0x6d726167, 32247, 7, 1, 9312, 0},
+    {0x6d797370, 10819, 12, 1, 9312, 0},
+    {0x6e616b6c, 39720, 5, 1, 9312, 0},
+    {0x6e657400, 2944, 3, 1, 9312, 0},
+    {0x6e696572, 8623, 13, 1, 9312, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9312, 0},
+    {0x6e6f7761, 27095, 8, 1, 9312, 0},
+    {0x6e797361, 41630, 4, 1, 9312, 0},
+    {0x6f6c6177, 39910, 5, 1, 9312, 0},
+    {0x6f6c6563, 36779, 6, 1, 9312, 0},
+    {0x6f6c6b75, 36785, 6, 1, 9312, 0},
+    {0x6f6c737a, 32604, 7, 1, 9312, 0},
+    {0x6f706f63, 32667, 7, 1, 9312, 0},
+    {0x6f706f6c, 39940, 5, 1, 9312, 0},
+    {0x6f726700, 6352, 3, 1, 9312, 0},
+    {0x6f737472, 32702, 7, 1, 9312, 0},
+    {0x6f737472, 22054, 9, 1, 9312, 0},
+    {0x6f737472, 22063, 9, 1, 9312, 0},
+    {0x6f737472, 17882, 10, 1, 9312, 0},
+    {0x70630000, 2554, 2, 1, 9312, 0},
+    {0x70696c61, 35919, 4, 1, 9312, 0},
+    {0x7069737a, 41686, 4, 1, 9312, 0},
+    {0x706f6468, 32793, 7, 1, 9312, 0},
+    {0x706f646c, 27319, 8, 1, 9312, 0},
+    {0x706f6c6b, 22153, 9, 1, 9312, 0},
+    {0x706f6d6f, 22162, 9, 1, 9312, 0},
+    {0x706f6d6f, 32835, 7, 1, 9312, 0},
+    {0x706f6e69, 22171, 9, 1, 9312, 0},
+    {0x706f7769, 37001, 6, 1, 9312, 0},
+    {0x706f7a6e, 37007, 6, 1, 9312, 0},
+    {0x70726976, 220, 4, 1, 9312, 0},
+    {0x70726f63, 17972, 10, 1, 9312, 0},
+    {0x70727573, 27399, 8, 1, 9312, 0},
+    {0x70727a65, 22216, 9, 1, 9312, 0},
+    {0x70756c61, 37037, 6, 1, 9312, 0},
+    {0x7261646f, 40130, 5, 1, 9312, 0},
+    {0x72617761, 27455, 8, 1, 9312, 0},
+    {0x7265616c, 18042, 10, 1, 9312, 0},
+    {0x72656c00, 1010, 3, 1, 9312, 0},
+    {0x7279626e, 37169, 6, 1, 9312, 0},
+    {0x727a6573, 32996, 7, 1, 9312, 0},
+    {0x73616e6f, 40290, 5, 1, 9312, 0},
+    {0x73647363, 27671, 8, 1, 9312, 0},
+    {0x73656a6e, 40315, 5, 1, 9312, 0},
+    {0x73657800, 34930, 3, 1, 9312, 0},
+    {0x73686f70, 6369, 4, 1, 9312, 0},
+    {0x73686f70, 22657, 9, 1, 9312, 0},
+    {0x73696d70, 18342, 10, 1, 9312, 0},
+    {0x736b6c65, 20699, 5, 1, 9312, 0},
+    {0x736b6f63, 33276, 7, 1, 9312, 0},
+    {0x736c6173, 40400, 5, 1, 9312, 0},
+    {0x736c7570, 37409, 6, 1, 9312, 0},
+    {0x736f706f, 40450, 5, 1, 9312, 0},
+    {0x736f7300, 22711, 3, 1, 9312, 0},
+    {0x736f736e, 22711, 9, 1, 9312, 0},
+    {0x7374616c, 11395, 12, 1, 9312, 0},
+    {0x73746172, 11407, 12, 1, 9312, 0},
+    {0x73746172, 28007, 8, 1, 9312, 0},
+    {0x73757761, 33409, 7, 1, 9312, 0},
+    {0x73776964, 28103, 8, 1, 9312, 0},
+    {0x73776964, 33423, 7, 1, 9312, 0},
+    {0x73776965, 18402, 10, 1, 9312, 0},
+    {0x7377696e, 14557, 11, 1, 9312, 0},
+    {0x737a637a, 28119, 8, 1, 9312, 0},
+    {0x737a637a, 28127, 8, 1, 9312, 0},
+    {0x737a6b6f, 37577, 6, 1, 9312, 0},
+    {0x74617267, 40545, 5, 1, 9312, 0},
+    {0x7461726e, 18452, 10, 1, 9312, 0},
+    {0x74676f72, 40580, 5, 1, 9312, 0},
+    {0x746d0000, 2797, 2, 1, 9312, 0},
+    {0x746f7572, 33633, 7, 1, 9312, 0},
+    {0x74726176, 2166, 6, 1, 9312, 0},
+    {0x74757265, 40660, 5, 1, 9312, 0},
+    {0x74757279, 23089, 9, 1, 9312, 0},
+    {0x74796368, 40675, 5, 1, 9312, 0},
+    {0x756e6963, 28615, 8, 1, 9312, 0},
+    {0x7573746b, 40750, 5, 1, 9312, 0},
+    {0x77616c62, 23224, 9, 1, 9312, 0},
+    {0x7761726d, 38123, 6, 1, 9312, 0},
+    {0x77617273, 28783, 8, 1, 9312, 0},
+    {0x77617700, 28789, 3, 1, 9312, 0},
+    {0x77656772, 38153, 6, 1, 9312, 0},
+    {0x7769656c, 38159, 6, 1, 9312, 0},
+    {0x776c6f63, 23269, 5, 1, 9312, 0},
+    {0x776c6f63, 23269, 9, 1, 9312, 0},
+    {0x776f647a, 23278, 9, 1, 9312, 0},
+    {0x776f6c6f, 34032, 7, 1, 9312, 0},
+    {0x77726f63, 34060, 4, 1, 9312, 0},
+    {0x77726f63, 34060, 7, 1, 9312, 0},
+    {0x7a616368, 23629, 9, 1, 9312, 0},
+    {0x7a616761, 40910, 5, 1, 9312, 0},
+    {0x7a616b6f, 29023, 8, 1, 9312, 0},
+    {0x7a61726f, 40920, 5, 1, 9312, 0},
+    {0x7a676f72, 40925, 5, 1, 9312, 0},
+    {0x7a676f72, 23638, 9, 1, 9312, 0},
+    {0x636f0000, 4, 2, 1, 9312, 0},
+    {0x6e616d65, 17722, 4, 1, 9312, 0},
+    {0x6f776e00, 3933, 3, 1, 9312, 0},
+    {0x636f0000, 4, 2, 1, 9312, 0},
+    {0x65647500, 9778, 3, 1, 9312, 0},
+    {0x676f7600, 810, 3, 1, 9312, 0},
+    {0x6e657400, 2944, 3, 1, 9312, 0},
+    {0x6f726700, 6352, 3, 1, 9312, 0},
+    {0x696e6469, 39230, 5, 1, 9312, 0},
+    {0x61630000, 35, 2, 1, 9312, 0},
+    {0x62697a00, 38535, 3, 1, 9312, 0},
+    {0x636f6d00, 19, 3, 1, 9312, 0},
+    {0x65647500, 9778, 3, 1, 9312, 0},
+    {0x65737400, 351, 3, 1, 9312, 0},
+    {0x676f7600, 810, 3, 1, 9312, 0},
+    {0x696e666f, 21606, 4, 1, 9312, 0},
+    {0x69736c61, 23282, 4, 1, 9312, 0},
+    {0x6e616d65, 17722, 4, 1, 9312, 0},
+    {0x6e657400, 2944, 3, 1, 9312, 0},
+    {0x6f726700, 6352, 3, 1, 9312, 0},
+    {0x70726f00, 5042, 3, 1, 9312, 0},
+    {0x70726f66, 14260, 4, 1, 9312, 0},
+    {0x61616100, 7079, 3, 1, 9312, 0},
+    {0x61636100, 7829, 3, 1, 9312, 0},
+    {0x61636374, 40966, 4, 1, 9312, 0},
+    {0x61766f63, 29293, 6, 1, 9312, 0},
+    {0x62617200, 638, 3, 1, 9312, 0},
+    {0x62617273, 12676, 5, 1, 9312, 0},
+    {0x636c6f75, 29776, 7, 1, 9312, 0},
+    {0x63706100, 22116, 3, 1, 9312, 0},
+    {0x646e7374, 24495, 8, 0, 9312, 1},
+    {0x656e6700, 782, 3, 1, 9313, 0},
+    {0x6a757200, 14313, 3, 1, 9313, 0},
+    {0x6c617700, 5271, 3, 1, 9313, 0},
+    {0x6d656400, 1498, 3, 1, 9313, 0},
+    {0x72656368, 40150, 5, 1, 9313, 0},
+    {0x636f6d00, 19, 3, 1, 9313, 0},
+    {0x65647500, 9778, 3, 1, 9313, 0},
+    {0x676f7600, 810, 3, 1, 9313, 0},
+    {0x6e657400, 2944, 3, 1, 9313, 0},
+    {0x6f726700, 6352, 3, 1, 9313, 0},
+    {0x706c6f00, 11523, 3, 1, 9313, 0},
+    {0x73656300, 3806, 3, 1, 9313, 0},
+    {0x31323370, 9715, 12, 1, 9313, 0},
+    {0x626c6f67, 23967, 8, 1, 9313, 0},
+    {0x636f6d00, 19, 3, 1, 9313, 0},
+    {0x65647500, 9778, 3, 1, 9313, 0},
+    {0x676f7600, 810, 3, 1, 9313, 0},
+    {0x696e7400, 2022, 3, 1, 9313, 0},
+    {0x6e657400, 2944, 3, 1, 9313, 0},
+    {0x6e6f6d65, 6156, 4, 1, 9313, 0},
+    {0x6f726700, 6352, 3, 1, 9313, 0},
+    {0x7075626c, 4969, 4, 1, 9313, 0},
+    {0x62617273, 12676, 5, 1, 9313, 0},
+    {0x62656c61, 38500, 5, 1, 9313, 0},
+    {0x636c6f75, 29776, 7, 1, 9313, 0},
+    {0x636f0000, 4, 2, 1, 9313, 0},
+    {0x65640000, 1023, 2, 1, 9313, 0},
+    {0x676f0000, 810, 2, 1, 9313, 0},
+    {0x6e650000, 703, 2, 1, 9313, 0},
+    {0x6f720000, 5, 2, 1, 9313, 0},
+    {0x78343433, 41998, 4, 1, 9313, 0},
+    {0x636f6d00, 19, 3, 1, 9313, 0},
+    {0x636f6f70, 12918, 4, 1, 9313, 0},
+    {0x65647500, 9778, 3, 1, 9313, 0},
+    {0x676f7600, 810, 3, 1, 9313, 0},
+    {0x6d696c00, 6019, 3, 1, 9313, 0},
+    {0x6e657400, 2944, 3, 1, 9313, 0},
+    {0x6f726700, 6352, 3, 1, 9313, 0},
+    {0x626c6f67, 23967, 8, 1, 9313, 0},
+    {0x636f6d00, 19, 3, 1, 9313, 0},
+    {0x65647500, 9778, 3, 1, 9313, 0},
+    {0x676f7600, 810, 3, 1, 9313, 0},
+    {0x6d696c00, 6019, 3, 1, 9313, 0},
+    {0x6e616d65, 17722, 4, 1, 9313, 0},
+    {0x6e657400, 2944, 3, 1, 9313, 0},
+    {0x6f726700, 6352, 3, 1, 9313, 0},
+    {0x73636800, 1512, 3, 1, 9313, 0},
+    {0x6173736f, 788, 4, 1, 9313, 0},
+    {0x626c6f67, 23967, 8, 1, 9313, 0},
+    {0x636f6d00, 19, 3, 1, 9313, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9313, 0},
+    {0x79626f00, 34522, 3, 1, 9313, 0},
+    {0x636c616e, 41082, 4, 1, 9313, 0},
+    {0x61727473, 4056, 4, 1, 9313, 0},
+    {0x62617273, 12676, 5, 1, 9313, 0},
+    {0x626c6f67, 23967, 8, 1, 9313, 0},
+    {0x636f0000, 4, 2, 1, 9313, 0},
+    {0x636f6d00, 19, 3, 1, 9313, 0},
+    {0x6669726d, 24743, 4, 1, 9313, 0},
+    {0x696e666f, 21606, 4, 1, 9313, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9313, 0},
+    {0x6e740000, 50, 2, 1, 9313, 0},
+    {0x6f726700, 6352, 3, 1, 9313, 0},
+    {0x72656300, 2808, 3, 1, 9313, 0},
+    {0x73686f70, 6369, 4, 1, 9313, 0},
+    {0x73746f72, 10046, 5, 1, 9313, 0},
+    {0x746d0000, 2797, 2, 1, 9313, 0},
+    {0x77777700, 34154, 3, 1, 9313, 0},
+    {0x6c696d61, 21442, 9, 1, 9313, 0},
+    {0x6d796464, 36497, 6, 1, 9313, 0},
+    {0x77656273, 28791, 8, 1, 9313, 0},
+    {0x61630000, 35, 2, 1, 9313, 0},
+    {0x626c6f67, 23967, 8, 1, 9313, 0},
+    {0x6272656e, 29496, 7, 0, 9313, 1},
+    {0x636f0000, 4, 2, 1, 9314, 0},
+    {0x65647500, 9778, 3, 1, 9314, 0},
+    {0x676f7600, 810, 3, 1, 9314, 0},
+    {0x696e0000, 204, 2, 1, 9314, 0},
+    {0x6f726700, 6352, 3, 1, 9314, 0},
+    {0x6f780000, 1266, 2, 1, 9314, 0},
+    {0x75610000, 2091, 2, 1, 9314, 0},
+    {0x31323373, 29055, 7, 1, 9314, 0},
+    {0x61630000, 35, 2, 1, 9314, 0},
+    {0x61647967, 29083, 7, 1, 9314, 0},
+    {0x62617368, 19741, 9, 1, 9314, 0},
+    {0x62697200, 16092, 3, 1, 9314, 0},
+    {0x626c6f67, 23967, 8, 1, 9314, 0},
+    {0x63626700, 42069, 3, 1, 9314, 0},
+    {0x636c646d, 29755, 7, 0, 9314, 1},
+    {0x636f6d00, 19, 3, 1, 9315, 0},
+    {0x64616765, 24375, 8, 1, 9315, 0},
+    {0x65647500, 9778, 3, 1, 9315, 0},
+    {0x6575726f, 30203, 7, 1, 9315, 0},
+    {0x676f7600, 810, 3, 1, 9315, 0},
+    {0x67726f7a, 35189, 6, 1, 9315, 0},
+    {0x696e7400, 2022, 3, 1, 9315, 0},
+    {0x6b616c6d, 25591, 8, 1, 9315, 0},
+    {0x6b757374, 26143, 8, 1, 9315, 0},
+    {0x6c6b3300, 42249, 3, 1, 9315, 0},
+    {0x6d617269, 36131, 6, 1, 9315, 0},
+    {0x6d636469, 39610, 5, 1, 9315, 1},
+    {0x6d637072, 39615, 5, 1, 9316, 0},
+    {0x6d696c00, 6019, 3, 1, 9316, 0},
+    {0x6d697263, 26535, 8, 1, 9316, 0},
+    {0x6d6f7264, 26607, 8, 1, 9316, 0},
+    {0x6d736b00, 7526, 3, 1, 9316, 0},
+    {0x6d796a69, 36509, 6, 1, 9316, 4},
+    {0x6d797469, 39700, 5, 1, 9320, 0},
+    {0x6e613475, 41578, 4, 1, 9320, 0},
+    {0x6e616c63, 32324, 7, 1, 9320, 0},
+    {0x6e657400, 2944, 3, 1, 9320, 0},
+    {0x6e6f7600, 16246, 3, 1, 9320, 0},
+    {0x6f726700, 6352, 3, 1, 9320, 0},
+    {0x70700000, 1404, 2, 1, 9320, 0},
+    {0x70796174, 18002, 10, 1, 9320, 0},
+    {0x72617300, 8656, 3, 1, 9320, 0},
+    {0x72656772, 11119, 12, 0, 9320, 1},
+    {0x73706200, 42378, 3, 1, 9321, 0},
+    {0x74657374, 3483, 4, 1, 9321, 0},
+    {0x766c6164, 14733, 11, 1, 9321, 0},
+    {0x766c6164, 28735, 8, 1, 9321, 0},
+    {0x6275696c, 12988, 5, 2, 9321, 0},
+    {0x636f6465, 16768, 4, 2, 9321, 0},
+    {0x64617461, 24391, 8, 2, 9321, 0},
+    {0x64657665, 12995, 11, 1, 9321, 0},
+    {0x68730000, 3863, 2, 1, 9321, 0},
+    {0x6d696772, 21649, 9, 2, 9321, 0},
+    {0x6f6e706f, 27159, 8, 1, 9321, 0},
+    {0x72617665, 32863, 7, 1, 9321, 0},
+    {0x7265706c, 3558, 4, 1, 9321, 0},
+    {0x73657276, 14419, 7, 1, 9321, 0},
+    {0x61630000, 35, 2, 1, 9321, 0},
+    {0x636f0000, 4, 2, 1, 9321, 0},
+    {0x636f6f70, 12918, 4, 1, 9321, 0},
+    {0x676f7600, 810, 3, 1, 9321, 0},
+    {0x6d696c00, 6019, 3, 1, 9321, 0},
+    {0x6e657400, 2944, 3, 1, 9321, 0},
+    {0x6f726700, 6352, 3, 1, 9321, 0},
+    {0x636f6d00, 19, 3, 1, 9321, 0},
+    {0x65647500, 9778, 3, 1, 9321, 0},
+    {0x676f7600, 810, 3, 1, 9321, 0},
+    {0x6d656400, 1498, 3, 1, 9321, 0},
+    {0x6e657400, 2944, 3, 1, 9321, 0},
+    {0x6f726700, 6352, 3, 1, 9321, 0},
+    {0x70756200, 4969, 3, 1, 9321, 0},
+    {0x73636800, 1512, 3, 1, 9321, 0},
+    {0x636f6d00, 19, 3, 1, 9321, 0},
+    {0x65647500, 9778, 3, 1, 9321, 0},
+    {0x676f7600, 810, 3, 1, 9321, 0},
+    {0x6e657400, 2944, 3, 1, 9321, 0},
+    {0x6f726700, 6352, 3, 1, 9321, 0},
+    {0x636f6d00, 19, 3, 1, 9321, 0},
+    {0x65647500, 9778, 3, 1, 9321, 0},
+    {0x676f7600, 810, 3, 1, 9321, 0},
+    {0x6e657400, 2944, 3, 1, 9321, 0},
+    {0x6f726700, 6352, 3, 1, 9321, 0},
+    {0x79626f00, 34522, 3, 1, 9321, 0},
+    {0x65647500, 9778, 3, 1, 9321, 0},
+    {0x676f7600, 810, 3, 1, 9321, 1},
+    {0x636f6d00, 19, 3, 1, 9322, 0},
+    {0x65647500, 9778, 3, 1, 9322, 0},
+    {0x676f7600, 810, 3, 1, 9322, 0},
+    {0x696e666f, 21606, 4, 1, 9322, 0},
+    {0x6d656400, 1498, 3, 1, 9322, 0},
+    {0x6e657400, 2944, 3, 1, 9322, 0},
+    {0x6f726700, 6352, 3, 1, 9322, 0},
+    {0x74760000, 2443, 2, 1, 9322, 0},
+    {0x3132336d, 15822, 10, 1, 9322, 0},
+    {0x61000000, 26, 1, 1, 9322, 0},
+    {0x61630000, 35, 2, 1, 9322, 0},
+    {0x62000000, 125, 1, 1, 9322, 0},
+    {0x62640000, 5476, 2, 1, 9322, 0},
+    {0x626c6f67, 23967, 8, 1, 9322, 0},
+    {0x6272616e, 3388, 5, 1, 9322, 0},
+    {0x63000000, 4, 1, 1, 9322, 0},
+    {0x636f6d00, 19, 3, 1, 9322, 0},
+    {0x636f6e66, 13922, 4, 1, 9322, 0},
+    {0x64000000, 48, 1, 1, 9322, 0},
+    {0x65000000, 8, 1, 1, 9322, 0},
+    {0x66000000, 61, 1, 1, 9322, 0},
+    {0x66680000, 1299, 2, 1, 9322, 0},
+    {0x6668736b, 41190, 4, 1, 9322, 0},
+    {0x66687600, 42138, 3, 1, 9322, 0},
+    {0x67000000, 30, 1, 1, 9322, 0},
+    {0x68000000, 31, 1, 1, 9322, 0},
+    {0x69000000, 9, 1, 1, 9322, 0},
+    {0x696f7073, 35531, 6, 1, 9322, 0},
+    {0x6974636f, 10519, 12, 1, 9322, 0},
+    {0x6b000000, 870, 1, 1, 9322, 0},
+    {0x6b6f6d66, 31743, 7, 1, 9322, 0},
+    {0x6b6f6d6d, 5052, 15, 1, 9322, 0},
+    {0x6b6f6d76, 35813, 6, 1, 9322, 0},
+    {0x6c000000, 17, 1, 1, 9322, 0},
+    {0x6c616e62, 35921, 6, 1, 9322, 0},
+    {0x6d000000, 21, 1, 1, 9322, 0},
+    {0x6d797370, 10819, 12, 1, 9322, 0},
+    {0x6e000000, 1, 1, 1, 9322, 0},
+    {0x6e617475, 6793, 14, 1, 9322, 0},
+    {0x6f000000, 5, 1, 1, 9322, 0},
+    {0x6f726700, 6352, 3, 1, 9322, 0},
+    {0x70000000, 67, 1, 1, 9322, 0},
+    {0x70616261, 28065, 4, 0, 9322, 1},
+    {0x70617274, 40020, 5, 1, 9323, 0},
+    {0x70700000, 1404, 2, 1, 9323, 0},
+    {0x70726573, 4357, 5, 1, 9323, 0},
+    {0x72000000, 6, 1, 1, 9323, 0},
+    {0x73000000, 11, 1, 1, 9323, 0},
+    {0x74000000, 15, 1, 1, 9323, 0},
+    {0x746d0000, 2797, 2, 1, 9323, 0},
+    {0x75000000, 22, 1, 1, 9323, 0},
+    {0x77000000, 123, 1, 1, 9323, 0},
+    {0x78000000, 0, 1, 1, 9323, 0},
+    {0x79000000, 1120, 1, 1, 9323, 0},
+    {0x7a000000, 227, 1, 1, 9323, 0},
+    {0x6c6f6769, 21487, 9, 1, 9323, 0},
+    {0x626c6f67, 23967, 8, 1, 9323, 0},
+    {0x636f6d00, 19, 3, 1, 9323, 0},
+    {0x65647500, 9778, 3, 1, 9323, 0},
+    {0x656e7363, 24631, 8, 1, 9323, 0},
+    {0x676f7600, 810, 3, 1, 9323, 0},
+    {0x6e657400, 2944, 3, 1, 9323, 0},
+    {0x6f726700, 6352, 3, 1, 9323, 0},
+    {0x70657200, 1092, 3, 1, 9323, 0},
+    {0x62697000, 42045, 3, 1, 9323, 0},
+    {0x636f6d00, 19, 3, 1, 9323, 0},
+    {0x676f7600, 810, 3, 1, 9323, 0},
+    {0x68617368, 25095, 8, 1, 9323, 0},
+    {0x6d696c00, 6019, 3, 1, 9323, 0},
+    {0x6e657400, 2944, 3, 1, 9323, 0},
+    {0x6e6f7700, 1019, 3, 1, 9323, 0},
+    {0x6f726700, 6352, 3, 1, 9323, 0},
+    {0x706c6174, 7900, 8, 0, 9323, 4},
+    {0x76786c00, 42435, 3, 1, 9327, 0},
+    {0x77656465, 28799, 8, 1, 9327, 0},
+    {0x62617273, 12676, 5, 1, 9327, 0},
+    {0x62617365, 13263, 4, 1, 9327, 0},
+    {0x686f706c, 35417, 6, 1, 9327, 0},
+    {0x626c6f67, 23967, 8, 1, 9327, 0},
+    {0x67697461, 35111, 6, 1, 9327, 0},
+    {0x67697470, 30903, 7, 1, 9327, 0},
+    {0x62617273, 12676, 5, 1, 9327, 0},
+    {0x6279656e, 41062, 4, 1, 9327, 0},
+    {0x636c6f75, 24287, 8, 2, 9327, 0},
+    {0x63796f6e, 41110, 4, 1, 9327, 0},
+    {0x66617374, 6387, 7, 1, 9327, 0},
+    {0x666e776b, 41218, 4, 1, 9327, 0},
+    {0x666f6c69, 10075, 12, 1, 9327, 0},
+    {0x6a656c65, 10531, 4, 1, 9327, 0},
+    {0x6c656c75, 39490, 5, 1, 9327, 0},
+    {0x6c6f6769, 21487, 9, 1, 9327, 0},
+    {0x6d696e74, 32184, 7, 1, 9327, 0},
+    {0x6e6f7665, 27087, 8, 1, 9327, 0},
+    {0x6f6d6e69, 36791, 6, 1, 9327, 0},
+    {0x6f70656e, 17862, 10, 1, 9327, 0},
+    {0x706c6174, 17942, 10, 2, 9327, 0},
+    {0x73726874, 41814, 4, 1, 9327, 0},
+    {0x74737400, 8947, 3, 2, 9327, 0},
+    {0x626c6f67, 23967, 8, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x61727400, 3749, 3, 1, 9327, 0},
+    {0x626c6f67, 23967, 8, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x676f7576, 41266, 4, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x70657273, 1092, 5, 1, 9327, 0},
+    {0x756e6976, 18602, 4, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x6d650000, 102, 2, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x73636800, 1512, 3, 1, 9327, 0},
+    {0x64696865, 38750, 5, 2, 9327, 0},
+    {0x6d796661, 36503, 6, 1, 9327, 0},
+    {0x75626572, 13614, 4, 1, 9327, 0},
+    {0x78733461, 38177, 6, 1, 9327, 0},
+    {0x62697a00, 38535, 3, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x6d650000, 102, 2, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x73636800, 1512, 3, 1, 9327, 0},
+    {0x636f0000, 4, 2, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x636f6e73, 20029, 9, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x656d6261, 20182, 9, 1, 9327, 0},
+    {0x6d696c00, 6019, 3, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6e6f686f, 36695, 4, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x7072696e, 27375, 8, 1, 9327, 0},
+    {0x73616f74, 33059, 7, 1, 9327, 0},
+    {0x73746f72, 10046, 5, 1, 9327, 0},
+    {0x73656c6c, 37289, 6, 1, 9327, 0},
+    {0x73686f70, 27863, 8, 1, 9327, 0},
+    {0x73746f72, 22819, 9, 1, 9327, 0},
+    {0x61626b68, 23671, 8, 1, 9327, 0},
+    {0x61647967, 29083, 7, 1, 9327, 0},
+    {0x616b7479, 15912, 10, 1, 9327, 0},
+    {0x61726b68, 12632, 11, 1, 9327, 0},
+    {0x61726d65, 29209, 7, 1, 9327, 0},
+    {0x61736867, 23799, 8, 1, 9327, 0},
+    {0x617a6572, 15992, 10, 1, 9327, 0},
+    {0x62616c61, 23879, 8, 1, 9327, 0},
+    {0x62617368, 19741, 9, 1, 9327, 0},
+    {0x62727961, 29524, 7, 1, 9327, 0},
+    {0x62756b68, 29538, 7, 1, 9327, 0},
+    {0x6368696d, 24215, 8, 1, 9327, 0},
+    {0x64616765, 24375, 8, 1, 9327, 0},
+    {0x65617374, 4602, 15, 1, 9327, 0},
+    {0x65786e65, 38845, 5, 1, 9327, 0},
+    {0x67656f72, 30868, 7, 1, 9327, 0},
+    {0x67726f7a, 35189, 6, 1, 9327, 0},
+    {0x6976616e, 31414, 7, 1, 9327, 0},
+    {0x6a616d62, 35555, 6, 1, 9327, 0},
+    {0x6b616c6d, 25591, 8, 1, 9327, 0},
+    {0x6b616c75, 35639, 6, 1, 9327, 0},
+    {0x6b617261, 31561, 7, 1, 9327, 0},
+    {0x6b617261, 21019, 9, 1, 9327, 0},
+    {0x6b617265, 31575, 7, 1, 9327, 0},
+    {0x6b68616b, 21127, 9, 1, 9327, 0},
+    {0x6b726173, 21253, 9, 1, 9327, 0},
+    {0x6b757267, 35879, 6, 1, 9327, 0},
+    {0x6b757374, 26143, 8, 1, 9327, 0},
+    {0x6c656e75, 39495, 5, 1, 9327, 0},
+    {0x6d616e67, 17462, 10, 1, 9327, 0},
+    {0x6d6f7264, 26607, 8, 1, 9327, 0},
+    {0x6d736b00, 7526, 3, 1, 9327, 0},
+    {0x6d75726d, 26695, 8, 1, 9327, 0},
+    {0x6e616c63, 32324, 7, 1, 9327, 0},
+    {0x6e61766f, 39775, 5, 1, 9327, 0},
+    {0x6e6f7274, 3852, 16, 1, 9327, 0},
+    {0x6e6f7600, 16246, 3, 1, 9327, 0},
+    {0x6f626e69, 32520, 7, 1, 9327, 0},
+    {0x70656e7a, 40045, 5, 1, 9327, 0},
+    {0x706f6b72, 27327, 8, 1, 9327, 0},
+    {0x736f6368, 40425, 5, 1, 9327, 0},
+    {0x73706200, 42378, 3, 1, 9327, 0},
+    {0x74617368, 28327, 8, 1, 9327, 0},
+    {0x7465726d, 37697, 6, 1, 9327, 0},
+    {0x746f676c, 22990, 9, 1, 9327, 0},
+    {0x74726f69, 33703, 7, 1, 9327, 0},
+    {0x7473656c, 14645, 11, 1, 9327, 0},
+    {0x74756c61, 41882, 4, 1, 9327, 0},
+    {0x74757661, 41890, 4, 1, 9327, 0},
+    {0x766c6164, 14733, 11, 1, 9327, 0},
+    {0x766c6164, 28735, 8, 1, 9327, 0},
+    {0x766f6c6f, 33899, 7, 1, 9327, 0},
+    {0x62617273, 12676, 5, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x676f6200, 38533, 3, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x72656400, 1912, 3, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x6d696c00, 6019, 3, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x6b6e6967, 13721, 11, 1, 9327, 0},
+    {0x61630000, 35, 2, 1, 9327, 0},
+    {0x636f0000, 4, 2, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x63680000, 36, 2, 1, 9327, 0},
+    {0x6d650000, 102, 2, 1, 9327, 0},
+    {0x77650000, 123, 2, 1, 9327, 0},
+    {0x626c6f67, 23967, 8, 1, 9327, 0},
+    {0x64697363, 20056, 9, 1, 9327, 0},
+    {0x6a656c61, 25487, 8, 1, 9327, 0},
+    {0x636f0000, 4, 2, 1, 9327, 0},
+    {0x73636800, 1512, 3, 1, 9327, 0},
+    {0x61630000, 35, 2, 1, 9327, 0},
+    {0x636f0000, 4, 2, 1, 9327, 0},
+    {0x676f0000, 810, 2, 1, 9327, 0},
+    {0x696e0000, 204, 2, 1, 9327, 0},
+    {0x6d690000, 492, 2, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6f6e6c69, 6871, 6, 1, 9327, 0},
+    {0x6f720000, 5, 2, 1, 9327, 0},
+    {0x73686f70, 6369, 4, 1, 9327, 0},
+    {0x61630000, 35, 2, 1, 9327, 0},
+    {0x62697a00, 38535, 3, 1, 9327, 0},
+    {0x636f0000, 4, 2, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x676f0000, 810, 2, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x696e7400, 2022, 3, 1, 9327, 0},
+    {0x6d696c00, 6019, 3, 1, 9327, 0},
+    {0x6e616d65, 17722, 4, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6e696300, 23, 3, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x74657374, 3483, 4, 1, 9327, 0},
+    {0x77656200, 123, 3, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x636f0000, 4, 2, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x6d696c00, 6019, 3, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x656e7300, 44, 3, 1, 9327, 0},
+    {0x66696e00, 720, 3, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x696e6400, 477, 3, 1, 9327, 0},
+    {0x696e666f, 21606, 4, 1, 9327, 0},
+    {0x696e746c, 18114, 4, 1, 9327, 0},
+    {0x6d696e63, 36275, 6, 1, 9327, 0},
+    {0x6e617400, 1107, 3, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6f72616e, 14106, 11, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x70657273, 1092, 5, 1, 9327, 0},
+    {0x746f7572, 33633, 7, 1, 9327, 0},
+    {0x36313100, 42021, 3, 1, 9327, 0},
+    {0x636f6d00, 19, 3, 1, 9327, 0},
+    {0x65647500, 9778, 3, 1, 9327, 0},
+    {0x676f7600, 810, 3, 1, 9327, 0},
+    {0x6d696c00, 6019, 3, 1, 9327, 0},
+    {0x6e657400, 2944, 3, 1, 9327, 0},
+    {0x6e79616e, 41622, 4, 1, 9327, 0},
+    {0x6f726700, 6352, 3, 1, 9327, 0},
+    {0x6f796100, 3885, 3, 1, 9327, 0},
+    {0x71756963, 11071, 12, 0, 9327, 1},
+    {0x72647600, 18690, 3, 1, 9328, 0},
+    {0x76706e70, 33906, 7, 1, 9328, 0},
+    {0x70726571, 11035, 12, 1, 9328, 0},
+    {0x6e6f772d, 32506, 7, 1, 9328, 0},
+    {0x6e74646c, 39840, 5, 1, 9328, 0},
+    {0x61760000, 1620, 2, 1, 9328, 0},
+    {0x62627300, 27700, 3, 1, 9328, 0},
+    {0x62656c00, 8916, 3, 1, 9328, 0},
+    {0x62697a00, 38535, 3, 1, 9328, 0},
+    {0x636f6d00, 19, 3, 1, 9328, 1},
+    {0x64720000, 633, 2, 1, 9329, 0},
+    {0x65647500, 9778, 3, 1, 9329, 0},
+    {0x67656e00, 324, 3, 1, 9329, 0},
+    {0x676f7600, 810, 3, 1, 9329, 0},
+    {0x696e666f, 21606, 4, 1, 9329, 0},
+    {0x6b313200, 42237, 3, 1, 9329, 0},
+    {0x6b657000, 39335, 3, 1, 9329, 0},
+    {0x6d696c00, 6019, 3, 1, 9329, 0},
+    {0x6e616d65, 17722, 4, 1, 9329, 0},
+    {0x6e630000, 64, 2, 1, 9329, 1},
+    {0x6e657400, 2944, 3, 1, 9330, 0},
+    {0x6f726700, 6352, 3, 1, 9330, 0},
+    {0x706f6c00, 9733, 3, 1, 9330, 0},
+    {0x74656c00, 15, 3, 1, 9330, 0},
+    {0x74736b00, 10598, 3, 1, 9330, 0},
+    {0x74760000, 2443, 2, 1, 9330, 0},
+    {0x77656200, 123, 3, 1, 9330, 0},
+    {0x79626f00, 34522, 3, 1, 9330, 0},
+    {0x6165726f, 19390, 4, 1, 9330, 0},
+    {0x62697a00, 38535, 3, 1, 9330, 0},
+    {0x636f0000, 4, 2, 1, 9330, 0},
+    {0x636f6d00, 19, 3, 1, 9330, 0},
+    {0x636f6f70, 12918, 4, 1, 9330, 0},
+    {0x65647500, 9778, 3, 1, 9330, 0},
+    {0x676f7600, 810, 3, 1, 9330, 0},
+    {0x696e666f, 21606, 4, 1, 9330, 0},
+    {0x696e7400, 2022, 3, 1, 9330, 0},
+    {0x6a6f6273, 41366, 4, 1, 9330, 0},
+    {0x6d6f6269, 2103, 4, 1, 9330, 0},
+    {0x6d757365, 1121, 6, 1, 9330, 0},
+    {0x6e616d65, 17722, 4, 1, 9330, 0},
+    {0x6e657400, 2944, 3, 1, 9330, 0},
+    {0x6f726700, 6352, 3, 1, 9330, 0},
+    {0x70726f00, 5042, 3, 1, 9330, 0},
+    {0x74726176, 2166, 6, 1, 9330, 0},
+    {0x62657474, 12731, 11, 1, 9330, 0},
+    {0x64796e64, 6317, 6, 1, 9330, 0},
+    {0x6f6e2d74, 17852, 10, 1, 9330, 0},
+    {0x776f7273, 18772, 10, 1, 9330, 0},
+    {0x626c6f67, 23967, 8, 1, 9330, 0},
+    {0x636c7562, 23699, 4, 1, 9330, 0},
+    {0x636f6d00, 19, 3, 1, 9330, 1},
+    {0x6562697a, 41154, 4, 1, 9331, 0},
+    {0x65647500, 9778, 3, 1, 9331, 0},
+    {0x67616d65, 3339, 4, 1, 9331, 0},
+    {0x676f7600, 810, 3, 1, 9331, 0},
+    {0x69647600, 42204, 3, 1, 9331, 0},
+    {0x6d696c00, 6019, 3, 1, 9331, 0},
+    {0x6e657400, 2944, 3, 1, 9331, 0},
+    {0x6f726700, 6352, 3, 1, 9331, 0},
+    {0x75726c00, 18339, 3, 1, 9331, 0},
+    {0x786e2d2d, 15096, 11, 1, 9331, 0},
+    {0x786e2d2d, 19232, 10, 1, 9331, 0},
+    {0x786e2d2d, 12475, 12, 1, 9331, 0},
+    {0x61630000, 35, 2, 1, 9331, 0},
+    {0x636f0000, 4, 2, 1, 9331, 0},
+    {0x676f0000, 810, 2, 1, 9331, 0},
+    {0x686f7465, 4887, 5, 1, 9331, 0},
+    {0x696e666f, 21606, 4, 1, 9331, 0},
+    {0x6d650000, 102, 2, 1, 9331, 0},
+    {0x6d696c00, 6019, 3, 1, 9331, 0},
+    {0x6d6f6269, 2103, 4, 1, 9331, 0},
+    {0x6e650000, 703, 2, 1, 9331, 0},
+    {0x6f720000, 5, 2, 1, 9331, 0},
+    {0x73630000, 1512, 2, 1, 9331, 0},
+    {0x74760000, 2443, 2, 1, 9331, 0},
+    {0x62697a00, 38535, 3, 1, 9331, 0},
+    {0x63630000, 456, 2, 1, 9331, 0},
+    {0x63686572, 19921, 9, 1, 9331, 0},
+    {0x63686572, 24175, 8, 1, 9331, 0},
+    {0x63686572, 19930, 9, 1, 9331, 0},
+    {0x63686572, 19939, 9, 1, 9331, 0},
+    {0x63686572, 16232, 10, 1, 9331, 0},
+    {0x63686572, 16242, 10, 1, 9331, 0},
+    {0x636b0000, 2937, 2, 1, 9331, 0},
+    {0x636e0000, 6219, 2, 1, 9331, 0},
+    {0x636f0000, 4, 2, 1, 9331, 0},
+    {0x636f6d00, 19, 3, 1, 9331, 0},
+    {0x63720000, 5582, 2, 1, 9331, 0},
+    {0x6372696d, 34697, 6, 1, 9331, 0},
+    {0x63760000, 4279, 2, 1, 9331, 0},
+    {0x63780000, 1725, 2, 1, 9331, 0},
+    {0x646e0000, 1303, 2, 1, 9331, 0},
+    {0x646e6570, 6289, 14, 1, 9331, 0},
+    {0x646e6970, 6303, 14, 1, 9331, 0},
+    {0x646f6e65, 30014, 7, 1, 9331, 0},
+    {0x64700000, 7899, 2, 1, 9331, 0},
+    {0x65647500, 9778, 3, 1, 9331, 0},
+    {0x676f7600, 810, 3, 1, 9331, 0},
+    {0x69660000, 3767, 2, 1, 9331, 0},
+    {0x696e0000, 204, 2, 1, 9331, 0},
+    {0x696e6600, 3522, 3, 1, 9331, 0},
+    {0x6976616e, 5007, 15, 1, 9331, 0},
+    {0x6b680000, 2938, 2, 1, 9331, 0},
+    {0x6b686172, 31659, 7, 1, 9331, 0},
+    {0x6b686172, 31666, 7, 1, 9331, 0},
+    {0x6b686572, 31673, 7, 1, 9331, 0},
+    {0x6b686d65, 10591, 12, 1, 9331, 0},
+    {0x6b686d65, 10603, 12, 1, 9331, 0},
+    {0x6b696576, 41402, 4, 1, 9331, 0},
+    {0x6b69726f, 17192, 10, 1, 9331, 0},
+    {0x6b6d0000, 17471, 2, 1, 9331, 0},
+    {0x6b720000, 1749, 2, 1, 9331, 0},
+    {0x6b72796d, 41446, 4, 1, 9331, 0},
+    {0x6b730000, 1239, 2, 1, 9331, 0},
+    {0x6b760000, 4192, 2, 1, 9331, 0},
+    {0x6b796976, 41466, 4, 1, 9331, 0},
+    {0x6c670000, 4400, 2, 1, 9331, 0},
+    {0x6c740000, 232, 2, 1, 9331, 0},
+    {0x6c746400, 33033, 3, 1, 9331, 0},
+    {0x6c756761, 32023, 7, 1, 9331, 0},
+    {0x6c757473, 39580, 5, 1, 9331, 0},
+    {0x6c760000, 2301, 2, 1, 9331, 0},
+    {0x6c766976, 41506, 4, 1, 9331, 0},
+    {0x6d6b0000, 12143, 2, 1, 9331, 0},
+    {0x6d796b6f, 26735, 8, 1, 9331, 0},
+    {0x6e657400, 2944, 3, 1, 9331, 0},
+    {0x6e696b6f, 26959, 8, 1, 9331, 0},
+    {0x6f640000, 2784, 2, 1, 9331, 0},
+    {0x6f646573, 39870, 5, 1, 9331, 0},
+    {0x6f646573, 36749, 6, 1, 9331, 0},
+    {0x6f726700, 6352, 3, 1, 9331, 0},
+    {0x706c0000, 2832, 2, 1, 9331, 0},
+    {0x706f6c74, 32828, 7, 1, 9331, 0},
+    {0x70700000, 1404, 2, 1, 9331, 0},
+    {0x7269766e, 40185, 5, 1, 9331, 0},
+    {0x726f766e, 40210, 5, 1, 9331, 0},
+    {0x72760000, 113, 2, 1, 9331, 0},
+    {0x73620000, 327, 2, 1, 9331, 0},
+    {0x73656261, 18202, 10, 1, 9331, 0},
+    {0x73657661, 18262, 10, 1, 9331, 0},
+    {0x736d0000, 3774, 2, 1, 9331, 0},
+    {0x73756d79, 41822, 4, 1, 9331, 0},
+    {0x74650000, 15, 2, 1, 9331, 0},
+    {0x7465726e, 28359, 8, 1, 9331, 0},
+    {0x757a0000, 8756, 2, 1, 9331, 0},
+    {0x757a6867, 28647, 8, 1, 9331, 0},
+    {0x76000000, 97, 1, 1, 9331, 0},
+    {0x76696e6e, 33878, 7, 1, 9331, 0},
+    {0x76696e6e, 23206, 9, 1, 9331, 0},
+    {0x766e0000, 4193, 2, 1, 9331, 0},
+    {0x766f6c79, 40815, 5, 1, 9331, 0},
+    {0x79616c74, 40875, 5, 1, 9331, 0},
+    {0x7a61706f, 15811, 11, 1, 9331, 0},
+    {0x7a61706f, 12499, 12, 1, 9331, 0},
+    {0x7a686974, 29039, 8, 1, 9331, 0},
+    {0x7a687974, 29047, 8, 1, 9331, 0},
+    {0x7a700000, 30218, 2, 1, 9331, 0},
+    {0x7a740000, 13701, 2, 1, 9331, 0},
+    {0x61630000, 35, 2, 1, 9331, 0},
+    {0x626c6f67, 23967, 8, 1, 9331, 0},
+    {0x636f0000, 4, 2, 1, 9331, 0},
+    {0x636f6d00, 19, 3, 1, 9331, 0},
+    {0x676f0000, 810, 2, 1, 9331, 0},
+    {0x6e650000, 703, 2, 1, 9331, 0},
+    {0x6f720000, 5, 2, 1, 9331, 0},
+    {0x6f726700, 6352, 3, 1, 9331, 0},
+    {0x73630000, 1512, 2, 1, 9331, 0},
+    {0x61630000, 35, 2, 1, 9331, 0},
+    {0x62617273, 12676, 5, 1, 9331, 0},
+    {0x636f0000, 4, 2, 1, 9331, 11},
+    {0x636f6e6e, 11076, 4, 1, 9342, 0},
+    {0x636f7072, 38660, 5, 1, 9342, 0},
+    {0x676f7600, 810, 3, 1, 9342, 4},
+    {0x686f7370, 25303, 4, 1, 9346, 0},
+    {0x696e6465, 477, 22, 1, 9346, 0},
+    {0x696e6465, 1460, 19, 1, 9346, 0},
+    {0x696e6465, 1479, 19, 1, 9346, 0},
+    {0x696e6465, 2713, 17, 1, 9346, 0},
+    {0x696e6465, 2004, 18, 1, 9346, 0},
+    {0x6c746400, 33033, 3, 1, 9346, 0},
+    {0x6d650000, 102, 2, 1, 9346, 0},
+    {0x6e657400, 2944, 3, 1, 9346, 0},
+    {0x6e687300, 42270, 3, 1, 9346, 0},
+    {0x6f726700, 6352, 3, 1, 9346, 6},
+    {0x706c6300, 42309, 3, 1, 9352, 0},
+    {0x706f6c69, 36983, 6, 1, 9352, 0},
+    {0x7075626c, 6821, 14, 1, 9352, 0},
+    {0x70796d6e, 40125, 5, 1, 9352, 0},
+    {0x726f7961, 3884, 16, 1, 9352, 0},
+    {0x73636800, 1512, 3, 2, 9352, 0},
+    {0x616b0000, 967, 2, 1, 9352, 3},
+    {0x616c0000, 106, 2, 1, 9355, 3},
+    {0x61720000, 639, 2, 1, 9358, 3},
+    {0x61730000, 140, 2, 1, 9361, 3},
+    {0x617a0000, 3199, 2, 1, 9364, 3},
+    {0x63610000, 25, 2, 1, 9367, 3},
+    {0x636c6f75, 29776, 7, 1, 9370, 0},
+    {0x636f0000, 4, 2, 1, 9370, 3},
+    {0x63740000, 452, 2, 1, 9373, 3},
+    {0x64630000, 4486, 2, 1, 9376, 3},
+    {0x64650000, 48, 2, 1, 9379, 3},
+    {0x646e6900, 6303, 3, 1, 9382, 0},
+    {0x64727564, 41138, 4, 1, 9382, 0},
+    {0x656e7363, 24631, 8, 0, 9382, 1},
+    {0x66656400, 3516, 3, 1, 9383, 0},
+    {0x666c0000, 4517, 2, 1, 9383, 3},
+    {0x66726565, 24411, 8, 1, 9386, 0},
+    {0x67610000, 471, 2, 1, 9386, 3},
+    {0x676f6c66, 30959, 7, 1, 9389, 0},
+    {0x67726170, 31015, 7, 1, 9389, 0},
+    {0x67750000, 3231, 2, 1, 9389, 3},
+    {0x68690000, 37, 2, 1, 9392, 2},
+    {0x69610000, 635, 2, 1, 9394, 3},
+    {0x69640000, 458, 2, 1, 9397, 3},
+    {0x696c0000, 1036, 2, 1, 9400, 3},
+    {0x696e0000, 204, 2, 1, 9403, 3},
+    {0x69732d62, 39245, 5, 1, 9406, 0},
+    {0x69736100, 5885, 3, 1, 9406, 0},
+    {0x6b696473, 33482, 4, 1, 9406, 0},
+    {0x6b730000, 1239, 2, 1, 9406, 3},
+    {0x6b790000, 6712, 2, 1, 9409, 3},
+    {0x6c610000, 728, 2, 1, 9412, 3},
+    {0x6c616e64, 13754, 11, 1, 9415, 0},
+    {0x6d610000, 970, 2, 1, 9415, 3},
+    {0x6d640000, 17714, 2, 1, 9418, 3},
+    {0x6d650000, 102, 2, 1, 9421, 3},
+    {0x6d690000, 492, 2, 1, 9424, 11},
+    {0x6d697263, 26535, 8, 1, 9435, 0},
+    {0x6d6e0000, 5601, 2, 1, 9435, 3},
+    {0x6d6f0000, 736, 2, 1, 9438, 3},
+    {0x6d730000, 578, 2, 1, 9441, 3},
+    {0x6d740000, 1271, 2, 1, 9444, 3},
+    {0x6e630000, 64, 2, 1, 9447, 3},
+    {0x6e640000, 74, 2, 1, 9450, 2},
+    {0x6e650000, 703, 2, 1, 9452, 3},
+    {0x6e680000, 1504, 2, 1, 9455, 3},
+    {0x6e6a0000, 2373, 2, 1, 9458, 3},
+    {0x6e6d0000, 101, 2, 1, 9461, 3},
+    {0x6e6f6970, 41602, 4, 1, 9464, 0},
+    {0x6e736e00, 42282, 3, 1, 9464, 0},
+    {0x6e760000, 96, 2, 1, 9464, 3},
+    {0x6e790000, 2335, 2, 1, 9467, 3},
+    {0x6f680000, 1752, 2, 1, 9470, 3},
+    {0x6f6b0000, 1734, 2, 1, 9473, 3},
+    {0x6f720000, 5, 2, 1, 9476, 3},
+    {0x70610000, 778, 2, 1, 9479, 3},
+    {0x706c6174, 27303, 8, 1, 9482, 0},
+    {0x706f696e, 32807, 7, 1, 9482, 0},
+    {0x70720000, 220, 2, 1, 9482, 3},
+    {0x72690000, 221, 2, 1, 9485, 2},
+    {0x73630000, 1512, 2, 1, 9487, 3},
+    {0x73640000, 208, 2, 1, 9490, 2},
+    {0x73747566, 11443, 12, 1, 9492, 0},
+    {0x746e0000, 1624, 2, 1, 9492, 3},
+    {0x74780000, 7352, 2, 1, 9495, 3},
+    {0x75740000, 161, 2, 1, 9498, 3},
+    {0x76610000, 114, 2, 1, 9501, 3},
+    {0x76690000, 97, 2, 1, 9504, 3},
+    {0x76740000, 7975, 2, 1, 9507, 3},
+    {0x77610000, 1758, 2, 1, 9510, 3},
+    {0x77690000, 1035, 2, 1, 9513, 3},
+    {0x77760000, 30775, 2, 1, 9516, 1},
+    {0x77790000, 13563, 2, 1, 9517, 3},
+    {0x636f6d00, 19, 3, 1, 9520, 1},
+    {0x65647500, 9778, 3, 1, 9521, 0},
+    {0x67756200, 42192, 3, 1, 9521, 0},
+    {0x6d696c00, 6019, 3, 1, 9521, 0},
+    {0x6e657400, 2944, 3, 1, 9521, 0},
+    {0x6f726700, 6352, 3, 1, 9521, 0},
+    {0x636f0000, 4, 2, 1, 9521, 0},
+    {0x636f6d00, 19, 3, 1, 9521, 0},
+    {0x6e657400, 2944, 3, 1, 9521, 0},
+    {0x6f726700, 6352, 3, 1, 9521, 0},
+    {0x30650000, 552, 2, 1, 9521, 0},
+    {0x636f6d00, 19, 3, 1, 9521, 0},
+    {0x65647500, 9778, 3, 1, 9521, 0},
+    {0x676f7600, 810, 3, 1, 9521, 0},
+    {0x67760000, 11610, 2, 1, 9521, 1},
+    {0x6d696c00, 6019, 3, 1, 9522, 0},
+    {0x6e657400, 2944, 3, 1, 9522, 0},
+    {0x6f726700, 6352, 3, 1, 9522, 0},
+    {0x61727473, 4056, 4, 1, 9522, 0},
+    {0x62696200, 16718, 3, 1, 9522, 0},
+    {0x636f0000, 4, 2, 1, 9522, 0},
+    {0x636f6d00, 19, 3, 1, 9522, 0},
+    {0x65313200, 12521, 3, 1, 9522, 0},
+    {0x65647500, 9778, 3, 1, 9522, 0},
+    {0x6669726d, 24743, 4, 1, 9522, 0},
+    {0x676f6200, 38533, 3, 1, 9522, 0},
+    {0x676f7600, 810, 3, 1, 9522, 0},
+    {0x696e666f, 21606, 4, 1, 9522, 0},
+    {0x696e7400, 2022, 3, 1, 9522, 0},
+    {0x6d696c00, 6019, 3, 1, 9522, 0},
+    {0x6e657400, 2944, 3, 1, 9522, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9522, 0},
+    {0x6f726700, 6352, 3, 1, 9522, 0},
+    {0x72617200, 3510, 3, 1, 9522, 0},
+    {0x72656300, 2808, 3, 1, 9522, 0},
+    {0x73746f72, 10046, 5, 1, 9522, 0},
+    {0x74656300, 9756, 3, 1, 9522, 0},
+    {0x77656200, 123, 3, 1, 9522, 0},
+    {0x61740000, 89, 2, 1, 9522, 0},
+    {0x636f0000, 4, 2, 1, 9522, 0},
+    {0x636f6d00, 19, 3, 1, 9522, 0},
+    {0x6b313200, 42237, 3, 1, 9522, 0},
+    {0x6e657400, 2944, 3, 1, 9522, 0},
+    {0x6f726700, 6352, 3, 1, 9522, 0},
+    {0x61630000, 35, 2, 1, 9522, 0},
+    {0x62697a00, 38535, 3, 1, 9522, 0},
+    {0x626c6f67, 23967, 8, 1, 9522, 0},
+    {0x636f6d00, 19, 3, 1, 9522, 0},
+    {0x65647500, 9778, 3, 1, 9522, 0},
+    {0x676f7600, 810, 3, 1, 9522, 0},
+    {0x6865616c, 229, 6, 1, 9522, 0},
+    {0x696e666f, 21606, 4, 1, 9522, 0},
+    {0x696e7400, 2022, 3, 1, 9522, 0},
+    {0x6e616d65, 17722, 4, 1, 9522, 0},
+    {0x6e657400, 2944, 3, 1, 9522, 0},
+    {0x6f726700, 6352, 3, 1, 9522, 0},
+    {0x70726f00, 5042, 3, 1, 9522, 0},
+    {0x626c6f67, 3492, 4, 1, 9522, 0},
+    {0x636e0000, 6219, 2, 1, 9522, 0},
+    {0x636f6d00, 19, 3, 1, 9522, 0},
+    {0x64657600, 4572, 3, 1, 9522, 0},
+    {0x65647500, 9778, 3, 1, 9522, 0},
+    {0x6d650000, 102, 2, 1, 9522, 0},
+    {0x6e657400, 2944, 3, 1, 9522, 0},
+    {0x6f726700, 6352, 3, 1, 9522, 0},
+    {0x6672616d, 10111, 6, 1, 9522, 0},
+    {0x62697a00, 38535, 3, 1, 9522, 0},
+    {0x73636800, 1512, 3, 1, 9522, 0},
+    {0x6672616d, 10111, 6, 1, 9522, 0},
+    {0x61647669, 729, 7, 2, 9522, 0},
+    {0x636c6f75, 29769, 7, 1, 9522, 0},
+    {0x636f6d00, 19, 3, 1, 9522, 0},
+    {0x64796e64, 6317, 6, 1, 9522, 0},
+    {0x65647500, 9778, 3, 1, 9522, 0},
+    {0x676f7600, 810, 3, 1, 9522, 0},
+    {0x6d797065, 36515, 6, 1, 9522, 0},
+    {0x6e657400, 2944, 3, 1, 9522, 0},
+    {0x6f726700, 6352, 3, 1, 9522, 0},
+    {0x786e2d2d, 9169, 13, 1, 9522, 0},
+    {0x786e2d2d, 14975, 11, 1, 9522, 0},
+    {0x786e2d2d, 18882, 10, 1, 9522, 0},
+    {0x786e2d2d, 15239, 11, 1, 9522, 0},
+    {0x786e2d2d, 28855, 8, 1, 9522, 0},
+    {0x786e2d2d, 23323, 9, 1, 9522, 0},
+    {0x786e2d2d, 23341, 9, 1, 9522, 0},
+    {0x786e2d2d, 28871, 8, 1, 9522, 0},
+    {0x786e2d2d, 23458, 8, 1, 9522, 0},
+    {0x786e2d2d, 23458, 9, 1, 9522, 0},
+    {0x786e2d2d, 18832, 10, 1, 9522, 0},
+    {0x786e2d2d, 19052, 10, 1, 9522, 0},
+    {0x786e2d2d, 19152, 10, 1, 9522, 0},
+    {0x786e2d2d, 19172, 10, 1, 9522, 0},
+    {0x786e2d2d, 19232, 10, 1, 9522, 0},
+    {0x786e2d2d, 15734, 11, 1, 9522, 0},
+    {0x786e2d2d, 9156, 13, 1, 9522, 0},
+    {0x786e2d2d, 5442, 15, 1, 9522, 0},
+    {0x786e2d2d, 4060, 16, 1, 9522, 0},
+    {0x786e2d2d, 9338, 13, 1, 9522, 0},
+    {0x786e2d2d, 12031, 12, 1, 9522, 0},
+    {0x786e2d2d, 15492, 11, 1, 9522, 0},
+    {0x786e2d2d, 34074, 7, 1, 9522, 0},
+    {0x786e2d2d, 7073, 14, 1, 9522, 0},
+    {0x786e2d2d, 18902, 10, 1, 9522, 0},
+    {0x786e2d2d, 23314, 9, 1, 9522, 0},
+    {0x786e2d2d, 23341, 9, 1, 9522, 0},
+    {0x786e2d2d, 23395, 9, 1, 9522, 0},
+    {0x786e2d2d, 19072, 10, 1, 9522, 0},
+    {0x786e2d2d, 23404, 9, 1, 9522, 0},
+    {0x786e2d2d, 23413, 9, 1, 9522, 0},
+    {0x786e2d2d, 15272, 11, 1, 9522, 0},
+    {0x626c6f67, 23959, 8, 1, 9522, 0},
+    {0x63726166, 24351, 8, 1, 9522, 0},
+    {0x6c6f6361, 21478, 9, 1, 9522, 0},
+    {0x74656c65, 33486, 7, 2, 9522, 0},
+    {0x7a617074, 40915, 5, 1, 9522, 0},
+    {0x636f6d00, 19, 3, 1, 9522, 0},
+    {0x65647500, 9778, 3, 1, 9522, 0},
+    {0x676f7600, 810, 3, 1, 9522, 0},
+    {0x6d696c00, 6019, 3, 1, 9522, 0},
+    {0x6e657400, 2944, 3, 1, 9522, 0},
+    {0x6f726700, 6352, 3, 1, 9522, 0},
+    {0x6f726700, 6352, 3, 1, 9522, 0},
+    {0x61630000, 35, 2, 1, 9522, 0},
+    {0x61677269, 12566, 5, 1, 9522, 0},
+    {0x616c7400, 231, 3, 1, 9522, 0},
+    {0x636f0000, 4, 2, 1, 9522, 1},
+    {0x65647500, 9778, 3, 1, 9523, 0},
+    {0x676f7600, 810, 3, 1, 9523, 0},
+    {0x67726f6e, 31036, 7, 1, 9523, 0},
+    {0x6c617700, 5271, 3, 1, 9523, 0},
+    {0x6d696c00, 6019, 3, 1, 9523, 0},
+    {0x6e657400, 2944, 3, 1, 9523, 0},
+    {0x6e676f00, 12810, 3, 1, 9523, 0},
+    {0x6e696300, 23, 3, 1, 9523, 0},
+    {0x6e697300, 3723, 3, 1, 9523, 0},
+    {0x6e6f6d00, 5080, 3, 1, 9523, 0},
+    {0x6f726700, 6352, 3, 1, 9523, 0},
+    {0x7363686f, 22378, 6, 1, 9523, 0},
+    {0x746d0000, 2797, 2, 1, 9523, 0},
+    {0x77656200, 123, 3, 1, 9523, 0},
+    {0x61630000, 35, 2, 1, 9523, 0},
+    {0x62697a00, 38535, 3, 1, 9523, 0},
+    {0x636f0000, 4, 2, 1, 9523, 0},
+    {0x636f6d00, 19, 3, 1, 9523, 0},
+    {0x65647500, 9778, 3, 1, 9523, 0},
+    {0x676f7600, 810, 3, 1, 9523, 0},
+    {0x696e666f, 21606, 4, 1, 9523, 0},
+    {0x6d696c00, 6019, 3, 1, 9523, 0},
+    {0x6e657400, 2944, 3, 1, 9523, 0},
+    {0x6f726700, 6352, 3, 1, 9523, 0},
+    {0x73636800, 1512, 3, 1, 9523, 0},
+    {0x636c6f75, 29769, 7, 1, 9523, 0},
+    {0x68730000, 3863, 2, 1, 9523, 0},
+    {0x6c696d61, 21442, 4, 1, 9523, 0},
+    {0x74726974, 37853, 6, 2, 9523, 0},
+    {0x61630000, 35, 2, 1, 9523, 0},
+    {0x636f0000, 4, 2, 1, 9523, 0},
+    {0x676f7600, 810, 3, 1, 9523, 0},
+    {0x6d696c00, 6019, 3, 1, 9523, 0},
+    {0x6f726700, 6352, 3, 1, 9523, 0},
+    {0x61000000, 26, 1, 1, 9523, 0},
+    {0x70726976, 14238, 11, 1, 9523, 0},
+    {0x626c6f67, 23967, 8, 1, 9523, 0},
+    {0x73746800, 7036, 3, 1, 9523, 0},
+    {0x626c6f67, 23967, 8, 1, 9523, 0},
+    {0x7769656e, 41970, 4, 1, 9523, 0},
+    {0x65780000, 243, 2, 2, 9523, 0},
+    {0x696e0000, 204, 2, 2, 9523, 0},
+    {0x65780000, 243, 2, 2, 9523, 0},
+    {0x6b756e64, 35861, 6, 2, 9523, 0},
+    {0x626c6f67, 23967, 8, 1, 9523, 0},
+    {0x636c6f75, 20002, 9, 0, 9523, 1},
+    {0x6d797370, 10819, 12, 1, 9524, 0},
+    {0x61637400, 2800, 3, 1, 9524, 0},
+    {0x63617468, 24167, 8, 1, 9524, 0},
+    {0x6e737700, 42285, 3, 1, 9524, 1},
+    {0x6e740000, 50, 2, 1, 9525, 0},
+    {0x716c6400, 42339, 3, 1, 9525, 0},
+    {0x73610000, 506, 2, 1, 9525, 0},
+    {0x74617300, 7977, 3, 1, 9525, 0},
+    {0x76696300, 6102, 3, 1, 9525, 0},
+    {0x77610000, 1758, 2, 1, 9525, 0},
+    {0x716c6400, 42339, 3, 1, 9525, 0},
+    {0x73610000, 506, 2, 1, 9525, 0},
+    {0x74617300, 7977, 3, 1, 9525, 0},
+    {0x76696300, 6102, 3, 1, 9525, 0},
+    {0x77610000, 1758, 2, 1, 9525, 0},
+    {0x636c6f75, 2555, 5, 1, 9525, 0},
+    {0x657a7072, 30217, 7, 1, 9525, 0},
+    {0x626c6f67, 23967, 8, 1, 9525, 0},
+    {0x73696d70, 18342, 10, 1, 9525, 0},
+    {0x76697274, 11647, 12, 0, 9525, 1},
+    {0x61630000, 35, 2, 1, 9526, 0},
+    {0x616c0000, 106, 2, 1, 9526, 0},
+    {0x616d0000, 969, 2, 1, 9526, 0},
+    {0x61700000, 131, 2, 1, 9526, 0},
+    {0x62610000, 454, 2, 1, 9526, 0},
+    {0x63650000, 65, 2, 1, 9526, 0},
+    {0x64660000, 3531, 2, 1, 9526, 0},
+    {0x65730000, 27, 2, 1, 9526, 0},
+    {0x676f0000, 810, 2, 1, 9526, 0},
+    {0x6d610000, 970, 2, 1, 9526, 0},
+    {0x6d670000, 323, 2, 1, 9526, 0},
+    {0x6d730000, 578, 2, 1, 9526, 0},
+    {0x6d740000, 1271, 2, 1, 9526, 0},
+    {0x70610000, 778, 2, 1, 9526, 0},
+    {0x70620000, 9846, 2, 1, 9526, 0},
+    {0x70650000, 481, 2, 1, 9526, 0},
+    {0x70690000, 4455, 2, 1, 9526, 0},
+    {0x70720000, 220, 2, 1, 9526, 0},
+    {0x726a0000, 1277, 2, 1, 9526, 0},
+    {0x726e0000, 919, 2, 1, 9526, 0},
+    {0x726f0000, 99, 2, 1, 9526, 0},
+    {0x72720000, 6, 2, 1, 9526, 0},
+    {0x72730000, 868, 2, 1, 9526, 0},
+    {0x73630000, 1512, 2, 1, 9526, 0},
+    {0x73650000, 94, 2, 1, 9526, 0},
+    {0x73700000, 1406, 2, 1, 9526, 0},
+    {0x746f0000, 1004, 2, 1, 9526, 0},
+    {0x61630000, 35, 2, 1, 9526, 0},
+    {0x616c0000, 106, 2, 1, 9526, 0},
+    {0x616d0000, 969, 2, 1, 9526, 0},
+    {0x61700000, 131, 2, 1, 9526, 0},
+    {0x62610000, 454, 2, 1, 9526, 0},
+    {0x63650000, 65, 2, 1, 9526, 0},
+    {0x64660000, 3531, 2, 1, 9526, 0},
+    {0x65730000, 27, 2, 1, 9526, 0},
+    {0x676f0000, 810, 2, 1, 9526, 0},
+    {0x6d610000, 970, 2, 1, 9526, 0},
+    {0x6d670000, 323, 2, 1, 9526, 0},
+    {0x6d730000, 578, 2, 1, 9526, 0},
+    {0x6d740000, 1271, 2, 1, 9526, 0},
+    {0x70610000, 778, 2, 1, 9526, 0},
+    {0x70620000, 9846, 2, 1, 9526, 0},
+    {0x70650000, 481, 2, 1, 9526, 0},
+    {0x70690000, 4455, 2, 1, 9526, 0},
+    {0x70720000, 220, 2, 1, 9526, 0},
+    {0x726a0000, 1277, 2, 1, 9526, 0},
+    {0x726e0000, 919, 2, 1, 9526, 0},
+    {0x726f0000, 99, 2, 1, 9526, 0},
+    {0x72720000, 6, 2, 1, 9526, 0},
+    {0x72730000, 868, 2, 1, 9526, 0},
+    {0x73630000, 1512, 2, 1, 9526, 0},
+    {0x73650000, 94, 2, 1, 9526, 0},
+    {0x73700000, 1406, 2, 1, 9526, 0},
+    {0x746f0000, 1004, 2, 1, 9526, 0},
+    {0x626c6f67, 23967, 8, 1, 9526, 0},
+    {0x75690000, 1494, 2, 1, 9526, 0},
+    {0x696e7374, 20794, 9, 1, 9526, 0},
+    {0x73766300, 42387, 3, 2, 9526, 0},
+    {0x61650000, 26, 2, 0, 9526, 1},
+    {0x61707065, 19570, 9, 1, 9527, 0},
+    {0x65732d31, 41158, 4, 1, 9527, 0},
+    {0x65750000, 766, 2, 1, 9527, 0},
+    {0x76697000, 18692, 3, 1, 9527, 0},
+    {0x61727562, 17037, 5, 0, 9527, 1},
+    {0x69743100, 14947, 3, 1, 9528, 0},
+    {0x63730000, 4927, 2, 1, 9528, 0},
+    {0x746e0000, 1624, 2, 1, 9528, 0},
+    {0x756b0000, 6692, 2, 1, 9528, 0},
+    {0x756b0000, 6692, 2, 1, 9528, 0},
+    {0x63610000, 25, 2, 1, 9528, 0},
+    {0x756b0000, 6692, 2, 1, 9528, 0},
+    {0x75730000, 767, 2, 1, 9528, 0},
+    {0x62617265, 19732, 9, 0, 9528, 3},
+    {0x66722d70, 24799, 6, 0, 9531, 5},
+    {0x696e7374, 20794, 9, 0, 9536, 2},
+    {0x6b387300, 42240, 3, 1, 9538, 0},
+    {0x6e6c2d61, 27007, 6, 0, 9538, 4},
+    {0x706c2d77, 36971, 6, 0, 9542, 3},
+    {0x7363616c, 22369, 9, 1, 9545, 0},
+    {0x736d6172, 8909, 13, 1, 9545, 0},
+    {0x63680000, 36, 2, 1, 9545, 0},
+    {0x64650000, 48, 2, 1, 9545, 0},
+    {0x616d617a, 19471, 9, 0, 9545, 4},
+    {0x64697265, 2806, 6, 1, 9549, 0},
+    {0x626c6f67, 23967, 8, 1, 9549, 0},
+    {0x69640000, 458, 2, 1, 9549, 0},
+    {0x69640000, 458, 2, 1, 9549, 0},
+    {0x64657600, 4572, 3, 2, 9549, 0},
+    {0x61662d73, 15862, 10, 0, 9549, 1},
+    {0x61702d65, 19552, 9, 0, 9550, 1},
+    {0x61702d6e, 131, 14, 0, 9551, 2},
+    {0x61702d6e, 2869, 14, 0, 9553, 4},
+    {0x61702d6e, 6023, 14, 0, 9557, 1},
+    {0x61702d73, 8769, 10, 0, 9558, 4},
+    {0x61702d73, 156, 14, 0, 9562, 2},
+    {0x61702d73, 181, 14, 0, 9564, 2},
+    {0x63612d63, 5190, 12, 0, 9566, 4},
+    {0x636f6d70, 4542, 7, 2, 9570, 0},
+    {0x636f6d70, 20020, 9, 2, 9570, 0},
+    {0x656c6200, 21614, 3, 2, 9570, 0},
+    {0x65752d63, 5205, 12, 0, 9570, 4},
+    {0x65752d6e, 16592, 10, 0, 9574, 1},
+    {0x65752d73, 16602, 10, 0, 9575, 1},
+    {0x65752d77, 1138, 9, 0, 9576, 2},
+    {0x65752d77, 11170, 9, 0, 9578, 4},
+    {0x65752d77, 11182, 9, 0, 9582, 4},
+    {0x6d652d73, 17512, 10, 0, 9586, 1},
+    {0x73330000, 120, 2, 1, 9587, 0},
+    {0x73332d61, 2849, 17, 1, 9587, 0},
+    {0x73332d61, 2866, 17, 1, 9587, 0},
+    {0x73332d61, 8766, 13, 1, 9587, 0},
+    {0x73332d61, 2883, 17, 1, 9587, 0},
+    {0x73332d61, 2900, 17, 1, 9587, 0},
+    {0x73332d63, 5187, 15, 1, 9587, 0},
+    {0x73332d65, 5202, 15, 1, 9587, 0},
+    {0x73332d65, 11155, 12, 1, 9587, 0},
+    {0x73332d65, 11167, 12, 1, 9587, 0},
+    {0x73332d65, 11179, 12, 1, 9587, 0},
+    {0x73332d65, 8779, 13, 1, 9587, 0},
+    {0x73332d66, 799, 21, 1, 9587, 0},
+    {0x73332d73, 11191, 12, 1, 9587, 0},
+    {0x73332d75, 11203, 12, 1, 9587, 0},
+    {0x73332d75, 3900, 16, 1, 9587, 0},
+    {0x73332d75, 11215, 12, 1, 9587, 0},
+    {0x73332d75, 11227, 12, 1, 9587, 0},
+    {0x73332d77, 120, 25, 1, 9587, 0},
+    {0x73332d77, 145, 25, 1, 9587, 0},
+    {0x73332d77, 170, 25, 1, 9587, 0},
+    {0x73332d77, 1127, 20, 1, 9587, 0},
+    {0x73332d77, 1147, 20, 1, 9587, 0},
+    {0x73332d77, 1167, 20, 1, 9587, 0},
+    {0x73332d77, 1187, 20, 1, 9587, 0},
+    {0x73332d77, 1207, 20, 1, 9587, 0},
+    {0x73612d65, 1158, 9, 0, 9587, 2},
+    {0x75732d65, 1178, 9, 1, 9589, 2},
+    {0x75732d65, 11206, 9, 0, 9591, 4},
+    {0x75732d77, 1198, 9, 0, 9595, 1},
+    {0x75732d77, 1218, 9, 0, 9596, 1},
+    {0x72000000, 6, 1, 2, 9597, 0},
+    {0x616c7068, 2543, 5, 1, 9597, 0},
+    {0x62657461, 16062, 4, 1, 9597, 0},
+    {0x6275696c, 12988, 7, 2, 9597, 0},
+    {0x6465762d, 12984, 11, 2, 9597, 0},
+    {0x7374672d, 14513, 11, 2, 9597, 0},
+    {0x6f636900, 791, 3, 2, 9597, 0},
+    {0x6f637000, 42288, 3, 2, 9597, 0},
+    {0x6f637300, 14323, 3, 2, 9597, 0},
+    {0x64656d6f, 8303, 4, 1, 9597, 0},
+    {0x696e7374, 20794, 8, 1, 9597, 0},
+    {0x61702d6e, 131, 14, 1, 9597, 0},
+    {0x61702d6e, 2869, 14, 1, 9597, 0},
+    {0x61702d6e, 6023, 14, 1, 9597, 0},
+    {0x61702d73, 8769, 10, 1, 9597, 0},
+    {0x61702d73, 156, 14, 1, 9597, 0},
+    {0x61702d73, 181, 14, 1, 9597, 0},
+    {0x63612d63, 5190, 12, 1, 9597, 0},
+    {0x65752d63, 5205, 12, 1, 9597, 0},
+    {0x65752d77, 1138, 9, 1, 9597, 0},
+    {0x65752d77, 11170, 9, 1, 9597, 0},
+    {0x65752d77, 11182, 9, 1, 9597, 0},
+    {0x73612d65, 1158, 9, 1, 9597, 0},
+    {0x75732d65, 1178, 9, 1, 9597, 0},
+    {0x75732d65, 11206, 9, 1, 9597, 0},
+    {0x75732d67, 807, 13, 1, 9597, 0},
+    {0x75732d77, 1198, 9, 1, 9597, 0},
+    {0x75732d77, 1218, 9, 1, 9597, 0},
+    {0x65752d31, 41162, 4, 1, 9597, 0},
+    {0x65752d32, 41166, 4, 1, 9597, 0},
+    {0x65752d33, 41170, 4, 1, 9597, 0},
+    {0x65752d34, 41174, 4, 1, 9597, 0},
+    {0x75732d31, 41914, 4, 1, 9597, 0},
+    {0x75732d32, 41918, 4, 1, 9597, 0},
+    {0x75732d33, 41922, 4, 1, 9597, 0},
+    {0x75732d34, 41926, 4, 1, 9597, 0},
+    {0x61707073, 1403, 4, 1, 9597, 0},
+    {0x70616173, 33965, 4, 1, 9597, 0},
+    {0x7261672d, 11095, 9, 1, 9597, 0},
+    {0x7261672d, 11095, 12, 1, 9597, 0},
+    {0x6a636c6f, 6653, 6, 1, 9597, 0},
+    {0x6a636c6f, 6653, 14, 1, 9597, 0},
+    {0x64656d6f, 8303, 4, 1, 9597, 0},
+    {0x636e7300, 42090, 3, 2, 9597, 0},
+    {0x6d656d62, 32156, 7, 1, 9597, 0},
+    {0x6e6f6465, 10939, 12, 2, 9597, 0},
+    {0x69700000, 803, 2, 1, 9597, 0},
+    {0x61707000, 1403, 3, 1, 9597, 0},
+    {0x70616173, 33965, 4, 1, 9597, 0},
+    {0x65750000, 766, 2, 1, 9597, 0},
+    {0x63617261, 29566, 7, 1, 9597, 0},
+    {0x63757374, 9979, 8, 1, 9597, 0},
+    {0x66656e74, 24703, 8, 1, 9597, 0},
+    {0x6c796e78, 41510, 4, 1, 9597, 0},
+    {0x6f63656c, 36743, 6, 1, 9597, 0},
+    {0x6f6e6369, 32639, 7, 1, 9597, 0},
+    {0x6f6e7a61, 737, 4, 1, 9597, 0},
+    {0x73706869, 37439, 6, 1, 9597, 0},
+    {0x76730000, 5019, 2, 1, 9597, 0},
+    {0x78000000, 0, 1, 1, 9597, 0},
+    {0x79616c69, 26281, 4, 1, 9597, 0},
+    {0x636c6f75, 2555, 5, 1, 9597, 0},
+    {0x73746174, 4367, 6, 1, 9597, 0},
+    {0x78656e00, 42453, 3, 1, 9597, 0},
+    {0x65750000, 766, 2, 1, 9597, 0},
+    {0x61707000, 1403, 3, 1, 9597, 0},
+    {0x61706900, 6634, 3, 1, 9597, 0},
+    {0x73697465, 126, 4, 1, 9597, 0},
+    {0x70726f00, 5042, 3, 1, 9597, 0},
+    {0x6a656400, 42219, 3, 1, 9597, 0},
+    {0x6c6f6e00, 1029, 3, 1, 9597, 0},
+    {0x72796400, 20072, 3, 1, 9597, 0},
+    {0x70616765, 2094, 5, 1, 9597, 0},
+    {0x6a730000, 14563, 2, 1, 9597, 0},
+    {0x75320000, 18989, 2, 1, 9597, 0},
+    {0x75322d6c, 28567, 8, 1, 9597, 0},
+    {0x626c6f67, 23967, 8, 1, 9597, 0},
+    {0x7363616c, 18172, 10, 0, 9597, 1},
+    {0x636c6f75, 2555, 5, 2, 9598, 0},
+    {0x63757374, 9979, 6, 1, 9598, 0},
+    {0x636c6f75, 2555, 5, 0, 9598, 2},
+    {0x64796e00, 4587, 3, 1, 9600, 0},
+    {0x64796e00, 4587, 3, 1, 9600, 0},
+    {0x64796e64, 6317, 6, 1, 9600, 0},
+    {0x64796e00, 4587, 3, 1, 9600, 0},
+    {0x69740000, 127, 2, 0, 9600, 1},
+    {0x63757374, 9979, 8, 1, 9601, 0},
+    {0x75736572, 767, 4, 2, 9601, 0},
+    {0x6c6f6e64, 36029, 6, 1, 9601, 0},
+    {0x627a7a00, 42063, 3, 2, 9601, 0},
+    {0x6769742d, 20461, 9, 1, 9601, 0},
+    {0x626c6f67, 23967, 8, 1, 9601, 0},
+    {0x626c6f67, 23967, 8, 1, 9601, 0},
+    {0x626c6f67, 23967, 8, 1, 9601, 0},
+    {0x6a656c61, 25487, 8, 1, 9601, 0},
+    {0x75736572, 767, 4, 1, 9601, 0},
+    {0x66690000, 720, 2, 1, 9601, 0},
+    {0x64656d6f, 8303, 4, 1, 9601, 0},
+    {0x70616173, 33965, 4, 1, 9601, 0},
+    {0x6461656d, 34709, 6, 1, 9601, 0},
+    {0x626c6f67, 23967, 8, 1, 9601, 0},
+    {0x72737300, 6903, 3, 2, 9601, 0},
+    {0x626c6f67, 23967, 8, 1, 9601, 0},
+    {0x6d797461, 32303, 7, 1, 9601, 0},
+    {0x72617670, 32877, 7, 1, 9601, 0},
+    {0x74616269, 18412, 10, 1, 9601, 0},
+    {0x6c746400, 33033, 3, 1, 9601, 0},
+    {0x706c6300, 42309, 3, 1, 9601, 0},
+    {0x61707000, 1403, 3, 1, 9601, 0},
+    {0x6261636b, 19687, 9, 2, 9601, 0},
+    {0x70616173, 33965, 4, 1, 9601, 0},
+    {0x73656b64, 40320, 5, 1, 9601, 0},
+    {0x756b3000, 42414, 3, 1, 9601, 0},
+    {0x64796e64, 6317, 6, 1, 9601, 0},
+    {0x69640000, 458, 2, 1, 9601, 0},
+    {0x61707073, 1403, 4, 1, 9601, 0},
+    {0x73746167, 16287, 5, 1, 9601, 0},
+    {0x6d6f636b, 41546, 4, 1, 9601, 0},
+    {0x73797300, 5160, 3, 2, 9601, 0},
+    {0x64657669, 6100, 7, 1, 9601, 0},
+    {0x64657600, 4572, 3, 0, 9601, 2},
+    {0x64697372, 34793, 6, 0, 9603, 2},
+    {0x70726f64, 7931, 4, 0, 9605, 1},
+    {0x74657374, 33514, 7, 0, 9606, 2},
+    {0x636c6f75, 19984, 9, 1, 9608, 0},
+    {0x67000000, 30, 1, 1, 9608, 0},
+    {0x6a630000, 6653, 2, 1, 9608, 0},
+    {0x6f70656e, 16383, 4, 0, 9608, 1},
+    {0x61697361, 38355, 5, 1, 9609, 0},
+    {0x616d6100, 969, 3, 1, 9609, 0},
+    {0x616e6a6f, 39746, 4, 1, 9609, 0},
+    {0x6173756b, 38430, 5, 1, 9609, 0},
+    {0x63686972, 34595, 6, 1, 9609, 0},
+    {0x63686974, 38635, 5, 1, 9609, 0},
+    {0x6675736f, 41234, 4, 1, 9609, 0},
+    {0x67616d61, 24959, 8, 1, 9609, 0},
+    {0x68616e64, 39105, 5, 1, 9609, 0},
+    {0x68617a75, 29327, 4, 1, 9609, 0},
+    {0x68656b69, 31148, 7, 1, 9609, 0},
+    {0x68696761, 16862, 10, 1, 9609, 0},
+    {0x69636869, 16922, 10, 1, 9609, 0},
+    {0x696e617a, 31302, 7, 1, 9609, 0},
+    {0x696e7579, 31323, 7, 1, 9609, 0},
+    {0x69737368, 31393, 7, 1, 9609, 0},
+    {0x6977616b, 31442, 7, 1, 9609, 0},
+    {0x6b616e69, 39315, 5, 1, 9609, 0},
+    {0x6b617269, 35669, 6, 1, 9609, 0},
+    {0x6b617375, 31624, 7, 1, 9609, 0},
+    {0x6b697261, 25833, 4, 1, 9609, 0},
+    {0x6b69796f, 35789, 6, 1, 9609, 0},
+    {0x6b6f6d61, 35795, 6, 1, 9609, 0},
+    {0x6b6f6e61, 39380, 5, 1, 9609, 0},
+    {0x6b6f7461, 27778, 4, 1, 9609, 0},
+    {0x6d696861, 36239, 6, 1, 9609, 0},
+    {0x6d69796f, 3637, 7, 1, 9609, 0},
+    {0x6e697368, 14007, 6, 1, 9609, 0},
+    {0x6e697373, 32450, 7, 1, 9609, 0},
+    {0x6f627500, 24078, 3, 1, 9609, 0},
+    {0x6f677563, 36755, 6, 1, 9609, 0},
+    {0x6f686172, 39895, 5, 1, 9609, 0},
+    {0x6f6b617a, 32569, 7, 1, 9609, 0},
+    {0x6f776172, 17902, 10, 1, 9609, 0},
+    {0x7365746f, 25027, 4, 1, 9609, 0},
+    {0x7368696b, 10905, 8, 1, 9609, 0},
+    {0x7368696e, 22585, 9, 1, 9609, 0},
+    {0x73686974, 33220, 7, 1, 9609, 0},
+    {0x74616861, 37595, 6, 1, 9609, 0},
+    {0x74616b61, 28159, 8, 1, 9609, 0},
+    {0x746f6269, 22972, 9, 1, 9609, 0},
+    {0x746f6569, 41866, 4, 1, 9609, 0},
+    {0x746f676f, 41870, 4, 1, 9609, 0},
+    {0x746f6b61, 40620, 5, 1, 9609, 0},
+    {0x746f6b6f, 28399, 8, 1, 9609, 0},
+    {0x746f796f, 33640, 7, 1, 9609, 0},
+    {0x746f796f, 23044, 9, 1, 9609, 0},
+    {0x746f796f, 28455, 8, 1, 9609, 0},
+    {0x746f796f, 37799, 6, 1, 9609, 0},
+    {0x746f796f, 37811, 6, 1, 9609, 0},
+    {0x74737573, 2671, 8, 1, 9609, 0},
+    {0x7961746f, 38255, 6, 1, 9609, 0},
+    {0x616b6974, 8440, 5, 1, 9609, 0},
+    {0x64616973, 34715, 6, 1, 9609, 0},
+    {0x66756a69, 24863, 8, 1, 9609, 0},
+    {0x676f6a6f, 35159, 6, 1, 9609, 0},
+    {0x68616368, 13413, 11, 1, 9609, 0},
+    {0x68617070, 35273, 6, 1, 9609, 0},
+    {0x68696761, 8246, 13, 1, 9609, 0},
+    {0x686f6e6a, 23624, 5, 1, 9609, 0},
+    {0x686f6e6a, 35411, 6, 1, 9609, 0},
+    {0x696b6177, 4755, 5, 1, 9609, 0},
+    {0x6b616d69, 21001, 9, 1, 9609, 0},
+    {0x6b616d69, 31526, 7, 1, 9609, 0},
+    {0x6b617461, 25743, 8, 1, 9609, 0},
+    {0x6b617a75, 35729, 6, 1, 9609, 0},
+    {0x6b697461, 21172, 9, 1, 9609, 0},
+    {0x6b6f7361, 35825, 6, 1, 9609, 0},
+    {0x6b796f77, 39445, 5, 1, 9609, 0},
+    {0x6d697361, 6535, 6, 1, 9609, 0},
+    {0x6d697461, 17586, 6, 1, 9609, 0},
+    {0x6d6f7269, 21766, 9, 1, 9609, 0},
+    {0x6e696b61, 36653, 6, 1, 9609, 0},
+    {0x6e6f7368, 32499, 7, 1, 9609, 0},
+    {0x6f646174, 22517, 5, 1, 9609, 0},
+    {0x6f676100, 4852, 3, 1, 9609, 0},
+    {0x6f676174, 13419, 5, 1, 9609, 0},
+    {0x73656d62, 33136, 7, 1, 9609, 0},
+    {0x796f6b6f, 38273, 6, 1, 9609, 0},
+    {0x79757269, 23620, 9, 1, 9609, 0},
+    {0x616f6d6f, 34295, 6, 1, 9609, 0},
+    {0x676f6e6f, 35171, 6, 1, 9609, 0},
+    {0x68616368, 20533, 9, 1, 9609, 0},
+    {0x68617368, 20551, 9, 1, 9609, 0},
+    {0x68697261, 31162, 7, 1, 9609, 0},
+    {0x6869726f, 25191, 8, 1, 9609, 0},
+    {0x69746179, 20848, 9, 1, 9609, 0},
+    {0x6b75726f, 26127, 8, 1, 9609, 0},
+    {0x6d697361, 36311, 6, 1, 9609, 0},
+    {0x6d757473, 21793, 5, 1, 9609, 0},
+    {0x6e616b61, 17702, 10, 1, 9609, 0},
+    {0x6e6f6865, 36689, 6, 1, 9609, 0},
+    {0x6f697261, 36767, 6, 1, 9609, 0},
+    {0x6f77616e, 39975, 5, 1, 9609, 0},
+    {0x726f6b75, 27527, 8, 1, 9609, 0},
+    {0x73616e6e, 33045, 7, 1, 9609, 0},
+    {0x73686963, 18282, 10, 1, 9609, 0},
+    {0x7368696e, 37325, 6, 1, 9609, 0},
+    {0x74616b6b, 40540, 5, 1, 9609, 0},
+    {0x746f7761, 37787, 6, 1, 9609, 0},
+    {0x74737567, 33738, 7, 1, 9609, 0},
+    {0x74737572, 33766, 7, 1, 9609, 0},
+    {0x6162696b, 38330, 5, 1, 9609, 0},
+    {0x61736168, 17907, 5, 1, 9609, 0},
+    {0x63686f6e, 34601, 6, 1, 9609, 0},
+    {0x63686f73, 34607, 6, 1, 9609, 0},
+    {0x63686f73, 34613, 6, 1, 9609, 0},
+    {0x6368756f, 14476, 4, 1, 9609, 0},
+    {0x66756e61, 20380, 9, 1, 9609, 0},
+    {0x66757474, 35039, 6, 1, 9609, 0},
+    {0x68616e61, 16822, 10, 1, 9609, 0},
+    {0x69636869, 25327, 8, 1, 9609, 0},
+    {0x69636869, 6527, 8, 1, 9609, 0},
+    {0x69636869, 16922, 10, 1, 9609, 0},
+    {0x696e7a61, 39235, 5, 1, 9609, 0},
+    {0x6973756d, 3634, 5, 1, 9609, 0},
+    {0x6b616d61, 25599, 8, 1, 9609, 0},
+    {0x6b616d6f, 25687, 8, 1, 9609, 0},
+    {0x6b617368, 13677, 7, 1, 9609, 0},
+    {0x6b61746f, 28225, 6, 1, 9609, 0},
+    {0x6b617473, 8615, 8, 1, 9609, 0},
+    {0x6b696d69, 31694, 7, 1, 9609, 0},
+    {0x6b697361, 25871, 8, 1, 9609, 0},
+    {0x6b6f7a61, 35843, 6, 1, 9609, 0},
+    {0x6b756a75, 26031, 8, 1, 9609, 0},
+    {0x6b796f6e, 35903, 6, 1, 9609, 0},
+    {0x6d617473, 32128, 7, 1, 9609, 0},
+    {0x6d69646f, 36215, 6, 1, 9609, 0},
+    {0x6d696861, 36239, 6, 1, 9609, 0},
+    {0x6d696e61, 17562, 10, 1, 9609, 0},
+    {0x6d6f6261, 36389, 6, 1, 9609, 0},
+    {0x6d757473, 21793, 9, 1, 9609, 0},
+    {0x6e616761, 36533, 6, 1, 9609, 0},
+    {0x6e616761, 17692, 10, 1, 9609, 0},
+    {0x6e617261, 21865, 9, 1, 9609, 0},
+    {0x6e617269, 36587, 6, 1, 9609, 0},
+    {0x6e6f6461, 21257, 4, 1, 9609, 0},
+    {0x6f616d69, 8649, 13, 1, 9609, 0},
+    {0x6f6d6967, 32611, 7, 1, 9609, 0},
+    {0x6f6e6a75, 36815, 6, 1, 9609, 0},
+    {0x6f74616b, 26138, 5, 1, 9609, 0},
+    {0x73616b61, 40255, 5, 1, 9609, 0},
+    {0x73616b75, 18122, 6, 1, 9609, 0},
+    {0x7368696d, 22522, 9, 1, 9609, 0},
+    {0x73686972, 33206, 7, 1, 9609, 0},
+    {0x73686972, 16967, 6, 1, 9609, 0},
+    {0x73686973, 37349, 6, 1, 9609, 0},
+    {0x736f6465, 22693, 9, 1, 9609, 0},
+    {0x736f7361, 25881, 4, 1, 9609, 0},
+    {0x74616b6f, 39251, 4, 1, 9609, 0},
+    {0x74617465, 28335, 8, 1, 9609, 0},
+    {0x746f6761, 37727, 6, 1, 9609, 0},
+    {0x746f686e, 28383, 8, 1, 9609, 0},
+    {0x746f6d69, 28415, 8, 1, 9609, 0},
+    {0x75726179, 33808, 7, 1, 9609, 0},
+    {0x79616368, 23530, 9, 1, 9609, 0},
+    {0x79616368, 34081, 7, 1, 9609, 0},
+    {0x796f6b61, 19342, 10, 1, 9609, 0},
+    {0x796f6b6f, 5952, 15, 1, 9609, 0},
+    {0x796f7473, 19352, 10, 1, 9609, 0},
+    {0x61696e61, 35616, 5, 1, 9609, 0},
+    {0x686f6e61, 37356, 5, 1, 9609, 0},
+    {0x696b6174, 21932, 5, 1, 9609, 0},
+    {0x696d6162, 31274, 7, 1, 9609, 0},
+    {0x69796f00, 3638, 3, 1, 9609, 0},
+    {0x6b616d69, 8693, 8, 1, 9609, 0},
+    {0x6b69686f, 35747, 6, 1, 9609, 0},
+    {0x6b756d61, 21271, 9, 1, 9609, 0},
+    {0x6d617361, 36143, 6, 1, 9609, 0},
+    {0x6d617473, 32135, 7, 1, 9609, 0},
+    {0x6d617473, 3603, 9, 1, 9609, 0},
+    {0x6e616d69, 26855, 8, 1, 9609, 0},
+    {0x6e696968, 32436, 7, 1, 9609, 0},
+    {0x6f7a7500, 41903, 3, 1, 9609, 0},
+    {0x7361696a, 40240, 5, 1, 9609, 0},
+    {0x73656979, 40310, 5, 1, 9609, 0},
+    {0x7368696b, 14469, 11, 1, 9609, 0},
+    {0x746f6265, 33563, 4, 1, 9609, 0},
+    {0x746f6f6e, 3751, 4, 1, 9609, 0},
+    {0x75636869, 4761, 6, 1, 9609, 0},
+    {0x7577616a, 33829, 7, 1, 9609, 0},
+    {0x79617761, 19332, 10, 1, 9609, 0},
+    {0x65636869, 8538, 7, 1, 9609, 0},
+    {0x65696865, 30112, 7, 1, 9609, 0},
+    {0x66756b75, 38955, 5, 1, 9609, 0},
+    {0x696b6564, 39205, 5, 1, 9609, 0},
+    {0x6b617473, 21100, 9, 1, 9609, 0},
+    {0x6d696861, 36239, 6, 1, 9609, 0},
+    {0x6d696e61, 8532, 13, 1, 9609, 0},
+    {0x6f62616d, 39855, 5, 1, 9609, 0},
+    {0x6f686900, 6484, 3, 1, 9609, 0},
+    {0x6f6e6f00, 12956, 3, 1, 9609, 0},
+    {0x73616261, 40230, 5, 1, 9609, 0},
+    {0x73616b61, 14359, 5, 1, 9609, 0},
+    {0x74616b61, 28159, 8, 1, 9609, 0},
+    {0x74737572, 11527, 7, 1, 9609, 0},
+    {0x77616b61, 21044, 6, 1, 9609, 0},
+    {0x61736869, 8262, 6, 1, 9609, 0},
+    {0x62757a65, 38575, 5, 1, 9609, 0},
+    {0x6368696b, 29678, 7, 1, 9609, 0},
+    {0x6368696b, 19957, 7, 1, 9609, 0},
+    {0x6368696b, 29685, 7, 1, 9609, 0},
+    {0x6368696b, 16252, 10, 1, 9609, 0},
+    {0x6368696b, 24199, 8, 1, 9609, 0},
+    {0x6368756f, 14476, 4, 1, 9609, 0},
+    {0x64617a61, 29951, 7, 1, 9609, 0},
+    {0x66756b75, 13358, 7, 1, 9609, 0},
+    {0x68616b61, 35219, 6, 1, 9609, 0},
+    {0x68696761, 2662, 7, 1, 9609, 0},
+    {0x6869726f, 25183, 8, 1, 9609, 0},
+    {0x68697361, 25199, 8, 1, 9609, 0},
+    {0x69697a75, 35483, 6, 1, 9609, 0},
+    {0x696e6174, 25343, 8, 1, 9609, 0},
+    {0x6b61686f, 13477, 4, 1, 9609, 0},
+    {0x6b617375, 31624, 6, 1, 9609, 0},
+    {0x6b617375, 35681, 6, 1, 9609, 0},
+    {0x6b617761, 35705, 6, 1, 9609, 0},
+    {0x6b656973, 35735, 6, 1, 9609, 0},
+    {0x6b6f6761, 17737, 4, 1, 9609, 0},
+    {0x6b757261, 35873, 6, 1, 9609, 0},
+    {0x6b75726f, 35891, 6, 1, 9609, 0},
+    {0x6b757275, 8240, 6, 1, 9609, 0},
+    {0x6d696e61, 5082, 6, 1, 9609, 0},
+    {0x6d697961, 17612, 6, 1, 9609, 0},
+    {0x6d697961, 5086, 6, 1, 9609, 0},
+    {0x6d697961, 26543, 8, 1, 9609, 0},
+    {0x6d697a75, 26559, 8, 1, 9609, 0},
+    {0x6d756e61, 26679, 8, 1, 9609, 0},
+    {0x6e616b61, 26791, 8, 1, 9609, 0},
+    {0x6e616b61, 36563, 6, 1, 9609, 0},
+    {0x6e697368, 10891, 5, 1, 9609, 0},
+    {0x6e6f6761, 36683, 6, 1, 9609, 0},
+    {0x6f676f72, 39885, 5, 1, 9609, 0},
+    {0x6f6b6167, 32555, 7, 1, 9609, 0},
+    {0x6f6b6177, 17097, 5, 1, 9609, 0},
+    {0x6f6b6900, 6249, 3, 1, 9609, 0},
+    {0x6f6d7574, 39925, 5, 1, 9609, 0},
+    {0x6f6e6761, 30845, 4, 1, 9609, 0},
+    {0x6f6e6f6a, 17617, 5, 1, 9609, 0},
+    {0x6f746f00, 2754, 3, 1, 9609, 0},
+    {0x73616967, 33003, 7, 1, 9609, 0},
+    {0x73617361, 27639, 8, 1, 9609, 0},
+    {0x7368696e, 37331, 6, 1, 9609, 0},
+    {0x7368696e, 8883, 13, 1, 9609, 0},
+    {0x73686f6e, 37355, 6, 1, 9609, 0},
+    {0x736f6564, 40430, 5, 1, 9609, 0},
+    {0x73756500, 1602, 3, 1, 9609, 0},
+    {0x74616368, 22873, 9, 1, 9609, 0},
+    {0x74616761, 25905, 6, 1, 9609, 0},
+    {0x74616b61, 8760, 6, 1, 9609, 0},
+    {0x746f686f, 35403, 4, 1, 9609, 0},
+    {0x746f796f, 33654, 7, 1, 9609, 0},
+    {0x74737569, 37877, 6, 1, 9609, 0},
+    {0x756b6968, 40700, 5, 1, 9609, 0},
+    {0x756d6900, 3636, 3, 1, 9609, 0},
+    {0x75737569, 40504, 4, 1, 9609, 0},
+    {0x79616d61, 38219, 6, 1, 9609, 0},
+    {0x79616d65, 4346, 4, 1, 9609, 0},
+    {0x79616e61, 28935, 8, 1, 9609, 0},
+    {0x79756b75, 23611, 9, 1, 9609, 0},
+    {0x61697a75, 19417, 9, 1, 9609, 0},
+    {0x61697a75, 15892, 10, 1, 9609, 0},
+    {0x61697a75, 7700, 13, 1, 9609, 0},
+    {0x6173616b, 29223, 7, 1, 9609, 0},
+    {0x62616e64, 34403, 6, 1, 9609, 0},
+    {0x64617465, 6593, 4, 1, 9609, 0},
+    {0x66756b75, 8432, 9, 1, 9609, 0},
+    {0x66757275, 24935, 8, 1, 9609, 0},
+    {0x66757461, 35027, 6, 1, 9609, 0},
+    {0x68616e61, 35255, 6, 1, 9609, 0},
+    {0x68696761, 2662, 7, 1, 9609, 0},
+    {0x68697261, 22613, 6, 1, 9609, 0},
+    {0x6869726f, 32502, 6, 1, 9609, 0},
+    {0x69697461, 35471, 6, 1, 9609, 0},
+    {0x696e6177, 16962, 10, 1, 9609, 0},
+    {0x69736869, 21938, 8, 1, 9609, 0},
+    {0x6977616b, 21968, 5, 1, 9609, 0},
+    {0x697a756d, 20884, 9, 1, 9609, 0},
+    {0x6b616761, 17072, 10, 1, 9609, 0},
+    {0x6b616e65, 25711, 8, 1, 9609, 0},
+    {0x6b617761, 25783, 8, 1, 9609, 0},
+    {0x6b697461, 25927, 8, 1, 9609, 0},
+    {0x6b697461, 10615, 12, 1, 9609, 0},
+    {0x6b6f6f72, 39390, 5, 1, 9609, 0},
+    {0x6b6f7269, 7653, 8, 1, 9609, 0},
+    {0x6b756e69, 35867, 6, 1, 9609, 0},
+    {0x6d696861, 36245, 6, 1, 9609, 0},
+    {0x6d697368, 32191, 7, 1, 9609, 0},
+    {0x6e616d69, 8534, 5, 1, 9609, 0},
+    {0x6e616e67, 39740, 5, 1, 9609, 0},
+    {0x6e697368, 21901, 9, 1, 9609, 0},
+    {0x6e697368, 32443, 7, 1, 9609, 0},
+    {0x6f6b756d, 26062, 5, 1, 9609, 0},
+    {0x6f6d6f74, 32625, 7, 1, 9609, 0},
+    {0x6f6e6f00, 12956, 3, 1, 9609, 0},
+    {0x6f74616d, 37654, 5, 1, 9609, 0},
+    {0x73616d65, 27575, 8, 1, 9609, 0},
+    {0x7368696d, 33192, 7, 1, 9609, 0},
+    {0x73686972, 3619, 9, 1, 9609, 0},
+    {0x73686f77, 40365, 5, 1, 9609, 0},
+    {0x736f6d61, 41798, 4, 1, 9609, 0},
+    {0x73756b61, 28047, 8, 1, 9609, 0},
+    {0x74616973, 33451, 7, 1, 9609, 0},
+    {0x74616d61, 28279, 8, 1, 9609, 0},
+    {0x74616e61, 28295, 8, 1, 9609, 0},
+    {0x74656e65, 40560, 5, 1, 9609, 0},
+    {0x79616275, 38183, 6, 1, 9609, 0},
+    {0x79616d61, 7647, 6, 1, 9609, 0},
+    {0x79616d61, 23566, 9, 1, 9609, 0},
+    {0x79616e61, 34102, 7, 1, 9609, 0},
+    {0x79756761, 29007, 6, 1, 9609, 0},
+    {0x616e7061, 29181, 7, 1, 9609, 0},
+    {0x656e6100, 1638, 3, 1, 9609, 0},
+    {0x67696675, 41246, 4, 1, 9609, 0},
+    {0x67696e61, 38990, 5, 1, 9609, 0},
+    {0x676f646f, 41262, 4, 1, 9609, 0},
+    {0x67756a6f, 41294, 4, 1, 9609, 0},
+    {0x68617368, 31134, 7, 1, 9609, 0},
+    {0x68696368, 31155, 7, 1, 9609, 0},
+    {0x68696461, 13354, 4, 1, 9609, 0},
+    {0x68696761, 3612, 16, 1, 9609, 0},
+    {0x69626967, 31246, 7, 1, 9609, 0},
+    {0x696b6564, 39205, 5, 1, 9609, 0},
+    {0x6b616b61, 10555, 12, 1, 9609, 0},
+    {0x6b616e69, 13965, 4, 1, 9609, 0},
+    {0x6b617361, 25727, 8, 1, 9609, 0},
+    {0x6b617361, 21046, 9, 1, 9609, 0},
+    {0x6b617761, 35711, 6, 1, 9609, 0},
+    {0x6b697461, 25895, 8, 1, 9609, 0},
+    {0x6d696e6f, 10765, 4, 1, 9609, 0},
+    {0x6d696e6f, 26527, 8, 1, 9609, 0},
+    {0x6d697461, 36329, 6, 1, 9609, 0},
+    {0x6d697a75, 26567, 8, 1, 9609, 0},
+    {0x6d6f746f, 36455, 6, 1, 9609, 0},
+    {0x6e616b61, 13974, 11, 1, 9609, 0},
+    {0x6f67616b, 34290, 5, 1, 9609, 0},
+    {0x73616b61, 27543, 8, 1, 9609, 0},
+    {0x73656b69, 10546, 4, 1, 9609, 0},
+    {0x73656b69, 18212, 10, 1, 9609, 0},
+    {0x73686972, 3619, 9, 1, 9609, 0},
+    {0x74616a69, 37613, 6, 1, 9609, 0},
+    {0x74616b61, 28231, 8, 1, 9609, 0},
+    {0x74617275, 40550, 5, 1, 9609, 0},
+    {0x746f6b69, 25941, 4, 1, 9609, 0},
+    {0x746f6d69, 37745, 6, 1, 9609, 0},
+    {0x77616e6f, 28775, 8, 1, 9609, 0},
+    {0x79616d61, 28903, 8, 1, 9609, 0},
+    {0x79616f74, 38225, 6, 1, 9609, 0},
+    {0x796f726f, 36613, 4, 1, 9609, 0},
+    {0x616e6e61, 34277, 6, 1, 9609, 0},
+    {0x63686979, 29713, 7, 1, 9609, 0},
+    {0x66756a69, 30798, 7, 1, 9609, 0},
+    {0x68696761, 4797, 15, 1, 9609, 0},
+    {0x69736573, 31379, 7, 1, 9609, 0},
+    {0x6974616b, 31407, 7, 1, 9609, 0},
+    {0x6b616e6e, 31540, 5, 1, 9609, 0},
+    {0x6b616e72, 39320, 5, 1, 9609, 0},
+    {0x6b617461, 21082, 9, 1, 9609, 0},
+    {0x6b617761, 35699, 6, 1, 9609, 0},
+    {0x6b697279, 39345, 5, 1, 9609, 0},
+    {0x6b757361, 31813, 7, 1, 9609, 0},
+    {0x6d616562, 26311, 8, 1, 9609, 0},
+    {0x6d656977, 39620, 5, 1, 9609, 0},
+    {0x6d69646f, 36215, 6, 1, 9609, 0},
+    {0x6d696e61, 26503, 8, 1, 9609, 0},
+    {0x6e616761, 17672, 10, 1, 9609, 0},
+    {0x6e616b61, 26807, 8, 1, 9609, 0},
+    {0x6e616e6d, 32345, 7, 1, 9609, 0},
+    {0x6e756d61, 36725, 6, 1, 9609, 0},
+    {0x6f697a75, 20883, 6, 1, 9609, 0},
+    {0x6f726100, 3519, 3, 1, 9609, 0},
+    {0x6f746100, 3442, 3, 1, 9609, 0},
+    {0x73686962, 22468, 9, 1, 9609, 0},
+    {0x7368696d, 22549, 9, 1, 9609, 0},
+    {0x7368696e, 27807, 6, 1, 9609, 0},
+    {0x73686f77, 40365, 5, 1, 9609, 0},
+    {0x74616b61, 28215, 8, 1, 9609, 0},
+    {0x74616b61, 28231, 8, 1, 9609, 0},
+    {0x74616d61, 28287, 8, 1, 9609, 0},
+    {0x74617465, 14590, 11, 1, 9609, 0},
+    {0x746f6d69, 33584, 7, 1, 9609, 0},
+    {0x7473756b, 23080, 9, 1, 9609, 0},
+    {0x7473756d, 28535, 8, 1, 9609, 0},
+    {0x75656e6f, 28599, 4, 1, 9609, 0},
+    {0x796f7368, 28999, 8, 1, 9609, 0},
+    {0x6173616d, 19624, 9, 1, 9609, 0},
+    {0x64616977, 38705, 5, 1, 9609, 0},
+    {0x6574616a, 30189, 7, 1, 9609, 0},
+    {0x66756368, 38945, 5, 1, 9609, 0},
+    {0x66756b75, 24903, 8, 1, 9609, 0},
+    {0x68617473, 13446, 11, 1, 9609, 0},
+    {0x68696761, 3580, 16, 1, 9609, 0},
+    {0x686f6e67, 39160, 5, 1, 9609, 0},
+    {0x6a696e73, 10543, 12, 1, 9609, 0},
+    {0x6b616974, 39305, 5, 1, 9609, 0},
+    {0x6b756900, 14496, 3, 1, 9609, 0},
+    {0x6b756d61, 35855, 6, 1, 9609, 0},
+    {0x6b757265, 41454, 4, 1, 9609, 0},
+    {0x6d696861, 18106, 6, 1, 9609, 0},
+    {0x6d69796f, 3637, 7, 1, 9609, 0},
+    {0x6e616b61, 6685, 4, 1, 9609, 0},
+    {0x6f6e6f6d, 27151, 8, 1, 9609, 0},
+    {0x6f73616b, 8688, 13, 1, 9609, 0},
+    {0x6f74616b, 39955, 5, 1, 9609, 0},
+    {0x73616b61, 6187, 4, 1, 9609, 0},
+    {0x73657261, 9589, 4, 1, 9609, 0},
+    {0x73657261, 22405, 9, 1, 9609, 0},
+    {0x7368696e, 27791, 8, 1, 9609, 0},
+    {0x73686f62, 33227, 7, 1, 9609, 0},
+    {0x74616b65, 28247, 8, 1, 9609, 0},
+    {0x61626173, 23663, 8, 1, 9609, 0},
+    {0x61626972, 29127, 5, 1, 9609, 0},
+    {0x61696265, 29104, 7, 1, 9609, 0},
+    {0x616b6162, 29125, 7, 1, 9609, 0},
+    {0x616b6b65, 29139, 7, 1, 9609, 0},
+    {0x61736168, 19615, 9, 1, 9609, 0},
+    {0x61736869, 19633, 9, 1, 9609, 0},
+    {0x6173686f, 34337, 6, 1, 9609, 0},
+    {0x61737361, 34343, 6, 1, 9609, 0},
+    {0x61747375, 4806, 6, 1, 9609, 0},
+    {0x62696261, 38515, 5, 1, 9609, 0},
+    {0x62696569, 41018, 4, 1, 9609, 0},
+    {0x62696675, 34469, 6, 1, 9609, 0},
+    {0x6269686f, 34475, 6, 1, 9609, 0},
+    {0x62697261, 23943, 8, 1, 9609, 0},
+    {0x63686970, 12874, 11, 1, 9609, 0},
+    {0x63686974, 29706, 7, 1, 9609, 0},
+    {0x64617465, 6593, 4, 1, 9609, 0},
+    {0x65626574, 34865, 6, 1, 9609, 0},
+    {0x656d6265, 30133, 7, 1, 9609, 0},
+    {0x656e6977, 38825, 5, 1, 9609, 0},
+    {0x6572696d, 38835, 5, 1, 9609, 0},
+    {0x6573616e, 21437, 4, 1, 9609, 0},
+    {0x65736173, 34913, 6, 1, 9609, 0},
+    {0x66756b61, 24879, 8, 1, 9609, 0},
+    {0x66756b75, 8432, 9, 1, 9609, 0},
+    {0x66757261, 10753, 6, 1, 9609, 0},
+    {0x66757275, 24927, 8, 1, 9609, 0},
+    {0x6861626f, 35201, 6, 1, 9609, 0},
+    {0x68616b6f, 25071, 8, 1, 9609, 0},
+    {0x68616d61, 10159, 12, 1, 9609, 0},
+    {0x68696461, 35351, 6, 1, 9609, 0},
+    {0x68696761, 8220, 13, 1, 9609, 0},
+    {0x68696761, 13457, 11, 1, 9609, 0},
+    {0x6869726f, 32516, 5, 1, 9609, 0},
+    {0x686f6b75, 31169, 7, 1, 9609, 0},
+    {0x686f6b75, 35399, 6, 1, 9609, 0},
+    {0x686f6e62, 25271, 8, 1, 9609, 0},
+    {0x686f726f, 20722, 9, 1, 9609, 0},
+    {0x686f726f, 25295, 8, 1, 9609, 0},
+    {0x696b6564, 39205, 5, 1, 9609, 0},
+    {0x696d616b, 31281, 7, 1, 9609, 0},
+    {0x69736869, 25431, 8, 1, 9609, 0},
+    {0x6977616d, 20857, 9, 1, 9609, 0},
+    {0x6977616e, 35543, 6, 1, 9609, 0},
+    {0x6b616d69, 17082, 10, 1, 9609, 0},
+    {0x6b616d69, 25647, 8, 1, 9609, 0},
+    {0x6b616d69, 13666, 11, 1, 9609, 0},
+    {0x6b616d69, 10579, 12, 1, 9609, 0},
+    {0x6b616d6f, 25679, 8, 1, 9609, 0},
+    {0x6b617961, 35723, 6, 1, 9609, 0},
+    {0x6b656d62, 25815, 8, 1, 9609, 0},
+    {0x6b696b6f, 31680, 7, 1, 9609, 0},
+    {0x6b696d6f, 21154, 9, 1, 9609, 0},
+    {0x6b697461, 8441, 13, 1, 9609, 0},
+    {0x6b697461, 35771, 6, 1, 9609, 0},
+    {0x6b69796f, 25951, 8, 1, 9609, 0},
+    {0x6b6f7368, 21235, 9, 1, 9609, 0},
+    {0x6b756e6e, 26111, 8, 1, 9609, 0},
+    {0x6b757269, 26119, 8, 1, 9609, 0},
+    {0x6b75726f, 10675, 12, 1, 9609, 0},
+    {0x6b757368, 31820, 7, 1, 9609, 0},
+    {0x6b757463, 31827, 7, 1, 9609, 0},
+    {0x6b796f77, 39445, 5, 1, 9609, 0},
+    {0x6d617368, 32100, 7, 1, 9609, 0},
+    {0x6d617473, 26399, 8, 1, 9609, 0},
+    {0x6d696b61, 36251, 6, 1, 9609, 0},
+    {0x6d696e61, 10747, 12, 1, 9609, 0},
+    {0x6d6f6d62, 26583, 8, 1, 9609, 0},
+    {0x6d6f7365, 26639, 8, 1, 9609, 0},
+    {0x6d756b61, 27593, 6, 1, 9609, 0},
+    {0x6d75726f, 32254, 7, 1, 9609, 0},
+    {0x6e616965, 41586, 4, 1, 9609, 0},
+    {0x6e616b61, 26791, 8, 1, 9609, 0},
+    {0x6e616b61, 10831, 12, 1, 9609, 0},
+    {0x6e616b61, 10843, 12, 1, 9609, 0},
+    {0x6e616e61, 39725, 5, 1, 9609, 0},
+    {0x6e616e70, 32352, 7, 1, 9609, 0},
+    {0x6e61796f, 36611, 6, 1, 9609, 0},
+    {0x6e656d75, 36617, 6, 1, 9609, 0},
+    {0x6e69696b, 26951, 8, 1, 9609, 0},
+    {0x6e696b69, 36659, 4, 1, 9609, 0},
+    {0x6e697368, 14007, 11, 1, 9609, 0},
+    {0x6e6f626f, 14018, 11, 1, 9609, 0},
+    {0x6e756d61, 36725, 6, 1, 9609, 0},
+    {0x6f626968, 32513, 7, 1, 9609, 0},
+    {0x6f626972, 39860, 5, 1, 9609, 0},
+    {0x6f6b6574, 39905, 5, 1, 9609, 0},
+    {0x6f6b6f70, 14012, 6, 1, 9609, 0},
+    {0x6f746172, 39965, 5, 1, 9609, 0},
+    {0x6f746f62, 39970, 5, 1, 9609, 0},
+    {0x6f746f66, 32709, 7, 1, 9609, 0},
+    {0x6f746f69, 22072, 9, 1, 9609, 0},
+    {0x6f756d75, 3786, 4, 1, 9609, 0},
+    {0x6f7a6f72, 39995, 5, 1, 9609, 0},
+    {0x70697070, 40065, 5, 1, 9609, 0},
+    {0x72616e6b, 27447, 8, 1, 9609, 0},
+    {0x72656275, 40145, 5, 1, 9609, 0},
+    {0x72696b75, 22270, 9, 1, 9609, 0},
+    {0x72697368, 14348, 7, 1, 9609, 0},
+    {0x72697368, 14348, 11, 1, 9609, 0},
+    {0x7361726f, 37241, 6, 1, 9609, 0},
+    {0x73617275, 22360, 9, 1, 9609, 0},
+    {0x7368616b, 27775, 8, 1, 9609, 0},
+    {0x73686172, 40345, 5, 1, 9609, 0},
+    {0x73686962, 27783, 8, 1, 9609, 0},
+    {0x73686962, 19634, 8, 1, 9609, 0},
+    {0x7368696b, 33157, 7, 1, 9609, 0},
+    {0x7368696b, 33164, 7, 1, 9609, 0},
+    {0x7368696d, 22495, 9, 1, 9609, 0},
+    {0x7368696d, 14627, 7, 1, 9609, 0},
+    {0x7368696d, 22540, 9, 1, 9609, 0},
+    {0x7368696e, 11359, 12, 1, 9609, 0},
+    {0x7368696e, 27807, 8, 1, 9609, 0},
+    {0x73686972, 22603, 9, 1, 9609, 0},
+    {0x73686972, 33213, 7, 1, 9609, 0},
+    {0x73686972, 22621, 9, 1, 9609, 0},
+    {0x736f6265, 33290, 7, 1, 9609, 0},
+    {0x73756e61, 10583, 8, 1, 9609, 0},
+    {0x7461696b, 40525, 5, 1, 9609, 0},
+    {0x74616b61, 37631, 6, 1, 9609, 0},
+    {0x74616b69, 28263, 8, 1, 9609, 0},
+    {0x74616b69, 28271, 8, 1, 9609, 0},
+    {0x74657368, 22945, 9, 1, 9609, 0},
+    {0x746f6265, 33563, 7, 1, 9609, 0},
+    {0x746f686d, 40615, 5, 1, 9609, 0},
+    {0x746f6d61, 23026, 9, 1, 9609, 0},
+    {0x746f6d61, 37739, 6, 1, 9609, 0},
+    {0x746f7961, 25113, 4, 1, 9609, 0},
+    {0x746f7961, 37793, 6, 1, 9609, 0},
+    {0x746f796f, 28479, 8, 1, 9609, 0},
+    {0x746f796f, 33661, 7, 1, 9609, 0},
+    {0x74737562, 28519, 8, 1, 9609, 0},
+    {0x7473756b, 23071, 9, 1, 9609, 0},
+    {0x7572616b, 33801, 7, 1, 9609, 0},
+    {0x75726175, 37943, 6, 1, 9609, 0},
+    {0x75727975, 31172, 4, 1, 9609, 0},
+    {0x75746173, 23152, 9, 1, 9609, 0},
+    {0x77616b6b, 28759, 8, 1, 9609, 0},
+    {0x77617373, 33927, 7, 1, 9609, 0},
+    {0x79616b75, 38213, 6, 1, 9609, 0},
+    {0x796f6963, 38267, 6, 1, 9609, 0},
+    {0x61696f69, 40970, 4, 1, 9609, 0},
+    {0x616b6173, 21063, 6, 1, 9609, 0},
+    {0x616b6f00, 10626, 3, 1, 9609, 0},
+    {0x616d6167, 19462, 9, 1, 9609, 0},
+    {0x616f6761, 34289, 6, 1, 9609, 0},
+    {0x61736167, 28210, 5, 1, 9609, 0},
+    {0x61736869, 8262, 6, 1, 9609, 0},
+    {0x6177616a, 13892, 5, 1, 9609, 0},
+    {0x66756b75, 24895, 8, 1, 9609, 0},
+    {0x676f7368, 30980, 7, 1, 9609, 0},
+    {0x68617269, 35285, 6, 1, 9609, 0},
+    {0x68696d65, 35369, 6, 1, 9609, 0},
+    {0x69636869, 6527, 8, 1, 9609, 0},
+    {0x696e6167, 22569, 7, 1, 9609, 0},
+    {0x6974616d, 35772, 5, 1, 9609, 0},
+    {0x6b616b6f, 25583, 8, 1, 9609, 0},
+    {0x6b616d69, 25631, 8, 1, 9609, 0},
+    {0x6b616d69, 25647, 8, 1, 9609, 0},
+    {0x6b617361, 39330, 5, 1, 9609, 0},
+    {0x6b617375, 31624, 6, 1, 9609, 0},
+    {0x6b617761, 21118, 9, 1, 9609, 0},
+    {0x6d696b69, 10569, 4, 1, 9609, 0},
+    {0x6d696e61, 13886, 11, 1, 9609, 0},
+    {0x6e697368, 13996, 11, 1, 9609, 0},
+    {0x6e697368, 21964, 9, 1, 9609, 0},
+    {0x6f6e6f00, 12956, 3, 1, 9609, 0},
+    {0x73616e64, 19515, 5, 1, 9609, 0},
+    {0x73616e6e, 37223, 6, 1, 9609, 0},
+    {0x73617361, 27647, 8, 1, 9609, 0},
+    {0x7361796f, 41750, 4, 1, 9609, 0},
+    {0x7368696e, 37331, 6, 1, 9609, 0},
+    {0x7368696e, 22576, 9, 1, 9609, 0},
+    {0x73686973, 14499, 5, 1, 9609, 0},
+    {0x73756d6f, 21571, 6, 1, 9609, 0},
+    {0x74616973, 33451, 6, 1, 9609, 0},
+    {0x74616b61, 8760, 4, 1, 9609, 0},
+    {0x74616b61, 18442, 10, 1, 9609, 0},
+    {0x74616b61, 28207, 8, 1, 9609, 0},
+    {0x74616b69, 28271, 6, 1, 9609, 0},
+    {0x74616d62, 26178, 5, 1, 9609, 0},
+    {0x74617473, 33472, 7, 1, 9609, 0},
+    {0x746f796f, 33647, 7, 1, 9609, 0},
+    {0x79616275, 38183, 4, 1, 9609, 0},
+    {0x79617368, 21687, 7, 1, 9609, 0},
+    {0x796f6b61, 19342, 4, 1, 9609, 0},
+    {0x796f6b61, 25945, 6, 1, 9609, 0},
+    {0x616d6900, 4590, 3, 1, 9609, 0},
+    {0x61736168, 17907, 5, 1, 9609, 0},
+    {0x62616e64, 38465, 5, 1, 9609, 0},
+    {0x6368696b, 24191, 8, 1, 9609, 0},
+    {0x64616967, 38700, 5, 1, 9609, 0},
+    {0x66756a69, 20362, 9, 1, 9609, 0},
+    {0x68697461, 10231, 7, 1, 9609, 0},
+    {0x68697461, 13468, 11, 1, 9609, 0},
+    {0x68697461, 10231, 12, 1, 9609, 0},
+    {0x68697461, 16872, 10, 1, 9609, 0},
+    {0x69626172, 31232, 7, 1, 9609, 0},
+    {0x696e6100, 721, 3, 1, 9609, 0},
+    {0x696e6173, 25335, 8, 1, 9609, 0},
+    {0x6974616b, 39250, 5, 1, 9609, 0},
+    {0x6977616d, 39270, 5, 1, 9609, 0},
+    {0x6a6f736f, 41370, 4, 1, 9609, 0},
+    {0x6b616d69, 10579, 6, 1, 9609, 0},
+    {0x6b617361, 21046, 6, 1, 9609, 0},
+    {0x6b617368, 22920, 7, 1, 9609, 0},
+    {0x6b617375, 13688, 11, 1, 9609, 0},
+    {0x6b6f6761, 17737, 4, 1, 9609, 0},
+    {0x6d69686f, 41542, 4, 1, 9609, 0},
+    {0x6d69746f, 21012, 4, 1, 9609, 0},
+    {0x6d6f7269, 26615, 6, 1, 9609, 0},
+    {0x6e616b61, 6685, 4, 1, 9609, 0},
+    {0x6e616d65, 26839, 8, 1, 9609, 0},
+    {0x6f617261, 39850, 5, 1, 9609, 0},
+    {0x6f676177, 4852, 5, 1, 9609, 0},
+    {0x6f6d6974, 32618, 7, 1, 9609, 0},
+    {0x72797567, 22315, 9, 1, 9609, 0},
+    {0x73616b61, 14359, 5, 1, 9609, 0},
+    {0x73616b75, 18122, 10, 1, 9609, 0},
+    {0x7368696d, 22513, 9, 1, 9609, 0},
+    {0x7368696d, 18302, 10, 1, 9609, 0},
+    {0x73686972, 22639, 9, 1, 9609, 0},
+    {0x736f7761, 41806, 4, 1, 9609, 0},
+    {0x73756966, 40500, 5, 1, 9609, 0},
+    {0x74616b61, 28151, 8, 1, 9609, 0},
+    {0x74616d61, 14579, 11, 1, 9609, 0},
+    {0x746f6b61, 40620, 5, 1, 9609, 0},
+    {0x746f6d6f, 37757, 6, 1, 9609, 0},
+    {0x746f6e65, 12793, 4, 1, 9609, 0},
+    {0x746f7269, 37775, 6, 1, 9609, 0},
+    {0x74737563, 23062, 9, 1, 9609, 0},
+    {0x7473756b, 33745, 7, 1, 9609, 0},
+    {0x75636869, 28575, 8, 1, 9609, 0},
+    {0x75736869, 37955, 6, 1, 9609, 0},
+    {0x79616368, 34081, 7, 1, 9609, 0},
+    {0x79616d61, 28903, 8, 1, 9609, 0},
+    {0x79617761, 38261, 6, 1, 9609, 0},
+    {0x79756b69, 42010, 4, 1, 9609, 0},
+    {0x616e616d, 29167, 7, 1, 9609, 0},
+    {0x68616b75, 39095, 5, 1, 9609, 0},
+    {0x68616b75, 31092, 7, 1, 9609, 0},
+    {0x6b616761, 8214, 4, 1, 9609, 0},
+    {0x6b61686f, 35609, 6, 1, 9609, 0},
+    {0x6b616e61, 25703, 8, 1, 9609, 0},
+    {0x6b617761, 25775, 8, 1, 9609, 0},
+    {0x6b6f6d61, 10627, 7, 1, 9609, 0},
+    {0x6e616b61, 26815, 8, 1, 9609, 0},
+    {0x6e616e61, 39730, 5, 1, 9609, 0},
+    {0x6e6f6d69, 5080, 4, 1, 9609, 0},
+    {0x6e6f6e6f, 27015, 8, 1, 9609, 0},
+    {0x6e6f746f, 26819, 4, 1, 9609, 0},
+    {0x7368696b, 8211, 5, 1, 9609, 0},
+    {0x73757a75, 37547, 4, 1, 9609, 0},
+    {0x74737562, 33731, 7, 1, 9609, 0},
+    {0x74737572, 33759, 7, 1, 9609, 0},
+    {0x75636869, 28583, 8, 1, 9609, 0},
+    {0x77616a69, 25769, 6, 1, 9609, 0},
+    {0x66756461, 38950, 5, 1, 9609, 0},
+    {0x66756a69, 24871, 8, 1, 9609, 0},
+    {0x68616e61, 25087, 8, 1, 9609, 0},
+    {0x68697261, 20623, 9, 1, 9609, 0},
+    {0x6869726f, 32502, 6, 1, 9609, 0},
+    {0x69636869, 18284, 8, 1, 9609, 0},
+    {0x69636869, 16932, 10, 1, 9609, 0},
+    {0x69776169, 25463, 8, 1, 9609, 0},
+    {0x69776174, 39280, 5, 1, 9609, 0},
+    {0x6a6f626f, 35561, 6, 1, 9609, 0},
+    {0x6b616d61, 25607, 8, 1, 9609, 0},
+    {0x6b616e65, 17112, 10, 1, 9609, 0},
+    {0x6b617275, 31603, 7, 1, 9609, 0},
+    {0x6b617761, 17162, 5, 1, 9609, 0},
+    {0x6b697461, 25919, 8, 1, 9609, 0},
+    {0x6b756a69, 41450, 4, 1, 9609, 0},
+    {0x6b756e6f, 27529, 6, 1, 9609, 0},
+    {0x6b757a75, 26151, 8, 1, 9609, 0},
+    {0x6d697961, 17612, 6, 1, 9609, 0},
+    {0x6d697a75, 26575, 8, 1, 9609, 0},
+    {0x6d6f7269, 32233, 7, 1, 9609, 0},
+    {0x6e696e6f, 36665, 6, 1, 9609, 0},
+    {0x6e6f6461, 21257, 4, 1, 9609, 0},
+    {0x6f66756e, 32534, 7, 1, 9609, 0},
+    {0x6f736875, 39411, 4, 1, 9609, 0},
+    {0x6f747375, 32716, 7, 1, 9609, 0},
+    {0x72696b75, 8753, 13, 1, 9609, 0},
+    {0x73686977, 13679, 5, 1, 9609, 0},
+    {0x7368697a, 14491, 11, 1, 9609, 0},
+    {0x73756d69, 37511, 6, 1, 9609, 0},
+    {0x74616e6f, 28311, 8, 1, 9609, 0},
+    {0x746f6e6f, 12955, 4, 1, 9609, 0},
+    {0x79616861, 38195, 6, 1, 9609, 0},
+    {0x79616d61, 38219, 6, 1, 9609, 0},
+    {0x61796167, 29314, 7, 1, 9609, 0},
+    {0x68696761, 8207, 13, 1, 9609, 0},
+    {0x6b616e6f, 31547, 7, 1, 9609, 0},
+    {0x6b6f746f, 25991, 8, 1, 9609, 0},
+    {0x6d616e6e, 39595, 5, 1, 9609, 0},
+    {0x6d617275, 26367, 8, 1, 9609, 0},
+    {0x6d69746f, 36335, 6, 1, 9609, 0},
+    {0x6e616f73, 26863, 8, 1, 9609, 0},
+    {0x73616e75, 37235, 6, 1, 9609, 0},
+    {0x7461646f, 33444, 7, 1, 9609, 0},
+    {0x74616b61, 22909, 9, 1, 9609, 0},
+    {0x746f6e6f, 33591, 7, 1, 9609, 0},
+    {0x75636869, 28591, 8, 1, 9609, 0},
+    {0x7574617a, 40760, 5, 1, 9609, 0},
+    {0x7a656e74, 29031, 8, 1, 9609, 0},
+    {0x616b756e, 38360, 5, 1, 9609, 0},
+    {0x616d616d, 36242, 5, 1, 9609, 0},
+    {0x68696f6b, 39135, 5, 1, 9609, 0},
+    {0x69736100, 5885, 3, 1, 9609, 0},
+    {0x6973656e, 20165, 4, 1, 9609, 0},
+    {0x697a756d, 15893, 5, 1, 9609, 0},
+    {0x6b61676f, 20983, 9, 1, 9609, 0},
+    {0x6b616e6f, 35645, 6, 1, 9609, 0},
+    {0x6b617761, 25791, 8, 1, 9609, 0},
+    {0x6b696e6b, 39340, 5, 1, 9609, 0},
+    {0x6b6f7579, 31778, 7, 1, 9609, 0},
+    {0x6d616b75, 17412, 10, 1, 9609, 0},
+    {0x6d617473, 21568, 9, 1, 9609, 0},
+    {0x6d696e61, 17582, 10, 1, 9609, 0},
+    {0x6e616b61, 26823, 8, 1, 9609, 0},
+    {0x6e697368, 10915, 12, 1, 9609, 0},
+    {0x73617473, 8792, 13, 1, 9609, 0},
+    {0x736f6f00, 42375, 3, 1, 9609, 0},
+    {0x74617275, 28319, 8, 1, 9609, 0},
+    {0x79757375, 40905, 5, 1, 9609, 0},
+    {0x61696b61, 34205, 6, 1, 9609, 0},
+    {0x61747375, 34355, 6, 1, 9609, 0},
+    {0x61796173, 27748, 5, 1, 9609, 0},
+    {0x63686967, 19948, 9, 1, 9609, 0},
+    {0x6562696e, 38810, 5, 1, 9609, 0},
+    {0x66756a69, 24871, 8, 1, 9609, 0},
+    {0x68616461, 35207, 6, 1, 9609, 0},
+    {0x68616b6f, 35225, 6, 1, 9609, 0},
+    {0x68697261, 20632, 9, 1, 9609, 0},
+    {0x69736568, 31365, 7, 1, 9609, 0},
+    {0x6b616973, 35621, 6, 1, 9609, 0},
+    {0x6b616d61, 25615, 8, 1, 9609, 0},
+    {0x6b69796f, 25943, 8, 1, 9609, 0},
+    {0x6d617473, 32121, 7, 1, 9609, 0},
+    {0x6d696e61, 6751, 14, 1, 9609, 0},
+    {0x6d697572, 39650, 5, 1, 9609, 0},
+    {0x6e616b61, 39715, 5, 1, 9609, 0},
+    {0x6e696e6f, 26967, 8, 1, 9609, 0},
+    {0x6f646177, 32527, 7, 1, 9609, 0},
+    {0x6f690000, 1903, 2, 1, 9609, 0},
+    {0x6f69736f, 31809, 4, 1, 9609, 0},
+    {0x73616761, 18102, 10, 1, 9609, 0},
+    {0x73616d75, 27591, 8, 1, 9609, 0},
+    {0x7473756b, 37883, 6, 1, 9609, 0},
+    {0x79616d61, 28911, 8, 1, 9609, 0},
+    {0x79616d61, 7647, 6, 1, 9609, 0},
+    {0x796f6b6f, 28951, 8, 1, 9609, 0},
+    {0x79756761, 29007, 8, 1, 9609, 0},
+    {0x7a616d61, 38297, 4, 1, 9609, 0},
+    {0x7a757368, 17265, 5, 1, 9609, 0},
+    {0x63697479, 21447, 4, 4, 9609, 0},
+    {0x63697479, 21447, 4, 4, 9609, 0},
+    {0x63697479, 21447, 4, 4, 9609, 0},
+    {0x616b6900, 8440, 3, 1, 9609, 0},
+    {0x67656973, 35081, 6, 1, 9609, 0},
+    {0x68696461, 35351, 6, 1, 9609, 0},
+    {0x68696761, 10219, 12, 1, 9609, 0},
+    {0x696e6f00, 204, 3, 1, 9609, 0},
+    {0x6b616761, 17072, 6, 1, 9609, 0},
+    {0x6b616d69, 8693, 4, 1, 9609, 0},
+    {0x6b697461, 25903, 8, 1, 9609, 0},
+    {0x6b6f6368, 39365, 5, 1, 9609, 0},
+    {0x6d696861, 18106, 6, 1, 9609, 0},
+    {0x6d6f746f, 26655, 8, 1, 9609, 0},
+    {0x6d75726f, 36473, 6, 1, 9609, 0},
+    {0x6e616861, 36557, 6, 1, 9609, 0},
+    {0x6e616b61, 26799, 8, 1, 9609, 0},
+    {0x6e616e6b, 32338, 7, 1, 9609, 0},
+    {0x6e697368, 21955, 9, 1, 9609, 0},
+    {0x6e69796f, 17782, 10, 1, 9609, 0},
+    {0x6f636869, 4466, 4, 1, 9609, 0},
+    {0x6f6b6177, 17097, 5, 1, 9609, 0},
+    {0x6f746f79, 28478, 5, 1, 9609, 0},
+    {0x6f747375, 36869, 6, 1, 9609, 0},
+    {0x73616b61, 29224, 6, 1, 9609, 0},
+    {0x73756b75, 37493, 6, 1, 9609, 0},
+    {0x73757361, 37529, 6, 1, 9609, 0},
+    {0x746f7361, 14368, 4, 1, 9609, 0},
+    {0x746f7361, 14623, 11, 1, 9609, 0},
+    {0x746f796f, 23044, 4, 1, 9609, 0},
+    {0x7473756e, 10226, 5, 1, 9609, 0},
+    {0x756d616a, 40710, 5, 1, 9609, 0},
+    {0x79617375, 38243, 6, 1, 9609, 0},
+    {0x79757375, 29015, 8, 1, 9609, 0},
+    {0x616d616b, 13659, 7, 1, 9609, 0},
+    {0x6172616f, 22015, 4, 1, 9609, 0},
+    {0x61736f00, 13341, 3, 1, 9609, 0},
+    {0x63686f79, 38645, 5, 1, 9609, 0},
+    {0x67796f6b, 31064, 7, 1, 9609, 0},
+    {0x6b616d69, 13655, 11, 1, 9609, 0},
+    {0x6b696b75, 31687, 7, 1, 9609, 0},
+    {0x6b756d61, 26055, 8, 1, 9609, 0},
+    {0x6d617368, 32107, 7, 1, 9609, 0},
+    {0x6d696675, 36233, 6, 1, 9609, 0},
+    {0x6d696e61, 26511, 8, 1, 9609, 0},
+    {0x6d696e61, 13908, 11, 1, 9609, 0},
+    {0x6e616761, 36539, 6, 1, 9609, 0},
+    {0x6e697368, 21919, 9, 1, 9609, 0},
+    {0x6f67756e, 13914, 5, 1, 9609, 0},
+    {0x6f7a7500, 41903, 3, 1, 9609, 0},
+    {0x73756d6f, 21571, 6, 1, 9609, 0},
+    {0x74616b61, 28191, 8, 1, 9609, 0},
+    {0x756b6900, 21162, 3, 1, 9609, 0},
+    {0x75746f00, 15983, 3, 1, 9609, 0},
+    {0x79616d61, 13365, 6, 1, 9609, 0},
+    {0x79616d61, 7647, 6, 1, 9609, 0},
+    {0x79617473, 19322, 10, 1, 9609, 0},
+    {0x61796162, 35724, 5, 1, 9609, 0},
+    {0x66756b75, 13358, 11, 1, 9609, 0},
+    {0x68696761, 8259, 11, 1, 9609, 0},
+    {0x69646500, 458, 3, 1, 9609, 0},
+    {0x696e6500, 1103, 3, 1, 9609, 0},
+    {0x6a6f796f, 41374, 4, 1, 9609, 0},
+    {0x6b616d65, 31519, 7, 1, 9609, 0},
+    {0x6b616d6f, 25679, 4, 1, 9609, 0},
+    {0x6b697461, 6681, 4, 1, 9609, 0},
+    {0x6b697a75, 41422, 4, 1, 9609, 0},
+    {0x6b756d69, 26079, 8, 1, 9609, 0},
+    {0x6b796f74, 26175, 8, 1, 9609, 0},
+    {0x6b796f74, 21343, 9, 1, 9609, 0},
+    {0x6b796f74, 26183, 8, 1, 9609, 0},
+    {0x6d61697a, 32051, 7, 1, 9609, 0},
+    {0x6d696e61, 5082, 6, 1, 9609, 0},
+    {0x6d696e61, 5082, 15, 1, 9609, 0},
+    {0x6d697961, 36359, 6, 1, 9609, 0},
+    {0x6d756b6f, 41562, 4, 1, 9609, 0},
+    {0x6e616761, 17682, 10, 1, 9609, 0},
+    {0x6e616b61, 32310, 7, 1, 9609, 0},
+    {0x6e616e74, 36575, 6, 1, 9609, 0},
+    {0x6f79616d, 22090, 9, 1, 9609, 0},
+    {0x73616b79, 40260, 5, 1, 9609, 0},
+    {0x7365696b, 35624, 5, 1, 9609, 0},
+    {0x74616e61, 21346, 6, 1, 9609, 0},
+    {0x756a6900, 4753, 3, 1, 9609, 0},
+    {0x756a6974, 23125, 9, 1, 9609, 0},
+    {0x77617a75, 35719, 6, 1, 9609, 0},
+    {0x79616d61, 23557, 9, 1, 9609, 0},
+    {0x79617761, 19332, 6, 1, 9609, 0},
+    {0x61736168, 17907, 5, 1, 9609, 0},
+    {0x696e6162, 39220, 5, 1, 9609, 0},
+    {0x69736500, 4639, 3, 1, 9609, 0},
+    {0x6b616d65, 25623, 8, 1, 9609, 0},
+    {0x6b617761, 31638, 7, 1, 9609, 0},
+    {0x6b69686f, 35747, 4, 1, 9609, 0},
+    {0x6b69736f, 25879, 8, 1, 9609, 0},
+    {0x6b697761, 38103, 4, 1, 9609, 0},
+    {0x6b6f6d6f, 35801, 6, 1, 9609, 0},
+    {0x6b756d61, 35855, 6, 1, 9609, 0},
+    {0x6b757761, 35897, 6, 1, 9609, 0},
+    {0x6d617473, 21577, 9, 1, 9609, 0},
+    {0x6d656977, 39620, 5, 1, 9609, 0},
+    {0x6d696861, 36239, 6, 1, 9609, 0},
+    {0x6d696e61, 21658, 9, 1, 9609, 0},
+    {0x6d697375, 36317, 6, 1, 9609, 0},
+    {0x6d697961, 5086, 6, 1, 9609, 0},
+    {0x6e616261, 36527, 6, 1, 9609, 0},
+    {0x7368696d, 2666, 5, 1, 9609, 0},
+    {0x73757a75, 37547, 6, 1, 9609, 0},
+    {0x7461646f, 33444, 4, 1, 9609, 0},
+    {0x7461696b, 40525, 5, 1, 9609, 0},
+    {0x74616b69, 21179, 4, 1, 9609, 0},
+    {0x74616d61, 37643, 6, 1, 9609, 0},
+    {0x746f6261, 41862, 4, 1, 9609, 0},
+    {0x74737500, 2671, 3, 1, 9609, 0},
+    {0x75646f6e, 24938, 5, 1, 9609, 0},
+    {0x75726573, 28631, 8, 1, 9609, 0},
+    {0x77617461, 33934, 7, 1, 9609, 0},
+    {0x796f6b6b, 23584, 9, 1, 9609, 0},
+    {0x66757275, 24943, 8, 1, 9609, 0},
+    {0x68696761, 2662, 17, 1, 9609, 0},
+    {0x69736869, 17012, 10, 1, 9609, 0},
+    {0x6977616e, 31449, 7, 1, 9609, 0},
+    {0x6b616b75, 35627, 6, 1, 9609, 0},
+    {0x6b616d69, 8693, 4, 1, 9609, 0},
+    {0x6b617761, 25799, 8, 1, 9609, 0},
+    {0x6d617275, 26375, 8, 1, 9609, 0},
+    {0x6d617473, 2669, 10, 1, 9609, 0},
+    {0x6d696e61, 8545, 13, 1, 9609, 0},
+    {0x6d697361, 6535, 6, 1, 9609, 0},
+    {0x6d757261, 28291, 6, 1, 9609, 0},
+    {0x6e61746f, 36605, 6, 1, 9609, 0},
+    {0x6f676177, 32541, 7, 1, 9609, 0},
+    {0x6f686972, 25994, 5, 1, 9609, 0},
+    {0x6f6e6167, 32632, 7, 1, 9609, 0},
+    {0x6f73616b, 8688, 5, 1, 9609, 0},
+    {0x72696675, 14353, 4, 1, 9609, 0},
+    {0x73656d69, 37295, 6, 1, 9609, 0},
+    {0x73686962, 33143, 7, 1, 9609, 0},
+    {0x73686963, 8857, 13, 1, 9609, 0},
+    {0x7368696b, 25612, 7, 1, 9609, 0},
+    {0x7368696f, 27823, 8, 1, 9609, 0},
+    {0x73686972, 22630, 9, 1, 9609, 0},
+    {0x74616761, 37589, 6, 1, 9609, 0},
+    {0x74616977, 39278, 5, 1, 9609, 0},
+    {0x746f6d65, 9982, 4, 1, 9609, 0},
+    {0x746f6d69, 37751, 6, 1, 9609, 0},
+    {0x77616b75, 38105, 6, 1, 9609, 0},
+    {0x77617461, 38129, 6, 1, 9609, 0},
+    {0x79616d61, 28919, 8, 1, 9609, 0},
+    {0x7a616f00, 755, 3, 1, 9609, 0},
+    {0x61796100, 4837, 3, 1, 9609, 0},
+    {0x6562696e, 38815, 5, 1, 9609, 0},
+    {0x676f6b61, 35165, 6, 1, 9609, 0},
+    {0x68797567, 39190, 5, 1, 9609, 0},
+    {0x6b61646f, 25551, 8, 1, 9609, 0},
+    {0x6b617761, 17172, 10, 1, 9609, 0},
+    {0x6b696a6f, 41406, 4, 1, 9609, 0},
+    {0x6b697461, 25903, 8, 1, 9609, 0},
+    {0x6b697461, 25927, 8, 1, 9609, 0},
+    {0x6b697461, 31701, 7, 1, 9609, 0},
+    {0x6b6f6261, 21190, 9, 1, 9609, 0},
+    {0x6b756e69, 26103, 8, 1, 9609, 0},
+    {0x6b757368, 8434, 7, 1, 9609, 0},
+    {0x6d696d61, 36263, 6, 1, 9609, 0},
+    {0x6d697961, 17612, 10, 1, 9609, 0},
+    {0x6d697961, 26551, 8, 1, 9609, 0},
+    {0x6d6f726f, 21775, 9, 1, 9609, 0},
+    {0x6e696368, 26943, 8, 1, 9609, 0},
+    {0x6e697368, 21946, 9, 1, 9609, 0},
+    {0x6e6f6265, 32464, 7, 1, 9609, 0},
+    {0x73616974, 40250, 5, 1, 9609, 0},
+    {0x73686969, 37319, 6, 1, 9609, 0},
+    {0x7368696e, 27815, 8, 1, 9609, 0},
+    {0x74616b61, 28167, 8, 1, 9609, 0},
+    {0x74616b61, 28199, 8, 1, 9609, 0},
+    {0x74616b61, 28239, 8, 1, 9609, 0},
+    {0x7473756e, 10226, 5, 1, 9609, 0},
+    {0x61636869, 35, 4, 1, 9609, 0},
+    {0x6167656d, 23711, 8, 1, 9609, 0},
+    {0x616e616e, 3346, 4, 1, 9609, 0},
+    {0x616f6b69, 32582, 4, 1, 9609, 0},
+    {0x61736168, 17907, 5, 1, 9609, 0},
+    {0x617a756d, 29328, 7, 1, 9609, 0},
+    {0x6368696b, 19957, 9, 1, 9609, 0},
+    {0x6368696b, 29692, 7, 1, 9609, 0},
+    {0x6368696e, 16923, 5, 1, 9609, 0},
+    {0x66756a69, 24855, 6, 1, 9609, 0},
+    {0x68616b75, 35231, 6, 1, 9609, 0},
+    {0x68617261, 10563, 4, 1, 9609, 0},
+    {0x68697261, 35393, 6, 1, 9609, 0},
+    {0x69696461, 16468, 4, 1, 9609, 0},
+    {0x69696a69, 35465, 6, 1, 9609, 0},
+    {0x69697961, 35477, 6, 1, 9609, 0},
+    {0x69697a75, 35489, 6, 1, 9609, 0},
+    {0x696b6564, 39205, 5, 1, 9609, 0},
+    {0x696b7573, 31267, 7, 1, 9609, 0},
+    {0x696e6100, 721, 3, 1, 9609, 0},
+    {0x6b617275, 21037, 9, 1, 9609, 0},
+    {0x6b617761, 17098, 8, 1, 9609, 0},
+    {0x6b69736f, 8428, 4, 1, 9609, 0},
+    {0x6b69736f, 8428, 13, 1, 9609, 0},
+    {0x6b697461, 25887, 8, 1, 9609, 0},
+    {0x6b6f6d61, 25959, 8, 1, 9609, 0},
+    {0x6b6f6d6f, 35807, 6, 1, 9609, 0},
+    {0x6d617473, 21559, 9, 1, 9609, 0},
+    {0x6d617473, 21568, 9, 1, 9609, 0},
+    {0x6d696173, 39635, 5, 1, 9609, 0},
+    {0x6d696e61, 17552, 10, 1, 9609, 0},
+    {0x6d696e61, 17572, 10, 1, 9609, 0},
+    {0x6d696e61, 10759, 12, 1, 9609, 0},
+    {0x6d696e6f, 10765, 6, 1, 9609, 0},
+    {0x6d697961, 36341, 6, 1, 9609, 0},
+    {0x6d69796f, 36365, 6, 1, 9609, 0},
+    {0x6d6f6368, 21712, 9, 1, 9609, 0},
+    {0x6e616761, 8422, 6, 1, 9609, 0},
+    {0x6e616761, 10585, 6, 1, 9609, 0},
+    {0x6e616769, 36545, 6, 1, 9609, 0},
+    {0x6e616b61, 26791, 8, 1, 9609, 0},
+    {0x6e616b61, 26807, 6, 1, 9609, 0},
+    {0x6e6f7a61, 14062, 11, 1, 9609, 0},
+    {0x6f627573, 39865, 5, 1, 9609, 0},
+    {0x6f676177, 4852, 5, 1, 9609, 0},
+    {0x6f6b6179, 32562, 5, 1, 9609, 0},
+    {0x6f6d6163, 11341, 6, 1, 9609, 0},
+    {0x6f6d6900, 5081, 3, 1, 9609, 0},
+    {0x6f6f6b75, 36821, 6, 1, 9609, 0},
+    {0x6f6f7368, 32653, 7, 1, 9609, 0},
+    {0x6f74616b, 26138, 5, 1, 9609, 0},
+    {0x6f746172, 39960, 5, 1, 9609, 0},
+    {0x73616b61, 40255, 5, 1, 9609, 0},
+    {0x73616b61, 37199, 6, 1, 9609, 0},
+    {0x73616b75, 18122, 4, 1, 9609, 0},
+    {0x73616b75, 37211, 6, 1, 9609, 0},
+    {0x7368696d, 22558, 9, 1, 9609, 0},
+    {0x7368696e, 11335, 12, 1, 9609, 0},
+    {0x7368696f, 27831, 8, 1, 9609, 0},
+    {0x73757761, 22563, 4, 1, 9609, 0},
+    {0x73757a61, 37541, 6, 1, 9609, 0},
+    {0x74616b61, 37625, 6, 1, 9609, 0},
+    {0x74616b61, 28191, 8, 1, 9609, 0},
+    {0x74616b61, 28231, 8, 1, 9609, 0},
+    {0x74617465, 22936, 9, 1, 9609, 0},
+    {0x74617473, 33472, 7, 1, 9609, 0},
+    {0x746f6761, 22981, 9, 1, 9609, 0},
+    {0x746f6775, 37733, 6, 1, 9609, 0},
+    {0x746f6d69, 8892, 4, 1, 9609, 0},
+    {0x75656461, 41894, 4, 1, 9609, 0},
+    {0x77616461, 21168, 4, 1, 9609, 0},
+    {0x79616d61, 28903, 8, 1, 9609, 0},
+    {0x79616d61, 19312, 10, 1, 9609, 0},
+    {0x79617361, 38231, 6, 1, 9609, 0},
+    {0x79617375, 34109, 7, 1, 9609, 0},
+    {0x6368696a, 29671, 7, 1, 9609, 0},
+    {0x66757473, 22364, 5, 1, 9609, 0},
+    {0x676f746f, 11355, 4, 1, 9609, 0},
+    {0x68617361, 35297, 6, 1, 9609, 0},
+    {0x68697261, 35381, 6, 1, 9609, 0},
+    {0x696b6900, 10570, 3, 1, 9609, 0},
+    {0x69736168, 31358, 7, 1, 9609, 0},
+    {0x6b617761, 25807, 8, 1, 9609, 0},
+    {0x6b756368, 17282, 10, 1, 9609, 0},
+    {0x6d617473, 26407, 8, 1, 9609, 0},
+    {0x6e616761, 26775, 8, 1, 9609, 0},
+    {0x6f62616d, 39855, 5, 1, 9609, 0},
+    {0x6f6d7572, 37935, 5, 1, 9609, 0},
+    {0x6f736574, 39945, 5, 1, 9609, 0},
+    {0x7361696b, 37187, 6, 1, 9609, 0},
+    {0x73617365, 37247, 6, 1, 9609, 0},
+    {0x73656968, 40305, 5, 1, 9609, 0},
+    {0x7368696d, 22486, 9, 1, 9609, 0},
+    {0x7368696e, 11347, 12, 1, 9609, 0},
+    {0x746f6769, 33577, 7, 1, 9609, 0},
+    {0x74737573, 2671, 8, 1, 9609, 0},
+    {0x756e7a65, 40720, 5, 1, 9609, 0},
+    {0x63697479, 21447, 4, 4, 9609, 0},
+    {0x616e646f, 36848, 4, 1, 9609, 0},
+    {0x676f7365, 39040, 4, 1, 9609, 0},
+    {0x68656775, 35321, 6, 1, 9609, 0},
+    {0x68696761, 6471, 14, 1, 9609, 0},
+    {0x696b6172, 31260, 7, 1, 9609, 0},
+    {0x696b6f6d, 32118, 5, 1, 9609, 0},
+    {0x6b616d69, 10567, 12, 1, 9609, 0},
+    {0x6b616e6d, 31533, 7, 1, 9609, 0},
+    {0x6b617368, 31617, 7, 1, 9609, 0},
+    {0x6b617368, 21055, 9, 1, 9609, 0},
+    {0x6b617473, 21091, 9, 1, 9609, 0},
+    {0x6b617761, 17162, 5, 1, 9609, 0},
+    {0x6b617761, 17098, 8, 1, 9609, 0},
+    {0x6b617761, 21118, 9, 1, 9609, 0},
+    {0x6b6f7279, 39395, 5, 1, 9609, 0},
+    {0x6b75726f, 26135, 8, 1, 9609, 0},
+    {0x6d697473, 25673, 6, 1, 9609, 0},
+    {0x6d697961, 36353, 6, 1, 9609, 0},
+    {0x6e617261, 21865, 4, 1, 9609, 0},
+    {0x6e6f7365, 27039, 8, 1, 9609, 0},
+    {0x6f6a6900, 25068, 3, 1, 9609, 0},
+    {0x6f756461, 7684, 4, 1, 9609, 0},
+    {0x6f796f64, 39990, 5, 1, 9609, 0},
+    {0x73616b75, 33017, 7, 1, 9609, 0},
+    {0x73616e67, 40280, 5, 1, 9609, 0},
+    {0x7368696d, 22531, 9, 1, 9609, 0},
+    {0x7368696d, 8870, 13, 1, 9609, 0},
+    {0x7368696e, 37337, 6, 1, 9609, 0},
+    {0x736f6e69, 22112, 4, 1, 9609, 0},
+    {0x74616b61, 28223, 8, 1, 9609, 0},
+    {0x74617761, 18472, 10, 1, 9609, 0},
+    {0x74656e6b, 33507, 7, 1, 9609, 0},
+    {0x74656e72, 40565, 5, 1, 9609, 0},
+    {0x75646100, 7685, 3, 1, 9609, 0},
+    {0x79616d61, 7647, 14, 1, 9609, 0},
+    {0x79616d61, 12487, 12, 1, 9609, 0},
+    {0x79616d61, 34095, 7, 1, 9609, 0},
+    {0x796f7368, 6478, 7, 1, 9609, 0},
+    {0x61736569, 29230, 7, 0, 9609, 1},
+    {0x67656869, 35075, 6, 1, 9610, 0},
+    {0x61676100, 2406, 3, 1, 9610, 0},
+    {0x6167616e, 8423, 5, 1, 9610, 0},
+    {0x676f7365, 39040, 5, 1, 9610, 0},
+    {0x69746f69, 25455, 8, 1, 9610, 0},
+    {0x697a756d, 20893, 9, 1, 9610, 0},
+    {0x6a6f6574, 35573, 6, 1, 9610, 0},
+    {0x6b616d6f, 25679, 4, 1, 9610, 0},
+    {0x6b617269, 35663, 6, 1, 9610, 0},
+    {0x6b617368, 13677, 11, 1, 9610, 0},
+    {0x6d696e61, 10771, 12, 1, 9610, 0},
+    {0x6d697473, 32205, 7, 1, 9610, 0},
+    {0x6d75696b, 39675, 5, 1, 9610, 0},
+    {0x6d757261, 26687, 8, 1, 9610, 0},
+    {0x6d796f6b, 39685, 5, 1, 9610, 0},
+    {0x6e616761, 17682, 7, 1, 9610, 0},
+    {0x6e696967, 32429, 7, 1, 9610, 0},
+    {0x6f6a6979, 39900, 5, 1, 9610, 0},
+    {0x6f6d6900, 5081, 3, 1, 9610, 0},
+    {0x7361646f, 41734, 4, 1, 9610, 0},
+    {0x73616e6a, 40285, 5, 1, 9610, 0},
+    {0x73656972, 37277, 5, 1, 9610, 0},
+    {0x73656972, 37277, 6, 1, 9610, 0},
+    {0x73656b69, 27679, 8, 1, 9610, 0},
+    {0x73686962, 33143, 7, 1, 9610, 0},
+    {0x74616761, 25745, 6, 1, 9610, 0},
+    {0x7461696e, 37601, 6, 1, 9610, 0},
+    {0x746f6368, 37721, 6, 1, 9610, 0},
+    {0x746f6b61, 22999, 9, 1, 9610, 0},
+    {0x74737562, 33724, 7, 1, 9610, 0},
+    {0x7473756e, 37889, 6, 1, 9610, 0},
+    {0x756f6e75, 10777, 6, 1, 9610, 0},
+    {0x79616869, 38201, 6, 1, 9610, 0},
+    {0x796f6974, 40880, 5, 1, 9610, 0},
+    {0x79757a61, 38291, 6, 1, 9610, 0},
+    {0x62657070, 38510, 5, 1, 9610, 0},
+    {0x62756e67, 24071, 8, 1, 9610, 0},
+    {0x62756e67, 12808, 11, 1, 9610, 0},
+    {0x68617361, 35291, 6, 1, 9610, 0},
+    {0x68696a69, 29672, 4, 1, 9610, 0},
+    {0x68696d65, 20614, 9, 1, 9610, 0},
+    {0x68697461, 10231, 4, 1, 9610, 0},
+    {0x6b616d69, 25671, 8, 1, 9610, 0},
+    {0x6b6f6b6f, 31736, 7, 1, 9610, 0},
+    {0x6b756a75, 26031, 4, 1, 9610, 0},
+    {0x6b756e69, 26095, 8, 1, 9610, 0},
+    {0x6b757375, 41458, 4, 1, 9610, 0},
+    {0x6f697461, 39254, 4, 1, 9610, 0},
+    {0x7361696b, 40245, 5, 1, 9610, 0},
+    {0x74616b65, 37637, 6, 1, 9610, 0},
+    {0x7473756b, 33752, 7, 1, 9610, 0},
+    {0x75736100, 5113, 3, 1, 9610, 0},
+    {0x7573756b, 40755, 5, 1, 9610, 0},
+    {0x79756675, 42006, 4, 1, 9610, 0},
+    {0x616b6169, 34229, 6, 1, 9610, 0},
+    {0x6173616b, 23791, 8, 1, 9610, 0},
+    {0x62697a65, 38535, 5, 1, 9610, 0},
+    {0x68617961, 20578, 9, 1, 9610, 0},
+    {0x69626172, 31087, 5, 1, 9610, 0},
+    {0x6b616761, 25559, 8, 1, 9610, 0},
+    {0x6b617361, 31610, 7, 1, 9610, 0},
+    {0x6b696269, 25823, 8, 1, 9610, 0},
+    {0x6b756d65, 31799, 7, 1, 9610, 0},
+    {0x6b757261, 21298, 9, 1, 9610, 0},
+    {0x6d616e69, 35540, 6, 1, 9610, 0},
+    {0x6d697361, 36299, 6, 1, 9610, 0},
+    {0x6e616769, 8166, 4, 1, 9610, 0},
+    {0x6e69696d, 39795, 5, 1, 9610, 0},
+    {0x6e697368, 10891, 12, 1, 9610, 0},
+    {0x6f6b6179, 32562, 7, 1, 9610, 0},
+    {0x7361746f, 33080, 7, 1, 9610, 0},
+    {0x7365746f, 27751, 8, 1, 9610, 0},
+    {0x7368696e, 37337, 6, 1, 9610, 0},
+    {0x73686f6f, 41774, 4, 1, 9610, 0},
+    {0x736f6a61, 41790, 4, 1, 9610, 0},
+    {0x74616b61, 22900, 9, 1, 9610, 0},
+    {0x74616d61, 37649, 6, 1, 9610, 0},
+    {0x74737579, 3605, 7, 1, 9610, 0},
+    {0x77616b65, 41962, 4, 1, 9610, 0},
+    {0x79616b61, 38207, 6, 1, 9610, 0},
+    {0x6167756e, 28978, 5, 1, 9610, 0},
+    {0x67696e6f, 30896, 7, 1, 9610, 0},
+    {0x67696e6f, 35105, 6, 1, 9610, 0},
+    {0x67757368, 20506, 9, 1, 9610, 0},
+    {0x68616562, 31078, 7, 1, 9610, 0},
+    {0x68696761, 2662, 7, 1, 9610, 0},
+    {0x68697261, 35387, 6, 1, 9610, 0},
+    {0x69686579, 39200, 5, 1, 9610, 0},
+    {0x69736869, 25423, 8, 1, 9610, 0},
+    {0x69736869, 21938, 8, 1, 9610, 0},
+    {0x69746f6d, 35537, 6, 1, 9610, 0},
+    {0x697a656e, 39285, 5, 1, 9610, 0},
+    {0x6b616465, 35603, 6, 1, 9610, 0},
+    {0x6b696e00, 5508, 3, 1, 9610, 0},
+    {0x6b697461, 21181, 9, 1, 9610, 0},
+    {0x6b697461, 6681, 14, 1, 9610, 0},
+    {0x6b756d65, 26071, 8, 1, 9610, 0},
+    {0x6b756e69, 26087, 8, 1, 9610, 0},
+    {0x6d696e61, 13897, 11, 1, 9610, 0},
+    {0x6d6f746f, 36449, 6, 1, 9610, 0},
+    {0x6e61676f, 22335, 4, 1, 9610, 0},
+    {0x6e616861, 20391, 4, 1, 9610, 0},
+    {0x6e616b61, 6685, 10, 1, 9610, 0},
+    {0x6e616b69, 32317, 7, 1, 9610, 0},
+    {0x6e616e6a, 39745, 5, 1, 9610, 0},
+    {0x6e697368, 21919, 9, 1, 9610, 0},
+    {0x6f67696d, 39880, 5, 1, 9610, 0},
+    {0x6f6b696e, 32583, 7, 1, 9610, 0},
+    {0x6f6e6e61, 31472, 4, 1, 9610, 0},
+    {0x7368696d, 33199, 7, 1, 9610, 0},
+    {0x74616b65, 28255, 8, 1, 9610, 0},
+    {0x74617261, 37667, 6, 1, 9610, 0},
+    {0x746f6b61, 23008, 9, 1, 9610, 0},
+    {0x746f6d69, 18542, 10, 1, 9610, 0},
+    {0x746f6e61, 37763, 6, 1, 9610, 0},
+    {0x75726173, 37937, 6, 1, 9610, 0},
+    {0x7572756d, 32055, 5, 1, 9610, 0},
+    {0x79616573, 40855, 5, 1, 9610, 0},
+    {0x796f6d69, 34123, 7, 1, 9610, 0},
+    {0x796f6e61, 28967, 8, 1, 9610, 0},
+    {0x796f6e61, 28975, 8, 1, 9610, 0},
+    {0x7a616d61, 38297, 6, 1, 9610, 0},
+    {0x6162656e, 38325, 5, 1, 9610, 0},
+    {0x63686968, 6177, 14, 1, 9610, 0},
+    {0x6368756f, 14476, 4, 1, 9610, 0},
+    {0x64616974, 13903, 5, 1, 9610, 0},
+    {0x66756a69, 20353, 9, 1, 9610, 0},
+    {0x68616269, 25055, 8, 1, 9610, 0},
+    {0x68616e6e, 35261, 6, 1, 9610, 0},
+    {0x68696761, 10207, 12, 1, 9610, 0},
+    {0x68696761, 3628, 16, 1, 9610, 0},
+    {0x68696761, 4842, 15, 1, 9610, 0},
+    {0x68697261, 25167, 8, 1, 9610, 0},
+    {0x69626172, 31232, 7, 1, 9610, 0},
+    {0x696b6564, 39205, 5, 1, 9610, 0},
+    {0x697a756d, 15893, 5, 1, 9610, 0},
+    {0x697a756d, 20866, 9, 1, 9610, 0},
+    {0x697a756d, 20875, 9, 1, 9610, 0},
+    {0x6b61646f, 17704, 6, 1, 9610, 0},
+    {0x6b61697a, 31512, 7, 1, 9610, 0},
+    {0x6b616e61, 39310, 5, 1, 9610, 0},
+    {0x6b617368, 21064, 9, 1, 9610, 0},
+    {0x6b617461, 35687, 6, 1, 9610, 0},
+    {0x6b617761, 8415, 13, 1, 9610, 0},
+    {0x6b697368, 21163, 9, 1, 9610, 0},
+    {0x6b697461, 6681, 4, 1, 9610, 0},
+    {0x6b756d61, 26063, 8, 1, 9610, 0},
+    {0x6d617473, 21550, 9, 1, 9610, 0},
+    {0x6d696e61, 14364, 6, 1, 9610, 0},
+    {0x6d696e6f, 39640, 5, 1, 9610, 0},
+    {0x6d697361, 36299, 6, 1, 9610, 0},
+    {0x6d6f7269, 21748, 9, 1, 9610, 0},
+    {0x6e657961, 26935, 8, 1, 9610, 0},
+    {0x6e697368, 10891, 5, 1, 9610, 0},
+    {0x6e6f7365, 14485, 4, 1, 9610, 0},
+    {0x6f73616b, 14128, 11, 1, 9610, 0},
+    {0x73616b61, 14359, 5, 1, 9610, 0},
+    {0x73617961, 14133, 6, 1, 9610, 0},
+    {0x73656e6e, 37307, 6, 1, 9610, 0},
+    {0x73657474, 37313, 6, 1, 9610, 0},
+    {0x7368696a, 14458, 11, 1, 9610, 0},
+    {0x7368696d, 22504, 9, 1, 9610, 0},
+    {0x73756974, 40505, 5, 1, 9610, 0},
+    {0x74616461, 33437, 7, 1, 9610, 0},
+    {0x74616973, 33451, 6, 1, 9610, 0},
+    {0x74616a69, 37619, 6, 1, 9610, 0},
+    {0x74616b61, 28183, 8, 1, 9610, 0},
+    {0x74616b61, 22927, 9, 1, 9610, 0},
+    {0x746f6e64, 11491, 12, 1, 9610, 0},
+    {0x746f796f, 28463, 8, 1, 9610, 0},
+    {0x746f796f, 37805, 6, 1, 9610, 0},
+    {0x79616f00, 9738, 3, 1, 9610, 0},
+    {0x61726961, 34325, 6, 1, 9610, 0},
+    {0x61726974, 17777, 5, 1, 9610, 0},
+    {0x66756b75, 24887, 8, 1, 9610, 0},
+    {0x67656e6b, 35087, 6, 1, 9610, 0},
+    {0x68616d61, 25079, 8, 1, 9610, 0},
+    {0x68697a65, 8540, 5, 1, 9610, 0},
+    {0x696d6172, 39215, 5, 1, 9610, 0},
+    {0x6b616d69, 25655, 8, 1, 9610, 0},
+    {0x6b616e7a, 31554, 7, 1, 9610, 0},
+    {0x6b617261, 31568, 7, 1, 9610, 0},
+    {0x6b617368, 22920, 7, 1, 9610, 0},
+    {0x6b697461, 25895, 8, 1, 9610, 0},
+    {0x6b697461, 25911, 8, 1, 9610, 0},
+    {0x6b697961, 35777, 6, 1, 9610, 0},
+    {0x6b6f7568, 31764, 7, 1, 9610, 0},
+    {0x6b797572, 31841, 7, 1, 9610, 0},
+    {0x6e697368, 17772, 10, 1, 9610, 0},
+    {0x6f676900, 6059, 3, 1, 9610, 0},
+    {0x6f6d6163, 11341, 6, 1, 9610, 0},
+    {0x6f756368, 19317, 5, 1, 9610, 0},
+    {0x73616761, 18102, 4, 1, 9610, 0},
+    {0x73686972, 22630, 9, 1, 9610, 0},
+    {0x74616b75, 31408, 4, 1, 9610, 0},
+    {0x74617261, 11408, 4, 1, 9610, 0},
+    {0x746f7375, 36457, 4, 1, 9610, 0},
+    {0x796f7368, 15800, 11, 1, 9610, 0},
+    {0x6172616b, 25764, 7, 1, 9610, 0},
+    {0x6173616b, 6186, 5, 1, 9610, 0},
+    {0x63686963, 4819, 8, 1, 9610, 0},
+    {0x66756a69, 24855, 6, 1, 9610, 0},
+    {0x66756a69, 24855, 8, 1, 9610, 0},
+    {0x66756b61, 35021, 6, 1, 9610, 0},
+    {0x68616e6e, 39110, 5, 1, 9610, 0},
+    {0x68616e79, 39115, 5, 1, 9610, 0},
+    {0x68617375, 35303, 6, 1, 9610, 0},
+    {0x6861746f, 25103, 8, 1, 9610, 0},
+    {0x6861746f, 25111, 8, 1, 9610, 0},
+    {0x68696461, 35351, 6, 1, 9610, 0},
+    {0x68696761, 4812, 15, 1, 9610, 0},
+    {0x68696761, 3596, 16, 1, 9610, 0},
+    {0x686f6e6a, 23624, 5, 1, 9610, 0},
+    {0x696e6100, 721, 3, 1, 9610, 0},
+    {0x6972756d, 39240, 5, 1, 9610, 0},
+    {0x69776174, 25471, 8, 1, 9610, 0},
+    {0x6b616d69, 20992, 9, 1, 9610, 0},
+    {0x6b616d69, 25647, 8, 1, 9610, 0},
+    {0x6b616d69, 25663, 8, 1, 9610, 0},
+    {0x6b617375, 25735, 8, 1, 9610, 0},
+    {0x6b617761, 31638, 7, 1, 9610, 0},
+    {0x6b617761, 4756, 9, 1, 9610, 0},
+    {0x6b617761, 25767, 8, 1, 9610, 0},
+    {0x6b617a6f, 41394, 4, 1, 9610, 0},
+    {0x6b697461, 25935, 8, 1, 9610, 0},
+    {0x6b6f7368, 21226, 9, 1, 9610, 0},
+    {0x6b6f756e, 31771, 7, 1, 9610, 0},
+    {0x6b756b69, 35751, 4, 1, 9610, 0},
+    {0x6b756d61, 26047, 8, 1, 9610, 0},
+    {0x6d617473, 17492, 10, 1, 9610, 0},
+    {0x6d696e61, 36269, 6, 1, 9610, 0},
+    {0x6d697361, 6535, 6, 1, 9610, 0},
+    {0x6d697961, 21685, 9, 1, 9610, 0},
+    {0x6d69796f, 3637, 7, 1, 9610, 0},
+    {0x6d6f726f, 26623, 8, 1, 9610, 0},
+    {0x6e616761, 26783, 8, 1, 9610, 0},
+    {0x6e616d65, 26847, 8, 1, 9610, 0},
+    {0x6e69697a, 39800, 5, 1, 9610, 0},
+    {0x6f67616e, 39875, 5, 1, 9610, 0},
+    {0x6f676177, 4852, 5, 1, 9610, 0},
+    {0x6f676f73, 39890, 5, 1, 9610, 0},
+    {0x6f6b6567, 32576, 7, 1, 9610, 0},
+    {0x6f6d6979, 10238, 5, 1, 9610, 0},
+    {0x6f74616b, 26138, 5, 1, 9610, 0},
+    {0x72616e7a, 37073, 6, 1, 9610, 0},
+    {0x72796f6b, 32989, 7, 1, 9610, 0},
+    {0x73616974, 33010, 7, 1, 9610, 0},
+    {0x73616b61, 37193, 6, 1, 9610, 0},
+    {0x73617474, 40295, 5, 1, 9610, 0},
+    {0x73617961, 14133, 6, 1, 9610, 0},
+    {0x7368696b, 21302, 5, 1, 9610, 0},
+    {0x73686972, 27839, 8, 1, 9610, 0},
+    {0x736f6b61, 41794, 4, 1, 9610, 0},
+    {0x73756769, 37481, 6, 1, 9610, 0},
+    {0x746f6461, 40610, 4, 1, 9610, 0},
+    {0x746f6b69, 28391, 8, 1, 9610, 0},
+    {0x746f6b6f, 18532, 10, 1, 9610, 0},
+    {0x74737572, 11527, 12, 1, 9610, 0},
+    {0x75726177, 40735, 5, 1, 9610, 0},
+    {0x77617261, 38117, 6, 1, 9610, 0},
+    {0x79617368, 38237, 6, 1, 9610, 0},
+    {0x796f6b6f, 38279, 6, 1, 9610, 0},
+    {0x796f6e6f, 23085, 4, 1, 9610, 0},
+    {0x796f7269, 40890, 5, 1, 9610, 0},
+    {0x796f7368, 13351, 7, 1, 9610, 0},
+    {0x796f7368, 23602, 9, 1, 9610, 0},
+    {0x796f7368, 34130, 7, 1, 9610, 0},
+    {0x63697479, 21447, 4, 4, 9610, 0},
+    {0x63697479, 21447, 4, 4, 9610, 0},
+    {0x61697368, 37359, 5, 1, 9610, 0},
+    {0x67616d6f, 29401, 4, 1, 9610, 0},
+    {0x68696761, 16852, 10, 1, 9610, 0},
+    {0x68696b6f, 35363, 6, 1, 9610, 0},
+    {0x6b6f6b61, 41434, 4, 1, 9610, 0},
+    {0x6b6f6e61, 39380, 5, 1, 9610, 0},
+    {0x6b6f7365, 39405, 5, 1, 9610, 0},
+    {0x6b6f746f, 25991, 4, 1, 9610, 0},
+    {0x6b757361, 31813, 7, 1, 9610, 0},
+    {0x6d616962, 32044, 7, 1, 9610, 0},
+    {0x6d6f7269, 26615, 8, 1, 9610, 0},
+    {0x6e616761, 26767, 8, 1, 9610, 0},
+    {0x6e697368, 21910, 9, 1, 9610, 0},
+    {0x6e6f746f, 27071, 8, 1, 9610, 0},
+    {0x6f6d6968, 14095, 11, 1, 9610, 0},
+    {0x6f747375, 11367, 4, 1, 9610, 0},
+    {0x72697474, 40180, 5, 1, 9610, 0},
+    {0x7279756f, 40225, 5, 1, 9610, 0},
+    {0x74616b61, 22918, 9, 1, 9610, 0},
+    {0x74616b61, 22927, 9, 1, 9610, 0},
+    {0x746f7261, 28447, 8, 1, 9610, 0},
+    {0x746f796f, 28471, 8, 1, 9610, 0},
+    {0x79617375, 21812, 4, 1, 9610, 0},
+    {0x616b6167, 37626, 5, 1, 9610, 0},
+    {0x616d6100, 969, 3, 1, 9610, 0},
+    {0x676f7473, 39045, 5, 1, 9610, 0},
+    {0x68616d61, 35243, 6, 1, 9610, 0},
+    {0x68696761, 10195, 12, 1, 9610, 0},
+    {0x68696b61, 6529, 6, 1, 9610, 0},
+    {0x68696b69, 31692, 6, 1, 9610, 0},
+    {0x697a756d, 10202, 5, 1, 9610, 0},
+    {0x6b616b69, 25575, 8, 1, 9610, 0},
+    {0x6d617375, 36149, 6, 1, 9610, 0},
+    {0x6d617473, 36161, 6, 1, 9610, 0},
+    {0x6d697361, 6535, 6, 1, 9610, 0},
+    {0x6e697368, 10927, 12, 1, 9610, 0},
+    {0x6f686461, 41638, 4, 1, 9610, 0},
+    {0x6f6b696e, 17812, 10, 1, 9610, 0},
+    {0x6f6b7569, 27127, 8, 1, 9610, 0},
+    {0x7368696d, 33185, 7, 1, 9610, 0},
+    {0x74616d61, 37655, 6, 1, 9610, 0},
+    {0x74737577, 33773, 7, 1, 9610, 0},
+    {0x756e6e61, 40715, 5, 1, 9610, 0},
+    {0x79616b75, 38213, 6, 1, 9610, 0},
+    {0x79617375, 38249, 6, 1, 9610, 0},
+    {0x79617473, 34116, 7, 1, 9610, 0},
+    {0x61726169, 22878, 4, 1, 9610, 0},
+    {0x6174616d, 26516, 5, 1, 9610, 0},
+    {0x66756a69, 4752, 4, 1, 9610, 0},
+    {0x66756a69, 30791, 7, 1, 9610, 0},
+    {0x66756a69, 4752, 8, 1, 9610, 0},
+    {0x66756a69, 16702, 10, 1, 9610, 0},
+    {0x66756b75, 30819, 7, 1, 9610, 0},
+    {0x676f7465, 30987, 7, 1, 9610, 0},
+    {0x68616962, 31085, 7, 1, 9610, 0},
+    {0x68616d61, 20542, 9, 1, 9610, 0},
+    {0x68696761, 10195, 10, 1, 9610, 0},
+    {0x69746f00, 8891, 3, 1, 9610, 0},
+    {0x69776174, 39275, 5, 1, 9610, 0},
+    {0x697a7500, 7701, 3, 1, 9610, 0},
+    {0x697a756e, 20902, 9, 1, 9610, 0},
+    {0x6b616b65, 25567, 8, 1, 9610, 0},
+    {0x6b616e6e, 31540, 7, 1, 9610, 0},
+    {0x6b617761, 21109, 9, 1, 9610, 0},
+    {0x6b617761, 35717, 6, 1, 9610, 0},
+    {0x6b696b75, 25839, 8, 1, 9610, 0},
+    {0x6b6f7361, 39400, 5, 1, 9610, 0},
+    {0x6d616b69, 17402, 10, 1, 9610, 0},
+    {0x6d617473, 21586, 9, 1, 9610, 0},
+    {0x6d696e61, 21667, 9, 1, 9610, 0},
+    {0x6d697368, 32191, 7, 1, 9610, 0},
+    {0x6d6f7269, 21757, 9, 1, 9610, 0},
+    {0x6e697368, 26983, 8, 1, 9610, 0},
+    {0x6e756d61, 36731, 6, 1, 9610, 0},
+    {0x6f6d6165, 27135, 8, 1, 9610, 0},
+    {0x7368696d, 33178, 7, 1, 9610, 0},
+    {0x7368696d, 14627, 7, 1, 9610, 0},
+    {0x7368696d, 22513, 7, 1, 9610, 0},
+    {0x7368697a, 27847, 8, 1, 9610, 0},
+    {0x7375736f, 37535, 6, 1, 9610, 0},
+    {0x7961697a, 40870, 5, 1, 9610, 0},
+    {0x796f7368, 13351, 7, 1, 9610, 0},
+    {0x61736869, 8210, 8, 1, 9610, 0},
+    {0x6261746f, 33617, 4, 1, 9610, 0},
+    {0x68616761, 41298, 4, 1, 9610, 0},
+    {0x69636869, 31253, 7, 1, 9610, 0},
+    {0x69776166, 31428, 7, 1, 9610, 0},
+    {0x6b616d69, 17092, 10, 1, 9610, 0},
+    {0x6b616e75, 35651, 6, 1, 9610, 0},
+    {0x6b617261, 17132, 10, 1, 9610, 0},
+    {0x6b75726f, 31806, 7, 1, 9610, 0},
+    {0x6d617368, 32114, 7, 1, 9610, 0},
+    {0x6d696275, 41538, 4, 1, 9610, 0},
+    {0x6d6f6b61, 22543, 4, 1, 9610, 0},
+    {0x6d6f7465, 36443, 6, 1, 9610, 0},
+    {0x6e617375, 10855, 4, 1, 9610, 0},
+    {0x6e617375, 10855, 12, 1, 9610, 0},
+    {0x6e696b6b, 39805, 5, 1, 9610, 0},
+    {0x6e697368, 21928, 9, 1, 9610, 0},
+    {0x6e6f6769, 41598, 4, 1, 9610, 0},
+    {0x6f686972, 25994, 5, 1, 9610, 0},
+    {0x6f687461, 27119, 8, 1, 9610, 0},
+    {0x6f79616d, 17107, 5, 1, 9610, 0},
+    {0x73616b75, 18122, 6, 1, 9610, 0},
+    {0x73616e6f, 20880, 4, 1, 9610, 0},
+    {0x7368696d, 18292, 10, 1, 9610, 0},
+    {0x7368696f, 37343, 6, 1, 9610, 0},
+    {0x74616b61, 18432, 10, 1, 9610, 0},
+    {0x746f6368, 33570, 7, 1, 9610, 0},
+    {0x74737567, 13978, 5, 1, 9610, 0},
+    {0x756a6969, 40695, 5, 1, 9610, 0},
+    {0x75747375, 18622, 10, 1, 9610, 0},
+    {0x79616974, 40865, 5, 1, 9610, 0},
+    {0x61697a75, 15892, 6, 1, 9610, 0},
+    {0x616e616e, 3346, 4, 1, 9610, 0},
+    {0x69636869, 19346, 6, 1, 9610, 0},
+    {0x6974616e, 39255, 5, 1, 9610, 0},
+    {0x6b61696e, 35615, 6, 1, 9610, 0},
+    {0x6b6f6d61, 10627, 12, 1, 9610, 0},
+    {0x6d617473, 17502, 10, 1, 9610, 0},
+    {0x6d696d61, 13829, 4, 1, 9610, 0},
+    {0x6d696e61, 5082, 6, 1, 9610, 0},
+    {0x6d69796f, 3637, 7, 1, 9610, 0},
+    {0x6d756769, 41558, 4, 1, 9610, 0},
+    {0x6e616b61, 26791, 8, 1, 9610, 0},
+    {0x6e617275, 36593, 6, 1, 9610, 0},
+    {0x73616e61, 22333, 9, 1, 9610, 0},
+    {0x73686973, 22648, 9, 1, 9610, 0},
+    {0x746f6b75, 23017, 9, 1, 9610, 0},
+    {0x77616a69, 38099, 6, 1, 9610, 0},
+    {0x61646163, 34181, 6, 1, 9610, 0},
+    {0x616b6972, 29132, 7, 1, 9610, 0},
+    {0x616b6973, 22501, 8, 1, 9610, 0},
+    {0x616f6761, 19543, 9, 1, 9610, 0},
+    {0x6172616b, 25764, 7, 1, 9610, 0},
+    {0x62756e6b, 34541, 6, 1, 9610, 0},
+    {0x63686979, 29713, 7, 1, 9610, 0},
+    {0x63686f66, 38640, 5, 1, 9610, 0},
+    {0x6368756f, 14476, 4, 1, 9610, 0},
+    {0x65646f67, 30098, 7, 1, 9610, 0},
+    {0x66756368, 38945, 5, 1, 9610, 0},
+    {0x66757373, 38960, 5, 1, 9610, 0},
+    {0x68616368, 31071, 7, 1, 9610, 0},
+    {0x68616368, 25063, 8, 1, 9610, 0},
+    {0x68616d75, 35249, 6, 1, 9610, 0},
+    {0x68696761, 8233, 13, 1, 9610, 0},
+    {0x68696761, 4827, 15, 1, 9610, 0},
+    {0x68696761, 8259, 13, 1, 9610, 0},
+    {0x68696e6f, 6481, 4, 1, 9610, 0},
+    {0x68696e6f, 32476, 6, 1, 9610, 0},
+    {0x68696e6f, 25159, 8, 1, 9610, 0},
+    {0x696e6167, 39225, 5, 1, 9610, 0},
+    {0x69746162, 25447, 8, 1, 9610, 0},
+    {0x6b617473, 17142, 10, 1, 9610, 0},
+    {0x6b697461, 6681, 4, 1, 9610, 0},
+    {0x6b69796f, 35783, 6, 1, 9610, 0},
+    {0x6b6f6461, 31722, 7, 1, 9610, 0},
+    {0x6b6f6761, 31729, 7, 1, 9610, 0},
+    {0x6b6f6b75, 21199, 9, 1, 9610, 0},
+    {0x6b6f6d61, 39375, 5, 1, 9610, 0},
+    {0x6b6f746f, 25991, 4, 1, 9610, 0},
+    {0x6b6f757a, 17262, 10, 1, 9610, 0},
+    {0x6b756e69, 21280, 9, 1, 9610, 0},
+    {0x6d616368, 32037, 7, 1, 9610, 0},
+    {0x6d656775, 36185, 6, 1, 9610, 0},
+    {0x6d696e61, 14364, 6, 1, 9610, 0},
+    {0x6d697461, 36323, 6, 1, 9610, 0},
+    {0x6d697a75, 36371, 6, 1, 9610, 0},
+    {0x6d757361, 5112, 15, 1, 9610, 0},
+    {0x6d757361, 21784, 9, 1, 9610, 0},
+    {0x6e616b61, 26807, 6, 1, 9610, 0},
+    {0x6e657269, 36623, 6, 1, 9610, 0},
+    {0x6f676173, 22009, 9, 1, 9610, 0},
+    {0x6f6b7574, 32590, 7, 1, 9610, 0},
+    {0x6f6d6500, 4769, 3, 1, 9610, 0},
+    {0x6f736869, 3590, 6, 1, 9610, 0},
+    {0x6f746100, 3442, 3, 1, 9610, 0},
+    {0x73657461, 27743, 8, 1, 9610, 0},
+    {0x73686962, 33150, 7, 1, 9610, 0},
+    {0x7368696e, 22567, 9, 1, 9610, 0},
+    {0x7368696e, 27799, 8, 1, 9610, 0},
+    {0x73756769, 28039, 8, 1, 9610, 0},
+    {0x73756d69, 37505, 6, 1, 9610, 0},
+    {0x74616368, 22882, 9, 1, 9610, 0},
+    {0x74616974, 40535, 5, 1, 9610, 0},
+    {0x74616d61, 14579, 4, 1, 9610, 0},
+    {0x746f7368, 33619, 7, 1, 9610, 0},
+    {0x6368697a, 21714, 5, 1, 9610, 0},
+    {0x68696e6f, 6481, 4, 1, 9610, 0},
+    {0x6b617761, 25759, 8, 1, 9610, 0},
+    {0x6b6f6765, 4765, 4, 1, 9610, 0},
+    {0x6b6f746f, 31757, 7, 1, 9610, 0},
+    {0x6d697361, 36305, 6, 1, 9610, 0},
+    {0x6e616e62, 39735, 5, 1, 9610, 0},
+    {0x6e696368, 26943, 8, 1, 9610, 0},
+    {0x73616b61, 14359, 11, 1, 9610, 0},
+    {0x746f7474, 33626, 7, 1, 9610, 0},
+    {0x77616b61, 21044, 6, 1, 9610, 0},
+    {0x79617a75, 36361, 4, 1, 9610, 0},
+    {0x796f6e61, 38285, 6, 1, 9610, 0},
+    {0x61736168, 17907, 5, 1, 9610, 0},
+    {0x66756368, 38945, 5, 1, 9610, 0},
+    {0x66756b75, 20371, 9, 1, 9610, 0},
+    {0x66756e61, 20389, 9, 1, 9610, 0},
+    {0x68696d69, 14628, 4, 1, 9610, 0},
+    {0x696d697a, 14629, 5, 1, 9610, 0},
+    {0x696e616d, 5083, 5, 1, 9610, 0},
+    {0x6a6f6861, 35585, 6, 1, 9610, 0},
+    {0x6b616d69, 25639, 8, 1, 9610, 0},
+    {0x6b75726f, 35885, 6, 1, 9610, 0},
+    {0x6e616b61, 13963, 11, 1, 9610, 0},
+    {0x6e616d65, 17722, 10, 1, 9610, 0},
+    {0x6e616e74, 39750, 5, 1, 9610, 0},
+    {0x6e79757a, 36737, 6, 1, 9610, 0},
+    {0x6f796162, 39985, 5, 1, 9610, 0},
+    {0x74616972, 40530, 5, 1, 9610, 0},
+    {0x74616b61, 33458, 7, 1, 9610, 0},
+    {0x74617465, 28335, 8, 1, 9610, 0},
+    {0x746f6761, 22981, 4, 1, 9610, 0},
+    {0x746f6e61, 37769, 6, 1, 9610, 0},
+    {0x746f7961, 25113, 6, 1, 9610, 0},
+    {0x756e617a, 33787, 7, 1, 9610, 0},
+    {0x756f7a75, 41902, 4, 1, 9610, 0},
+    {0x79616d61, 38219, 6, 1, 9610, 0},
+    {0x61726964, 19597, 5, 1, 9610, 0},
+    {0x61726964, 19597, 9, 1, 9610, 0},
+    {0x676f626f, 41258, 4, 1, 9610, 0},
+    {0x68617368, 20560, 9, 1, 9610, 0},
+    {0x68696461, 35351, 6, 1, 9610, 0},
+    {0x6869726f, 25175, 8, 1, 9610, 0},
+    {0x696e616d, 5083, 5, 1, 9610, 0},
+    {0x69776164, 39265, 5, 1, 9610, 0},
+    {0x6b61696e, 35615, 6, 1, 9610, 0},
+    {0x6b616d69, 21010, 9, 1, 9610, 0},
+    {0x6b617473, 21091, 9, 1, 9610, 0},
+    {0x6b696d69, 35753, 6, 1, 9610, 0},
+    {0x6b696e6f, 25855, 8, 1, 9610, 0},
+    {0x6b697461, 8875, 8, 1, 9610, 0},
+    {0x6b6f7961, 19310, 4, 1, 9610, 0},
+    {0x6b6f7a61, 25999, 4, 1, 9610, 0},
+    {0x6b6f7a61, 25999, 8, 1, 9610, 0},
+    {0x6b75646f, 26023, 8, 1, 9610, 0},
+    {0x6b757368, 21307, 9, 1, 9610, 0},
+    {0x6d696861, 36239, 6, 1, 9610, 0},
+    {0x6d697361, 6535, 6, 1, 9610, 0},
+    {0x6e616368, 8610, 13, 1, 9610, 0},
+    {0x7368696e, 37331, 6, 1, 9610, 0},
+    {0x73686972, 22594, 9, 1, 9610, 0},
+    {0x7461696a, 40520, 5, 1, 9610, 0},
+    {0x74616e61, 21346, 6, 1, 9610, 0},
+    {0x77616b61, 28751, 8, 1, 9610, 0},
+    {0x79756173, 40900, 5, 1, 9610, 0},
+    {0x79757261, 31842, 4, 1, 9610, 0},
+    {0x61736168, 17907, 5, 1, 9610, 0},
+    {0x66756e61, 24911, 8, 1, 9610, 0},
+    {0x68696761, 20605, 9, 1, 9610, 0},
+    {0x69696465, 20356, 4, 1, 9610, 0},
+    {0x6b61686f, 35609, 6, 1, 9610, 0},
+    {0x6b616d69, 17102, 10, 1, 9610, 0},
+    {0x6b616e65, 25711, 8, 1, 9610, 0},
+    {0x6b617761, 21118, 9, 1, 9610, 0},
+    {0x6d616d75, 17432, 10, 1, 9610, 0},
+    {0x6d696b61, 25649, 6, 1, 9610, 0},
+    {0x6d757261, 4834, 8, 1, 9610, 0},
+    {0x6e616761, 39710, 5, 1, 9610, 0},
+    {0x6e616b61, 26831, 8, 1, 9610, 0},
+    {0x6e616e79, 39755, 5, 1, 9610, 0},
+    {0x6e697368, 21937, 9, 1, 9610, 0},
+    {0x6f62616e, 22000, 9, 1, 9610, 0},
+    {0x6f650000, 11112, 2, 1, 9610, 0},
+    {0x6f67756e, 13914, 5, 1, 9610, 0},
+    {0x6f686b75, 36761, 6, 1, 9610, 0},
+    {0x6f697368, 32548, 7, 1, 9610, 0},
+    {0x73616761, 40235, 5, 1, 9610, 0},
+    {0x73616b61, 37205, 6, 1, 9610, 0},
+    {0x73616b65, 27551, 8, 1, 9610, 0},
+    {0x7368696e, 37337, 6, 1, 9610, 0},
+    {0x73686972, 22612, 9, 1, 9610, 0},
+    {0x73686f6e, 37355, 6, 1, 9610, 0},
+    {0x74616b61, 28175, 8, 1, 9610, 0},
+    {0x74656e64, 40555, 5, 1, 9610, 0},
+    {0x746f7a61, 37817, 6, 1, 9610, 0},
+    {0x74737572, 28543, 8, 1, 9610, 0},
+    {0x79616d61, 28903, 8, 1, 9610, 0},
+    {0x79616d61, 28927, 8, 1, 9610, 0},
+    {0x796f6e65, 28983, 8, 1, 9610, 0},
+    {0x79757a61, 38291, 4, 1, 9610, 0},
+    {0x61627500, 4436, 3, 1, 9610, 0},
+    {0x68616769, 28155, 4, 1, 9610, 0},
+    {0x68696b61, 5961, 6, 1, 9610, 0},
+    {0x686f6675, 38641, 4, 1, 9610, 0},
+    {0x6977616b, 31435, 7, 1, 9610, 0},
+    {0x6b756461, 21262, 9, 1, 9610, 0},
+    {0x6d69746f, 39645, 5, 1, 9610, 0},
+    {0x6e616761, 26783, 6, 1, 9610, 0},
+    {0x6f736869, 3590, 6, 1, 9610, 0},
+    {0x7368696d, 14480, 11, 1, 9610, 0},
+    {0x7368756e, 37367, 6, 1, 9610, 0},
+    {0x74616275, 37583, 6, 1, 9610, 0},
+    {0x746f6b75, 28407, 8, 1, 9610, 0},
+    {0x746f796f, 37811, 6, 1, 9610, 0},
+    {0x75626500, 10701, 3, 1, 9610, 0},
+    {0x79757500, 42468, 3, 1, 9610, 0},
+    {0x6368756f, 14476, 4, 1, 9610, 0},
+    {0x646f7368, 38765, 5, 1, 9610, 0},
+    {0x66756566, 30784, 7, 1, 9610, 0},
+    {0x66756a69, 4752, 8, 1, 9610, 0},
+    {0x66756a69, 4752, 15, 1, 9610, 0},
+    {0x66756a69, 13347, 11, 1, 9610, 0},
+    {0x68617961, 25119, 8, 1, 9610, 0},
+    {0x686f6b75, 35399, 6, 1, 9610, 0},
+    {0x69636869, 6527, 14, 1, 9610, 0},
+    {0x6b616900, 13451, 3, 1, 9610, 0},
+    {0x6b6f6675, 41430, 4, 1, 9610, 0},
+    {0x6b6f7368, 39410, 5, 1, 9610, 0},
+    {0x6b6f7375, 35837, 6, 1, 9610, 0},
+    {0x6d696e61, 13875, 11, 1, 9610, 0},
+    {0x6d696e6f, 36293, 6, 1, 9610, 0},
+    {0x6e616b61, 21847, 9, 1, 9610, 0},
+    {0x6e616e62, 39735, 5, 1, 9610, 0},
+    {0x6e617275, 26871, 8, 1, 9610, 0},
+    {0x6e697261, 26975, 8, 1, 9610, 0},
+    {0x6e697368, 10903, 12, 1, 9610, 0},
+    {0x6f736869, 6479, 6, 1, 9610, 0},
+    {0x6f747375, 36869, 6, 1, 9610, 0},
+    {0x73686f77, 40365, 5, 1, 9610, 0},
+    {0x74616261, 28143, 8, 1, 9610, 0},
+    {0x74737572, 11527, 5, 1, 9610, 0},
+    {0x75656e6f, 28599, 8, 1, 9610, 0},
+    {0x79616d61, 19302, 10, 1, 9610, 0},
+    {0x79616d61, 23548, 9, 1, 9610, 0},
+    {0x63697479, 21447, 4, 4, 9610, 0},
+    {0x626c6f67, 23967, 8, 1, 9610, 0},
+    {0x75706161, 40725, 5, 1, 9610, 0},
+    {0x64657600, 4572, 3, 1, 9610, 0},
+    {0x73697465, 7773, 5, 1, 9610, 0},
+    {0x6c6f6361, 21469, 9, 1, 9610, 0},
+    {0x73697465, 126, 4, 1, 9610, 0},
+    {0x626c6f67, 23967, 8, 1, 9610, 0},
+    {0x666f7267, 34985, 6, 1, 9610, 0},
+    {0x666f7267, 34985, 6, 1, 9610, 0},
+    {0x70726f64, 7931, 4, 0, 9610, 1},
+    {0x31000000, 144, 1, 1, 9611, 0},
+    {0x32000000, 33, 1, 1, 9611, 0},
+    {0x63656e74, 19903, 9, 1, 9611, 0},
+    {0x65617374, 24551, 8, 1, 9611, 0},
+    {0x65617374, 30077, 7, 1, 9611, 0},
+    {0x77657374, 18752, 10, 1, 9611, 0},
+    {0x77657374, 33976, 7, 1, 9611, 0},
+    {0x72000000, 6, 1, 1, 9611, 0},
+    {0x75000000, 22, 1, 1, 9611, 0},
+    {0x66726131, 30392, 7, 1, 9611, 0},
+    {0x77657374, 28807, 8, 1, 9611, 0},
+    {0x6a6c732d, 25511, 8, 1, 9611, 0},
+    {0x6a6c732d, 25519, 8, 1, 9611, 0},
+    {0x6a6c732d, 25527, 8, 1, 9611, 0},
+    {0x66726565, 30399, 7, 1, 9611, 0},
+    {0x6d617000, 36909, 3, 1, 9611, 0},
+    {0x70726f64, 7931, 4, 0, 9611, 2},
+    {0x73736c00, 19900, 3, 0, 9613, 3},
+    {0x6d617000, 36909, 3, 1, 9616, 0},
+    {0x70616173, 33965, 4, 0, 9616, 6},
+    {0x686f7374, 4872, 7, 2, 9622, 0},
+    {0x77656270, 33962, 7, 2, 9622, 0},
+    {0x6a656c61, 25487, 8, 1, 9622, 0},
+    {0x6e6f7264, 10951, 12, 1, 9622, 0},
+    {0x6a000000, 593, 1, 1, 9622, 0},
+    {0x736f6300, 790, 3, 1, 9622, 0},
+    {0x75736572, 767, 4, 1, 9622, 0},
+    {0x62657461, 16062, 4, 1, 9622, 0},
+    {0x70616765, 2094, 5, 1, 9622, 0},
+    {0x6a656c61, 25487, 8, 1, 9622, 0},
+    {0x6a656c61, 25487, 8, 0, 9622, 3},
+    {0x73746f72, 33367, 7, 1, 9625, 0},
+    {0x77656273, 123, 7, 1, 9625, 0},
+    {0x626c6f67, 23967, 8, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x6e657300, 1810, 3, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x6e657300, 1810, 3, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x6f730000, 10, 2, 1, 9625, 0},
+    {0x76616c65, 35448, 5, 1, 9625, 0},
+    {0x786e2d2d, 12463, 12, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x6f730000, 10, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x6865726f, 39125, 5, 1, 9625, 0},
+    {0x73616e64, 18132, 5, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x626f0000, 887, 2, 1, 9625, 0},
+    {0x6865726f, 39125, 5, 1, 9625, 0},
+    {0x786e2d2d, 23332, 9, 1, 9625, 0},
+    {0x786e2d2d, 11971, 12, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x76616c65, 35448, 5, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x626f0000, 887, 2, 1, 9625, 0},
+    {0x786e2d2d, 23332, 9, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x73616e64, 18132, 5, 1, 9625, 0},
+    {0x67730000, 3101, 2, 1, 9625, 0},
+    {0x73616e64, 18132, 5, 1, 9625, 0},
+    {0x786e2d2d, 11971, 12, 1, 9625, 0},
+    {0x786e2d2d, 12463, 12, 1, 9625, 0},
+    {0x626c6f67, 23967, 8, 1, 9625, 0},
+    {0x73746167, 980, 7, 1, 9625, 0},
+    {0x74656c65, 15, 4, 1, 9625, 0},
+    {0x63000000, 4, 1, 1, 9625, 0},
+    {0x72736300, 2111, 3, 1, 9625, 0},
+    {0x6f726967, 973, 6, 0, 9625, 1},
+    {0x676f0000, 810, 2, 1, 9626, 0},
+    {0x686f6d65, 4857, 4, 1, 9626, 0},
+    {0x616c0000, 106, 2, 1, 9626, 0},
+    {0x6173736f, 788, 4, 1, 9626, 0},
+    {0x61740000, 89, 2, 1, 9626, 0},
+    {0x61750000, 866, 2, 1, 9626, 0},
+    {0x62650000, 328, 2, 1, 9626, 0},
+    {0x62670000, 3100, 2, 1, 9626, 0},
+    {0x63610000, 25, 2, 1, 9626, 0},
+    {0x63640000, 563, 2, 1, 9626, 0},
+    {0x63680000, 36, 2, 1, 9626, 0},
+    {0x636e0000, 6219, 2, 1, 9626, 0},
+    {0x63790000, 10029, 2, 1, 9626, 0},
+    {0x637a0000, 15089, 2, 1, 9626, 0},
+    {0x64650000, 48, 2, 1, 9626, 0},
+    {0x646b0000, 10650, 2, 1, 9626, 0},
+    {0x65647500, 9778, 3, 1, 9626, 0},
+    {0x65650000, 2100, 2, 1, 9626, 0},
+    {0x65730000, 27, 2, 1, 9626, 0},
+    {0x66690000, 720, 2, 1, 9626, 0},
+    {0x66720000, 61, 2, 1, 9626, 0},
+    {0x67720000, 2757, 2, 1, 9626, 0},
+    {0x68720000, 6192, 2, 1, 9626, 0},
+    {0x68750000, 1300, 2, 1, 9626, 0},
+    {0x69650000, 43, 2, 1, 9626, 0},
+    {0x696c0000, 1036, 2, 1, 9626, 0},
+    {0x696e0000, 204, 2, 1, 9626, 0},
+    {0x696e7400, 2022, 3, 1, 9626, 0},
+    {0x69730000, 52, 2, 1, 9626, 0},
+    {0x69740000, 127, 2, 1, 9626, 0},
+    {0x6a700000, 6664, 2, 1, 9626, 0},
+    {0x6b720000, 1749, 2, 1, 9626, 0},
+    {0x6c740000, 232, 2, 1, 9626, 0},
+    {0x6c750000, 1732, 2, 1, 9626, 0},
+    {0x6c760000, 2301, 2, 1, 9626, 0},
+    {0x6d630000, 1647, 2, 1, 9626, 0},
+    {0x6d650000, 102, 2, 1, 9626, 0},
+    {0x6d6b0000, 12143, 2, 1, 9626, 0},
+    {0x6d740000, 1271, 2, 1, 9626, 0},
+    {0x6d790000, 2549, 2, 1, 9626, 0},
+    {0x6e657400, 2944, 3, 1, 9626, 0},
+    {0x6e670000, 334, 2, 1, 9626, 0},
+    {0x6e6c0000, 5838, 2, 1, 9626, 0},
+    {0x6e6f0000, 134, 2, 1, 9626, 0},
+    {0x6e7a0000, 738, 2, 1, 9626, 0},
+    {0x70617269, 40010, 5, 1, 9626, 0},
+    {0x706c0000, 2832, 2, 1, 9626, 0},
+    {0x70740000, 1961, 2, 1, 9626, 0},
+    {0x712d6100, 42330, 3, 1, 9626, 0},
+    {0x726f0000, 99, 2, 1, 9626, 0},
+    {0x72750000, 39, 2, 1, 9626, 0},
+    {0x73650000, 94, 2, 1, 9626, 0},
+    {0x73690000, 126, 2, 1, 9626, 0},
+    {0x736b0000, 869, 2, 1, 9626, 0},
+    {0x74720000, 199, 2, 1, 9626, 0},
+    {0x756b0000, 6692, 2, 1, 9626, 0},
+    {0x75730000, 767, 2, 1, 9626, 0},
+    {0x636c6f75, 2555, 5, 1, 9626, 0},
+    {0x6f730000, 10, 2, 0, 9626, 1},
+    {0x73746700, 14513, 3, 0, 9627, 1},
+    {0x73330000, 120, 2, 1, 9628, 0},
+    {0x61700000, 131, 2, 1, 9628, 0},
+    {0x67726977, 41278, 4, 1, 9628, 0},
+    {0x69630000, 24, 2, 1, 9628, 0},
+    {0x69730000, 52, 2, 1, 9628, 0},
+    {0x6b6d7073, 39360, 5, 1, 9628, 0},
+    {0x6b6f6e73, 25967, 8, 1, 9628, 0},
+    {0x6b707073, 39420, 5, 1, 9628, 0},
+    {0x6b777000, 5426, 3, 1, 9628, 0},
+    {0x6b777073, 39435, 5, 1, 9628, 0},
+    {0x6d757000, 42261, 3, 1, 9628, 0},
+    {0x6d770000, 38146, 2, 1, 9628, 0},
+    {0x6f69726d, 41642, 4, 1, 9628, 0},
+    {0x6f756d00, 3786, 3, 1, 9628, 0},
+    {0x70610000, 778, 2, 1, 9628, 0},
+    {0x70696e62, 41674, 4, 1, 9628, 0},
+    {0x70697700, 42306, 3, 1, 9628, 0},
+    {0x706f0000, 67, 2, 1, 9628, 0},
+    {0x70737000, 1405, 3, 1, 9628, 0},
+    {0x70737365, 11321, 4, 1, 9628, 0},
+    {0x70757000, 40068, 3, 1, 9628, 0},
+    {0x727a6777, 41730, 4, 1, 9628, 0},
+    {0x73610000, 506, 2, 1, 9628, 0},
+    {0x73646e00, 24494, 3, 1, 9628, 0},
+    {0x736b6f00, 869, 3, 1, 9628, 0},
+    {0x736f0000, 159, 2, 1, 9628, 0},
+    {0x73720000, 1825, 2, 1, 9628, 0},
+    {0x73746172, 22756, 9, 1, 9628, 0},
+    {0x75670000, 11531, 2, 1, 9628, 0},
+    {0x7567696d, 36320, 4, 1, 9628, 0},
+    {0x756d0000, 1125, 2, 1, 9628, 0},
+    {0x756d6967, 13691, 4, 1, 9628, 0},
+    {0x75706f77, 41910, 4, 1, 9628, 0},
+    {0x7570706f, 33396, 4, 1, 9628, 0},
+    {0x75730000, 767, 2, 1, 9628, 0},
+    {0x75770000, 7703, 2, 1, 9628, 0},
+    {0x757a7300, 22349, 3, 1, 9628, 0},
+    {0x77696600, 22041, 3, 1, 9628, 0},
+    {0x77696968, 41974, 4, 1, 9628, 0},
+    {0x77696e62, 41978, 4, 1, 9628, 0},
+    {0x77696f73, 41982, 4, 1, 9628, 0},
+    {0x77697464, 41986, 4, 1, 9628, 0},
+    {0x77697700, 42441, 3, 1, 9628, 0},
+    {0x77736100, 19478, 3, 1, 9628, 0},
+    {0x77736b72, 41990, 4, 1, 9628, 0},
+    {0x77756f7a, 41994, 4, 1, 9628, 0},
+    {0x777a6d69, 38165, 6, 1, 9628, 0},
+    {0x7a700000, 30218, 2, 1, 9628, 0},
+    {0x62636900, 41324, 3, 1, 9628, 0},
+    {0x73686f70, 6369, 4, 1, 9628, 0},
+    {0x68620000, 965, 2, 1, 9628, 0},
+    {0x76707300, 6391, 3, 1, 9628, 0},
+    {0x686f7374, 4872, 7, 2, 9628, 0},
+    {0x6c616e64, 31862, 7, 2, 9628, 0},
+    {0x73706563, 27991, 8, 2, 9628, 0},
+    {0x76707300, 6391, 3, 2, 9628, 0},
+    {0x6a656c61, 25487, 8, 1, 9628, 0},
+    {0x73657276, 27735, 7, 1, 9628, 0},
+    {0x73750000, 237, 2, 1, 9628, 0},
+    {0x62630000, 1800, 2, 1, 9628, 0},
+    {0x656e7400, 49, 3, 1, 9628, 0},
+    {0x65750000, 766, 2, 1, 9628, 0},
+    {0x75730000, 767, 2, 1, 9628, 0},
+    {0x64697265, 2806, 6, 1, 9628, 0},
+    {0x626c6f67, 23967, 8, 1, 9628, 0},
+    {0x676f7600, 810, 3, 1, 9628, 0},
+    {0x6d796d61, 26743, 8, 1, 9628, 0},
+    {0x6164696d, 38335, 5, 1, 9628, 0},
+    {0x62617273, 12676, 5, 1, 9628, 0},
+    {0x62617273, 12687, 11, 1, 9628, 0},
+    {0x626c6f67, 23967, 8, 1, 9628, 0},
+    {0x62797465, 24095, 8, 0, 9628, 2},
+    {0x6c617965, 17312, 10, 0, 9630, 1},
+    {0x6d797370, 10819, 12, 1, 9631, 0},
+    {0x6e682d73, 32422, 7, 1, 9631, 0},
+    {0x6e6f2d69, 39820, 5, 1, 9631, 0},
+    {0x72657472, 22252, 9, 0, 9631, 1},
+    {0x77656c6c, 9117, 13, 1, 9632, 0},
+    {0x61706900, 6634, 3, 1, 9632, 0},
+    {0x63616d70, 24119, 8, 1, 9632, 0},
+    {0x686f6d65, 16902, 10, 1, 9632, 0},
+    {0x73657276, 27735, 7, 1, 9632, 0},
+    {0x61666669, 4332, 15, 1, 9632, 0},
+    {0x676c7567, 41250, 4, 1, 9632, 0},
+    {0x6c756700, 20075, 3, 1, 9632, 0},
+    {0x6c756773, 41502, 4, 1, 9632, 0},
+    {0x72616666, 14293, 11, 1, 9632, 0},
+    {0x7765656b, 9104, 13, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x70687800, 42303, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 0},
+    {0x6c696200, 3713, 3, 1, 9632, 0},
+    {0x63630000, 456, 2, 1, 9632, 0},
+    {0x6b313200, 42237, 3, 1, 9632, 3},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x616e6e2d, 19525, 9, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x636f6700, 42096, 3, 1, 9635, 0},
+    {0x64737400, 14512, 3, 1, 9635, 0},
+    {0x6561746f, 38805, 5, 1, 9635, 0},
+    {0x67656e00, 324, 3, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x6d757300, 1121, 3, 1, 9635, 0},
+    {0x74656300, 9756, 3, 1, 9635, 0},
+    {0x77617368, 23233, 9, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x63630000, 456, 2, 1, 9635, 0},
+    {0x6b313200, 42237, 3, 1, 9635, 0},
+    {0x6c696200, 3713, 3, 1, 9635, 0},
+    {0x626c6f67, 23967, 8, 1, 9635, 0},
+    {0x64000000, 48, 1, 1, 9635, 0},
+    {0x626c6f67, 23967, 8, 1, 9635, 0},
+    {0x6d656c00, 10593, 3, 1, 9635, 0},
+    {0x7363686f, 33094, 7, 1, 9635, 0},
+    {0x7363616c, 18172, 5, 0, 9635, 1},
+    {0x616c7031, 40978, 4, 1, 9636, 0},
+    {0x65757200, 3497, 3, 0, 9636, 1},
+    {0x66722d70, 24799, 8, 1, 9637, 0},
+    {0x66722d70, 24807, 8, 1, 9637, 0},
+    {0x6e6c2d61, 27007, 8, 1, 9637, 0},
+    {0x666e6300, 42144, 3, 1, 9637, 1},
+    {0x6b387300, 42240, 3, 1, 9638, 1},
+    {0x73330000, 120, 2, 1, 9639, 0},
+    {0x73332d77, 120, 10, 1, 9639, 0},
+    {0x77686d00, 42438, 3, 1, 9639, 0},
+    {0x70726976, 220, 4, 1, 9639, 0},
+    {0x70756200, 4969, 3, 1, 9639, 0},
+    {0x6b387300, 42240, 3, 1, 9639, 1},
+    {0x73330000, 120, 2, 1, 9640, 0},
+    {0x73332d77, 120, 10, 1, 9640, 0},
+    {0x77686d00, 42438, 3, 1, 9640, 0},
+    {0x6b387300, 42240, 3, 1, 9640, 1},
+    {0x73330000, 120, 2, 1, 9641, 0},
+    {0x73332d77, 120, 10, 1, 9641, 0},
+    {0x636e2d6e, 16322, 10, 0, 9641, 1},
+    {0x636f6d70, 4542, 7, 2, 9642, 0},
+    {0x65620000, 124, 2, 0, 9642, 2},
+    {0x656c6200, 21614, 3, 2, 9644, 0},
+    {0x636c6f75, 34661, 6, 0, 9644, 2},
+    {0x636c6f75, 34661, 6, 0, 9646, 2},
+    {0x636c6f75, 34661, 6, 0, 9648, 2},
+    {0x6475616c, 20101, 9, 0, 9650, 1},
+    {0x636c6f75, 34661, 6, 0, 9651, 2},
+    {0x6475616c, 20101, 9, 0, 9653, 1},
+    {0x73330000, 120, 2, 1, 9654, 0},
+    {0x73332d77, 120, 10, 1, 9654, 0},
+    {0x636c6f75, 34661, 6, 0, 9654, 2},
+    {0x636c6f75, 34661, 6, 0, 9656, 2},
+    {0x6475616c, 20101, 9, 0, 9658, 1},
+    {0x73330000, 120, 2, 1, 9659, 0},
+    {0x73332d77, 120, 10, 1, 9659, 0},
+    {0x636c6f75, 34661, 6, 0, 9659, 2},
+    {0x6475616c, 20101, 9, 0, 9661, 1},
+    {0x636c6f75, 34661, 6, 0, 9662, 2},
+    {0x6475616c, 20101, 9, 0, 9664, 1},
+    {0x636c6f75, 34661, 6, 0, 9665, 2},
+    {0x6475616c, 20101, 9, 0, 9667, 1},
+    {0x73330000, 120, 2, 1, 9668, 0},
+    {0x73332d77, 120, 10, 1, 9668, 0},
+    {0x636c6f75, 34661, 6, 0, 9668, 2},
+    {0x6475616c, 20101, 9, 0, 9670, 1},
+    {0x73330000, 120, 2, 1, 9671, 0},
+    {0x73332d77, 120, 10, 1, 9671, 0},
+    {0x636c6f75, 34661, 6, 0, 9671, 2},
+    {0x636c6f75, 34661, 6, 0, 9673, 2},
+    {0x636c6f75, 34661, 6, 0, 9675, 2},
+    {0x6475616c, 20101, 9, 0, 9677, 1},
+    {0x636c6f75, 34661, 6, 0, 9678, 2},
+    {0x6475616c, 20101, 9, 0, 9680, 1},
+    {0x73330000, 120, 2, 1, 9681, 0},
+    {0x73332d77, 120, 10, 1, 9681, 0},
+    {0x636c6f75, 34661, 6, 0, 9681, 2},
+    {0x6475616c, 20101, 9, 0, 9683, 1},
+    {0x73330000, 120, 2, 1, 9684, 0},
+    {0x73332d77, 120, 10, 1, 9684, 0},
+    {0x636c6f75, 34661, 6, 0, 9684, 2},
+    {0x636c6f75, 34661, 6, 0, 9686, 2},
+    {0x6475616c, 20101, 9, 0, 9688, 1},
+    {0x636c6f75, 34661, 6, 0, 9689, 2},
+    {0x6475616c, 20101, 9, 0, 9691, 1},
+    {0x636c6f75, 34661, 6, 0, 9692, 2},
+    {0x6475616c, 20101, 9, 0, 9694, 1},
+    {0x73330000, 120, 2, 1, 9695, 0},
+    {0x73332d77, 120, 10, 1, 9695, 0},
+    {0x636c6f75, 34661, 6, 0, 9695, 2},
+    {0x636c6f75, 34661, 6, 0, 9697, 2},
+    {0x6a000000, 593, 1, 1, 9699, 0},
+    {0x666c7400, 42141, 3, 1, 9699, 0},
+    {0x75737200, 42420, 3, 1, 9699, 0},
+    {0x70616765, 2094, 5, 1, 9699, 0},
+    {0x63757374, 9979, 4, 1, 9699, 0},
+    {0x72657365, 32926, 7, 1, 9699, 0},
+    {0x63757374, 9979, 4, 1, 9699, 0},
+    {0x72657365, 32926, 7, 1, 9699, 0},
+    {0x63757374, 9979, 4, 1, 9699, 0},
+    {0x63757374, 9979, 4, 1, 9699, 0},
+    {0x72657365, 32926, 7, 1, 9699, 0},
+    {0x6a656c61, 25487, 8, 0, 9699, 1},
+    {0x75736572, 767, 4, 1, 9700, 0},
+    {0x63646e00, 7950, 3, 1, 9700, 0},
+    {0x61000000, 26, 1, 1, 9700, 0},
+    {0x676c6f62, 990, 6, 1, 9700, 0},
+    {0x61000000, 26, 1, 1, 9700, 0},
+    {0x62000000, 125, 1, 1, 9700, 0},
+    {0x676c6f62, 990, 6, 1, 9700, 0},
+    {0x66722d31, 41226, 4, 1, 9700, 0},
+    {0x6c6f6e2d, 39535, 5, 1, 9700, 0},
+    {0x6c6f6e2d, 39540, 5, 1, 9700, 0},
+    {0x6e792d31, 41610, 4, 1, 9700, 0},
+    {0x6e792d32, 41614, 4, 1, 9700, 0},
+    {0x73672d31, 41766, 4, 1, 9700, 0},
+    {0x61746c00, 7752, 3, 1, 9700, 0},
+    {0x6e6a7300, 42276, 3, 1, 9700, 0},
+    {0x72696300, 2684, 3, 1, 9700, 0},
+    {0x73736c00, 19900, 3, 1, 9700, 0},
+    {0x61707000, 1403, 3, 1, 9700, 0},
+    {0x6f730000, 10, 2, 0, 9700, 1},
+    {0x64680000, 2926, 2, 1, 9701, 0},
+    {0x766d0000, 17531, 2, 1, 9701, 0},
+    {0x6a000000, 593, 1, 1, 9701, 0},
+    {0x63757374, 9979, 4, 1, 9701, 0},
+    {0x63687472, 40152, 4, 1, 9701, 0},
+    {0x7061726f, 36911, 6, 1, 9701, 0},
+    {0x70767400, 42324, 3, 1, 9701, 0},
+    {0x75736572, 40745, 5, 1, 9701, 0},
+    {0x69743100, 14947, 3, 1, 9701, 0},
+    {0x66756e63, 6210, 9, 1, 9701, 0},
+    {0x6e6f6465, 39825, 5, 1, 9701, 0},
+    {0x6e6f6465, 39825, 5, 1, 9701, 0},
+    {0x6e6f6465, 39825, 5, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x636e2d6e, 16322, 10, 1, 9701, 0},
+    {0x636e2d6e, 6219, 14, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x73330000, 120, 2, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x76667300, 42426, 3, 1, 9701, 0},
+    {0x77656276, 7017, 14, 1, 9701, 0},
+    {0x636c6f75, 2555, 5, 1, 9701, 0},
+    {0x61707000, 1403, 3, 1, 9701, 0},
+};